@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+
+# copyright Dave French, Curlymorphic 2023, GPL3 or later
+
+# Generates src/dsp/WaveShapes/WaveShapeData.cpp from the captured wave shapes in
+# Docs/WaveShapes/Tables, one integer code per line, value = code / 5120.
+# Only the shapes named on the command line are generated, so unused captures
+# stay out of the plugin. The output is deterministic.
+#
+# usage: generatewaveshapes.py <output.cpp> <ShapeName> [<ShapeName> ...]
+
+import os
+import sys
+
+TABLE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "Docs", "WaveShapes", "Tables")
+CODE_COUNT = 4095
+VALUES_PER_LINE = 16
+
+
+def eprint(*args, **kwargs):
+    print(*args, file=sys.stderr, **kwargs)
+
+
+def read_codes(name):
+    path = os.path.join(TABLE_DIR, name + ".csv")
+    with open(path) as f:
+        codes = [int(line) for line in f if line.strip()]
+    if len(codes) != CODE_COUNT:
+        raise ValueError(f"{path} has {len(codes)} codes, expected {CODE_COUNT}")
+    if not all(-32768 <= c <= 32767 for c in codes):
+        raise ValueError(f"{path} has codes outside int16")
+    return codes
+
+
+def make_array(name, codes):
+    lines = [f"extern const int16_t {name}[codeCount] = {{"]
+    for i in range(0, len(codes), VALUES_PER_LINE):
+        lines.append("    " + ", ".join(str(c) for c in codes[i:i + VALUES_PER_LINE]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main(argv):
+    if len(argv) < 3:
+        eprint(f"usage: {argv[0]} <output.cpp> <ShapeName> [<ShapeName> ...]")
+        return 1
+
+    output = argv[1]
+    names = argv[2:]
+
+    parts = [
+        "//copyright Dave French, Curlymorphic 2023, GPL3 or later",
+        "",
+        "// GENERATED by generatewaveshapes.py from Docs/WaveShapes/Tables, do not edit",
+        "// 4096 bin waveshaper -1.2 +1.2, stored as integer capture codes, value = code / 5120",
+        "",
+        "#include <cstdint>",
+        "",
+        "namespace sspo",
+        "{",
+        "namespace AudioMath",
+        "{",
+        "namespace WaveShaper",
+        "{",
+        "namespace Codes",
+        "{",
+        f"static constexpr int codeCount = {CODE_COUNT};",
+        "",
+    ]
+    for name in names:
+        parts.append(make_array(name, read_codes(name)))
+        parts.append("")
+    parts += [
+        "} // namespace Codes",
+        "} // namespace WaveShaper",
+        "} // namespace AudioMath",
+        "} // namespace sspo",
+        "",
+    ]
+
+    if os.path.dirname(output):
+        os.makedirs(os.path.dirname(output), exist_ok=True)
+    with open(output, "w", newline="\n") as f:
+        f.write("\n".join(parts))
+    return 0
+
+
+if __name__ == "__main__":
+    try:
+        sys.exit(main(sys.argv))
+    except (OSError, ValueError) as e:
+        eprint(e)
+        sys.exit(1)
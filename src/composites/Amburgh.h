@@ -22,9 +22,13 @@
 #pragma once
 
 #include "IComposite.h"
+#include "ParamSnapshot.h"
 #include "SynthFilter.h"
 #include "AudioMath.h"
+#include "Random.h"
 #include "UtilityFilters.h"
+#include "Sanitize.h"
+#include <algorithm>
 #include <memory>
 #include <vector>
 #include <time.h>
@@ -62,10 +66,14 @@ class AmburghComp : public TBase
 public:
     AmburghComp (Module* module) : TBase (module)
     {
+        watchInputs();
+        snapshot.setDivisor (divisorRate);
     }
 
     AmburghComp() : TBase()
     {
+        watchInputs();
+        snapshot.setDivisor (divisorRate);
     }
 
     virtual ~AmburghComp()
@@ -81,6 +89,7 @@ public:
 
     void setSampleRate (float rate)
     {
+        snapshot.invalidate();
         sampleRate = rate;
         sampleTime = 1.0f / rate;
         maxFreq = std::min (rate / 2.0f, 20000.0f);
@@ -93,18 +102,12 @@ public:
         for (auto& f : filters)
         {
             f.setUseNonLinearProcessing (true);
-            f.setType (sspo::MoogLadderFilter<float_4>::types()[0]);
+            f.setType (Filter::types()[0]);
             f.setUseOversample (true);
-            float_4 asym = float_4 (1.0f);
-            f.nonLinearProcess = [asym] (float_4 in, float_4 drive)
-            {
-                return rack::simd::ifelse (in > float_4 (0),
-                                           (atan (drive * in) / atan (drive)),
-                                           (atan ((drive * in) / asym) / atan (drive / asym)));
-            }; //end of lambda
         }
-
-        sspo::AudioMath::defaultGenerator.seed (time (NULL));
+        // the lowest resonance and drive, until the snapshot reads the params
+        std::fill (resonances, resonances + SIMD_MAX_CHANNELS, float_4 (0.5f));
+        std::fill (drives, drives + SIMD_MAX_CHANNELS, float_4 (1.0f));
     }
 
     enum ParamIds
@@ -147,11 +150,27 @@ public:
     static constexpr float maxDrive = 30.0f;
     static constexpr int SIMD_MAX_CHANNELS = 4;
     static constexpr int typeCount = 6;
+    // samples between snapshot reads, the control rate of the filter coefficients
+    static constexpr auto divisorRate = 16U;
     int currentType = 1;
     float sampleRate = 1.0f;
+    sspo::Random random;
     float sampleTime = 1.0f;
-    std::vector<sspo::MoogLadderFilter<float_4>> filters;
+    using Filter = sspo::MoogLadderFilter<float_4, sspo::AtanPolicy>;
+    std::vector<Filter> filters;
+    // the control rate resonance and drive of each float_4 group
+    float_4 resonances[SIMD_MAX_CHANNELS];
+    float_4 drives[SIMD_MAX_CHANNELS];
+    // filter coefficients are only recalculated when this sees a change
+    ParamSnapshot<NUM_PARAMS, NUM_INPUTS> snapshot;
     void step() override;
+
+private:
+    void watchInputs()
+    {
+        snapshot.watchVoltages (RESONANCE_CV_INPUT);
+        snapshot.watchVoltages (DRIVE_CV_INPUT);
+    }
 };
 
 template <class TBase>
@@ -160,57 +179,69 @@ inline void AmburghComp<TBase>::step()
     auto channels = std::max (TBase::inputs[MAIN_INPUT].getChannels(),
                               TBase::inputs[VOCT_INPUT].getChannels());
     channels = std::max (channels, 1);
-    auto freqParam = TBase::params[FREQUENCY_PARAM].getValue();
-    auto resParam = TBase::params[RESONANCE_PARAM].getValue();
-    auto driveParam = TBase::params[DRIVE_PARAM].getValue();
-    auto modeParam = static_cast<int> (TBase::params[MODE_PARAM].getValue());
-    auto freqAttenuverterParam = TBase::params[FREQUENCY_CV_ATTENUVERTER_PARAM].getValue();
-    auto resAttenuverterParam = TBase::params[RESONANCE_CV_ATTENUVERTER_PARAM].getValue();
-    auto driveAttenuverterParam = TBase::params[DRIVE_CV_ATTENUVERTER_PARAM].getValue();
-
-    auto noise = float_4 (1e-6f * (2.0f * sspo::AudioMath::rand01() - 1.0f));
+    auto recalculate = snapshot.process (*this);
+    auto freqParam = snapshot.getValue (FREQUENCY_PARAM);
+    auto resParam = snapshot.getValue (RESONANCE_PARAM);
+    auto driveParam = snapshot.getValue (DRIVE_PARAM);
+    auto modeParam = static_cast<int> (snapshot.getValue (MODE_PARAM));
+    auto freqAttenuverterParam = snapshot.getValue (FREQUENCY_CV_ATTENUVERTER_PARAM);
+    auto resAttenuverterParam = snapshot.getValue (RESONANCE_CV_ATTENUVERTER_PARAM);
+    auto driveAttenuverterParam = snapshot.getValue (DRIVE_CV_ATTENUVERTER_PARAM);
+
+    auto noise = float_4 (1e-6f * random.bipolar());
     freqParam = freqParam * 10.0f - 5.0f;
 
+    // the pitch inputs may carry audio rate modulation, so while one is patched the
+    // cutoff follows it every sample, the knobs and the other CVs stay at control rate
+    const auto voctConnected = TBase::inputs[VOCT_INPUT].isConnected();
+    const auto freqCvConnected = TBase::inputs[FREQ_CV_INPUT].isConnected();
+    const auto pitchModulated = voctConnected || freqCvConnected;
+
     for (auto c = 0; c < channels; c += 4)
     {
         auto in = TBase::inputs[MAIN_INPUT].template getPolyVoltageSimd<float_4> (c);
         // Add -120dB noise to bootstrap self-oscillation
         in += noise;
 
-        auto frequency = float_4 (freqParam);
-        if (TBase::inputs[VOCT_INPUT].isConnected())
-            frequency += float_4 (TBase::inputs[VOCT_INPUT].template getPolyVoltageSimd<float_4> (c));
-        if (TBase::inputs[FREQ_CV_INPUT].isConnected())
+        if (recalculate)
         {
-            frequency += (TBase::inputs[FREQ_CV_INPUT].template getPolyVoltageSimd<float_4> (c)
-                          * freqAttenuverterParam);
-        }
-        frequency = dsp::FREQ_C4 * rack::simd::pow (2.0f, frequency);
+            auto resonance = float_4 (resParam);
+            resonance += (float_4 (TBase::inputs[RESONANCE_CV_INPUT].template getPolyVoltageSimd<float_4> (c)) / 5.0f)
+                         * resAttenuverterParam * maxRes;
+            resonances[c / 4] = rack::simd::clamp (resonance, float_4 (0.5f), float_4 (maxRes));
 
-        frequency = rack::simd::clamp (frequency, float_4 (0.0f), float_4 (maxFreq));
+            auto drive = float_4 (driveParam);
+            drive += (TBase::inputs[DRIVE_CV_INPUT].template getPolyVoltageSimd<float_4> (c) / 5.0f)
+                     * driveAttenuverterParam * maxDrive;
+            drives[c / 4] = rack::simd::clamp (drive, float_4 (1.0f), float_4 (maxDrive));
 
-        auto resonance = float_4 (resParam);
-        resonance += (float_4 (TBase::inputs[RESONANCE_CV_INPUT].template getPolyVoltageSimd<float_4> (c)) / 5.0f)
-                     * resAttenuverterParam * maxRes;
-        resonance = rack::simd::clamp (resonance, float_4 (0.5f), float_4 (maxRes));
-
-        auto drive = float_4 (driveParam);
-        drive += (TBase::inputs[DRIVE_CV_INPUT].template getPolyVoltageSimd<float_4> (c) / 5.0f)
-                 * driveAttenuverterParam * maxDrive;
-        drive = rack::simd::clamp (drive, float_4 (1.0f), float_4 (maxDrive));
+            if (currentType != modeParam)
+            {
+                currentType = modeParam;
+                filters[c / 4].setType (Filter::types()[currentType]);
+            }
+        }
 
-        if (currentType != modeParam)
+        if (recalculate || pitchModulated)
         {
-            currentType = modeParam;
-            filters[c / 4].setType (sspo::MoogLadderFilter<float_4>::types()[currentType]);
-        }
+            auto frequency = float_4 (freqParam);
+            if (voctConnected)
+                frequency += float_4 (TBase::inputs[VOCT_INPUT].template getPolyVoltageSimd<float_4> (c));
+            if (freqCvConnected)
+            {
+                frequency += (TBase::inputs[FREQ_CV_INPUT].template getPolyVoltageSimd<float_4> (c)
+                              * freqAttenuverterParam);
+            }
+            frequency = dsp::FREQ_C4 * rack::simd::pow (2.0f, frequency);
+
+            frequency = rack::simd::clamp (frequency, float_4 (0.0f), float_4 (maxFreq));
 
-        filters[c / 4].setParameters (frequency, resonance, drive, float_4 (0.5f), sampleRate);
+            filters[c / 4].setParameters (frequency, resonances[c / 4], drives[c / 4], float_4 (0.5f), sampleRate);
+        }
 
         auto out = filters[c / 4].process (in / 10.0f) * 10.0f;
 
-        //simd'ed out = std::isfinite (out) ? out : 0;
-        out = simd::ifelse ((movemask (out != out) == 0xF), float_4 (0.0f), out);
+        out = sspo::scrub (out);
 
         TBase::outputs[MAIN_OUTPUT].setVoltageSimd (out, c);
     }
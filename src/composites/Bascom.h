@@ -24,10 +24,13 @@
 #include "IComposite.h"
 #include "../dsp/SynthFilterII.h"
 #include "../dsp/AudioMath.h"
+#include "../dsp/Random.h"
 #include "../dsp/UtilityFilters.h"
 #include "../dsp/WaveShaper.h"
+#include "../dsp/Sanitize.h"
 #include <memory>
 #include <vector>
+#include <array>
 //#include <time.h>
 
 #include "jansson.h"
@@ -103,12 +106,10 @@ public:
             f.setAux (0.5f);
         }
 
-        sspo::AudioMath::defaultGenerator.seed (time (NULL));
         divider.setDivisor (1);
 
-        dcOutFilters.resize (SIMD_MAX_CHANNELS);
-        for (auto& dc : dcOutFilters)
-            dc.setButterworthHp2 (sampleRate, dcInFilterCutoff);
+        for (auto g = 0; g < SIMD_MAX_CHANNELS; ++g)
+            dcOutFilters.setButterworthHp2 (g, sampleRate, dcInFilterCutoff);
     }
 
     json_t* dataToJson()
@@ -156,6 +157,7 @@ public:
     static constexpr float maxDrive = 5.0f;
     static constexpr int SIMD_MAX_CHANNELS = 4;
     float sampleRate = 1.0f;
+    sspo::Random random;
     float sampleTime = 1.0f;
     std::vector<sspo::synthFilterII::LadderFilter<float_4>> filters;
     ClockDivider divider;
@@ -163,10 +165,10 @@ public:
     static constexpr auto semitoneVoltage = 1.0 / 12.0f;
     static constexpr int maxUpSampleRate = 12;
     static constexpr int maxUpSampleQuality = 12;
-    sspo::Upsampler<maxUpSampleRate, maxUpSampleQuality, float_4> upsampler;
-    sspo::Decimator<maxUpSampleRate, maxUpSampleQuality, float_4> decimator;
+    // one per float_4 group, as each holds the filter history of its channels
+    std::array<sspo::Resampler<maxUpSampleRate, maxUpSampleQuality, float_4>, SIMD_MAX_CHANNELS> resamplers;
     float_4 oversampleBuffer[maxUpSampleRate];
-    std::vector<sspo::BiQuad<float_4>> dcOutFilters;
+    sspo::BiquadBank<SIMD_MAX_CHANNELS * 4> dcOutFilters;
     WaveShaper::Nld nld;
 };
 
@@ -184,19 +186,13 @@ inline void BascomComp<TBase>::step()
     auto driveAttenuverterParam = TBase::params[DRIVE_CV_ATTENUVERTER_PARAM].getValue();
     auto vcaParam = TBase::params[VCA_PARAM].getValue();
 
-    auto noise = float_4 (1e-3f * (2.0f * sspo::AudioMath::rand01() - 1.0f));
+    auto noise = float_4 (1e-3f * random.bipolar());
     freqParam = freqParam * 10.0f - 5.0f;
 
     auto rightOut = 0.0f;
 
     for (auto c = 0; c < channels; c += 4)
     {
-        auto vcaGain = float_4 (vcaParam);
-        if (TBase::inputs[VCA_CV_INPUT].isConnected())
-        {
-            vcaGain = vcaGain + (TBase::inputs[VCA_CV_INPUT].template getPolyVoltageSimd<float_4> (c) * 0.1f * TBase::params[VCA_CV_ATTENUVERTER_PARAM].getValue());
-        }
-
         auto in = TBase::inputs[MAIN_INPUT].template getPolyVoltageSimd<float_4> (c);
 
         // copy right input to poly channel 1
@@ -242,10 +238,13 @@ inline void BascomComp<TBase>::step()
 
         divider.setDivisor (TBase::params[PARAM_UPDATE_DIVIDER_PARAM].getValue());
 
-        int upsampleRate = std::max (TBase::params[OVERSAMPLE_PARAM].getValue(), 1.1f);
+        resamplers[c / 4].setFilter (TBase::params[OVERSAMPLE_FILTER_PARAM].getValue());
+        resamplers[c / 4].setOverSample (std::max (TBase::params[OVERSAMPLE_PARAM].getValue(), 1.1f));
+        int upsampleRate = resamplers[c / 4].getOverSample();
 
         if (divider.process())
         {
+            // switches to the ladder compiled for these nld types when they change
             filters[c / 4].setNldTypes (TBase::params[INPUT_NLD_TYPE_PARAM].getValue(),
                                         TBase::params[RESONANCE_NLD_TYPE_PARAM].getValue(),
                                         TBase::params[STAGE_1_NLD_TYPE_PARAM].getValue(),
@@ -266,11 +265,7 @@ inline void BascomComp<TBase>::step()
                                       TBase::params[COEFF_D_PARAM].getValue(),
                                       TBase::params[COEFF_E_PARAM].getValue());
 
-            upsampler.setQuality (TBase::params[DECIMATOR_FILTERS_PARAM].getValue());
-            decimator.setQuality (TBase::params[DECIMATOR_FILTERS_PARAM].getValue());
-
-            upsampler.setOverSample (upsampleRate);
-            decimator.setOverSample (upsampleRate);
+            resamplers[c / 4].setQuality (TBase::params[DECIMATOR_FILTERS_PARAM].getValue());
 
             filters[c / 4].setFeedbackPath (TBase::params[FEEDBACK_PATH_PARAM].getValue());
         }
@@ -279,22 +274,39 @@ inline void BascomComp<TBase>::step()
 
         if (upsampleRate > 1)
         {
-            upsampler.process (in, oversampleBuffer);
+            resamplers[c / 4].upsample (in, oversampleBuffer);
+            for (auto i = 0; i < upsampleRate; ++i)
+                oversampleBuffer[i] = (drive * oversampleBuffer[i]) / 10.0f;
+            filters[c / 4].processBlock (oversampleBuffer, oversampleBuffer, upsampleRate);
             for (auto i = 0; i < upsampleRate; ++i)
-                oversampleBuffer[i] = filters[c / 4].process ((drive * oversampleBuffer[i]) / 10.0f) * 10.0f;
-            in = decimator.process (oversampleBuffer);
+                oversampleBuffer[i] *= 10.0f;
+            in = resamplers[c / 4].decimate (oversampleBuffer);
         }
         else
         {
             in = filters[c / 4].process ((drive * in) / 10.0f) * 10.0f;
         }
 
-        float_4 out = dcOutFilters[c / 4].process (in);
+        TBase::outputs[MAIN_OUTPUT].setVoltageSimd (in, c);
+    }
+
+    dcOutFilters.process (TBase::outputs[MAIN_OUTPUT].getVoltages(),
+                          TBase::outputs[MAIN_OUTPUT].getVoltages(),
+                          channels);
+
+    for (auto c = 0; c < channels; c += 4)
+    {
+        auto vcaGain = float_4 (vcaParam);
+        if (TBase::inputs[VCA_CV_INPUT].isConnected())
+        {
+            vcaGain = vcaGain + (TBase::inputs[VCA_CV_INPUT].template getPolyVoltageSimd<float_4> (c) * 0.1f * TBase::params[VCA_CV_ATTENUVERTER_PARAM].getValue());
+        }
+
+        float_4 out = TBase::outputs[MAIN_OUTPUT].template getVoltageSimd<float_4> (c);
         //out = std::isfinite (out) ? out : 0;
 
         out *= vcaGain;
-        //simd'ed out = std::isfinite (out) ? out : 0;
-        out = rack::simd::ifelse ((movemask (out == out) != 0xF), float_4 (0.0f), out);
+        out = sspo::scrub (out);
 
         TBase::outputs[MAIN_OUTPUT].setVoltageSimd (out, c);
 
@@ -374,22 +386,22 @@ IComposite::Config BascomDescription<TBase>::getParam (int i)
             ret = { -24.0f, 24.0f, 0.0f, "Fc Offset 4", " ", 0.0f, 1.0f, 0.0f };
             break;
         case BascomComp<TBase>::INPUT_NLD_TYPE_PARAM:
-            ret = { 0.0f, float (WaveShaper::nld.size()), 0.0f, "Input NLD Type", " ", 0.0f, 1.0f, 0.0f };
+            ret = { 0.0f, float (WaveShaper::nld().size()), 0.0f, "Input NLD Type", " ", 0.0f, 1.0f, 0.0f };
             break;
         case BascomComp<TBase>::RESONANCE_NLD_TYPE_PARAM:
-            ret = { -0.0f, float (WaveShaper::nld.size()), 0.0f, "Resonance NLD Type", " ", 0.0f, 1.0f, 0.0f };
+            ret = { -0.0f, float (WaveShaper::nld().size()), 0.0f, "Resonance NLD Type", " ", 0.0f, 1.0f, 0.0f };
             break;
         case BascomComp<TBase>::STAGE_1_NLD_TYPE_PARAM:
-            ret = { 0.0f, float (WaveShaper::nld.size()), 0.0f, "NLD TYPE 1", " ", 0.0f, 1.0f, 0.0f };
+            ret = { 0.0f, float (WaveShaper::nld().size()), 0.0f, "NLD TYPE 1", " ", 0.0f, 1.0f, 0.0f };
             break;
         case BascomComp<TBase>::STAGE_2_NLD_TYPE_PARAM:
-            ret = { 0.0f, float (WaveShaper::nld.size()), 0.0f, "NLD TYPE 2", " ", 0.0f, 1.0f, 0.0f };
+            ret = { 0.0f, float (WaveShaper::nld().size()), 0.0f, "NLD TYPE 2", " ", 0.0f, 1.0f, 0.0f };
             break;
         case BascomComp<TBase>::STAGE_3_NLD_TYPE_PARAM:
-            ret = { 0.0f, float (WaveShaper::nld.size()), 0.0f, "NLD TYPE 3", " ", 0.0f, 1.0f, 0.0f };
+            ret = { 0.0f, float (WaveShaper::nld().size()), 0.0f, "NLD TYPE 3", " ", 0.0f, 1.0f, 0.0f };
             break;
         case BascomComp<TBase>::STAGE_4_NLD_TYPE_PARAM:
-            ret = { 0.0f, float (WaveShaper::nld.size()), 0.0f, "NLD TYPE 4", " ", 0.0f, 1.0f, 0.0f };
+            ret = { 0.0f, float (WaveShaper::nld().size()), 0.0f, "NLD TYPE 4", " ", 0.0f, 1.0f, 0.0f };
             break;
         case BascomComp<TBase>::VCA_CV_ATTENUVERTER_PARAM:
             ret = { -1.0f, 1.0f, 0.0f, "VCA IN", " ", 0.0f, 1.0f, 0.0f };
@@ -403,6 +415,9 @@ IComposite::Config BascomDescription<TBase>::getParam (int i)
         case BascomComp<TBase>::HAS_LOADED:
             ret = { 0.0f, 1.0, 0.0f, "Has preset loaded", " ", 0.0f, 1.0f, 0.0f };
             break;
+        case BascomComp<TBase>::OVERSAMPLE_FILTER_PARAM:
+            ret = { 0.0f, sspo::NUM_OVERSAMPLE_FILTERS - 1, 0.0f, "Oversample Filter", " ", 0.0f, 1.0f, 0.0f };
+            break;
 
         default:
             assert (false);
@@ -28,6 +28,7 @@ enum ParamIds
     VCA_PARAM,
     FEEDBACK_PATH_PARAM,
     HAS_LOADED,
+    OVERSAMPLE_FILTER_PARAM,
 
     NUM_PARAMS
 };
\ No newline at end of file
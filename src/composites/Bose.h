@@ -23,6 +23,7 @@
 
 #include "IComposite.h"
 #include "../dsp/UtilityFilters.h"
+#include "../dsp/Random.h"
 #include <memory>
 #include <vector>
 #include <array>
@@ -92,8 +93,6 @@ public:
     {
         //resize arrays
         //initialise dsp object
-
-        sspo::AudioMath::defaultGenerator.seed (time (NULL));
     }
 
     void step() override;
@@ -144,6 +143,7 @@ public:
     std::array<std::array<sspo::SampleAndHold<float_4>, SIMD_MAX_CHANNELS>, 5> shs;
     std::array<float, 5> gains;
     float_4 nextRandom;
+    sspo::Random random;
 };
 
 template <class TBase>
@@ -169,11 +169,9 @@ inline void BoseComp<TBase>::step()
         {
             if (TBase::outputs[ONE_OUTPUT + i].isConnected())
             {
-                for (auto j = 0U; j < 4; ++j)
-                {
-                    if (trigger.s[j] >= 0.9f)
-                        nextRandom.s[j] = rand01();
-                }
+                auto triggered = trigger >= 0.9f;
+                if (movemask (triggered))
+                    nextRandom = simd::ifelse (triggered, random.uniform4(), nextRandom);
                 shs[i][c / 4].setUseDroop (useDroop);
                 auto out = shs[i][c / 4].step (nextRandom, trigger);
 
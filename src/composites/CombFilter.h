@@ -22,9 +22,13 @@
 #pragma once
 
 #include "IComposite.h"
+#include "ParamSnapshot.h"
 #include "CircularBuffer.h"
+#include "DelayArena.h"
+#include "FractionalDelay.h"
 #include "HardLimiter.h"
 #include "LookupTable.h"
+#include "Sanitize.h"
 //#include "resampler.hpp"
 
 namespace rack
@@ -58,10 +62,14 @@ class CombFilterComp : public TBase
 public:
     CombFilterComp (Module* module) : TBase (module)
     {
+        watchInputs();
+        snapshot.setDivisor (divisorRate);
     }
 
     CombFilterComp() : TBase()
     {
+        watchInputs();
+        snapshot.setDivisor (divisorRate);
     }
 
     virtual ~CombFilterComp()
@@ -83,6 +91,8 @@ public:
         COMB_PARAM,
         FEEDBACK_CV_ATTENUVERTER_PARAM,
         FEEDBACK_PARAM,
+        INTERPOLATION_PARAM,
+        LIMITER_LOOKAHEAD_PARAM,
         NUM_PARAMS
     };
     enum InputIds
@@ -105,21 +115,42 @@ public:
     };
 
     static constexpr float dcOutCutoff = 4.0f;
+    // the lowest comb frequency, sizes the delay lines
+    static constexpr float minFrequency = 10.0f;
     float maxFreq = 20000;
     float sampleRate = 1;
     float samplePeriod = 1;
 
-    std::vector<CircularBuffer<float>> buffers;
-    std::vector<sspo::Compressor> limiters;
-    std::vector<dsp::RCFilter> dcOutFilters;
+    static constexpr int simdChannels = PORT_MAX_CHANNELS / 4;
+    // samples between snapshot reads, the control rate of the delay times
+    static constexpr auto divisorRate = 16U;
+
+    // four channels to each delay line and filter
+    CircularBuffer<float_4> buffers[simdChannels];
+    sspo::DelayArena<float_4> arena;
+    rack::dsp::TRCFilter<float_4> dcOutFilters[simdChannels];
+    float_4 allpassStates[simdChannels] = {};
+    sspo::Compressor_4 limiters[simdChannels];
+
+    // comb and feedback are only recalculated when this sees a change, the pitch
+    // inputs may carry audio rate modulation so the delay time is worked out every sample
+    ParamSnapshot<NUM_PARAMS, NUM_INPUTS> snapshot;
+    float frequencyParam = 0.0f;
+    float frequencyAttenuverter = 0.0f;
+    float combs[PORT_MAX_CHANNELS] = {};
+    float feedbacks[PORT_MAX_CHANNELS] = {};
+    int interpolation = sspo::LINEAR_INTERPOLATION;
 
     void setSampleRate (float rate)
     {
+        snapshot.invalidate();
         sampleRate = rate;
         samplePeriod = 1.0f / sampleRate;
 
         maxFreq = std::min (20000.0f, sampleRate / 2.0f);
 
+        arena.allocate (buffers, simdChannels, sampleRate, minFrequency);
+
         for (auto& d : dcOutFilters)
             d.setCutoffFreq (dcOutCutoff / sampleRate);
 
@@ -130,68 +161,104 @@ public:
     // must be called after setSampleRate
     void init()
     {
-        buffers.resize (PORT_MAX_CHANNELS);
         for (auto& b : buffers)
-            b.reset (4096);
+            b.clear();
+        for (auto& a : allpassStates)
+            a = float_4::zero();
 
-        dcOutFilters.resize (PORT_MAX_CHANNELS);
         for (auto& d : dcOutFilters)
+        {
+            d = rack::dsp::TRCFilter<float_4>();
             d.setCutoffFreq (dcOutCutoff / sampleRate);
+        }
 
-        limiters.resize (PORT_MAX_CHANNELS);
         for (auto& l : limiters)
         {
             l.setSampleRate (sampleRate);
             l.setTimes (0.001, 0.120f);
             l.threshold = -0.3f;
             l.ratio = 10.5f;
+            l.reset();
         }
     }
 
     void step() override;
+
+private:
+    void watchInputs()
+    {
+        snapshot.watchVoltages (COMB_CV_INPUT);
+        snapshot.watchVoltages (FEEDBACK_CV_INPUT);
+    }
 };
 
 template <class TBase>
 inline void CombFilterComp<TBase>::step()
 {
     auto channels = std::max (1, TBase::inputs[MAIN_INPUT].getChannels());
-    auto freqParam = TBase::params[FREQUENCY_PARAM].getValue();
-    auto freqAttenuverterParam = TBase::params[FREQUENCY_CV_ATTENUVERTER_PARAM].getValue();
-    auto combParam = TBase::params[COMB_PARAM].getValue();
-    auto combAttenuverterParam = TBase::params[COMB_CV_ATTENUVERTER_PARAM].getValue();
-    auto feedbackParam = TBase::params[FEEDBACK_PARAM].getValue();
-    auto feedbackAttenuverterParam = TBase::params[FEEDBACK_CV_ATTENUVERTER_PARAM].getValue();
-
-    for (auto c = 0; c < channels; ++c)
+
+    if (snapshot.process (*this))
     {
-        auto in = TBase::inputs[MAIN_INPUT].getPolyVoltage (c) / 5.0f;
+        frequencyParam = snapshot.getValue (FREQUENCY_PARAM);
+        frequencyAttenuverter = snapshot.getValue (FREQUENCY_CV_ATTENUVERTER_PARAM);
+        auto combParam = snapshot.getValue (COMB_PARAM);
+        auto combAttenuverterParam = snapshot.getValue (COMB_CV_ATTENUVERTER_PARAM);
+        auto feedbackParam = snapshot.getValue (FEEDBACK_PARAM);
+        auto feedbackAttenuverterParam = snapshot.getValue (FEEDBACK_CV_ATTENUVERTER_PARAM);
+
+        // the allpass state belongs to the old reader, start the new one from silence
+        const auto interpolationParam = static_cast<int> (snapshot.getValue (INTERPOLATION_PARAM));
+        if (interpolationParam != interpolation)
+        {
+            interpolation = interpolationParam;
+            for (auto& a : allpassStates)
+                a = float_4::zero();
+        }
 
-        auto frequency = freqParam;
-        frequency += TBase::inputs[VOCT_INPUT].getPolyVoltage (c);
-        frequency += (TBase::inputs[FREQ_CV_INPUT].getPolyVoltage (c) * freqAttenuverterParam);
-        frequency = dsp::FREQ_C4 * simd::pow (2.0f, frequency);
-        frequency = clamp (frequency, 0.1f, maxFreq);
+        // the limiter is after the loop, so its latency only delays the output
+        const auto lookahead = snapshot.getValue (LIMITER_LOOKAHEAD_PARAM) > 0.5f;
+        for (auto& l : limiters)
+            l.setLookahead (lookahead);
+
+        for (auto c = 0; c < channels; ++c)
+        {
+            auto feedback = feedbackParam + feedbackAttenuverterParam * (TBase::inputs[FEEDBACK_CV_INPUT].getPolyVoltage (c) / 5.0f);
+            feedbacks[c] = clamp (feedback, -0.9f, 0.9f);
+
+            auto comb = combParam + combAttenuverterParam * (TBase::inputs[COMB_CV_INPUT].getPolyVoltage (c) / 5.0f);
+            combs[c] = clamp (comb, -1.0f, 1.0f);
+        }
+    }
 
-        auto feedback = feedbackParam + feedbackAttenuverterParam * (TBase::inputs[FEEDBACK_CV_INPUT].getPolyVoltage (c) / 5.0f);
-        feedback = clamp (feedback, -0.9f, 0.9f);
+    //loop over poly channels, using float_4. so 4 channels
+    for (auto c = 0; c < channels; c += 4)
+    {
+        const auto g = c / 4;
+        auto in = TBase::inputs[MAIN_INPUT].template getPolyVoltageSimd<float_4> (c) / 5.0f;
 
-        auto comb = combParam + combAttenuverterParam * (TBase::inputs[COMB_CV_INPUT].getPolyVoltage (c) / 5.0f);
-        comb = clamp (comb, -1.0f, 1.0f);
+        auto frequency = float_4 (frequencyParam);
+        frequency += TBase::inputs[VOCT_INPUT].template getPolyVoltageSimd<float_4> (c);
+        frequency += TBase::inputs[FREQ_CV_INPUT].template getPolyVoltageSimd<float_4> (c) * frequencyAttenuverter;
+        frequency = dsp::FREQ_C4 * simd::pow (2.0f, frequency);
+        frequency = simd::clamp (frequency, float_4 (minFrequency), float_4 (maxFreq));
+        auto index = 1.0f / frequency * sampleRate;
 
-        auto delayTime = 1.0f / frequency;
-        auto index = delayTime * sampleRate;
+        auto comb = float_4::load (combs + c);
+        auto feedback = float_4::load (feedbacks + c);
 
-        in += buffers[c].readBuffer (index) * comb * feedback;
+        auto delayed = buffers[g].read (index, interpolation, allpassStates[g]);
+        // the one check on the way into the loop, the delay line trusts it
+        in = sspo::scrub (in + delayed * comb * feedback);
 
-        auto out = in + buffers[c].readBuffer (index) * comb;
-        buffers[c].writeBuffer (in);
+        auto out = in + delayed * comb;
+        buffers[g].writeBuffer (in);
 
-        dcOutFilters[c].process (out);
-        out = dcOutFilters[c].highpass();
+        dcOutFilters[g].process (out);
+        out = dcOutFilters[g].highpass();
 
-        out = limiters[c].process (out);
+        out = limiters[g].process (out);
 
-        TBase::outputs[MAIN_OUTPUT].setVoltage (out * 5.0f, c);
+        TBase::outputs[MAIN_OUTPUT].setVoltageSimd (out * 5.0f, c);
     }
     TBase::outputs[MAIN_OUTPUT].setChannels (channels);
 }
@@ -226,6 +293,12 @@ IComposite::Config CombFilterDescription<TBase>::getParam (int i)
         case CombFilterComp<TBase>::FEEDBACK_PARAM:
             ret = { 0.0f, 1.1f, 0.f, "Feedback", " ", 0, 1, 0.0f };
             break;
+        case CombFilterComp<TBase>::INTERPOLATION_PARAM:
+            ret = { 0.0f, sspo::NUM_INTERPOLATIONS - 1, 0.0f, "Interpolation", " ", 0.0f, 1.0f, 0.0f };
+            break;
+        case CombFilterComp<TBase>::LIMITER_LOOKAHEAD_PARAM:
+            ret = { 0.0f, 1.0f, 0.0f, "Limiter Lookahead", " ", 0.0f, 1.0f, 0.0f };
+            break;
         default:
             assert (false);
     }
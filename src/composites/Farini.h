@@ -99,13 +99,12 @@ public:
         //resize arrays
         //initialise dsp object
 
-        sspo::AudioMath::defaultGenerator.seed (time (NULL));
         for (auto& d : dividers)
             d.setDivisor (divisorRate);
-        upsamplerL.setQuality (upSampleQuality);
-        decimatorL.setQuality (upSampleQuality);
-        upsamplerR.setQuality (upSampleQuality);
-        decimatorR.setQuality (upSampleQuality);
+        for (auto& r : resamplersL)
+            r.setQuality (upSampleQuality);
+        for (auto& r : resamplersR)
+            r.setQuality (upSampleQuality);
     }
 
     void step() override;
@@ -136,6 +135,7 @@ public:
         RELEASE_PARAM,
         RELEASE_CV_PARAM,
         USE_NLD_PARAM,
+        OVERSAMPLE_FILTER_PARAM,
         NUM_PARAMS
     };
     enum InputId
@@ -187,11 +187,10 @@ public:
     static constexpr int maxUpSampleQuality = 12;
     int upSampleRate = 1;
     int upSampleQuality = 1;
-    sspo::Upsampler<maxUpSampleRate, maxUpSampleQuality, float_4> upsamplerL;
-    sspo::Decimator<maxUpSampleRate, maxUpSampleQuality, float_4> decimatorL;
+    // one per float_4 group, as each holds the filter history of its channels
+    std::array<sspo::Resampler<maxUpSampleRate, maxUpSampleQuality, float_4>, SIMD_MAX_CHANNELS> resamplersL;
     float_4 oversampleBufferL[maxUpSampleRate];
-    sspo::Upsampler<maxUpSampleRate, maxUpSampleQuality, float_4> upsamplerR;
-    sspo::Decimator<maxUpSampleRate, maxUpSampleQuality, float_4> decimatorR;
+    std::array<sspo::Resampler<maxUpSampleRate, maxUpSampleQuality, float_4>, SIMD_MAX_CHANNELS> resamplersR;
     float_4 oversampleBufferR[maxUpSampleRate];
     std::array<sspo::BiQuad<float_4>, SIMD_MAX_CHANNELS> dcOutFilters;
     std::array<sspo::Adsr_4, SIMD_MAX_CHANNELS> adsrs;
@@ -212,6 +211,7 @@ inline void FariniComp<TBase>::step()
     bool resetOnTrigger = TBase::params[RESET_PARAM].getValue();
     bool cycle = TBase::params[CYCLE_PARAM].getValue();
     bool useNLD = TBase::params[USE_NLD_PARAM].getValue();
+    int oversampleFilter = TBase::params[OVERSAMPLE_FILTER_PARAM].getValue();
     float_4 attack = TBase::params[ATTACK_PARAM].getValue();
     float_4 decay = TBase::params[DECAY_PARAM].getValue();
     float_4 sustain = TBase::params[SUSTAIN_PARAM].getValue();
@@ -324,22 +324,20 @@ inline void FariniComp<TBase>::step()
         {
             if (leftChannels)
             {
-                upsamplerL.setOverSample (upSampleRate);
-                upsamplerL.process (leftOut * 0.1f, oversampleBufferL);
-                for (auto i = 0; i < upSampleRate; ++i)
-                    oversampleBufferL[i] = vca.process (oversampleBufferL[i], 0); //vca 1
-                decimatorL.setOverSample (upSampleRate);
-                leftOut = decimatorL.process (oversampleBufferL) * 10.0f;
+                resamplersL[c / 4].setFilter (oversampleFilter);
+                resamplersL[c / 4].setOverSample (upSampleRate);
+                resamplersL[c / 4].upsample (leftOut * 0.1f, oversampleBufferL);
+                vca.processBlock (oversampleBufferL, oversampleBufferL, upSampleRate, 0); //vca 1
+                leftOut = resamplersL[c / 4].decimate (oversampleBufferL) * 10.0f;
             }
 
             if (rightChannels)
             {
-                upsamplerR.setOverSample (upSampleRate);
-                upsamplerR.process (rightOut * 0.1f, oversampleBufferR);
-                for (auto i = 0; i < upSampleRate; ++i)
-                    oversampleBufferR[i] = vca.process (oversampleBufferR[i], 1); //vca 2
-                decimatorR.setOverSample (upSampleRate);
-                rightOut = decimatorR.process (oversampleBufferR) * 10.0f;
+                resamplersR[c / 4].setFilter (oversampleFilter);
+                resamplersR[c / 4].setOverSample (upSampleRate);
+                resamplersR[c / 4].upsample (rightOut * 0.1f, oversampleBufferR);
+                vca.processBlock (oversampleBufferR, oversampleBufferR, upSampleRate, 1); //vca 2
+                rightOut = resamplersR[c / 4].decimate (oversampleBufferR) * 10.0f;
             }
         }
 
@@ -436,6 +434,10 @@ IComposite::Config FariniDescription<TBase>::getParam (int i)
             ret = { 0.0f, 1.0f, 0.0f, "Waveshape", " ", 0.0f, 1.0f, 0.0f };
             break;
 
+        case FariniComp<TBase>::OVERSAMPLE_FILTER_PARAM:
+            ret = { 0.0f, sspo::NUM_OVERSAMPLE_FILTERS - 1, 0.0f, "Oversample Filter", " ", 0.0f, 1.0f, 0.0f };
+            break;
+
         default:
             assert (false);
     }
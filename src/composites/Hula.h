@@ -26,6 +26,7 @@
 #include "IComposite.h"
 #include "LookupTable.h"
 #include "AudioMath.h"
+#include "Random.h"
 #include "dsp/UtilityFilters.h"
 
 #include "simd/functions.hpp"
@@ -103,6 +104,7 @@ public:
         DEFAULT_TUNING_PARAM,
         DC_OFFSET_PARAM,
         SCALE_PARAM,
+        OVERSAMPLE_FILTER_PARAM,
         NUM_PARAMS
     };
     enum InputIds
@@ -129,14 +131,15 @@ public:
     std::array<float_4, SIMD_CHANNELS> lastOuts;
     std::array<float_4, SIMD_CHANNELS> phases;
     std::array<float_4, SIMD_CHANNELS> fineTuneVocts;
+    sspo::Random random;
 
     static constexpr int maxOversampleCount = 16;
     static constexpr int oversampleQuality = 1;
 
-    std::array<sspo::Decimator<maxOversampleCount, oversampleQuality, float_4>, SIMD_CHANNELS> decimators;
+    std::array<sspo::Resampler<maxOversampleCount, oversampleQuality, float_4>, SIMD_CHANNELS> resamplers;
     std::array<std::array<float_4, maxOversampleCount>, SIMD_CHANNELS> oversampleBuffers;
-    std::array<sspo::BiQuad<float_4>, SIMD_CHANNELS> dcOutFilters;
-    std::array<sspo::BiQuad<float_4>, SIMD_CHANNELS> lpFilters;
+    sspo::BiquadBank<SIMD_CHANNELS * 4> dcOutFilters;
+    sspo::BiquadBank<SIMD_CHANNELS * 4> lpFilters;
 
     std::array<sspo::BiQuad<float_4>, SIMD_CHANNELS> depthFilters;
     std::array<sspo::BiQuad<float_4>, SIMD_CHANNELS> feedbackFilters;
@@ -152,11 +155,11 @@ void HulaComp<TBase>::setSampleRate (float rate)
     reciprocalSampleRate = 1 / rate;
     sampleRate = rate;
 
-    for (auto& l : lpFilters)
-        l.setButterworthLp2 (rate, std::min (10e3f, rate * 0.25f));
-
-    for (auto& dc : dcOutFilters)
-        dc.setButterworthHp2 (sampleRate, dcOutCutoff);
+    for (auto g = 0; g < SIMD_CHANNELS; ++g)
+    {
+        lpFilters.setButterworthLp2 (g, rate, std::min (10e3f, rate * 0.25f));
+        dcOutFilters.setButterworthHp2 (g, sampleRate, dcOutCutoff);
+    }
 
     /// filter the changes in depth and feedback by fs/40
     for (auto& d : depthFilters)
@@ -172,19 +175,16 @@ void HulaComp<TBase>::init()
     // set random detune, += 3 cent;
     auto detuneLimit = 2.0f; //cents
     for (auto& f : fineTuneVocts)
-        f = float_4 ((rand01() * 2.0f - 1.0f) * detuneLimit / (12.0f * 100.0f),
-                     (rand01() * 2.0f - 1.0f) * detuneLimit / (12.0f * 100.0f),
-                     (rand01() * 2.0f - 1.0f) * detuneLimit / (12.0f * 100.0f),
-                     (rand01() * 2.0f - 1.0f) * detuneLimit / (12.0f * 100.0f));
+        f = random.bipolar4() * detuneLimit / (12.0f * 100.0f);
 
     for (auto& l : lastOuts)
         l = float_4 (0);
 
     for (auto& p : phases)
-        p = float_4 (rand01(), rand01(), rand01(), rand01());
+        p = random.uniform4();
 
-    for (auto& d : decimators)
-        d.setQuality (1);
+    for (auto& r : resamplers)
+        r.setQuality (1);
 
     for (auto& os : oversampleBuffers)
         for (auto& o : os)
@@ -205,10 +205,15 @@ inline void HulaComp<TBase>::step()
                              TBase::params[UNISON_PARAM].getValue(),
                              channels);
 
-    int oversampleCount = std::max (TBase::params[OVERSAMPLE_PARAM].getValue(), 1.0f);
+    int oversampleParam = std::max (TBase::params[OVERSAMPLE_PARAM].getValue(), 1.0f);
+    int oversampleFilter = TBase::params[OVERSAMPLE_FILTER_PARAM].getValue();
 
     for (auto c = 0; c < channels; c += 4)
     {
+        resamplers[c / 4].setFilter (oversampleFilter);
+        resamplers[c / 4].setOverSample (oversampleParam);
+        auto oversampleCount = resamplers[c / 4].getOverSample();
+
         //calculate frequency
         float_4 voct = TBase::inputs[VOCT_INPUT].template getPolyVoltageSimd<float_4> (c) + fineTuneVocts[c / 4];
         voct += simd::floor (TBase::params[OCTAVE_PARAM].getValue());
@@ -233,8 +238,6 @@ inline void HulaComp<TBase>::step()
 
         phaseOffset += TBase::params[DEPTH_PARAM].getValue() * fmIn;
 
-        decimators[c / 4].setOverSample (oversampleCount);
-
         float_4 processed = float_4::zero();
 
         if (oversampleCount > 1)
@@ -249,7 +252,7 @@ inline void HulaComp<TBase>::step()
                 oversampleBuffers[c / 4][i] = lookup.hulaSin4 ((phases[c / 4] + phaseOffset) * k_2pi);
             }
 
-            processed = decimators[c / 4].process (oversampleBuffers[c / 4].data());
+            processed = resamplers[c / 4].decimate (oversampleBuffers[c / 4].data());
         }
         else
         {
@@ -264,9 +267,13 @@ inline void HulaComp<TBase>::step()
         lastOuts[c / 4] = processed * 5.0f;
         processed = lastOuts[c / 4] * TBase::params[SCALE_PARAM].getValue()
                     + TBase::params[DC_OFFSET_PARAM].getValue();
-        TBase::outputs[MAIN_OUTPUT].setVoltageSimd (lpFilters[c / 4].process (processed), c);
+        TBase::outputs[MAIN_OUTPUT].setVoltageSimd (processed, c);
     }
 
+    lpFilters.process (TBase::outputs[MAIN_OUTPUT].getVoltages(),
+                       TBase::outputs[MAIN_OUTPUT].getVoltages(),
+                       channels);
+
     TBase::outputs[MAIN_OUTPUT].setChannels (channels);
 
     // sum channels if unison
@@ -319,6 +326,9 @@ IComposite::Config HulaDescription<TBase>::getParam (int i)
         case HulaComp<TBase>::SCALE_PARAM:
             ret = { -2.0f, 2.0f, 1.0f, "Scale", " ", 0, 1, 0.0f };
             break;
+        case HulaComp<TBase>::OVERSAMPLE_FILTER_PARAM:
+            ret = { 0.0f, sspo::NUM_OVERSAMPLE_FILTERS - 1, 0.0f, "Oversample Filter", " ", 0, 1, 0.0f };
+            break;
         default:
             assert (false);
     }
@@ -24,10 +24,13 @@
 #include "IComposite.h"
 #include "LookupTable.h"
 #include "CircularBuffer.h"
+#include "DelayArena.h"
+#include "FractionalDelay.h"
 #include "HardLimiter.h"
+#include "Random.h"
+#include "Sanitize.h"
 
 #include <cstdlib>
-#include <vector>
 
 namespace rack
 {
@@ -82,8 +85,8 @@ public:
         sampleRate = rate;
         maxCutoff = std::min (rate / 2.0f, 20000.0f);
 
-        for (auto& dc : dcInFilters)
-            dc.setParameters (rack::dsp::BiquadFilter::HIGHPASS, dcInFilterCutoff / rate, 0.141f, 1.0f);
+        arena.allocate (buffers, maxChannels, rate, minFrequency);
+        setFilters();
 
         for (auto& l : limiters)
             l.setSampleRate (rate);
@@ -92,70 +95,47 @@ public:
     // must be called after setSampleRate
     void init()
     {
-        buffers.resize (maxChannels);
         for (auto& b : buffers)
-            b.reset (4096);
+            b.clear();
 
-        dcInFilters.resize (maxChannels);
-        for (auto& dc : dcInFilters)
-            dc.setParameters (rack::dsp::BiquadFilter::HIGHPASS, dcInFilterCutoff / sampleRate, 0.141f, 1.0f);
-
-        dcOutFilters.resize (maxChannels);
-        for (auto& dc : dcOutFilters)
-            dc.setParameters (rack::dsp::BiquadFilter::HIGHPASS, dcOutFilterCutoff / sampleRate, 0.141f, 1.0f);
-
-        lastWets.resize (maxChannels);
-        for (auto& lw : lastWets)
-            lw = 0;
-
-        delayTimes.resize (maxChannels);
-        for (auto& d : delayTimes)
-            d = 0;
+        setFilters();
+        for (auto g = 0; g < simdChannels; ++g)
+        {
+            voices.dcInFilters[g].reset();
+            voices.dcOutFilters[g].reset();
+            voices.glide[g].reset();
+            voices.glide[g].setRiseFall (glideTime, glideTime);
+            voices.lastWets[g] = 0.0f;
+        }
+        std::fill (voices.allpassStates, voices.allpassStates + maxChannels, 0.0f);
+        controlCounter = 0;
+        controlChannels = 0;
 
-        limiters.resize (maxChannels);
+        // no lookahead, its latency would be inside the loop and flatten the pitch
         for (auto& l : limiters)
         {
             l.setTimes (0.00f, 0.0025f);
             l.setSampleRate (sampleRate);
             l.threshold = -0.50f;
+            l.reset();
         }
 
-        oscphases.resize (maxChannels);
-        for (auto& perChannel : oscphases)
-        {
-            perChannel.resize (maxOscCount);
-            for (auto& phase : perChannel)
-            {
-                phase = static_cast<float> (std::rand()) / RAND_MAX;
-            }
-        }
-
-        glide.resize (maxChannels);
-        for (auto& g : glide)
-            g.setRiseFall (0.01f, 0.01f);
-
-        lastOut.resize (maxChannels);
-        for (auto& lo : lastOut)
-            lo = 0.000f;
-
-        pitches.resize (maxChannels);
-        for (auto& p : pitches)
-            p = dsp::FREQ_C4;
-
-        unisonTunings = { 0.0f, -0.01952356f, 0.01991221f, -0.06288439f, 0.06216538f, -0.11002313f, 0.10745242f };
+        for (auto i = 0; i < maxChannels; ++i)
+            for (auto osc = 0; osc < maxOscCount; ++osc)
+                voices.phases[osc][i / 4][i % 4] = static_cast<float> (std::rand()) / RAND_MAX;
     }
 
     //supersaw curves from "How to emulate the supersaw, Adam Szabo"
     // 0.0f <= x <= 1
 
-    float unisonCentreLevel (const float x)
+    float_4 unisonCentreLevel (const float_4 x)
     {
-        return -0.55366 * x + 0.99785;
+        return -0.55366f * x + 0.99785f;
     }
 
-    float unisonSideLevel (const float x)
+    float_4 unisonSideLevel (const float_4 x)
     {
-        return -0.73764 * x * x + 1.2841 * x + 0.044372;
+        return -0.73764f * x * x + 1.2841f * x + 0.044372f;
     }
 
     // Define all the enums here. This will let the tests and the widget access them.
@@ -170,6 +150,8 @@ public:
         UNISON_MIX_PARAM,
         STRETCH_PARAM,
         STRETCH_LOCK_PARAM,
+        INTERPOLATION_PARAM,
+        PARAM_UPDATE_DIVIDER_PARAM,
         NUM_PARAMS
     };
 
@@ -205,35 +187,76 @@ public:
     float maxCutoff = 20000.0f;
 
     constexpr static int maxChannels = 16;
+    constexpr static int simdChannels = maxChannels / 4;
     constexpr static float dcInFilterCutoff = 5.5f;
     constexpr static float dcOutFilterCutoff = 10.0f;
+    constexpr static float glideTime = 0.05f;
+    constexpr static float minFrequency = 20.0f;
     constexpr static int maxOscCount = 7;
+    constexpr static int maxDivider = 128;
 
     //Oscillator detunings for unisson from "How to emulate the super saw, Adam Szabo"
     //
-    std::vector<float> unisonTunings;
-    std::vector<float> unisonLevels;
-    std::vector<CircularBuffer<float>> buffers;
-    std::vector<rack::dsp::BiquadFilter> dcInFilters;
-    std::vector<rack::dsp::BiquadFilter> dcOutFilters;
-    std::vector<sspo::Compressor> limiters;
-    std::vector<float> lastWets;
-    std::vector<float> delayTimes;
-    std::vector<std::vector<float>> oscphases;
-    std::vector<dsp::SlewLimiter> glide;
-    std::vector<int> framesToSample;
-    std::vector<float> lastOut;
-    std::vector<float> pitches;
+    const float unisonTunings[maxOscCount] = { 0.0f, -0.01952356f, 0.01991221f, -0.06288439f, 0.06216538f, -0.11002313f, 0.10745242f };
+
+    /// the per channel state of the audio loop, four channels to a float_4, one block
+    struct Voices
+    {
+        float_4 phases[maxOscCount][simdChannels];
+        float_4 lastWets[simdChannels];
+        float allpassStates[maxChannels];
+        rack::dsp::TSlewLimiter<float_4> glide[simdChannels];
+        rack::dsp::TBiquadFilter<float_4> dcInFilters[simdChannels];
+        rack::dsp::TBiquadFilter<float_4> dcOutFilters[simdChannels];
+    };
+
+    /// worked out every divider samples, the delay index ramps to its target in between
+    struct Controls
+    {
+        float_4 index[simdChannels];
+        float_4 indexStep[simdChannels];
+        float_4 indexTarget[simdChannels];
+        float_4 feedback[simdChannels];
+        float_4 stretch[simdChannels];
+        float_4 stretchThreshold[simdChannels];
+        float_4 phaseIncrement[simdChannels];
+        float_4 centreLevel[simdChannels];
+        float_4 sideLevel[simdChannels];
+        float_4 unison[simdChannels];
+        int maxUnison[simdChannels];
+    };
+
+    Voices voices;
+    Controls controls;
+    CircularBuffer<float> buffers[maxChannels];
+    sspo::DelayArena<float> arena;
+    sspo::Compressor_4 limiters[simdChannels];
 
 private:
+    void updateControls (const int channels);
+
+    void setFilters()
+    {
+        for (auto& dc : voices.dcInFilters)
+            dc.setParameters (rack::dsp::TBiquadFilter<float_4>::HIGHPASS, dcInFilterCutoff / sampleRate, 0.141f, 1.0f);
+        for (auto& dc : voices.dcOutFilters)
+            dc.setParameters (rack::dsp::TBiquadFilter<float_4>::HIGHPASS, dcOutFilterCutoff / sampleRate, 0.141f, 1.0f);
+    }
+
     float reciprocalSampleRate = 1.0f;
     float sampleRate = 1.0f;
+    int interpolation = sspo::LINEAR_INTERPOLATION;
+    float minIndex = 0.0f;
+    float minTapOffset = 0.0f;
+    int controlDivider = 1;
+    int controlCounter = 0;
+    int controlChannels = 0;
+    sspo::Random random;
 };
 
 template <class TBase>
-inline void KSDelayComp<TBase>::step()
+inline void KSDelayComp<TBase>::updateControls (const int channels)
 {
-    auto channels = std::max (TBase::inputs[IN_INPUT].getChannels(), TBase::inputs[VOCT].getChannels());
     auto octaveParam = TBase::params[OCTAVE_PARAM].getValue();
     auto tuneParam = TBase::params[TUNE_PARAM].getValue();
     auto feedbackParam = TBase::params[FEEDBACK_PARAM].getValue();
@@ -241,82 +264,164 @@ inline void KSDelayComp<TBase>::step()
     auto unisonSpread = TBase::params[UNISON_SPREAD_PARAM].getValue();
     auto unisonMix = TBase::params[UNISON_MIX_PARAM].getValue();
     auto stretchParam = TBase::params[STRETCH_PARAM].getValue();
+    auto stretchConnected = TBase::inputs[STRETCH_INPUT].isConnected();
 
-    auto glideParam = 0.05f;
+    controlDivider = clamp (static_cast<int> (TBase::params[PARAM_UPDATE_DIVIDER_PARAM].getValue()), 1, maxDivider);
+    controlChannels = channels;
 
-    channels = std::max (channels, 1);
+    // the allpass state belongs to the old reader, start the new one from silence
+    const auto interpolationParam = static_cast<int> (TBase::params[INTERPOLATION_PARAM].getValue());
+    if (interpolationParam != interpolation)
+    {
+        interpolation = interpolationParam;
+        std::fill (voices.allpassStates, voices.allpassStates + maxChannels, 0.0f);
+    }
+    // Lagrange reads one sample newer than its delay, so it needs a delay of 1 or more
+    minIndex = interpolation == sspo::LAGRANGE_INTERPOLATION ? 1.0f : 0.0f;
+    minTapOffset = interpolation == sspo::LINEAR_INTERPOLATION ? 0.0f : 1.0f;
 
-    for (auto i = 0; i < channels; ++i)
+    for (auto c = 0; c < channels; c += 4)
     {
-        auto unisonSpreadCoefficient = lookup.unisonSpread (unisonSpread + std::abs (TBase::inputs[UNISON_SPREAD_INPUT].getPolyVoltage (i) / 10.0f));
-        auto unisonSideLevelCoefficient = unisonSideLevel (unisonMix + std::abs (TBase::inputs[UNISON_MIX_INPUT].getPolyVoltage (i) / 10.0f));
-        auto unisonCentreLevelCoefficient = unisonCentreLevel (unisonMix + std::abs (TBase::inputs[UNISON_MIX_INPUT].getPolyVoltage (i) / 10.0f));
+        const auto g = c / 4;
+        const auto lanes = std::min (4, channels - c);
+
+        auto mixIn = unisonMix + simd::abs (TBase::inputs[UNISON_MIX_INPUT].template getPolyVoltageSimd<float_4> (c) / 10.0f);
+        // the lookups are clamped to their tables, a float_4 read past the end is not safe
+        auto spreadIn = unisonSpread + simd::abs (TBase::inputs[UNISON_SPREAD_INPUT].template getPolyVoltageSimd<float_4> (c) / 10.0f);
+        auto unisonSpreadCoefficient = lookup.unisonSpread (simd::clamp (spreadIn, float_4::zero(), float_4 (1.0f)));
+        controls.sideLevel[g] = unisonSideLevel (mixIn);
+        controls.centreLevel[g] = unisonCount == 1 ? float_4 (1.0f) : unisonCentreLevel (mixIn);
+
+        auto feedback = feedbackParam + TBase::inputs[FEEDBACK_INPUT].template getPolyVoltageSimd<float_4> (c) / 10.0f;
+        controls.feedback[g] = simd::clamp (feedback, float_4::zero(), float_4 (0.5f));
+
+        // the slew is per unit of time, so each update covers the whole divider
+        auto pitch = TBase::inputs[VOCT].template getPolyVoltageSimd<float_4> (c) + octaveParam + tuneParam / 12.0f;
+        pitch = simd::clamp (pitch, float_4 (-10.0f), float_4 (10.0f));
+        auto glideFreq = voices.glide[g].process (10.0f * controlDivider, dsp::FREQ_C4 * lookup.pow2 (pitch));
+        glideFreq = simd::clamp (glideFreq, float_4 (minFrequency), float_4 (maxCutoff));
+
+        // ramp from where the last ramp ended, or jump there on the first update
+        auto target = 1.0f / glideFreq * sampleRate - 1.5f;
+        auto& index = controls.index[g];
+        index = simd::ifelse (index > 0.0f, index, target);
+        controls.indexTarget[g] = target;
+        controls.indexStep[g] = (target - index) / static_cast<float> (controlDivider);
+        controls.phaseIncrement[g] = unisonSpreadCoefficient / target;
+
+        auto stretch = float_4 (stretchParam);
+        if (stretchConnected)
+            stretch += TBase::inputs[STRETCH_INPUT].template getPolyVoltageSimd<float_4> (c) / 10.0f;
+        stretch = stretch * 0.0003f * glideFreq * glideFreq;
+        controls.stretch[g] = stretch;
+        controls.stretchThreshold[g] = 1.0f - 1.0f / stretch;
+
+        // each lane has its own unison count, the extra oscillators are masked
+        auto unisonIn = TBase::inputs[UNISON_INPUT].template getPolyVoltageSimd<float_4> (c);
+        controls.unison[g] = float_4::zero();
+        controls.maxUnison[g] = 0;
+        for (auto l = 0; l < lanes; ++l)
+        {
+            auto u = std::min (std::abs (static_cast<int> (unisonCount + unisonIn[l])), static_cast<int> (maxOscCount));
+            controls.unison[g][l] = static_cast<float> (u);
+            controls.maxUnison[g] = std::max (controls.maxUnison[g], u);
+        }
+    }
+}
 
-        auto in = TBase::inputs[IN_INPUT].getPolyVoltage (i);
+template <class TBase>
+inline void KSDelayComp<TBase>::step()
+{
+    auto channels = std::max (TBase::inputs[IN_INPUT].getChannels(), TBase::inputs[VOCT].getChannels());
+    channels = std::max (channels, 1);
 
-        in = dcInFilters[i].process (in);
-        auto feedback = feedbackParam + TBase::inputs[FEEDBACK_INPUT].getPolyVoltage (i) / 10.0f;
-        feedback = clamp (feedback, 0.0f, 0.5f);
+    // new channels have no controls yet, so a change of count updates at once and
+    // the added groups jump to their pitch rather than ramping from a stale one
+    if (controlCounter == 0 || channels != controlChannels)
+    {
+        for (auto g = (controlChannels + 3) / 4; g < (channels + 3) / 4; ++g)
+            controls.index[g] = 0.0f;
+        updateControls (channels);
+        controlCounter = controlDivider;
+    }
+    --controlCounter;
+    const auto rampEnd = controlCounter == 0;
 
-        auto glideTime = glideParam;
+    //loop over poly channels, using float_4. so 4 channels
+    //the delay lines and limiters are per channel, so only the used lanes touch them
+    for (auto c = 0; c < channels; c += 4)
+    {
+        const auto g = c / 4;
+        const auto lanes = std::min (4, channels - c);
 
-        glide[i].setRiseFall (glideTime, glideTime);
-        auto glideFreq = glide[i].process (10.0f, dsp::FREQ_C4 * lookup.pow2 (TBase::inputs[VOCT].getPolyVoltage (i) + octaveParam + tuneParam / 12.0f));
-        glideFreq = clamp (glideFreq, 20.0f, maxCutoff);
-        delayTimes[i] = 1.0f / glideFreq;
+        auto in = voices.dcInFilters[g].process (TBase::inputs[IN_INPUT].template getPolyVoltageSimd<float_4> (c));
 
-        auto index = delayTimes[i] * sampleRate - 1.5f;
+        // the last sample of a ramp lands on the target exactly, so the error can not build up
+        auto index = rampEnd ? controls.indexTarget[g] : controls.index[g] + controls.indexStep[g];
+        controls.index[g] = index;
+        auto loopIndex = simd::fmax (index, float_4 (minIndex));
 
         // update buffer
-        auto wet = buffers[i].readBuffer (index);
-
-        auto stretch = stretchParam;
-        if (TBase::inputs[STRETCH_INPUT].isConnected())
+        float_4 wet = float_4::zero();
+        for (auto l = 0; l < lanes; ++l)
+            wet[l] = buffers[c + l].read (loopIndex[l], interpolation, voices.allpassStates[c + l]);
+
+        // 1 - 1 / stretch is above any draw for a negative stretch and below every draw
+        // between 0 and 1, so the random draw is only needed for a stretch above 1
+        const auto& stretch = controls.stretch[g];
+        auto useStretch = stretch < 0.0f;
+        auto drawStretch = stretch > 1.0f;
+        if (simd::movemask (drawStretch))
+            useStretch = useStretch | (drawStretch & (controls.stretchThreshold[g] > random.uniform4()));
+
+        // the one check on the way into the loop, the limiter and delay line trust it
+        auto dry = sspo::scrub (simd::ifelse (useStretch,
+                                              in + wet,
+                                              in + voices.lastWets[g] * controls.feedback[g] + 0.5f * wet));
+        const auto limited = 5.0f * limiters[g].process (dry / 5.0f);
+        for (auto l = 0; l < lanes; ++l)
+            buffers[c + l].writeBuffer (limited[l]);
+        voices.lastWets[g] = wet;
+
+        // all the tap positions first, then one batch of reads per lane, then the mix
+        const auto& unison = controls.unison[g];
+        const auto maxUnison = controls.maxUnison[g];
+        float_4 offsets[maxOscCount];
+        float_4 taps[maxOscCount];
+        for (auto osc = 0; osc < maxUnison; ++osc)
         {
-            stretch += TBase::inputs[STRETCH_INPUT].getPolyVoltage (i) / 10.0;
+            auto phase = voices.phases[osc][g] + unisonTunings[osc] * controls.phaseIncrement[g];
+            phase = simd::ifelse (phase >= 1.0f, phase - 1.0f, phase);
+            phase = simd::ifelse (phase < 0.0f, phase + 1.0f, phase);
+            phase = simd::ifelse (float_4 (static_cast<float> (osc)) < unison, phase, voices.phases[osc][g]);
+            voices.phases[osc][g] = phase;
+
+            offsets[osc] = simd::fmax (index - phase * index, float_4 (minTapOffset));
+            taps[osc] = float_4::zero();
         }
-        stretch = stretch * 0.0003f * glideFreq * glideFreq;
 
-        auto nonStretchProbabilty = 1.0f / stretch;
-        auto useStretch = (1.0f - nonStretchProbabilty) > sspo::AudioMath::rand01();
-
-        auto dry = useStretch
-                       ? in + wet
-                       : in + lastWets[i] * feedback + 0.5f * wet;
-        dry = 5.0f * limiters[i].process (dry / 5.0f);
-        buffers[i].writeBuffer (dry);
-        lastWets[i] = wet;
-
-        // calc phases
-        auto mixedOsc = 0.0f;
-        auto unison = std::abs (std::min (static_cast<int> (unisonCount + TBase::inputs[UNISON_INPUT].getPolyVoltage (i)), 7));
-        if (unisonCount == 1)
-            unisonCentreLevelCoefficient = 1.0f;
-        for (int osc = 0; osc < unison; ++osc)
+        for (auto l = 0; l < lanes; ++l)
         {
-            oscphases[i][osc] += (unisonTunings[osc] * unisonSpreadCoefficient) / index;
-            if (oscphases[i][osc] >= 1.0f)
-                oscphases[i][osc] -= 1.0f;
-            if (oscphases[i][osc] < 0.0f)
-                oscphases[i][osc] += 1.0f;
-
-            auto phaseoffset = index - oscphases[i][osc] * index;
-            if (osc == 0)
-                mixedOsc += buffers[i].readBuffer (phaseoffset) * unisonCentreLevelCoefficient;
-            else
-                mixedOsc += buffers[i].readBuffer (phaseoffset) * unisonSideLevelCoefficient;
+            float laneOffsets[maxOscCount];
+            float laneTaps[maxOscCount];
+            for (auto osc = 0; osc < maxUnison; ++osc)
+                laneOffsets[osc] = offsets[osc][l];
+            buffers[c + l].readTaps (laneOffsets, laneTaps, maxUnison, interpolation);
+            for (auto osc = 0; osc < maxUnison; ++osc)
+                taps[osc][l] = laneTaps[osc];
         }
-        wet = mixedOsc;
 
-        auto mix = 1.0f;
-        mix = clamp (mix, 0.0f, 1.0f);
-        float out = crossfade (in, wet, mix);
+        float_4 mixedOsc = float_4::zero();
+        for (auto osc = 0; osc < maxUnison; ++osc)
+        {
+            auto level = osc == 0 ? controls.centreLevel[g] : controls.sideLevel[g];
+            mixedOsc += simd::ifelse (float_4 (static_cast<float> (osc)) < unison, taps[osc] * level, float_4::zero());
+        }
 
-        out = dcOutFilters[i].process (out);
+        auto out = voices.dcOutFilters[g].process (mixedOsc);
         out = sspo::voltageSaturate (out);
-        lastOut[i] = out;
 
-        TBase::outputs[OUT_OUTPUT].setVoltage (out, i);
+        TBase::outputs[OUT_OUTPUT].setVoltageSimd (out, c);
     }
     TBase::outputs[OUT_OUTPUT].setChannels (channels);
 }
@@ -357,6 +462,12 @@ IComposite::Config KSDelayDescription<TBase>::getParam (int i)
         case KSDelayComp<TBase>::STRETCH_LOCK_PARAM:
             ret = { 0.0f, 1.0f, 1.0f, "Stretch Lock", " ", 0, 1, 0.0f };
             break;
+        case KSDelayComp<TBase>::INTERPOLATION_PARAM:
+            ret = { 0.0f, sspo::NUM_INTERPOLATIONS - 1, 0.0f, "Interpolation", " ", 0, 1, 0.0f };
+            break;
+        case KSDelayComp<TBase>::PARAM_UPDATE_DIVIDER_PARAM:
+            ret = { 1.0f, KSDelayComp<TBase>::maxDivider, 1.0f, "Update Divider", " ", 0.0f, 1.0f, 0.0f };
+            break;
         default:
             assert (false);
     }
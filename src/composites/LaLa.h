@@ -22,8 +22,10 @@
 #pragma once
 
 #include "IComposite.h"
+#include "ParamSnapshot.h"
 #include "UtilityFilters.h"
 #include "HardLimiter.h"
+#include "Sanitize.h"
 
 #include "simd/functions.hpp"
 #include "simd/sse_mathfun.h"
@@ -65,10 +67,14 @@ class LaLaComp : public TBase
 public:
     LaLaComp (Module* module) : TBase (module)
     {
+        snapshot.watchVoltages (FREQ_CV_INPUT);
+        snapshot.setDivisor (divisorRate);
     }
 
     LaLaComp() : TBase()
     {
+        snapshot.watchVoltages (FREQ_CV_INPUT);
+        snapshot.setDivisor (divisorRate);
     }
 
     virtual ~LaLaComp()
@@ -107,6 +113,8 @@ public:
 
     // member variables
     static constexpr int maxChannels = 16;
+    // samples between snapshot reads, the control rate of the crossover coefficients
+    static constexpr auto divisorRate = 16U;
     static constexpr float dcBlockerFc = 5.5f;
     const float_4 dc_4{ dcBlockerFc, dcBlockerFc, dcBlockerFc, dcBlockerFc };
     float sampleRate = 1.0f;
@@ -114,12 +122,14 @@ public:
     float_4 sr_4{ sampleRate, sampleRate, sampleRate, sampleRate };
     float_4 maxFreq = { 0.5f, 0.5f, 0.5f, 0.5f };
     float_4 minFreq = { 10, 10, 10, 10 };
-    // filters and dc blocker filter for each band
-    std::vector<sspo::LinkwitzRileyLP4<float_4>> lpFilters;
-    std::vector<sspo::LinkwitzRileyHP4<float_4>> hpFilters;
+    // Linkwitz Riley 4th order, both bands from one set of coefficients and memories
+    sspo::Crossover<float_4> crossovers[maxChannels / 4];
+    // crossover coefficients are only recalculated when this sees a change
+    ParamSnapshot<NUM_PARAMS, NUM_INPUTS> snapshot;
 
     void setSampleRate (float rate)
     {
+        snapshot.invalidate();
         sampleRate = rate;
         sampleTime = 1.0f / rate;
         sr_4 = { sampleRate, sampleRate, sampleRate, sampleRate };
@@ -129,8 +139,8 @@ public:
     // must be called after setSampleRate
     void init()
     {
-        hpFilters.resize (maxChannels / 4);
-        lpFilters.resize (maxChannels / 4);
+        for (auto& crossover : crossovers)
+            crossover.clear();
     }
 
     inline void step() override;
@@ -140,26 +150,34 @@ template <class TBase>
 inline void LaLaComp<TBase>::step()
 {
     auto channels = TBase::inputs[MAIN_INPUT].getChannels();
-    auto freqParam = TBase::params[FREQ_PARAM].getValue();
-    freqParam = freqParam * 10.0f - 5.0f;
+
+    if (snapshot.process (*this))
+    {
+        auto freqParam = snapshot.getValue (FREQ_PARAM);
+        freqParam = freqParam * 10.0f - 5.0f;
+
+        for (auto c = 0; c < channels; c += 4)
+        {
+            auto fcv = TBase::inputs[FREQ_CV_INPUT].template getPolyVoltageSimd<float_4> (c);
+            fcv *= snapshot.getValue (FREQ_CV_PARAM);
+            fcv += freqParam;
+            float_4 freq = dsp::FREQ_C4 * simd::pow (2.0f, fcv);
+            freq = simd::clamp (freq, minFreq, maxFreq);
+            crossovers[c / 4].setParameters (sr_4, freq);
+        }
+    }
 
     for (auto c = 0; c < channels; c += 4)
     {
-        auto fcv = TBase::inputs[FREQ_CV_INPUT].template getPolyVoltageSimd<float_4> (c);
-        fcv *= TBase::params[FREQ_CV_PARAM].getValue();
-        fcv += freqParam;
-        float_4 freq = dsp::FREQ_C4 * simd::pow (2.0f, fcv);
-        freq = simd::clamp (freq, minFreq, maxFreq);
-        lpFilters[c / 4].setParameters (sr_4, freq);
-        hpFilters[c / 4].setParameters (sr_4, freq);
-        float_4 in = TBase::inputs[MAIN_INPUT].template getPolyVoltageSimd<float_4> (c);
-        auto lowOut = lpFilters[c / 4].process (in);
+        float_4 lowOut;
+        float_4 highOut;
+        crossovers[c / 4].process (TBase::inputs[MAIN_INPUT].template getVoltageSimd<float_4> (c), lowOut, highOut);
+
         lowOut = sspo::voltageSaturate (lowOut);
-        auto highOut = hpFilters[c / 4].process (in);
         highOut = sspo::voltageSaturate (highOut);
 
-        lowOut = rack::simd::ifelse ((movemask (lowOut == lowOut) != 0xF), float_4 (0.0f), lowOut);
-        highOut = rack::simd::ifelse ((movemask (highOut == highOut) != 0xF), float_4 (0.0f), highOut);
+        lowOut = sspo::scrub (lowOut);
+        highOut = sspo::scrub (highOut);
 
         lowOut.store (TBase::outputs[LOW_OUTPUT].getVoltages (c));
         highOut.store (TBase::outputs[HIGH_OUTPUT].getVoltages (c));
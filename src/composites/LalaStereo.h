@@ -22,8 +22,10 @@
 #pragma once
 
 #include "IComposite.h"
+#include "ParamSnapshot.h"
 #include "../dsp/UtilityFilters.h"
 #include "HardLimiter.h"
+#include "../dsp/Sanitize.h"
 #include <memory>
 #include <vector>
 #include <array>
@@ -67,10 +69,14 @@ class LalaStereoComp : public TBase
 public:
     LalaStereoComp (Module* module) : TBase (module)
     {
+        snapshot.watchVoltages (FREQ_CV_INPUT);
+        snapshot.setDivisor (divisorRate);
     }
 
     LalaStereoComp() : TBase()
     {
+        snapshot.watchVoltages (FREQ_CV_INPUT);
+        snapshot.setDivisor (divisorRate);
     }
 
     virtual ~LalaStereoComp()
@@ -86,6 +92,7 @@ public:
 
     void setSampleRate (float rate)
     {
+        snapshot.invalidate();
         sampleRate = rate;
         sampleTime = 1.0f / rate;
         sr_4 = { sampleRate, sampleRate, sampleRate, sampleRate };
@@ -98,8 +105,6 @@ public:
     {
         //resize arrays
         //initialise dsp object
-
-        sspo::AudioMath::defaultGenerator.seed (time (NULL));
     }
 
     void step() override;
@@ -141,7 +146,8 @@ public:
         NUM_LIGHTS
     };
 
-    static constexpr auto divisorRate = 4U;
+    // samples between snapshot reads, the control rate of the crossover coefficients
+    static constexpr auto divisorRate = 16U;
     constexpr static float dcInFilterCutoff = 5.5f;
     static constexpr float minFreq = 0.0f;
     float_4 maxFreq{ 20000.0f };
@@ -149,10 +155,18 @@ public:
     float sampleRate = 1.0f;
     float sampleTime = 1.0f;
     float_4 sr_4{ sampleRate, sampleRate, sampleRate, sampleRate };
-    std::array<sspo::LinkwitzRileyLP4<float_4>, SIMD_MAX_CHANNELS> lpFiltersL;
-    std::array<sspo::LinkwitzRileyHP4<float_4>, SIMD_MAX_CHANNELS> hpFiltersL;
-    std::array<sspo::LinkwitzRileyLP4<float_4>, SIMD_MAX_CHANNELS> lpFiltersR;
-    std::array<sspo::LinkwitzRileyHP4<float_4>, SIMD_MAX_CHANNELS> hpFiltersR;
+    // Linkwitz Riley 4th order, both bands from one set of coefficients and memories
+    sspo::Crossover<float_4> crossoversL[SIMD_MAX_CHANNELS];
+    sspo::Crossover<float_4> crossoversR[SIMD_MAX_CHANNELS];
+    // crossover coefficients are only recalculated when this sees a change
+    ParamSnapshot<NUM_PARAMS, NUM_INPUTS> snapshot;
+
+    void processSide (const int channels,
+                      const bool recalculate,
+                      const InputId input,
+                      const OutputId lowOutput,
+                      const OutputId highOutput,
+                      sspo::Crossover<float_4>* crossovers);
 };
 
 template <class TBase>
@@ -160,60 +174,58 @@ inline void LalaStereoComp<TBase>::step()
 {
     auto channelsL = TBase::inputs[LEFT_INPUT].getChannels();
     auto channelsR = TBase::inputs[RIGHT_INPUT].getChannels();
-    auto freqParam = TBase::params[FREQ_PARAM].getValue();
-    freqParam = freqParam * 10.0f - 5.0f;
-
-    for (auto c = 0; c < channelsL; c += 4)
-    {
-        auto fcv = TBase::inputs[FREQ_CV_INPUT].template getPolyVoltageSimd<float_4> (c);
-        fcv *= TBase::params[FREQ_CV_PARAM].getValue();
-        fcv += freqParam;
-        float_4 freq = dsp::FREQ_C4 * simd::pow (2.0f, fcv);
-        freq = simd::clamp (freq, minFreq, maxFreq);
-        lpFiltersL[c / 4].setParameters (sr_4, freq);
-        hpFiltersL[c / 4].setParameters (sr_4, freq);
-        float_4 in = TBase::inputs[LEFT_INPUT].template getPolyVoltageSimd<float_4> (c);
-        auto lowOut = lpFiltersL[c / 4].process (in);
-        lowOut = sspo::voltageSaturate (lowOut);
-        auto highOut = hpFiltersL[c / 4].process (in);
 
-        highOut = sspo::voltageSaturate (highOut);
+    auto recalculate = snapshot.process (*this);
 
-        //simd'ed out = std::isfinite (out) ? out : 0;
-        lowOut = rack::simd::ifelse ((movemask (lowOut == lowOut) != 0xF), float_4 (0.0f), lowOut);
-        highOut = rack::simd::ifelse ((movemask (highOut == highOut) != 0xF), float_4 (0.0f), highOut);
+    processSide (channelsL, recalculate, LEFT_INPUT, LEFT_LOW_OUTPUT, LEFT_HIGH_OUTPUT, crossoversL);
+    processSide (channelsR, recalculate, RIGHT_INPUT, RIGHT_LOW_OUTPUT, RIGHT_HIGH_OUTPUT, crossoversR);
+
+    TBase::outputs[LEFT_LOW_OUTPUT].setChannels (channelsL);
+    TBase::outputs[LEFT_HIGH_OUTPUT].setChannels (channelsL);
 
-        lowOut.store (TBase::outputs[LEFT_LOW_OUTPUT].getVoltages (c));
-        highOut.store (TBase::outputs[LEFT_HIGH_OUTPUT].getVoltages (c));
+    TBase::outputs[RIGHT_LOW_OUTPUT].setChannels (channelsR);
+    TBase::outputs[RIGHT_HIGH_OUTPUT].setChannels (channelsR);
+}
+
+template <class TBase>
+inline void LalaStereoComp<TBase>::processSide (const int channels,
+                                                const bool recalculate,
+                                                const InputId input,
+                                                const OutputId lowOutput,
+                                                const OutputId highOutput,
+                                                sspo::Crossover<float_4>* crossovers)
+{
+    if (recalculate)
+    {
+        auto freqParam = snapshot.getValue (FREQ_PARAM);
+        freqParam = freqParam * 10.0f - 5.0f;
+
+        for (auto c = 0; c < channels; c += 4)
+        {
+            auto fcv = TBase::inputs[FREQ_CV_INPUT].template getPolyVoltageSimd<float_4> (c);
+            fcv *= snapshot.getValue (FREQ_CV_PARAM);
+            fcv += freqParam;
+            float_4 freq = dsp::FREQ_C4 * simd::pow (2.0f, fcv);
+            freq = simd::clamp (freq, minFreq, maxFreq);
+            crossovers[c / 4].setParameters (sr_4, freq);
+        }
     }
 
-    for (auto c = 0; c < channelsR; c += 4)
-    {
-        auto fcv = TBase::inputs[FREQ_CV_INPUT].template getPolyVoltageSimd<float_4> (c);
-        fcv *= TBase::params[FREQ_CV_PARAM].getValue();
-        fcv += freqParam;
-        float_4 freq = dsp::FREQ_C4 * simd::pow (2.0f, fcv);
-        freq = simd::clamp (freq, minFreq, maxFreq);
-        lpFiltersR[c / 4].setParameters (sr_4, freq);
-        hpFiltersR[c / 4].setParameters (sr_4, freq);
-        float_4 in = TBase::inputs[RIGHT_INPUT].template getPolyVoltageSimd<float_4> (c);
-        auto lowOut = lpFiltersR[c / 4].process (in);
+    for (auto c = 0; c < channels; c += 4)
+    {
+        float_4 lowOut;
+        float_4 highOut;
+        crossovers[c / 4].process (TBase::inputs[input].template getVoltageSimd<float_4> (c), lowOut, highOut);
+
         lowOut = sspo::voltageSaturate (lowOut);
-        auto highOut = hpFiltersR[c / 4].process (in);
         highOut = sspo::voltageSaturate (highOut);
 
-        lowOut = rack::simd::ifelse ((movemask (lowOut == lowOut) != 0xF), float_4 (0.0f), lowOut);
-        highOut = rack::simd::ifelse ((movemask (highOut == highOut) != 0xF), float_4 (0.0f), highOut);
+        lowOut = sspo::scrub (lowOut);
+        highOut = sspo::scrub (highOut);
 
-        lowOut.store (TBase::outputs[RIGHT_LOW_OUTPUT].getVoltages (c));
-        highOut.store (TBase::outputs[RIGHT_HIGH_OUTPUT].getVoltages (c));
+        lowOut.store (TBase::outputs[lowOutput].getVoltages (c));
+        highOut.store (TBase::outputs[highOutput].getVoltages (c));
     }
-
-    TBase::outputs[LEFT_LOW_OUTPUT].setChannels (channelsL);
-    TBase::outputs[LEFT_HIGH_OUTPUT].setChannels (channelsL);
-
-    TBase::outputs[RIGHT_LOW_OUTPUT].setChannels (channelsR);
-    TBase::outputs[RIGHT_HIGH_OUTPUT].setChannels (channelsR);
 }
 
 template <class TBase>
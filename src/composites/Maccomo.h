@@ -24,10 +24,14 @@
 #include "IComposite.h"
 #include "SynthFilter.h"
 #include "AudioMath.h"
+#include "Random.h"
+#include "Sanitize.h"
 #include <memory>
 #include <vector>
 #include <time.h>
 
+using float_4 = ::rack::simd::float_4;
+
 namespace rack
 {
     namespace engine
@@ -90,16 +94,12 @@ public:
         for (auto& ct : currentTypes)
             ct = 0;
 
-        filters.resize (maxChannels);
+        filters.resize (SIMD_MAX_CHANNELS);
         for (auto& f : filters)
         {
             f.setUseNonLinearProcessing (true);
-            f.setType (sspo::MoogLadderFilter<float>::types()[0]);
-            f.nonLinearProcess = [] (float in, float drive)
-            { return std::tanh (in * drive); };
+            f.setType (Filter::types()[0]);
         }
-
-        sspo::AudioMath::defaultGenerator.seed (time (NULL));
     }
 
     enum ParamIds
@@ -141,15 +141,19 @@ public:
     static constexpr float maxRes = 10.0f;
     static constexpr float maxDrive = 2.0f;
     static constexpr int maxChannels = 16;
+    static constexpr int SIMD_MAX_CHANNELS = 4;
 
     static constexpr int typeCount = 6;
+    // the mode of each channel, a filter's lanes are set one at a time
     std::vector<int> currentTypes;
 
-    std::vector<sspo::MoogLadderFilter<float>> filters;
+    using Filter = sspo::MoogLadderFilter<float_4, sspo::TanhPolicy>;
+    std::vector<Filter> filters;
 
     void step() override;
 
     float sampleRate = 1.0f;
+    sspo::Random random;
     float sampleTime = 1.0f;
 };
 
@@ -169,45 +173,51 @@ inline void MaccomoComp<TBase>::step()
 
     freqParam = freqParam * 10.0f - 5.0f;
 
-    for (auto i = 0; i < channels; ++i)
+    for (auto c = 0; c < channels; c += 4)
     {
-        auto in = TBase::inputs[MAIN_INPUT].getVoltage (i);
+        auto in = TBase::inputs[MAIN_INPUT].template getPolyVoltageSimd<float_4> (c);
         // Add -120dB noise to bootstrap self-oscillation
-        in += 1e-6f * (2.f * sspo::AudioMath::rand01() - 1.f);
+        in += 1e-6f * random.bipolar4();
 
-        auto frequency = freqParam;
+        auto frequency = float_4 (freqParam);
         if (TBase::inputs[VOCT_INPUT].isConnected())
-            frequency += TBase::inputs[VOCT_INPUT].getPolyVoltage (i);
+            frequency += TBase::inputs[VOCT_INPUT].template getPolyVoltageSimd<float_4> (c);
         if (TBase::inputs[FREQ_CV_INPUT].isConnected())
         {
-            frequency += (TBase::inputs[FREQ_CV_INPUT].getPolyVoltage (i)
+            frequency += (TBase::inputs[FREQ_CV_INPUT].template getPolyVoltageSimd<float_4> (c)
                           * freqAttenuverterParam);
         }
-        frequency = dsp::FREQ_C4 * std::pow (2.0f, frequency);
+        frequency = dsp::FREQ_C4 * rack::simd::pow (2.0f, frequency);
 
-        frequency = clamp (frequency, 0.0f, maxFreq);
+        frequency = rack::simd::clamp (frequency, float_4 (0.0f), float_4 (maxFreq));
 
-        auto resonance = resParam;
-        resonance += (TBase::inputs[RESONANCE_CV_INPUT].getPolyVoltage (i) / 5.0f)
+        auto resonance = float_4 (resParam);
+        resonance += (TBase::inputs[RESONANCE_CV_INPUT].template getPolyVoltageSimd<float_4> (c) / 5.0f)
                      * resAttenuverterParam * maxRes;
-        resonance = clamp (resonance, 0.0f, maxRes);
+        resonance = rack::simd::clamp (resonance, float_4 (0.0f), float_4 (maxRes));
 
-        auto drive = driveParam;
-        drive += (TBase::inputs[DRIVE_CV_INPUT].getPolyVoltage (i) / 5.0f)
+        auto drive = float_4 (driveParam);
+        drive += (TBase::inputs[DRIVE_CV_INPUT].template getPolyVoltageSimd<float_4> (c) / 5.0f)
                  * driveAttenuverterParam * maxDrive;
-        drive = clamp (drive, 0.0f, maxDrive);
+        drive = rack::simd::clamp (drive, float_4 (0.0f), float_4 (maxDrive));
 
-        if (currentTypes[i] != modeParam + int (TBase::inputs[MODE_CV_INPUT].getPolyVoltage (i)))
+        const auto lanes = std::min (4, channels - c);
+        for (auto lane = 0; lane < lanes; ++lane)
         {
-            currentTypes[i] = clamp (modeParam + int (TBase::inputs[MODE_CV_INPUT].getPolyVoltage (i)), 0, typeCount - 1);
-            filters[i].setType (sspo::MoogLadderFilter<float>::types()[currentTypes[i]]);
+            const auto i = c + lane;
+            const auto mode = modeParam + int (TBase::inputs[MODE_CV_INPUT].getPolyVoltage (i));
+            if (currentTypes[i] != mode)
+            {
+                currentTypes[i] = clamp (mode, 0, typeCount - 1);
+                filters[c / 4].setLaneType (lane, Filter::types()[currentTypes[i]]);
+            }
         }
 
-        filters[i].setParameters (frequency, resonance, drive, 0, sampleRate);
+        filters[c / 4].setParameters (frequency, resonance, drive, float_4 (0.0f), sampleRate);
 
-        auto out = filters[i].process (in / 10.0f) * 10.0f;
-        out = std::isfinite (out) ? out : 0;
-        TBase::outputs[MAIN_OUTPUT].setVoltage (out, i);
+        auto out = filters[c / 4].process (in / 10.0f) * 10.0f;
+        out = sspo::scrub (out);
+        TBase::outputs[MAIN_OUTPUT].setVoltageSimd (out, c);
     }
     TBase::outputs[MAIN_OUTPUT].setChannels (channels);
 }
@@ -24,8 +24,10 @@
 #include "IComposite.h"
 #include "../dsp/UtilityFilters.h"
 #include "../dsp/WaveShaper.h"
+#include "../dsp/Sanitize.h"
 #include <memory>
 #include <vector>
+#include <array>
 
 #include "jansson.h"
 
@@ -97,11 +99,10 @@ public:
         //resize arrays
         //initialise dsp object
 
-        sspo::AudioMath::defaultGenerator.seed (time (NULL));
         dcOutFilters.resize (SIMD_MAX_CHANNELS);
         divider.setDivisor (divisorRate);
-        upsampler.setQuality (upSampleQuality);
-        decimator.setQuality (upSampleQuality);
+        for (auto& r : resamplers)
+            r.setQuality (upSampleQuality);
     }
 
     void step() override;
@@ -126,6 +127,8 @@ public:
         FIVE_PARAM,
         MAIN_PARAM,
         NLD_PARAM,
+        OVERSAMPLE_FILTER_PARAM,
+        ANTIALIASING_PARAM,
         NUM_PARAMS
     };
     enum InputId
@@ -159,9 +162,11 @@ public:
     static constexpr int maxUpSampleQuality = 12;
     int upSampleRate = 1;
     int upSampleQuality = 1;
-    sspo::Upsampler<maxUpSampleRate, maxUpSampleQuality, float_4> upsampler;
-    sspo::Decimator<maxUpSampleRate, maxUpSampleQuality, float_4> decimator;
+    // one per float_4 group, as each holds the filter history of its channels
+    std::array<sspo::Resampler<maxUpSampleRate, maxUpSampleQuality, float_4>, SIMD_MAX_CHANNELS> resamplers;
     float_4 oversampleBuffer[maxUpSampleRate];
+    // the alternative to oversampling, one per float_4 group as it holds the previous input
+    WaveShaper::Adaa<float_4> adaa[SIMD_MAX_CHANNELS];
     std::vector<sspo::BiQuad<float_4>> dcOutFilters;
     ClockDivider divider;
 };
@@ -192,22 +197,30 @@ inline void MixComp<TBase>::step()
               * TBase::params[FIVE_PARAM].getValue();
 
         //process audio
-        //only oversample if needed
-
-        // set the upsample rate if NLD used, else 0
-        upSampleRate = (TBase::params[NLD_PARAM].getValue() > 0.0f) ? 3 : 0;
-        upsampler.setOverSample (upSampleRate);
-        if (upSampleRate > 1)
+        //only oversample if needed, and not when the shaper is anti-aliased by ADAA
+        const auto nldType = TBase::params[NLD_PARAM].getValue();
+        const auto useAdaa = TBase::params[ANTIALIASING_PARAM].getValue() == sspo::ADAA_ANTIALIASING;
+
+        // set the upsample rate if NLD used, else 0, the half-band filters need a power of 2
+        resamplers[c / 4].setFilter (TBase::params[OVERSAMPLE_FILTER_PARAM].getValue());
+        upSampleRate = (nldType > 0.0f && ! useAdaa) ? (resamplers[c / 4].isHalfBand() ? 4 : 3) : 0;
+        resamplers[c / 4].setOverSample (upSampleRate);
+        if (nldType > 0.0f && useAdaa)
+        {
+            in = adaa[c / 4].process (WaveShaper::nld(), in * 0.1f, nldType) * TBase::params[MAIN_PARAM].getValue() * 10.0f;
+        }
+        else if (upSampleRate > 1)
         {
-            upsampler.process (in, oversampleBuffer);
-            for (auto i = 0; i < upSampleRate; ++i)
-            {
-                oversampleBuffer[i] = WaveShaper::nld.process (in * 0.1f,
-                                                               TBase::params[NLD_PARAM].getValue())
-                                      * TBase::params[MAIN_PARAM].getValue();
-            }
-            decimator.setOverSample (upSampleRate);
-            in = decimator.process (oversampleBuffer) * 10.0f;
+            if (resamplers[c / 4].isHalfBand())
+                resamplers[c / 4].upsample (in * 0.1f, oversampleBuffer);
+            else
+                // the IIR shaper has always been fed the un-upsampled input, as the upsampler output was overwritten
+                std::fill (oversampleBuffer, oversampleBuffer + upSampleRate, in * 0.1f);
+            WaveShaper::nld().processBlock (oversampleBuffer,
+                                            oversampleBuffer,
+                                            upSampleRate,
+                                            nldType);
+            in = resamplers[c / 4].decimate (oversampleBuffer) * TBase::params[MAIN_PARAM].getValue() * 10.0f;
         }
         else
         {
@@ -217,8 +230,7 @@ inline void MixComp<TBase>::step()
         //NO dc out filter, so cv can pass
         float_4 out = in; //dcOutFilters[c / 4].process (in);
 
-        //simd'ed out = std::isfinite (out) ? out : 0;
-        out = rack::simd::ifelse ((movemask (out == out) != 0xF), float_4 (0.0f), out);
+        out = sspo::scrub (out);
 
         TBase::outputs[MAIN_OUTPUT].setVoltageSimd (out, c);
     }
@@ -262,7 +274,13 @@ IComposite::Config MixDescription<TBase>::getParam (int i)
             break;
 
         case MixComp<TBase>::NLD_PARAM:
-            ret = { 0.0f, static_cast<float> (sspo::AudioMath::WaveShaper::nld.size() - 1), 0.0f, "NLD TYPE", " ", 0.0f, 1.0f, 0.0f };
+            ret = { 0.0f, static_cast<float> (sspo::AudioMath::WaveShaper::nld().size() - 1), 0.0f, "NLD TYPE", " ", 0.0f, 1.0f, 0.0f };
+            break;
+        case MixComp<TBase>::OVERSAMPLE_FILTER_PARAM:
+            ret = { 0.0f, sspo::NUM_OVERSAMPLE_FILTERS - 1, 0.0f, "Oversample Filter", " ", 0.0f, 1.0f, 0.0f };
+            break;
+        case MixComp<TBase>::ANTIALIASING_PARAM:
+            ret = { 0.0f, sspo::NUM_ANTIALIASINGS - 1, 0.0f, "Antialiasing", " ", 0.0f, 1.0f, 0.0f };
             break;
 
         default:
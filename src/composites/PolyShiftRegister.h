@@ -23,6 +23,7 @@
 
 #include "IComposite.h"
 #include "AudioMath.h"
+#include "Random.h"
 #include <algorithm>
 #include <cstdlib>
 #include <vector>
@@ -127,6 +128,7 @@ public:
     std::vector<float> accentAOffsets;
     std::vector<float> accentBOffsets;
     std::vector<float> accentRngOffsets;
+    sspo::Random random;
 
     //expander buffer
     sspo::TyrantExpanderBuffer producerM;
@@ -157,8 +159,6 @@ public:
     // must be called after setSampleRate
     void init()
     {
-        defaultGenerator.seed (time (nullptr));
-
         channelData.resize (maxChannels);
         for (auto& cd : channelData)
         {
@@ -216,7 +216,7 @@ public:
     void triggerRngGenerator()
     {
         for (auto i = 0; i < currentChannels; ++i)
-            triggerRng[i] = rand01();
+            triggerRng[i] = random.uniform();
     }
 
     void generateAccents (std::vector<float>& accentOffsets,
@@ -229,7 +229,7 @@ public:
     {
         if (TBase::inputs[accentProbCv].getChannels() > 1)
         {
-            auto scale = rng ? rand01() : 1.0f;
+            auto scale = rng ? random.uniform() : 1.0f;
             accentOffsets[bufferChannel] = scale
                                            * fixedAccent (accentProbParam,
                                                           accentProbCv,
@@ -239,7 +239,7 @@ public:
         }
         else
         {
-            auto scale = rng ? rand01() : 1.0f;
+            auto scale = rng ? random.uniform() : 1.0f;
             auto accent = scale
                           * fixedAccent (accentProbParam,
                                          accentProbCv,
@@ -287,7 +287,7 @@ public:
                                      + TBase::inputs[probInput].getPolyVoltage (c) / 10.0f,
                                  0.0f,
                                  1.0f);
-        auto useAccent = accentProb > rand01();
+        auto useAccent = accentProb > random.uniform();
         if (useAccent)
             ret = clamp (TBase::params[offsetParam].getValue()
                              + TBase::inputs[offsetInput].getPolyVoltage (c),
@@ -320,14 +320,14 @@ inline void PolyShiftRegisterComp<TBase>::step()
                                    + TBase::inputs[TRIGGER_PROB_INPUT].getVoltage() / 10.0f,
                                0.0f,
                                1.0f);
-    auto ignoreTrigger = triggerProb > rand01();
+    auto ignoreTrigger = triggerProb > random.uniform();
 
     auto monoShuffleProb = TBase::inputs[SHUFFLE_PROB_INPUT].getChannels() < 2;
     auto shuffleProb = clamp (TBase::params[SHUFFLE_PROB_PARAM].getValue()
                                   + TBase::inputs[SHUFFLE_PROB_INPUT].getVoltage() / 10.0f,
                               0.0f,
                               1.0f);
-    auto useShuffle = shuffleProb > rand01();
+    auto useShuffle = shuffleProb > random.uniform();
     //write ignore status to channel 0
     //expMessage->triggerAccent[0] = ignoreTrigger;
 
@@ -345,7 +345,7 @@ inline void PolyShiftRegisterComp<TBase>::step()
                              1.0f);
 
         if (! monoTriggerProb)
-            ignoreTrigger = triggerProb > rand01();
+            ignoreTrigger = triggerProb > random.uniform();
 
         if (triggered && ! ignoreTrigger)
         {
@@ -354,7 +354,7 @@ inline void PolyShiftRegisterComp<TBase>::step()
 
             triggerRngGenerator();
             if (! monoShuffleProb)
-                useShuffle = shuffleProb > rand01();
+                useShuffle = shuffleProb > random.uniform();
 
             expMessage->shuffleAccent[c] = useShuffle;
             if (useShuffle)
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2020 Dave French <contact/dot/dave/dot/french3/at/googlemail/dot/com>
+ *
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program (see COPYING); if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+
+/**
+ * Control rate copy of a composite's params, with change detection
+ *
+ * process is called every sample, every divisor samples it reads all the params, the
+ * channel count of every input and the voltages of the watched CV inputs, and returns
+ * true if any of them differ from the previous read. Composites recompute their
+ * coefficients only then.
+ *
+ * Works with TestComposite and WidgetComposite, both expose params and inputs.
+ */
+template <int numParams, int numInputs>
+class ParamSnapshot
+{
+public:
+    ParamSnapshot()
+    {
+        std::fill (values, values + numParams, 0.0f);
+        std::fill (channels, channels + numInputs, 0);
+        std::fill (watched, watched + numInputs, false);
+        for (auto& v : voltages)
+            std::fill (v, v + maxChannels, 0.0f);
+    }
+
+    /// the voltages of this input count as a change, as well as its connection
+    void watchVoltages (const int inputId)
+    {
+        watched[inputId] = true;
+    }
+
+    /// number of samples between reads, 1 reads every sample
+    void setDivisor (const int newDivisor)
+    {
+        divisor = std::max (1, newDivisor);
+        counter = std::min (counter, divisor - 1);
+    }
+
+    int getDivisor() const
+    {
+        return divisor;
+    }
+
+    /// the next read reports a change, for a sample rate change
+    void invalidate()
+    {
+        dirty = true;
+        counter = 0;
+    }
+
+    /// returns true when this sample read the composite and something had changed
+    template <typename TComposite>
+    bool process (TComposite& composite)
+    {
+        if (counter > 0)
+        {
+            --counter;
+            return false;
+        }
+        counter = divisor - 1;
+
+        auto changed = dirty;
+        dirty = false;
+
+        for (auto i = 0; i < numParams; ++i)
+        {
+            const auto value = composite.params[i].getValue();
+            if (value != values[i])
+            {
+                values[i] = value;
+                changed = true;
+            }
+        }
+
+        for (auto i = 0; i < numInputs; ++i)
+        {
+            const auto count = composite.inputs[i].getChannels();
+            if (count != channels[i])
+            {
+                channels[i] = count;
+                changed = true;
+            }
+
+            if (watched[i])
+            {
+                const auto* v = composite.inputs[i].getVoltages();
+                for (auto c = 0; c < count; ++c)
+                {
+                    if (v[c] != voltages[i][c])
+                    {
+                        voltages[i][c] = v[c];
+                        changed = true;
+                    }
+                }
+            }
+        }
+
+        return changed;
+    }
+
+    float getValue (const int paramId) const
+    {
+        return values[paramId];
+    }
+
+    int getChannels (const int inputId) const
+    {
+        return channels[inputId];
+    }
+
+    bool isConnected (const int inputId) const
+    {
+        return channels[inputId] > 0;
+    }
+
+private:
+    static constexpr int maxChannels = 16;
+
+    float values[numParams];
+    int channels[numInputs];
+    float voltages[numInputs][maxChannels];
+    bool watched[numInputs];
+    int divisor = 1;
+    int counter = 0;
+    bool dirty = true;
+};
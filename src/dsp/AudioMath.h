@@ -97,14 +97,6 @@ namespace sspo
             bool lastPositive = false;
         };
 
-        static std::default_random_engine defaultGenerator{ 99 };
-        static std::uniform_real_distribution<float> distribution{ 0.0, 1.0 - FLT_EPSILON };
-
-        inline float rand01()
-        {
-            return distribution (defaultGenerator);
-        }
-
         inline float db (float g)
         {
             return 20 * log (g) / Ln10;
@@ -115,6 +107,47 @@ namespace sspo
             return std::exp (Ln10 * db / 20.0);
         }
 
+        /// tan (pi * x), the bilinear prewarp of x = fc / fs, shared by every filter setter
+        /// the odd polynomial from Cephes tanf covers pi * x up to pi / 4, above that tan is
+        /// the reciprocal of the same polynomial at pi * (0.5 - x), so there is no branch.
+        /// Within 3e-7 relative of tan for 0 <= x <= 0.49, and right for -0.25 < x < 0.75
+        template <typename T>
+        inline T tanPi (const T x)
+        {
+            const auto reflect = x > 0.25f;
+            const T w = k_pi * rack::simd::ifelse (reflect, T (0.5f) - x, x);
+            const T z = w * w;
+            const T t = w + w * z * (3.33331568548e-1f + z * (1.33387994085e-1f + z * (5.34112807005e-2f + z * (2.44301354525e-2f + z * (3.11992232697e-3f + z * 9.38540185543e-3f)))));
+            return rack::simd::ifelse (reflect, T (1.0f) / t, t);
+        }
+
+        /// log2 of positive normal numbers, the exponent bits plus a quartic on the mantissa
+        /// within 0.0001 of std::log2, 0.0005dB
+        inline rack::simd::float_4 fastLog2 (const rack::simd::float_4 x)
+        {
+            using rack::simd::float_4;
+            using rack::simd::int32_4;
+            const auto bits = int32_4::cast (x);
+            const auto exponent = float_4 ((bits >> 23) - int32_4 (127));
+            const auto m = float_4::cast ((bits & int32_4 (0x007fffff)) | int32_4 (0x3f800000)) - 1.0f;
+            return exponent + (8.75919222e-05f + m * (1.43770439f + m * (-0.674942892f + m * (0.31867913f + m * -0.0816158087f))));
+        }
+
+        /// 2 to the x, the whole part goes into the exponent bits and a quartic covers the
+        /// fraction, within 0.0004% of std::exp2, x is clamped to +-126
+        inline rack::simd::float_4 fastExp2 (const rack::simd::float_4 x)
+        {
+            using rack::simd::float_4;
+            using rack::simd::int32_4;
+            const auto clamped = rack::simd::clamp (x, float_4 (-126.0f), float_4 (126.0f));
+            // truncation rounds the negatives up, the mask is -1 where it did
+            auto whole = int32_4 (clamped);
+            whole = whole + int32_4::cast (float_4 (whole) > clamped);
+            const auto f = clamped - float_4 (whole);
+            const auto p = 1.0000037f + f * (0.692966123f + f * (0.241638446f + f * (0.0516903582f + f * 0.0136976645f)));
+            return float_4::cast (int32_4::cast (p) + (whole << 23));
+        }
+
         class ClockDivider
         {
         public:
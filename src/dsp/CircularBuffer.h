@@ -1,89 +1,362 @@
-/*
- * Copyright (c) 2019 Dave French <contact/dot/dave/dot/french3/at/googlemail/dot/com>
- *
- *
- * This program is free software; you can redistribute it and/or
- * modify it under the terms of the GNU General Public
- * License as published by the Free Software Foundation; either
- * version 3 of the License, or (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
- * General Public License for more details.
- *
- * You should have received a copy of the GNU General Public
- * License along with this program (see COPYING); if not, write to the
- * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
- * Boston, MA 02110-1301 USA.
- *
- */
-
-#pragma once
-
-#include <cmath>
-#include <memory>
-
-#include "AudioMath.h"
-
-template <typename T>
-class CircularBuffer
-{
-public:
-    CircularBuffer()
-    {
-        reset (4096);
-    }
-    CircularBuffer (const unsigned int minBufferSize)
-    {
-        reset (minBufferSize);
-    }
-
-    void reset (const unsigned int minBufferSize)
-    {
-        writeIndex = 0;
-        bufferLength = static_cast<unsigned int> (std::pow (2, std::ceil (std::log (minBufferSize) / std::log (2))));
-        wrapBits = bufferLength - 1;
-        buffer.reset (new T[bufferLength]);
-        clear();
-    }
-
-    void clear()
-    {
-        for (auto i = 0; i < static_cast<int> (bufferLength); ++i)
-        {
-            buffer[i] = 0;
-        }
-    }
-
-    inline void writeBuffer (const T newValue) noexcept
-    {
-        writeIndex++;
-        writeIndex &= wrapBits;
-        buffer[writeIndex] = std::isnan (newValue) || std::isinf (newValue) ? 0 : newValue;
-    }
-
-    inline T readBuffer (const int delaySamples) const noexcept
-    {
-        return buffer[(writeIndex - delaySamples) & wrapBits];
-    }
-
-    inline T readBuffer (const float delaySamples) const noexcept
-    {
-        auto y1 = readBuffer (static_cast<int> (delaySamples));
-        auto y2 = readBuffer (static_cast<int> (delaySamples) + 1);
-        auto fract = delaySamples - static_cast<int> (delaySamples);
-        return sspo::AudioMath::linearInterpolate (y1, y2, fract);
-    }
-
-    int size()
-    {
-        return static_cast<int> (bufferLength);
-    }
-
-private:
-    std::unique_ptr<T[]> buffer{ nullptr };
-    unsigned int writeIndex{ 0 };
-    unsigned int bufferLength{ 0 };
-    unsigned int wrapBits{ 0 };
-};
+/*
+ * Copyright (c) 2019 Dave French <contact/dot/dave/dot/french3/at/googlemail/dot/com>
+ *
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program (see COPYING); if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <assert.h>
+#include <cmath>
+#include <memory>
+
+#include "AudioMath.h"
+#include "FractionalDelay.h"
+#include "Sanitize.h"
+
+template <typename T>
+class CircularBuffer
+{
+public:
+    CircularBuffer()
+    {
+        reset (4096);
+    }
+    CircularBuffer (const unsigned int minBufferSize)
+    {
+        reset (minBufferSize);
+    }
+
+    void reset (const unsigned int minBufferSize)
+    {
+        writeIndex = 0;
+        bufferLength = lengthFor (minBufferSize);
+        wrapBits = bufferLength - 1;
+        owned.reset (new T[bufferLength]);
+        buffer = owned.get();
+        clear();
+    }
+
+    /// uses memory owned elsewhere, such as a DelayArena, length must be a power of 2
+    void attach (T* memory, const unsigned int length)
+    {
+        assert ((length & (length - 1)) == 0 && "CircularBuffer length not a power of 2");
+        writeIndex = 0;
+        bufferLength = length;
+        wrapBits = bufferLength - 1;
+        owned.reset();
+        buffer = memory;
+        clear();
+    }
+
+    /// the power of 2 length used for a minimum size
+    static unsigned int lengthFor (const unsigned int minBufferSize)
+    {
+        return static_cast<unsigned int> (std::pow (2, std::ceil (std::log (minBufferSize) / std::log (2))));
+    }
+
+    void clear()
+    {
+        for (auto i = 0; i < static_cast<int> (bufferLength); ++i)
+        {
+            buffer[i] = 0;
+        }
+    }
+
+    /// a plain store, see Sanitize.h for where non finite values are caught
+    inline void writeBuffer (const T newValue) noexcept
+    {
+        writeIndex++;
+        writeIndex &= wrapBits;
+        buffer[writeIndex] = sspo::delayLineValue (newValue);
+    }
+
+    inline T readBuffer (const int delaySamples) const noexcept
+    {
+        return buffer[(writeIndex - delaySamples) & wrapBits];
+    }
+
+    inline T readBuffer (const float delaySamples) const noexcept
+    {
+        auto y1 = readBuffer (static_cast<int> (delaySamples));
+        auto y2 = readBuffer (static_cast<int> (delaySamples) + 1);
+        auto fract = delaySamples - static_cast<int> (delaySamples);
+        return sspo::AudioMath::linearInterpolate (y1, y2, fract);
+    }
+
+    /// third order Lagrange, flatter and closer in pitch than linear near nyquist,
+    /// for delays of 1 sample or more
+    inline T readLagrange (const float delaySamples) const noexcept
+    {
+        const auto whole = static_cast<int> (delaySamples);
+        const auto* h = sspo::FractionalDelay::tables().lagrange[sspo::FractionalDelay::row (delaySamples - whole)];
+        const auto index = writeIndex - whole;
+        return h[0] * buffer[(index + 1) & wrapBits]
+               + h[1] * buffer[index & wrapBits]
+               + h[2] * buffer[(index - 1) & wrapBits]
+               + h[3] * buffer[(index - 2) & wrapBits];
+    }
+
+    /// first order Thiran allpass, no high frequency loss, for delays of 0.5 samples or more
+    /// state is the last output of this reader, it must be kept between calls
+    inline T readAllpass (const float delaySamples, T& state) const noexcept
+    {
+        // the allpass covers 0.5 to 1.5 samples of the delay, its most accurate range
+        const auto shifted = delaySamples - 0.5f;
+        const auto whole = static_cast<int> (shifted);
+        const auto eta = sspo::FractionalDelay::tables().thiran[sspo::FractionalDelay::row (shifted - whole)];
+        const auto index = writeIndex - whole;
+        state = eta * (buffer[index & wrapBits] - state) + buffer[(index - 1) & wrapBits];
+        return state;
+    }
+
+    /// the read a sspo::Interpolation selects, state is only used by the allpass
+    inline T read (const float delaySamples, const int interpolation, T& state) const noexcept
+    {
+        switch (interpolation)
+        {
+            case sspo::LAGRANGE_INTERPOLATION:
+                return readLagrange (delaySamples);
+            case sspo::ALLPASS_INTERPOLATION:
+                return readAllpass (delaySamples, state);
+            default:
+                return readBuffer (delaySamples);
+        }
+    }
+
+    /// n fractional reads in one go, every index and fraction is worked out before the
+    /// reads, which are then issued back to back
+    /// the taps have no state, so any interpolation other than linear reads Lagrange
+    inline void readTaps (const float* delays, T* out, const int n, const int interpolation = sspo::LINEAR_INTERPOLATION) const noexcept
+    {
+        constexpr int block = 8;
+        unsigned int index[block];
+        T fract[block];
+        const auto linear = interpolation == sspo::LINEAR_INTERPOLATION;
+        for (auto start = 0; start < n; start += block)
+        {
+            const auto count = std::min (block, n - start);
+            for (auto i = 0; i < count; ++i)
+            {
+                const auto whole = static_cast<int> (delays[start + i]);
+                index[i] = (writeIndex - whole) & wrapBits;
+                fract[i] = delays[start + i] - whole;
+            }
+            if (linear)
+            {
+                for (auto i = 0; i < count; ++i)
+                {
+                    out[start + i] = sspo::AudioMath::linearInterpolate (buffer[index[i]],
+                                                                         buffer[(index[i] - 1) & wrapBits],
+                                                                         fract[i]);
+                }
+            }
+            else
+            {
+                const auto& table = sspo::FractionalDelay::tables().lagrange;
+                for (auto i = 0; i < count; ++i)
+                {
+                    const auto* h = table[sspo::FractionalDelay::row (fract[i])];
+                    out[start + i] = h[0] * buffer[(index[i] + 1) & wrapBits]
+                                     + h[1] * buffer[index[i]]
+                                     + h[2] * buffer[(index[i] - 1) & wrapBits]
+                                     + h[3] * buffer[(index[i] - 2) & wrapBits];
+                }
+            }
+        }
+    }
+
+    /// four fractional reads, the index and fraction maths is done as float_4
+    inline rack::simd::float_4 readTaps (const rack::simd::float_4 delays) const noexcept
+    {
+        using namespace rack::simd;
+        const auto whole = int32_4 (delays);
+        const auto fract = delays - float_4 (whole);
+        const auto index = (int32_4 (static_cast<int32_t> (writeIndex)) - whole) & int32_4 (static_cast<int32_t> (wrapBits));
+        const auto next = (index - int32_4 (1)) & int32_4 (static_cast<int32_t> (wrapBits));
+        const float_4 y1 (buffer[index[0]], buffer[index[1]], buffer[index[2]], buffer[index[3]]);
+        const float_4 y2 (buffer[next[0]], buffer[next[1]], buffer[next[2]], buffer[next[3]]);
+        return sspo::AudioMath::linearInterpolate (y1, y2, fract);
+    }
+
+    int size()
+    {
+        return static_cast<int> (bufferLength);
+    }
+
+private:
+    std::unique_ptr<T[]> owned{ nullptr };
+    T* buffer{ nullptr };
+    unsigned int writeIndex{ 0 };
+    unsigned int bufferLength{ 0 };
+    unsigned int wrapBits{ 0 };
+};
+
+/// Four channels interleaved, one float_4 frame per sample, each lane its own delay line
+///
+/// A write is one aligned store, a fractional read gathers the two samples of each lane
+/// and interpolates them as a float_4
+template <>
+class CircularBuffer<rack::simd::float_4>
+{
+public:
+    using float_4 = rack::simd::float_4;
+    using int32_4 = rack::simd::int32_4;
+
+    CircularBuffer()
+    {
+        reset (4096);
+    }
+    CircularBuffer (const unsigned int minBufferSize)
+    {
+        reset (minBufferSize);
+    }
+
+    void reset (const unsigned int minBufferSize)
+    {
+        writeIndex = 0;
+        bufferLength = lengthFor (minBufferSize);
+        wrapBits = bufferLength - 1;
+        owned.reset (new float_4[bufferLength]);
+        buffer = owned.get();
+        clear();
+    }
+
+    /// uses memory owned elsewhere, such as a DelayArena, length must be a power of 2
+    void attach (float_4* memory, const unsigned int length)
+    {
+        assert ((length & (length - 1)) == 0 && "CircularBuffer length not a power of 2");
+        writeIndex = 0;
+        bufferLength = length;
+        wrapBits = bufferLength - 1;
+        owned.reset();
+        buffer = memory;
+        clear();
+    }
+
+    static unsigned int lengthFor (const unsigned int minBufferSize)
+    {
+        return CircularBuffer<float>::lengthFor (minBufferSize);
+    }
+
+    void clear()
+    {
+        for (auto i = 0; i < static_cast<int> (bufferLength); ++i)
+        {
+            buffer[i] = float_4::zero();
+        }
+    }
+
+    /// a plain store, see Sanitize.h for where non finite values are caught
+    inline void writeBuffer (const float_4 newValue) noexcept
+    {
+        writeIndex++;
+        writeIndex &= wrapBits;
+        buffer[writeIndex] = sspo::delayLineValue (newValue);
+    }
+
+    inline float_4 readBuffer (const int delaySamples) const noexcept
+    {
+        return buffer[(writeIndex - delaySamples) & wrapBits];
+    }
+
+    /// a fractional delay per lane
+    inline float_4 readBuffer (const float_4 delaySamples) const noexcept
+    {
+        const auto whole = int32_4 (delaySamples);
+        const auto fract = delaySamples - float_4 (whole);
+        const auto wrap = int32_4 (static_cast<int32_t> (wrapBits));
+        const auto index = (int32_4 (static_cast<int32_t> (writeIndex)) - whole) & wrap;
+        const auto next = (index - int32_4 (1)) & wrap;
+        const float_4 y1 (buffer[index[0]][0], buffer[index[1]][1], buffer[index[2]][2], buffer[index[3]][3]);
+        const float_4 y2 (buffer[next[0]][0], buffer[next[1]][1], buffer[next[2]][2], buffer[next[3]][3]);
+        return sspo::AudioMath::linearInterpolate (y1, y2, fract);
+    }
+
+    /// third order Lagrange per lane, for delays of 1 sample or more
+    inline float_4 readLagrange (const float_4 delaySamples) const noexcept
+    {
+        const auto whole = int32_4 (delaySamples);
+        const auto rows = int32_4 ((delaySamples - float_4 (whole)) * static_cast<float> (sspo::FractionalDelay::tableSize) + 0.5f);
+        const auto wrap = int32_4 (static_cast<int32_t> (wrapBits));
+        const auto index = int32_4 (static_cast<int32_t> (writeIndex)) - whole;
+
+        // a table row per lane, transposed to one float_4 per tap
+        const auto& table = sspo::FractionalDelay::tables().lagrange;
+        auto h0 = float_4::load (table[rows[0]]);
+        auto h1 = float_4::load (table[rows[1]]);
+        auto h2 = float_4::load (table[rows[2]]);
+        auto h3 = float_4::load (table[rows[3]]);
+        _MM_TRANSPOSE4_PS (h0.v, h1.v, h2.v, h3.v);
+
+        const auto i0 = (index + int32_4 (1)) & wrap;
+        const auto i1 = index & wrap;
+        const auto i2 = (index - int32_4 (1)) & wrap;
+        const auto i3 = (index - int32_4 (2)) & wrap;
+        return h0 * gather (i0) + h1 * gather (i1) + h2 * gather (i2) + h3 * gather (i3);
+    }
+
+    /// first order Thiran allpass per lane, for delays of 0.5 samples or more
+    /// state is the last output of this reader, it must be kept between calls
+    inline float_4 readAllpass (const float_4 delaySamples, float_4& state) const noexcept
+    {
+        const auto shifted = delaySamples - 0.5f;
+        const auto whole = int32_4 (shifted);
+        const auto rows = int32_4 ((shifted - float_4 (whole)) * static_cast<float> (sspo::FractionalDelay::tableSize) + 0.5f);
+        const auto wrap = int32_4 (static_cast<int32_t> (wrapBits));
+        const auto index = int32_4 (static_cast<int32_t> (writeIndex)) - whole;
+
+        const auto& table = sspo::FractionalDelay::tables().thiran;
+        const float_4 eta (table[rows[0]], table[rows[1]], table[rows[2]], table[rows[3]]);
+        state = eta * (gather (index & wrap) - state) + gather ((index - int32_4 (1)) & wrap);
+        return state;
+    }
+
+    /// the read a sspo::Interpolation selects, state is only used by the allpass
+    inline float_4 read (const float_4 delaySamples, const int interpolation, float_4& state) const noexcept
+    {
+        switch (interpolation)
+        {
+            case sspo::LAGRANGE_INTERPOLATION:
+                return readLagrange (delaySamples);
+            case sspo::ALLPASS_INTERPOLATION:
+                return readAllpass (delaySamples, state);
+            default:
+                return readBuffer (delaySamples);
+        }
+    }
+
+    int size()
+    {
+        return static_cast<int> (bufferLength);
+    }
+
+private:
+    /// lane l from frame index[l]
+    inline float_4 gather (const int32_4 index) const noexcept
+    {
+        return float_4 (buffer[index[0]][0], buffer[index[1]][1], buffer[index[2]][2], buffer[index[3]][3]);
+    }
+
+    std::unique_ptr<float_4[]> owned{ nullptr };
+    float_4* buffer{ nullptr };
+    unsigned int writeIndex{ 0 };
+    unsigned int bufferLength{ 0 };
+    unsigned int wrapBits{ 0 };
+};
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2020 Dave French <contact/dot/dave/dot/french3/at/googlemail/dot/com>
+ *
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program (see COPYING); if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ *
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "CircularBuffer.h"
+#include "MirroredCircularBuffer.h"
+
+namespace sspo
+{
+    /// One block of memory for all the delay lines of a module
+    ///
+    /// Every buffer is sized for the longest delay the module can ask for at the current
+    /// sample rate, sampleRate / minFrequency plus the interpolation guard. The buffers are
+    /// packed one after another, each starting on a cache line. They are a power of 2 long,
+    /// so each is followed by one spare cache line, otherwise the write positions of all
+    /// the channels, which move in step, would land in the same cache set. The mirror of a
+    /// MirroredCircularBuffer goes in front of it, in whole cache lines.
+    template <typename T>
+    class DelayArena
+    {
+    public:
+        static constexpr size_t cacheLine = 64;
+        static constexpr int guardSamples = 3;
+
+        /// samples needed for the longest delay, the Lagrange read takes two more
+        static unsigned int samplesFor (const float sampleRate, const float minFrequency)
+        {
+            return static_cast<unsigned int> (std::ceil (sampleRate / minFrequency)) + guardSamples;
+        }
+
+        /// attach count buffers, reallocating only when the size needed has changed
+        void allocate (CircularBuffer<T>* buffers, const int count, const float sampleRate, const float minFrequency)
+        {
+            reserve (count, sampleRate, minFrequency, 0);
+            for (auto i = 0; i < count; ++i)
+                buffers[i].attach (base + i * stride, bufferLength);
+        }
+
+        /// as above, each buffer is preceded by its mirror, rounded up to a cache line
+        template <int mirror>
+        void allocate (MirroredCircularBuffer<T, mirror>* buffers, const int count, const float sampleRate, const float minFrequency)
+        {
+            const auto lineSamples = cacheLine / sizeof (T);
+            const auto mirrorLines = (mirror + lineSamples - 1) / lineSamples;
+            reserve (count, sampleRate, minFrequency, mirrorLines * lineSamples);
+            // the mirror ends where the cache line aligned buffer starts
+            const auto offset = mirrorLines * lineSamples - mirror;
+            for (auto i = 0; i < count; ++i)
+                buffers[i].attach (base + i * stride + offset, bufferLength);
+        }
+
+        /// start of the first buffer
+        const T* data() const
+        {
+            return base;
+        }
+
+        unsigned int getBufferLength() const
+        {
+            return bufferLength;
+        }
+
+        /// distance in samples from the start of one buffer to the next
+        size_t getStride() const
+        {
+            return stride;
+        }
+
+        size_t sizeInBytes() const
+        {
+            return capacity * sizeof (T);
+        }
+
+    private:
+        void reserve (const int count, const float sampleRate, const float minFrequency, const size_t extra)
+        {
+            bufferLength = CircularBuffer<T>::lengthFor (samplesFor (sampleRate, minFrequency));
+            stride = extra + bufferLength + cacheLine / sizeof (T);
+
+            const auto needed = stride * count;
+            if (needed != capacity)
+            {
+                capacity = needed;
+                auto bytes = capacity * sizeof (T) + cacheLine;
+                memory.reset (new char[bytes]);
+                void* start = memory.get();
+                base = static_cast<T*> (std::align (cacheLine, capacity * sizeof (T), start, bytes));
+            }
+        }
+
+        std::unique_ptr<char[]> memory{ nullptr };
+        T* base{ nullptr };
+        size_t capacity{ 0 };
+        size_t stride{ 0 };
+        unsigned int bufferLength{ 0 };
+    };
+} // namespace sspo
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020 Dave French <contact/dot/dave/dot/french3/at/googlemail/dot/com>
+ *
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program (see COPYING); if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ *
+ */
+
+#pragma once
+
+namespace sspo
+{
+    /// The fractional delay readers a composite can choose between, stored as a param value
+    enum Interpolation
+    {
+        LINEAR_INTERPOLATION,
+        LAGRANGE_INTERPOLATION,
+        ALLPASS_INTERPOLATION,
+        NUM_INTERPOLATIONS
+    };
+
+    /// Coefficient tables for the fractional delay reads of CircularBuffer, indexed by the
+    /// fraction of a sample, built once and shared by every buffer
+    namespace FractionalDelay
+    {
+        /// rows per sample, a fraction is rounded to the nearest row
+        static constexpr int tableSize = 256;
+
+        struct Tables
+        {
+            /// third order Lagrange, taps at delays whole - 1, whole, whole + 1, whole + 2
+            alignas (16) float lagrange[tableSize + 1][4];
+            /// first order Thiran allpass coefficient, for a delay of fraction + 0.5 samples
+            float thiran[tableSize + 1];
+
+            Tables()
+            {
+                for (auto i = 0; i <= tableSize; ++i)
+                {
+                    const auto d = static_cast<double> (i) / tableSize;
+                    lagrange[i][0] = static_cast<float> (-d * (d - 1.0) * (d - 2.0) / 6.0);
+                    lagrange[i][1] = static_cast<float> ((d + 1.0) * (d - 1.0) * (d - 2.0) / 2.0);
+                    lagrange[i][2] = static_cast<float> (-(d + 1.0) * d * (d - 2.0) / 2.0);
+                    lagrange[i][3] = static_cast<float> ((d + 1.0) * d * (d - 1.0) / 6.0);
+
+                    const auto delta = d + 0.5;
+                    thiran[i] = static_cast<float> ((1.0 - delta) / (1.0 + delta));
+                }
+            }
+        };
+
+        inline const Tables& tables()
+        {
+            static const Tables t;
+            return t;
+        }
+
+        /// the table row for a fraction in [0, 1]
+        inline int row (const float fraction)
+        {
+            return static_cast<int> (fraction * tableSize + 0.5f);
+        }
+    } // namespace FractionalDelay
+} // namespace sspo
@@ -108,6 +108,114 @@ namespace sspo
         static constexpr float TC{ -0.9996723408f }; // { std::log (0.368f); } //capacitor discharge to 36.8%
     };
 
+    ///
+    /// !Four channels of Compressor in one float_4
+    /// The times, ratio and threshold are shared, so are the coefficients. The envelope
+    /// follows the peak of each block of divFreq samples, and the gain is worked out once
+    /// a block in log2 units with the fast log2 and exp2. With lookahead the audio is
+    /// delayed by one block, so the gain from a block's peak lands on that same block.
+    ///
+    struct Compressor_4
+    {
+        Compressor_4()
+        {
+            reset();
+        }
+
+        void calcCoeffs()
+        {
+            attackCoeff = std::exp (TC / (sampleRate * attackTime));
+            releaseCoeff = std::exp (TC / (sampleRate * releaseTimes));
+        }
+
+        void setSampleRate (const float sr)
+        {
+            sampleRate = sr / divFreq;
+            calcCoeffs();
+        }
+
+        void setTimes (const float attack, const float release)
+        {
+            attackTime = attack;
+            releaseTimes = release;
+            calcCoeffs();
+        }
+
+        /// delay the audio by latency() samples, so no peak gets past before the gain drops
+        void setLookahead (const bool on)
+        {
+            lookahead = on;
+        }
+
+        int latency() const
+        {
+            return lookahead ? divFreq : 0;
+        }
+
+        void reset()
+        {
+            peak = float_4::zero();
+            envelope = float_4::zero();
+            gain = float_4 (1.0f);
+            counter = 0;
+            for (auto& d : delayed)
+                d = float_4::zero();
+        }
+
+        float_4 process (const float_4 in)
+        {
+            peak = simd::fmax (peak, simd::abs (in));
+
+            auto out = in;
+            if (lookahead)
+            {
+                out = delayed[counter];
+                delayed[counter] = in;
+            }
+            // the gain of the block before, this one is not finished
+            out *= gain;
+
+            if (++counter == divFreq)
+            {
+                counter = 0;
+                updateGain();
+            }
+            return out;
+        }
+
+        float attackTime{ 0.0001f };
+        float releaseTimes{ 0.025f };
+        float ratio{ 10.5f };
+        float threshold{ -0.0f }; //dB
+
+    private:
+        void updateGain()
+        {
+            //envelope follower
+            const auto coeff = simd::ifelse (peak > envelope, float_4 (attackCoeff), float_4 (releaseCoeff));
+            envelope = simd::fmax (coeff * (envelope - peak) + peak, float_4 (0.00000000001f));
+            peak = float_4::zero();
+
+            //Hard knee compression, above the threshold the gain takes off all but 1 / ratio
+            const auto over = AudioMath::fastLog2 (envelope) - threshold / dbPerOctave;
+            gain = AudioMath::fastExp2 (simd::fmax (over, float_4::zero()) * (1.0f / ratio - 1.0f));
+        }
+
+        static constexpr int divFreq = 4;
+        static constexpr float dbPerOctave{ 6.02059991f }; // 20 * log10 (2)
+        static constexpr float TC{ -0.9996723408f }; // { std::log (0.368f); } //capacitor discharge to 36.8%
+
+        float attackCoeff{ 0.0f };
+        float releaseCoeff{ 0.0f };
+        float sampleRate{ 1.0f };
+        float_4 peak;
+        float_4 envelope;
+        float_4 gain;
+        float_4 delayed[divFreq];
+        int counter{ 0 };
+        bool lookahead{ false };
+    };
+
     inline float saturate (float in, float max = 1.0f, float kneeWidth = 0.05)
     {
         auto ret = 0.0f;
@@ -133,6 +241,23 @@ namespace sspo
         return ret;
     }
 
+    /// the saturate curve for a rack::simd vector, float_4 now and float_8 when Rack has one
+    /// no per lane branches, all three parts are worked out and the masks pick one. The knee
+    /// is the same quadratic on the magnitude, in float rather than double, so it is within
+    /// 0.000002 * max of saturate, and like saturate it steps by kneeWidth / 8 at both ends
+    template <typename T>
+    inline T saturateSimd (const T in, const float max = 1.0f, const float kneeWidth = 0.05f)
+    {
+        const auto magnitude = simd::abs (in);
+        const auto bend = magnitude - (max - kneeWidth / 2.0f);
+        const auto knee = magnitude - bend * bend * (1.0f / (2.0f * kneeWidth));
+        const auto out = simd::ifelse (magnitude < max - kneeWidth,
+                                       magnitude,
+                                       simd::ifelse (magnitude < max, knee, T (max)));
+        // the sign of in, a NaN goes to -max as it does in saturate
+        return simd::ifelse (in > 0.0f, out, -out);
+    }
+
     inline float voltageSaturate (float in)
     {
         return saturate (in, 11.7f, 0.5f);
@@ -140,11 +265,7 @@ namespace sspo
 
     inline float_4 voltageSaturate (float_4 in)
     {
-        float_4 ret;
-        for (auto i = 0; i < 4; ++i)
-            ret[i] = voltageSaturate (in[i]);
-
-        return ret;
+        return saturateSimd (in, 11.7f, 0.5f);
     }
 
     struct Saturator
@@ -26,6 +26,7 @@
 #include <vector>
 
 #include "AudioMath.h"
+#include "Random.h"
 
 #include "simd/functions.hpp"
 #include "simd/sse_mathfun.h"
@@ -50,7 +51,7 @@ namespace sspo
             };
 
             template <typename T>
-            inline T process (Table<T>& source, const T x) noexcept
+            inline T process (const Table<T>& source, const T x) noexcept
             {
                 assert (source.table.size() != 0 && "Lookup table empty");
                 assert (source.minX != source.maxX && "Lookup table min equal max");
@@ -96,13 +97,12 @@ namespace sspo
             //            }
 
             // second attempt without creating new float_4;
-            // member float_4 are used, this makes Lookup tables no reentrant
-            // a separate instance is require for each module instance
-            // dont use lookup.xxx() for simd
+            // only locals are used, so a single shared table can be read
+            // from every module instance
             // perf.exe reports 23% of 1% usage
 
             template <typename T>
-            inline float_4 process (Table<T>& source, float_4 x)
+            inline float_4 process (const Table<T>& source, float_4 x)
             {
                 //				const float_4 lower = float_4(0.0f, 0.45f, 0.33f, 0.77f);
                 //				const float_4 upper {0.1f, 0.55f, 0.45f, 0.9f};
@@ -192,44 +192,120 @@ namespace sspo
                 return (10028.7312891634 * std::pow (x, 11)) - (50818.8652045924 * std::pow (x, 10)) + (111363.4808729368 * std::pow (x, 9)) - (138150.6761080548 * std::pow (x, 8)) + (106649.6679158292 * std::pow (x, 7)) - (53046.9642751875 * std::pow (x, 6)) + (17019.9518580080 * std::pow (x, 5)) - (3425.0836591318 * std::pow (x, 4)) + (404.2703938388 * std::pow (x, 3)) - (24.1878824391 * std::pow (x, 2)) + (0.6717417634 * x) + 0.0030115596;
             }
 
-            struct Lookup
+            inline Table<float> makeSineTable()
+            {
+                return makeTable<float> (-4 * k_2pi - 0.1f, 4 * k_2pi + 0.1f, 0.001f, [] (const float x) -> float
+                                         { return std::sin (x); });
+            }
+
+            inline Table<float> makePow2Table()
+            {
+                return makeTable<float> (-10.1f, 10.1f, 0.001f, [] (const float x) -> float
+                                         { return std::pow (2.0f, x); });
+            }
+
+            inline Table<float> makePow10Table()
+            {
+                return makeTable<float> (-10.1f, 10.1f, 0.001f, [] (const float x) -> float
+                                         { return std::pow (10.0f, x); });
+            }
+
+            inline Table<float> makeLog10Table()
+            {
+                return makeTable<float> (0.00001f, 10.1f, 0.001f, [] (const float x) -> float
+                                         { return std::log10 (x); });
+            }
+
+            inline Table<float> makeUnisonSpreadTable()
+            {
+                return makeTable<float> (0.0f, 1.1f, 0.01f, [] (const float x) -> float
+                                         { return unisonSpreadScalar (x); });
+            }
+
+            inline Table<float> makeHulaSineTable()
+            {
+                Random random;
+                return makeTable<float> (-4 * k_2pi - 0.1f, 4 * k_2pi + 0.1f, 0.001f, [&random] (const float x) -> float
+                                         { return std::sin (x) + (random.uniform() - 0.5f) * 1e-4f; });
+            }
+
+            template <typename T>
+            inline size_t sizeInBytes (const Table<T>& source)
+            {
+                return sizeof (Table<T>) + source.table.capacity() * sizeof (T);
+            }
+
+            /// Process wide registry of the shared lookup tables.
+            /// Each table is built on first use and is immutable afterwards.
+            /// The accessors are inline, so their function local statics are shared by
+            /// every translation unit in the plugin, and C++11 guarantees the
+            /// initialisation is thread safe.
+            struct Registry
             {
-                Lookup()
+                static const Table<float>& sine()
+                {
+                    static const Table<float> table = makeSineTable();
+                    return table;
+                }
+
+                static const Table<float>& pow2()
+                {
+                    static const Table<float> table = makePow2Table();
+                    return table;
+                }
+
+                static const Table<float>& pow10()
+                {
+                    static const Table<float> table = makePow10Table();
+                    return table;
+                }
+
+                static const Table<float>& log10()
+                {
+                    static const Table<float> table = makeLog10Table();
+                    return table;
+                }
+
+                static const Table<float>& unisonSpread()
+                {
+                    static const Table<float> table = makeUnisonSpreadTable();
+                    return table;
+                }
+
+                static const Table<float>& hulaSine()
                 {
-                    sineTable = sspo::AudioMath::LookupTable::makeTable<float> (-4 * k_2pi - 0.1f, 4 * k_2pi + 0.1f, 0.001f, [] (const float x) -> float
-                                                                                { return std::sin (x); });
-                    pow2Table = LookupTable::makeTable<float> (-10.1f, 10.1f, 0.001f, [] (const float x) -> float
-                                                               { return std::pow (2.0f, x); });
-                    pow10Table = LookupTable::makeTable<float> (-10.1f, 10.1f, 0.001f, [] (const float x) -> float
-                                                                { return std::pow (10.0f, x); });
-                    log10Table = LookupTable::makeTable<float> (0.00001f, 10.1f, 0.001f, [] (const float x) -> float
-                                                                { return std::log10 (x); });
-                    unisonSpreadTable = LookupTable::makeTable<float> (0.0f, 1.1f, 0.01f, [] (const float x) -> float
-                                                                       { return unisonSpreadScalar (x); });
-
-                    hulaSineTable = sspo::AudioMath::LookupTable::makeTable<float> (-4 * k_2pi - 0.1f, 4 * k_2pi + 0.1f, 0.001f, [] (const float x) -> float
-                                                                                    { return std::sin (x) + (rand01() - 0.5f) * 1e-4f; });
+                    static const Table<float> table = makeHulaSineTable();
+                    return table;
                 }
 
-                sspo::AudioMath::LookupTable::Table<float> sineTable;
-                sspo::AudioMath::LookupTable::Table<float> pow2Table;
-                sspo::AudioMath::LookupTable::Table<float> pow10Table;
-                sspo::AudioMath::LookupTable::Table<float> log10Table;
-                sspo::AudioMath::LookupTable::Table<float> unisonSpreadTable;
-                sspo::AudioMath::LookupTable::Table<float> hulaSineTable;
-
-                float sin (const float x) { return sspo::AudioMath::LookupTable::process (sineTable, x); }
-                float pow2 (const float x) { return sspo::AudioMath::LookupTable::process (pow2Table, x); }
-                float_4 pow2 (const float_4 x) { return sspo::AudioMath::LookupTable::process (pow2Table, x); }
-                float pow10 (const float x) { return sspo::AudioMath::LookupTable::process (pow10Table, x); }
-                float log10 (const float x) { return sspo::AudioMath::LookupTable::process (log10Table, x); }
-                float unisonSpread (const float x) { return sspo::AudioMath::LookupTable::process (unisonSpreadTable, x); }
-                float hulaSin (const float x) { return sspo::AudioMath::LookupTable::process (hulaSineTable, x); }
-                float_4 hulaSin4 (const float_4 x) { return sspo::AudioMath::LookupTable::process (hulaSineTable, x); }
+                /// forces every table to be built, returns the total memory used
+                static size_t buildAll()
+                {
+                    return sizeInBytes (sine())
+                           + sizeInBytes (pow2())
+                           + sizeInBytes (pow10())
+                           + sizeInBytes (log10())
+                           + sizeInBytes (unisonSpread())
+                           + sizeInBytes (hulaSine());
+                }
+            };
+
+            /// Stateless accessor for the shared tables, kept so call sites can use lookup.xxx()
+            struct Lookup
+            {
+                float sin (const float x) const { return process (Registry::sine(), x); }
+                float pow2 (const float x) const { return process (Registry::pow2(), x); }
+                float_4 pow2 (const float_4 x) const { return process (Registry::pow2(), x); }
+                float pow10 (const float x) const { return process (Registry::pow10(), x); }
+                float log10 (const float x) const { return process (Registry::log10(), x); }
+                float unisonSpread (const float x) const { return process (Registry::unisonSpread(), x); }
+                float_4 unisonSpread (const float_4 x) const { return process (Registry::unisonSpread(), x); }
+                float hulaSin (const float x) const { return process (Registry::hulaSine(), x); }
+                float_4 hulaSin4 (const float_4 x) const { return process (Registry::hulaSine(), x); }
             };
 
         } // namespace LookupTable
     } // namespace AudioMath
 } // namespace sspo
 
-static sspo::AudioMath::LookupTable::Lookup lookup;
\ No newline at end of file
+static const sspo::AudioMath::LookupTable::Lookup lookup{};
\ No newline at end of file
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2020 Dave French <contact/dot/dave/dot/french3/at/googlemail/dot/com>
+ *
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program (see COPYING); if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ *
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <cmath>
+#include <memory>
+
+#include "AudioMath.h"
+#include "CircularBuffer.h"
+#include "FractionalDelay.h"
+#include "Sanitize.h"
+
+/// A CircularBuffer whose last mirror samples are also written in front of its start
+///
+/// A read masks its index once, the older samples it needs then run on below it without
+/// wrapping, into the mirror if need be. So an interpolated read is one mask and
+/// contiguous loads, and block() hands out up to mirror + 1 samples in time order as a
+/// plain pointer. Each write near the end of the buffer is stored twice.
+///
+/// mirror must cover the widest read, 1 for linear and allpass, 3 for Lagrange, n - 1
+/// for a block of n.
+template <typename T, int mirror = 3>
+class MirroredCircularBuffer
+{
+public:
+    static constexpr int mirrorSamples = mirror;
+
+    MirroredCircularBuffer()
+    {
+        reset (4096);
+    }
+    MirroredCircularBuffer (const unsigned int minBufferSize)
+    {
+        reset (minBufferSize);
+    }
+
+    void reset (const unsigned int minBufferSize)
+    {
+        writeIndex = 0;
+        bufferLength = lengthFor (minBufferSize);
+        wrapBits = bufferLength - 1;
+        owned.reset (new T[bufferLength + mirror]);
+        buffer = owned.get() + mirror;
+        clear();
+    }
+
+    /// uses memory owned elsewhere, such as a DelayArena, length must be a power of 2 and
+    /// memory must hold length + mirrorSamples
+    void attach (T* memory, const unsigned int length)
+    {
+        assert ((length & (length - 1)) == 0 && "MirroredCircularBuffer length not a power of 2");
+        writeIndex = 0;
+        bufferLength = length;
+        wrapBits = bufferLength - 1;
+        owned.reset();
+        buffer = memory + mirror;
+        clear();
+    }
+
+    static unsigned int lengthFor (const unsigned int minBufferSize)
+    {
+        return CircularBuffer<float>::lengthFor (minBufferSize);
+    }
+
+    void clear()
+    {
+        for (auto i = -mirror; i < static_cast<int> (bufferLength); ++i)
+        {
+            buffer[i] = T (0);
+        }
+    }
+
+    inline void writeBuffer (const T newValue) noexcept
+    {
+        writeIndex++;
+        writeIndex &= wrapBits;
+        const auto value = sspo::delayLineValue (newValue);
+        buffer[writeIndex] = value;
+        if (writeIndex >= bufferLength - mirror)
+            buffer[static_cast<int> (writeIndex) - static_cast<int> (bufferLength)] = value;
+    }
+
+    inline T readBuffer (const int delaySamples) const noexcept
+    {
+        return buffer[(writeIndex - delaySamples) & wrapBits];
+    }
+
+    inline T readBuffer (const float delaySamples) const noexcept
+    {
+        const auto whole = static_cast<int> (delaySamples);
+        const auto* p = buffer + ((writeIndex - whole) & wrapBits);
+        return sspo::AudioMath::linearInterpolate (p[0], p[-1], T (delaySamples - whole));
+    }
+
+    /// third order Lagrange, as CircularBuffer::readLagrange
+    inline T readLagrange (const float delaySamples) const noexcept
+    {
+        static_assert (mirror >= 3, "Lagrange reads need a mirror of 3 samples");
+        const auto whole = static_cast<int> (delaySamples);
+        const auto* h = sspo::FractionalDelay::tables().lagrange[sspo::FractionalDelay::row (delaySamples - whole)];
+        const auto* p = buffer + ((writeIndex - whole + 1) & wrapBits);
+        return h[0] * p[0] + h[1] * p[-1] + h[2] * p[-2] + h[3] * p[-3];
+    }
+
+    /// first order Thiran allpass, as CircularBuffer::readAllpass
+    inline T readAllpass (const float delaySamples, T& state) const noexcept
+    {
+        const auto shifted = delaySamples - 0.5f;
+        const auto whole = static_cast<int> (shifted);
+        const auto eta = sspo::FractionalDelay::tables().thiran[sspo::FractionalDelay::row (shifted - whole)];
+        const auto* p = buffer + ((writeIndex - whole) & wrapBits);
+        state = eta * (p[0] - state) + p[-1];
+        return state;
+    }
+
+    /// the read a sspo::Interpolation selects, state is only used by the allpass
+    inline T read (const float delaySamples, const int interpolation, T& state) const noexcept
+    {
+        switch (interpolation)
+        {
+            case sspo::LAGRANGE_INTERPOLATION:
+                return readLagrange (delaySamples);
+            case sspo::ALLPASS_INTERPOLATION:
+                return readAllpass (delaySamples, state);
+            default:
+                return readBuffer (delaySamples);
+        }
+    }
+
+    /// n samples in time order, the last of them delaySamples old, n at most mirrorSamples + 1
+    inline const T* block (const int delaySamples, const int n) const noexcept
+    {
+        assert (n <= mirror + 1);
+        return buffer + ((writeIndex - delaySamples) & wrapBits) - (n - 1);
+    }
+
+    int size()
+    {
+        return static_cast<int> (bufferLength);
+    }
+
+private:
+    std::unique_ptr<T[]> owned{ nullptr };
+    T* buffer{ nullptr };
+    unsigned int writeIndex{ 0 };
+    unsigned int bufferLength{ 0 };
+    unsigned int wrapBits{ 0 };
+};
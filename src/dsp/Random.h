@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2020 Dave French <contact/dot/dave/dot/french3/at/googlemail/dot/com>
+ *
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program (see COPYING); if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+
+#include "AudioMath.h"
+#include "simd/functions.hpp"
+#include "simd/sse_mathfun.h"
+#include "simd/sse_mathfun_extension.h"
+
+namespace sspo
+{
+    using float_4 = rack::simd::float_4;
+
+    /// xoroshiro128+ random numbers, each instance has its own state
+    /// four independent generators, one per float_4 lane, so a float_4 costs one step of
+    /// each, the scalar calls hand out a float_4 block one lane at a time
+    class Random
+    {
+    public:
+        explicit Random (const uint64_t s = uniqueSeed())
+        {
+            seed (s);
+        }
+
+        /// fills the lane states from s with splitmix64, never all zero
+        void seed (uint64_t s)
+        {
+            for (auto i = 0; i < lanes; ++i)
+            {
+                s0[i] = splitmix64 (s);
+                s1[i] = splitmix64 (s);
+            }
+            next = lanes;
+        }
+
+        /// time based, different for every call, for instances that should not match
+        static uint64_t uniqueSeed()
+        {
+            static std::atomic<uint64_t> counter{ 0 };
+            return static_cast<uint64_t> (time (nullptr)) ^ (0x9E3779B97F4A7C15ULL * ++counter);
+        }
+
+        /// [0, 1)
+        float_4 uniform4()
+        {
+            int32_t bits[lanes];
+            for (auto i = 0; i < lanes; ++i)
+            {
+                const auto result = s0[i] + s1[i];
+                const auto x = s1[i] ^ s0[i];
+                s0[i] = rotl (s0[i], 55) ^ x ^ (x << 14);
+                s1[i] = rotl (x, 36);
+                // the top 24 bits, the most a float in [0, 1) can hold
+                bits[i] = static_cast<int32_t> (result >> 40);
+            }
+            return float_4 (bits[0], bits[1], bits[2], bits[3]) * (1.0f / 16777216.0f);
+        }
+
+        /// [-1, 1)
+        float_4 bipolar4()
+        {
+            return uniform4() * 2.0f - 1.0f;
+        }
+
+        /// mean 0, standard deviation 1, Box-Muller
+        float_4 gaussian4()
+        {
+            const auto radius = rack::simd::sqrt (-2.0f * rack::simd::log (1.0f - uniform4()));
+            const auto theta = AudioMath::k_2pi * uniform4();
+            return radius * rack::simd::sin (theta);
+        }
+
+        /// [0, 1)
+        float uniform()
+        {
+            if (next == lanes)
+            {
+                block = uniform4();
+                next = 0;
+            }
+            return block[next++];
+        }
+
+        /// [-1, 1)
+        float bipolar()
+        {
+            return uniform() * 2.0f - 1.0f;
+        }
+
+        /// mean 0, standard deviation 1, Box-Muller
+        float gaussian()
+        {
+            const auto radius = std::sqrt (-2.0f * std::log (1.0f - uniform()));
+            return radius * std::sin (AudioMath::k_2pi * uniform());
+        }
+
+    private:
+        static constexpr int lanes = 4;
+
+        static uint64_t rotl (const uint64_t x, const int k)
+        {
+            return (x << k) | (x >> (64 - k));
+        }
+
+        static uint64_t splitmix64 (uint64_t& s)
+        {
+            auto z = (s += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+
+        uint64_t s0[lanes];
+        uint64_t s1[lanes];
+        float_4 block;
+        int next = lanes;
+    };
+} // namespace sspo
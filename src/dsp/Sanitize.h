@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2020 Dave French <contact/dot/dave/dot/french3/at/googlemail/dot/com>
+ *
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program (see COPYING); if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ *
+ */
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE__) || defined(__x86_64__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define SSPO_HAS_MXCSR 1
+#else
+#define SSPO_HAS_MXCSR 0
+#endif
+
+#include "simd/functions.hpp"
+#include "simd/sse_mathfun.h"
+#include "simd/sse_mathfun_extension.h"
+
+/**
+ * How the plugin keeps NaN, infinity and denormals out of its signals
+ *
+ * The audio thread runs with flush to zero and denormals are zero, Rack's engine sets
+ * them on its threads, ScopedFlushDenormals does the same for the tests and perf runs.
+ * A composite scrubs each float_4 group once, where it leaves the composite or enters a
+ * feedback loop, and delay line writes are plain stores.
+ *
+ * SSPO_STRICT_FINITE also checks every delay line write, as the buffers always used to.
+ * It is on for the test build, so a non finite value is caught where it is written,
+ * define it as 0 or 1 to override.
+ */
+#ifndef SSPO_STRICT_FINITE
+#ifdef _TESTEX
+#define SSPO_STRICT_FINITE 1
+#else
+#define SSPO_STRICT_FINITE 0
+#endif
+#endif
+
+namespace sspo
+{
+    /// NaN and infinity become 0
+    inline float scrub (const float x) noexcept
+    {
+        return std::abs (x) < std::numeric_limits<float>::infinity() ? x : 0.0f;
+    }
+
+    /// per lane, NaN and infinity become 0, branch free
+    inline rack::simd::float_4 scrub (const rack::simd::float_4 x) noexcept
+    {
+        const auto finite = rack::simd::abs (x) < rack::simd::float_4 (std::numeric_limits<float>::infinity());
+        return rack::simd::ifelse (finite, x, rack::simd::float_4::zero());
+    }
+
+    /// the value a delay line stores, only checked with SSPO_STRICT_FINITE
+    template <typename T>
+    inline T delayLineValue (const T x) noexcept
+    {
+#if SSPO_STRICT_FINITE
+        return std::isnan (x) || std::isinf (x) ? T (0) : x;
+#else
+        return x;
+#endif
+    }
+
+    inline rack::simd::float_4 delayLineValue (const rack::simd::float_4 x) noexcept
+    {
+#if SSPO_STRICT_FINITE
+        return scrub (x);
+#else
+        return x;
+#endif
+    }
+
+    /// flush to zero and denormals are zero on this thread, as Rack runs its engine
+    /// threads, the previous mode is put back when it goes out of scope
+    class ScopedFlushDenormals
+    {
+    public:
+        ScopedFlushDenormals()
+        {
+#if SSPO_HAS_MXCSR
+            previous = _mm_getcsr();
+            _mm_setcsr (previous | flushToZero | denormalsAreZero);
+#endif
+        }
+
+        ~ScopedFlushDenormals()
+        {
+#if SSPO_HAS_MXCSR
+            _mm_setcsr (previous);
+#endif
+        }
+
+        ScopedFlushDenormals (const ScopedFlushDenormals&) = delete;
+        ScopedFlushDenormals& operator= (const ScopedFlushDenormals&) = delete;
+
+    private:
+        static constexpr unsigned int flushToZero = 0x8000;
+        static constexpr unsigned int denormalsAreZero = 0x0040;
+        unsigned int previous = 0;
+    };
+} // namespace sspo
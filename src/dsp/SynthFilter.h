@@ -29,6 +29,7 @@
 #include <functional>
 #include "AudioMath.h"
 #include "UtilityFilters.h"
+#include "WaveShaper.h"
 //#include "simd/vector.hpp"
 #include "simd/functions.hpp"
 #include "simd/sse_mathfun.h"
@@ -137,6 +138,18 @@ namespace sspo
                 return hp;
         }
 
+        /// process for a filter that is always LPF1, as the ladder stages are. Without the
+        /// type dispatch it is small enough that the compiler inlines it into the ladder
+        T processLowPass (const T in)
+        {
+            auto xn = in * preGain + feedback + feedbackOut * getFeedbackOut();
+            auto vn = (inputGain * xn - z1) * feedforward;
+
+            auto lp = vn + z1;
+            z1 = vn + lp;
+            return lp;
+        }
+
         void setParameters (const T newCutoff, const T newQ, const T newAux, const float newSampleRate)
         {
             SynthFilter<T>::cutoff = newCutoff;
@@ -146,6 +159,15 @@ namespace sspo
             calcCoeffs();
         }
 
+        /// as setParameters, with tanPi (cutoff / sample rate) already worked out by the
+        /// ladder, which shares it between its stages
+        void setPrewarped (const T newCutoff, const T prewarped, const float newSampleRate)
+        {
+            SynthFilter<T>::cutoff = newCutoff;
+            SynthFilter<T>::sampleRate = newSampleRate;
+            feedforward = prewarped / (1.0f + prewarped);
+        }
+
         void setType (typename SynthFilter<T>::Type newType)
         {
             SynthFilter<T>::type = newType;
@@ -160,11 +182,7 @@ namespace sspo
     private:
         void calcCoeffs()
         {
-            auto wd = AudioMath::k_2pi * SynthFilter<T>::cutoff;
-            auto T1 = 1.0f / SynthFilter<T>::sampleRate;
-            auto wa = (2 / T1) * rack::simd::tan (wd * T1 / 2);
-            auto g = wa * T1 / 2;
-
+            auto g = AudioMath::tanPi (SynthFilter<T>::cutoff / SynthFilter<T>::sampleRate);
             feedforward = g / (1.0f + g);
         }
 
@@ -178,7 +196,67 @@ namespace sspo
         T z1{ 0.0f };
     };
 
-    template <typename T>
+    /// MoogLadderFilter saturation policies, process (in, drive) is resolved at compile time
+    /// so it inlines into the ladder
+
+    /// std::tanh, lane by lane for simd as there is no vector tanh
+    struct TanhPolicy
+    {
+        static float process (const float in, const float drive)
+        {
+            return std::tanh (in * drive);
+        }
+
+        static rack::simd::float_4 process (const rack::simd::float_4 in, const rack::simd::float_4 drive)
+        {
+            const auto x = in * drive;
+            return rack::simd::float_4 (std::tanh (x[0]), std::tanh (x[1]), std::tanh (x[2]), std::tanh (x[3]));
+        }
+    };
+
+    /// AudioMath::fastTanh, clamped to +-3 where it reaches +-1
+    struct FastTanhPolicy
+    {
+        template <typename T>
+        static T process (const T in, const T drive)
+        {
+            const auto x = rack::simd::fmin (rack::simd::fmax (in * drive, T (-3.0f)), T (3.0f));
+            return AudioMath::fastTanh (x);
+        }
+    };
+
+    /// atan normalised so the drive does not change the level at 1
+    struct AtanPolicy
+    {
+        static float process (const float in, const float drive)
+        {
+            return std::atan (drive * in) / std::atan (drive);
+        }
+
+        static rack::simd::float_4 process (const rack::simd::float_4 in, const rack::simd::float_4 drive)
+        {
+            return rack::simd::atan (drive * in) / rack::simd::atan (drive);
+        }
+    };
+
+    /// one of the Nld tables, shape is its index in WaveShaper::nld()
+    template <int shape>
+    struct NldPolicy
+    {
+        static float process (const float in, const float drive)
+        {
+            namespace ws = AudioMath::WaveShaper;
+            const auto x = std::min (std::max (in * drive, ws::minValue), ws::maxValue - ws::interval);
+            return ws::nld().process (x, shape);
+        }
+
+        static rack::simd::float_4 process (const rack::simd::float_4 in, const rack::simd::float_4 drive)
+        {
+            return AudioMath::WaveShaper::nld().process (in * drive, shape);
+        }
+    };
+
+    template <typename T, typename NonLinear = TanhPolicy>
     class MoogLadderFilter : public SynthFilter<T>
     {
     public:
@@ -199,7 +277,7 @@ namespace sspo
             lpf3.setType (SynthFilter<T>::Type::LPF1);
             lpf4.setType (SynthFilter<T>::Type::LPF1);
 
-            SynthFilter<T>::type = SynthFilter<T>::Type::LPF4;
+            setType (SynthFilter<T>::Type::LPF4);
 
             reset();
         }
@@ -221,18 +299,18 @@ namespace sspo
             SynthFilter<T>::Q = newQ;
             SynthFilter<T>::sampleRate = newSampleRate;
             SynthFilter<T>::saturation = newSaturation;
-            lpf1.setParameters (SynthFilter<T>::cutoff, 0, 0, SynthFilter<T>::sampleRate);
-            lpf2.setParameters (SynthFilter<T>::cutoff, 0, 0, SynthFilter<T>::sampleRate);
-            lpf3.setParameters (SynthFilter<T>::cutoff, 0, 0, SynthFilter<T>::sampleRate);
-            lpf4.setParameters (SynthFilter<T>::cutoff, 0, 0, SynthFilter<T>::sampleRate);
+
+            // one prewarp for the ladder and all four of its stages
+            prewarped = AudioMath::tanPi (SynthFilter<T>::cutoff / SynthFilter<T>::sampleRate);
+            lpf1.setPrewarped (SynthFilter<T>::cutoff, prewarped, SynthFilter<T>::sampleRate);
+            lpf2.setPrewarped (SynthFilter<T>::cutoff, prewarped, SynthFilter<T>::sampleRate);
+            lpf3.setPrewarped (SynthFilter<T>::cutoff, prewarped, SynthFilter<T>::sampleRate);
+            lpf4.setPrewarped (SynthFilter<T>::cutoff, prewarped, SynthFilter<T>::sampleRate);
 
             K = (4.0f) * (SynthFilter<T>::Q - 1.0f) / (10.0f - 1.0f);
             calcCoeffs();
         }
 
-        //this must be defined in the module, normally as a lambda
-        std::function<T (T in, T drive)> nonLinearProcess;
-
         T process (const T in)
         {
             if (SynthFilter<T>::type == SynthFilter<T>::Type::BSF2
@@ -253,19 +331,19 @@ namespace sspo
                 {
                     upsampler.process (U, oversampleBuffer);
                     for (auto i = 0; i < oversampleRate; ++i)
-                        oversampleBuffer[i] = nonLinearProcess (U, SynthFilter<T>::saturation);
+                        oversampleBuffer[i] = NonLinear::process (U, SynthFilter<T>::saturation);
                     U = decimator.process (oversampleBuffer);
                 }
                 else
                 {
-                    U = nonLinearProcess (U, SynthFilter<T>::saturation);
+                    U = NonLinear::process (U, SynthFilter<T>::saturation);
                 }
             }
 
-            auto f1 = lpf1.process (U);
-            auto f2 = lpf2.process (f1);
-            auto f3 = lpf3.process (f2);
-            auto f4 = lpf4.process (f3);
+            auto f1 = lpf1.processLowPass (U);
+            auto f2 = lpf2.processLowPass (f1);
+            auto f3 = lpf3.processLowPass (f2);
+            auto f4 = lpf4.processLowPass (f3);
 
             return typeCoeffs.A * U
                    + typeCoeffs.B * f1
@@ -277,9 +355,25 @@ namespace sspo
         void setType (typename SynthFilter<T>::Type newType)
         {
             SynthFilter<T>::type = newType;
+            float mix[mixSize];
+            getMix (newType, mix);
+            typeCoeffs = { T (mix[0]), T (mix[1]), T (mix[2]), T (mix[3]), T (mix[4]) };
             calcCoeffs();
         }
 
+        /// the mode of a single simd lane, the other lanes keep theirs.
+        /// setType sets every lane
+        void setLaneType (const int lane, typename SynthFilter<T>::Type newType)
+        {
+            float mix[mixSize];
+            getMix (newType, mix);
+            typeCoeffs.A[lane] = mix[0];
+            typeCoeffs.B[lane] = mix[1];
+            typeCoeffs.C[lane] = mix[2];
+            typeCoeffs.D[lane] = mix[3];
+            typeCoeffs.E[lane] = mix[4];
+        }
+
         void reset()
         {
             lpf1.reset();
@@ -313,11 +407,7 @@ namespace sspo
 
         void calcCoeffs()
         {
-            auto wd = AudioMath::k_2pi * SynthFilter<T>::cutoff;
-            auto T1 = 1.0f / static_cast<float> (SynthFilter<T>::sampleRate);
-            auto wa = (2 / T1) * tan (wd * T1 / 2);
-            auto g = wa * T1 / 2;
-
+            const auto g = prewarped;
             auto G = g / (1.0f + g);
 
             lpf1.setFeedForward (G);
@@ -332,33 +422,45 @@ namespace sspo
 
             gamma = G * G * G * G;
             alpha = 1.0f / (1.0f + K * gamma);
+        }
+
+        static constexpr int mixSize = 5;
 
-            switch (SynthFilter<T>::type)
+        /// the Oberheim Xpander mix of the input and the four stage outputs for a type
+        static void getMix (typename SynthFilter<T>::Type type, float* mix)
+        {
+            switch (type)
             {
-                case SynthFilter<T>::Type::LPF4:
-                    typeCoeffs = { T (0.0f), T (0.0f), T (0.0f), T (0.0f), T (1.0f) };
-                    break;
                 case SynthFilter<T>::Type::LPF2:
-                    typeCoeffs = { T (0.0f), T (0.0f), T (1.0f), T (0.0f), T (0.0f) };
+                    setMix (mix, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
                     break;
                 case SynthFilter<T>::Type::BPF4:
-                    typeCoeffs = { T (0.0f), T (0.0f), T (4.0f), T (-8.0f), T (4.0f) };
+                    setMix (mix, 0.0f, 0.0f, 4.0f, -8.0f, 4.0f);
                     break;
                 case SynthFilter<T>::Type::BPF2:
-                    typeCoeffs = { T (0.0f), T (2.0f), T (-2.0f), T (0.0f), T (0.0f) };
+                    setMix (mix, 0.0f, 2.0f, -2.0f, 0.0f, 0.0f);
                     break;
                 case SynthFilter<T>::Type::HPF4:
-                    typeCoeffs = { T (1.0f), T (-4.0f), T (6.0f), T (-4.0f), T (1.0f) };
+                    setMix (mix, 1.0f, -4.0f, 6.0f, -4.0f, 1.0f);
                     break;
                 case SynthFilter<T>::Type::HPF2:
-                    typeCoeffs = { T (1.0f), T (-2.0f), T (1.0f), T (0.0f), T (0.0f) };
+                    setMix (mix, 1.0f, -2.0f, 1.0f, 0.0f, 0.0f);
                     break;
                 default: //lpf4
-                    typeCoeffs = { T (0.0f), T (0.0f), T (0.0f), T (0.0f), T (1.0f) };
+                    setMix (mix, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
                     break;
             }
         }
 
+        static void setMix (float* mix, const float a, const float b, const float c, const float d, const float e)
+        {
+            mix[0] = a;
+            mix[1] = b;
+            mix[2] = c;
+            mix[3] = d;
+            mix[4] = e;
+        }
+
         OnePoleFilter<T> lpf1{};
         OnePoleFilter<T> lpf2{};
         OnePoleFilter<T> lpf3{};
@@ -367,6 +469,7 @@ namespace sspo
         T K{ 0.0f };
         T gamma{ 0.0f };
         T alpha{ 1.0f };
+        T prewarped{ 0.0f };
 
         static constexpr int oversampleRate = 4;
         sspo::Upsampler<oversampleRate, 1, T> upsampler;
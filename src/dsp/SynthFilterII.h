@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <functional>
@@ -142,6 +143,15 @@ namespace sspo
                 calcCoeffs();
             }
 
+            /// as setParameters, with tanPi (cutoff / sample rate) already worked out by the
+            /// ladder, which shares it between its stages
+            void setPrewarped (const T newCutoff, const T prewarped, const float newSampleRate)
+            {
+                SynthFilter<T>::cutoff = newCutoff;
+                SynthFilter<T>::sampleRate = newSampleRate;
+                feedforward = prewarped / (1.0f + prewarped);
+            }
+
             void setSampleRate (float sr)
             {
                 SynthFilter<T>::sampleRate = sr;
@@ -162,11 +172,7 @@ namespace sspo
         private:
             void calcCoeffs()
             {
-                auto wd = AudioMath::k_2pi * SynthFilter<T>::cutoff;
-                auto T1 = 1.0f / SynthFilter<T>::sampleRate;
-                auto wa = (2 / T1) * rack::simd::tan (wd * T1 / 2);
-                auto g = wa * T1 / 2;
-
+                auto g = AudioMath::tanPi (SynthFilter<T>::cutoff / SynthFilter<T>::sampleRate);
                 feedforward = g / (1.0f + g);
             }
 
@@ -180,6 +186,30 @@ namespace sspo
             T z1{ 0.0f };
         };
 
+        /// ladder stage shaping policies, chosen per stage at compile time.
+        /// a linear stage is an identity, so it compiles away entirely
+        struct LinearStage
+        {
+            template <typename T>
+            static T process (const T x, const WaveShaper::Table*)
+            {
+                return x;
+            }
+        };
+
+        /// a table nld stage, matches Nld::process for the same table
+        struct NldStage
+        {
+            template <typename T>
+            static T process (const T x, const WaveShaper::Table* table)
+            {
+                return WaveShaper::process (table,
+                                            rack::simd::clamp (x,
+                                                               T (WaveShaper::minValue),
+                                                               T (WaveShaper::maxShapedInput)));
+            }
+        };
+
         template <typename T>
         class LadderFilter : public SynthFilter<T>
         {
@@ -198,6 +228,7 @@ namespace sspo
                 lpf2.setSampleRate (sr);
                 lpf3.setSampleRate (sr);
                 lpf4.setSampleRate (sr);
+                prewarped = AudioMath::tanPi (SynthFilter<T>::cutoff / SynthFilter<T>::sampleRate);
                 //                calcCoeffs();
             }
 
@@ -209,22 +240,39 @@ namespace sspo
                 SynthFilter<T>::Q = newQ;
                 SynthFilter<T>::saturation = newSaturation;
 
-                lpf1.setParameters (SynthFilter<T>::cutoff, 0, 0, SynthFilter<T>::sampleRate);
-                lpf2.setParameters (SynthFilter<T>::cutoff, 0, 0, SynthFilter<T>::sampleRate);
-                lpf3.setParameters (SynthFilter<T>::cutoff, 0, 0, SynthFilter<T>::sampleRate);
-                lpf4.setParameters (SynthFilter<T>::cutoff, 0, 0, SynthFilter<T>::sampleRate);
+                // one prewarp for the ladder and all four of its stages
+                prewarped = AudioMath::tanPi (SynthFilter<T>::cutoff / SynthFilter<T>::sampleRate);
+                lpf1.setPrewarped (SynthFilter<T>::cutoff, prewarped, SynthFilter<T>::sampleRate);
+                lpf2.setPrewarped (SynthFilter<T>::cutoff, prewarped, SynthFilter<T>::sampleRate);
+                lpf3.setPrewarped (SynthFilter<T>::cutoff, prewarped, SynthFilter<T>::sampleRate);
+                lpf4.setPrewarped (SynthFilter<T>::cutoff, prewarped, SynthFilter<T>::sampleRate);
 
                 calcCoeffs();
             }
 
+            /// selects the precompiled ladder for these types, only when they change,
+            /// type 0 is linear
             void setNldTypes (int inNld, int resNld, int s1, int s2, int s3, int s4)
             {
+                const auto lastType = static_cast<int> (WaveShaper::nld().size()) - 1;
+                auto clampType = [lastType] (const int type) { return std::min (std::max (type, 0), lastType); };
+                inNld = clampType (inNld);
+                const int types[shapedStages] = { clampType (resNld),
+                                                  clampType (s1),
+                                                  clampType (s2),
+                                                  clampType (s3),
+                                                  clampType (s4) };
+                if (inNld == inNldType && std::equal (types, types + shapedStages, stageTypes))
+                    return;
+
                 inNldType = inNld;
-                resNldType = resNld;
-                s1Stype = s1;
-                s2Stype = s2;
-                s3Stype = s3;
-                s4Stype = s4;
+                inTable = WaveShaper::nld().getTable (inNld);
+                for (auto i = 0; i < shapedStages; ++i)
+                {
+                    stageTypes[i] = types[i];
+                    stageTables[i] = WaveShaper::nld().getTable (types[i]);
+                }
+                shapedBlock = StageSelector<shapedStages>::select (stageTypes);
             }
 
             void setFcQSat (const T newCutoff1,
@@ -238,7 +286,9 @@ namespace sspo
                 SynthFilter<T>::Q = newQ;
                 SynthFilter<T>::saturation = newSaturation;
 
-                lpf1.setParameters (newCutoff1, 0, 0, SynthFilter<T>::sampleRate);
+                // the ladder's own coefficients share the first stage's prewarp
+                prewarped = AudioMath::tanPi (newCutoff1 / SynthFilter<T>::sampleRate);
+                lpf1.setPrewarped (newCutoff1, prewarped, SynthFilter<T>::sampleRate);
                 lpf2.setParameters (newCutoff2, 0, 0, SynthFilter<T>::sampleRate);
                 lpf3.setParameters (newCutoff3, 0, 0, SynthFilter<T>::sampleRate);
                 lpf4.setParameters (newCutoff4, 0, 0, SynthFilter<T>::sampleRate);
@@ -267,46 +317,39 @@ namespace sspo
                 SynthFilter<T>::Q = newQ;
                 SynthFilter<T>::sampleRate = newSampleRate;
                 SynthFilter<T>::saturation = newSaturation;
-                lpf1.setParameters (SynthFilter<T>::cutoff, 0, 0, SynthFilter<T>::sampleRate);
-                lpf2.setParameters (SynthFilter<T>::cutoff, 0, 0, SynthFilter<T>::sampleRate);
-                lpf3.setParameters (SynthFilter<T>::cutoff, 0, 0, SynthFilter<T>::sampleRate);
-                lpf4.setParameters (SynthFilter<T>::cutoff, 0, 0, SynthFilter<T>::sampleRate);
+
+                prewarped = AudioMath::tanPi (SynthFilter<T>::cutoff / SynthFilter<T>::sampleRate);
+                lpf1.setPrewarped (SynthFilter<T>::cutoff, prewarped, SynthFilter<T>::sampleRate);
+                lpf2.setPrewarped (SynthFilter<T>::cutoff, prewarped, SynthFilter<T>::sampleRate);
+                lpf3.setPrewarped (SynthFilter<T>::cutoff, prewarped, SynthFilter<T>::sampleRate);
+                lpf4.setPrewarped (SynthFilter<T>::cutoff, prewarped, SynthFilter<T>::sampleRate);
 
                 calcCoeffs();
             }
 
-            //this must be defined in the module, normally as a lambda
-            std::function<T (T in, T drive)> nonLinearProcess;
-
             T process (const T in)
             {
-                auto sigma = lpf1.getFeedbackOut()
-                             + lpf2.getFeedbackOut()
-                             + lpf3.getFeedbackOut()
-                             + lpf4.getFeedbackOut();
-                sigma *= K;
-                sigma = linearInterpolate (sigma, z1, T (feedbackPathCrossfade));
-                WaveShaper::nld.process (sigma, sigma, resNldType);
-                T xn;
-                WaveShaper::nld.process (xn, in, inNldType);
-                xn *= 1.0f + SynthFilter<T>::aux * K;
-                auto U = (xn - sigma) * alpha;
-                WaveShaper::nld.process (U, U, s1Stype);
-                auto f1 = lpf1.process (U);
-                WaveShaper::nld.process (f1, f1, s2Stype);
-                auto f2 = lpf2.process (f1);
-                WaveShaper::nld.process (f2, f2, s3Stype);
-                auto f3 = lpf3.process (f2);
-                WaveShaper::nld.process (f3, f3, s4Stype);
-                auto f4 = lpf4.process (f3);
+                T out;
+                processBlock (&in, &out, 1);
+                return out;
+            }
 
-                z1 = typeCoeffs.A * U
-                     + typeCoeffs.B * f1
-                     + typeCoeffs.C * f2
-                     + typeCoeffs.D * f3
-                     + typeCoeffs.E * f4;
+            /// processes a block, such as an oversample buffer, with the ladder selected by setNldTypes.
+            /// the input nld is outside the feedback loop, so is applied to the whole block first,
+            /// in and out may be the same buffer
+            void processBlock (const T* in, T* out, const int n)
+            {
+                applyInputNld (in, out, n);
+                (this->*shapedBlock) (out, n);
+            }
 
-                return z1;
+            /// the ladder with the stage shaping fixed at compile time, resonance then stages 1 to 4.
+            /// the tables are still those set by setNldTypes
+            template <typename Res, typename S1, typename S2, typename S3, typename S4>
+            void processBlock (const T* in, T* out, const int n)
+            {
+                applyInputNld (in, out, n);
+                processShapedBlock<Res, S1, S2, S3, S4> (out, n);
             }
 
             void setCoeffs (T a, T b, T c, T d, T e)
@@ -332,6 +375,78 @@ namespace sspo
             }
 
         private:
+            static constexpr int shapedStages = 5;
+            using ShapedBlock = void (LadderFilter::*) (T*, int);
+
+            /// picks the instantiation one stage at a time, linear for type 0
+            template <int remaining, typename... Chosen>
+            struct StageSelector
+            {
+                static ShapedBlock select (const int* types)
+                {
+                    return *types == 0
+                               ? StageSelector<remaining - 1, Chosen..., LinearStage>::select (types + 1)
+                               : StageSelector<remaining - 1, Chosen..., NldStage>::select (types + 1);
+                }
+            };
+
+            template <typename... Chosen>
+            struct StageSelector<0, Chosen...>
+            {
+                static ShapedBlock select (const int*)
+                {
+                    return &LadderFilter::template processShapedBlock<Chosen...>;
+                }
+            };
+
+            void applyInputNld (const T* in, T* out, const int n)
+            {
+                if (inNldType == 0)
+                {
+                    if (in != out)
+                        std::copy (in, in + n, out);
+                    return;
+                }
+                const auto low = T (WaveShaper::minValue);
+                const auto high = T (WaveShaper::maxShapedInput);
+                for (auto i = 0; i < n; ++i)
+                    out[i] = WaveShaper::process (inTable, rack::simd::clamp (in[i], low, high));
+            }
+
+            template <typename Res, typename S1, typename S2, typename S3, typename S4>
+            void processShapedBlock (T* buffer, const int n)
+            {
+                for (auto i = 0; i < n; ++i)
+                    buffer[i] = processShaped<Res, S1, S2, S3, S4> (buffer[i]);
+            }
+
+            // process with the input nld already applied
+            template <typename Res, typename S1, typename S2, typename S3, typename S4>
+            T processShaped (T xn)
+            {
+                auto sigma = lpf1.getFeedbackOut()
+                             + lpf2.getFeedbackOut()
+                             + lpf3.getFeedbackOut()
+                             + lpf4.getFeedbackOut();
+                sigma *= K;
+                sigma = linearInterpolate (sigma, z1, T (feedbackPathCrossfade));
+                sigma = Res::process (sigma, stageTables[0]);
+                xn *= 1.0f + SynthFilter<T>::aux * K;
+                auto U = S1::process ((xn - sigma) * alpha, stageTables[1]);
+                auto f1 = S2::process (lpf1.process (U), stageTables[2]);
+                auto f2 = S3::process (lpf2.process (f1), stageTables[3]);
+                auto f3 = S4::process (lpf3.process (f2), stageTables[4]);
+                auto f4 = lpf4.process (f3);
+
+                z1 = typeCoeffs.A * U
+                     + typeCoeffs.B * f1
+                     + typeCoeffs.C * f2
+                     + typeCoeffs.D * f3
+                     + typeCoeffs.E * f4;
+
+                return z1;
+            }
+
             struct OberheimXpander
             {
                 OberheimXpander()
@@ -356,11 +471,7 @@ namespace sspo
 
             void calcCoeffs()
             {
-                auto wd = AudioMath::k_2pi * SynthFilter<T>::cutoff;
-                auto T1 = 1.0f / static_cast<float> (SynthFilter<T>::sampleRate);
-                auto wa = (2 / T1) * tan (wd * T1 / 2);
-                auto g = wa * T1 / 2;
-
+                const auto g = prewarped;
                 auto G = g / (1.0f + g);
 
                 //                lpf1.setFeedForward (G);
@@ -384,16 +495,24 @@ namespace sspo
             OnePoleFilter<T> lpf3{};
             OnePoleFilter<T> lpf4{};
 
-            int resNldType{ 0 };
             int inNldType{ 0 };
-            int s1Stype{ 0 };
-            int s2Stype{ 0 };
-            int s3Stype{ 0 };
-            int s4Stype{ 0 };
+            const WaveShaper::Table* inTable{ WaveShaper::nld().getTable (0) };
+            int stageTypes[shapedStages]{ 0, 0, 0, 0, 0 };
+            const WaveShaper::Table* stageTables[shapedStages]{ WaveShaper::nld().getTable (0),
+                                                               WaveShaper::nld().getTable (0),
+                                                               WaveShaper::nld().getTable (0),
+                                                               WaveShaper::nld().getTable (0),
+                                                               WaveShaper::nld().getTable (0) };
+            ShapedBlock shapedBlock{ &LadderFilter::template processShapedBlock<LinearStage,
+                                                                                LinearStage,
+                                                                                LinearStage,
+                                                                                LinearStage,
+                                                                                LinearStage> };
 
             T K{ 0.0f };
             T gamma{ 0.0f };
             T alpha{ 1.0f };
+            T prewarped{ 0.0f };
             T z1{ 0.0f };
 
             float feedbackPathCrossfade{ 0 };
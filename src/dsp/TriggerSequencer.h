@@ -26,6 +26,7 @@
 #include <ctime>
 #include "asserts.h"
 #include "AudioMath.h"
+#include "Random.h"
 #include "common.hpp"
 #include "math.hpp"
 
@@ -101,6 +102,7 @@ namespace sspo
         float primaryProbability = 1.0f;
         float altProbability = 1.0f;
         int index = -1;
+        Random random;
     };
 
     template <int MAX_LENGTH>
@@ -117,7 +119,7 @@ namespace sspo
             {
                 if (primaryProbability <= 2.0f)
                 {
-                    if (primaryProbability >= rand01())
+                    if (primaryProbability >= random.uniform())
                         primaryState = true;
                 }
             }
@@ -125,10 +127,10 @@ namespace sspo
             {
                 if (primaryProbability > 1.0f)
                 {
-                    if (primaryProbability - 1.0 >= rand01())
+                    if (primaryProbability - 1.0 >= random.uniform())
                         primaryState = true;
                 }
-                if (! primaryState && altProbability > rand01())
+                if (! primaryState && altProbability > random.uniform())
                     altState = true;
             }
             return ret;
@@ -161,7 +163,6 @@ namespace sspo
     TriggerSequencer<MAX_LENGTH>::TriggerSequencer()
     {
         reset();
-        defaultGenerator.seed (time (0));
     }
 
     template <int MAX_LENGTH>
@@ -26,6 +26,7 @@
 //#include "simd/vector.hpp"
 #include "simd/sse_mathfun_extension.h"
 #include "simd/sse_mathfun.h"
+#include <algorithm>
 
 using float_4 = rack::simd::float_4;
 
@@ -86,7 +87,7 @@ namespace sspo
         void setButterworthLp2 (const T sr, const T freq)
         {
             T fc = rack::simd::ifelse (freq < sr * 0.5f, freq, freq * 0.95f);
-            auto C = 1.0f / rack::simd::tan ((k_pi * fc) / sr);
+            auto C = 1.0f / tanPi (fc / sr);
             auto a0 = 1.0f / (1.0f + 1.414213562f * C + C * C);
 
             setCoeffs (a0,
@@ -99,7 +100,7 @@ namespace sspo
         void setButterworthHp2 (const T sr, const T freq)
         {
             T fc = rack::simd::ifelse (freq < sr * 0.5f, freq, freq * 0.95f);
-            auto C = rack::simd::tan ((k_pi * fc) / sr);
+            auto C = tanPi (fc / sr);
             auto a0 = 1.0f / (1.0f + 1.414213562f * C + C * C);
 
             setCoeffs (a0,
@@ -113,9 +114,8 @@ namespace sspo
         {
             T fc = rack::simd::ifelse (freq < sr * 0.5, freq, freq * 0.95);
             T omega_c = k_pi * fc;
-            T theta_c = k_pi * fc / sr;
 
-            T k = omega_c / tan (theta_c);
+            T k = omega_c / tanPi (fc / sr);
             T denominator = k * k + omega_c * omega_c + 2.0 * k * omega_c;
             T b1Num = -2.0 * k * k + 2.0 * omega_c * omega_c;
             T b2Num = -2.0 * k * omega_c + k * k + omega_c * omega_c;
@@ -131,9 +131,8 @@ namespace sspo
         {
             T fc = rack::simd::ifelse (freq < sr * 0.5, freq, freq * 0.95);
             T omega_c = k_pi * fc;
-            T theta_c = k_pi * fc / sr;
 
-            T k = omega_c / tan (theta_c);
+            T k = omega_c / tanPi (fc / sr);
             T denominator = k * k + omega_c * omega_c + 2.0 * k * omega_c;
             T b1Num = -2.0 * k * k + 2.0 * omega_c * omega_c;
             T b2Num = -2.0 * k * omega_c + k * k + omega_c * omega_c;
@@ -149,7 +148,8 @@ namespace sspo
         void setAllPass1stOrder (const T sr, const T freq)
         {
             T fc = rack::simd::ifelse (freq < sr * 0.5, freq, freq * 0.95);
-            T alpha = (rack::simd::tan (k_pi * fc / sr) - 1) / (rack::simd::tan (k_pi * fc / sr) + 1);
+            T t = tanPi (fc / sr);
+            T alpha = (t - 1) / (t + 1);
             setCoeffs (alpha, 1.0f, 0.0f, alpha, 0.0f, 1.0f, 0.0f);
         }
 
@@ -186,6 +186,129 @@ namespace sspo
         }
     };
 
+    /// BiQuads for every polyphonic channel of a port, coefficients and state held as
+    /// struct of arrays in float_4 groups, each channel has its own coefficients
+    /// stages, number of identical sequential filters, 2 gives the Linkwitz Riley 4th order
+    /// process filters a whole port's voltages in one call, the groups within a stage are
+    /// independent so their feedback chains overlap
+    template <int channels, int stages = 1>
+    struct BiquadBank
+    {
+        static_assert (channels % 4 == 0, "BiquadBank channels must be a multiple of 4");
+        static constexpr int groups = channels / 4;
+
+        BiquadBank()
+        {
+            setCoeffs (BiQuad<float_4>::BiquadCoeffecients{});
+            clear();
+        }
+
+        /// coefficients for the four channels of one group, in every stage
+        void setCoeffs (const int group, const BiQuad<float_4>::BiquadCoeffecients& c)
+        {
+            for (auto s = 0; s < stages; ++s)
+            {
+                a0[s][group] = c.a0;
+                a1[s][group] = c.a1;
+                a2[s][group] = c.a2;
+                b1[s][group] = c.b1;
+                b2[s][group] = c.b2;
+                c0[s][group] = c.c0;
+                d0[s][group] = c.d0;
+            }
+        }
+
+        /// same coefficients for every channel
+        void setCoeffs (const BiQuad<float_4>::BiquadCoeffecients& c)
+        {
+            for (auto g = 0; g < groups; ++g)
+                setCoeffs (g, c);
+        }
+
+        /// coefficients for a single channel, in every stage
+        void setChannelCoeffs (const int channel, const BiQuad<float>::BiquadCoeffecients& c)
+        {
+            const auto g = channel / 4;
+            const auto lane = channel % 4;
+            for (auto s = 0; s < stages; ++s)
+            {
+                a0[s][g][lane] = c.a0;
+                a1[s][g][lane] = c.a1;
+                a2[s][g][lane] = c.a2;
+                b1[s][g][lane] = c.b1;
+                b2[s][g][lane] = c.b2;
+                c0[s][g][lane] = c.c0;
+                d0[s][g][lane] = c.d0;
+            }
+        }
+
+        void setButterworthLp2 (const int group, const float_4 sr, const float_4 freq)
+        {
+            BiQuad<float_4> design;
+            design.setButterworthLp2 (sr, freq);
+            setCoeffs (group, design.coeffs);
+        }
+
+        void setButterworthHp2 (const int group, const float_4 sr, const float_4 freq)
+        {
+            BiQuad<float_4> design;
+            design.setButterworthHp2 (sr, freq);
+            setCoeffs (group, design.coeffs);
+        }
+
+        void clear()
+        {
+            for (auto s = 0; s < stages; ++s)
+            {
+                for (auto g = 0; g < groups; ++g)
+                {
+                    xz1[s][g] = 0.0f;
+                    xz2[s][g] = 0.0f;
+                    yz1[s][g] = 0.0f;
+                    yz2[s][g] = 0.0f;
+                }
+            }
+        }
+
+        /// filters the first numChannels of in, rounded up to whole groups, into out
+        /// in and out may be the same buffer, as a port's getVoltages()
+        void process (const float* in, float* out, const int numChannels)
+        {
+            const auto active = std::min (static_cast<int> (groups), (numChannels + 3) / 4);
+            const float* src = in;
+            for (auto s = 0; s < stages; ++s)
+            {
+                for (auto g = 0; g < active; ++g)
+                {
+                    // as BiQuad::process, so the output matches it exactly
+                    const auto x = float_4::load (src + 4 * g);
+                    const auto y = a0[s][g] * x + a1[s][g] * xz1[s][g]
+                                   + a2[s][g] * xz2[s][g] - b1[s][g] * yz1[s][g] - b2[s][g] * yz2[s][g];
+                    yz2[s][g] = yz1[s][g];
+                    yz1[s][g] = y;
+                    xz2[s][g] = xz1[s][g];
+                    xz1[s][g] = x;
+                    (y * c0[s][g] + x * d0[s][g]).store (out + 4 * g);
+                }
+                src = out;
+            }
+        }
+
+    private:
+        float_4 a0[stages][groups];
+        float_4 a1[stages][groups];
+        float_4 a2[stages][groups];
+        float_4 b1[stages][groups];
+        float_4 b2[stages][groups];
+        float_4 c0[stages][groups];
+        float_4 d0[stages][groups];
+
+        float_4 xz1[stages][groups];
+        float_4 xz2[stages][groups];
+        float_4 yz1[stages][groups];
+        float_4 yz2[stages][groups];
+    };
+
     template <typename T>
     struct LinkwitzRileyLP2
     {
@@ -282,27 +405,227 @@ namespace sspo
         }
     };
 
+    enum class CrossoverSlope
+    {
+        LR2,
+        LR4
+    };
+
+    /// Linkwitz Riley crossover, low and high bands from one coefficient set.
+    /// the low band is the Butterworth section squared, LR2 two first order sections,
+    /// LR4 two second order. Their sum with the high band is the allpass with the same
+    /// poles, so the high band is that allpass minus the low band and the bands sum flat
+    /// by construction. The sections are trapezoidal (topology preserving), the same
+    /// bilinear responses as the Linkwitz Riley biquads, but the states stay well conditioned
+    /// with the poles close to dc, where direct form rounding stops the sum being flat.
+    /// The allpass is read from the first section, so 4 memories where separate low and
+    /// high filters need 16.
+    /// LR4 high is the Butterworth high pass squared, LR2 high is inverted, as an LR2
+    /// crossover must be to sum flat
+    template <typename T>
+    struct Crossover
+    {
+        /// the coefficients are recomputed for the new slope, so it may change either
+        /// side of setParameters
+        void setSlope (const CrossoverSlope newSlope)
+        {
+            slope = newSlope;
+            updateCoefficients();
+        }
+
+        CrossoverSlope getSlope() const
+        {
+            return slope;
+        }
+
+        /// one prewarp for both bands
+        void setParameters (const T sr, const T freq)
+        {
+            T fc = rack::simd::ifelse (freq < sr * 0.5f, freq, freq * 0.95f);
+            g = tanPi (fc / sr);
+            updateCoefficients();
+        }
+
+        void clear()
+        {
+            s1 = {};
+            s2 = {};
+            s3 = {};
+            s4 = {};
+        }
+
+        void process (const T in, T& low, T& high)
+        {
+            if (slope == CrossoverSlope::LR2)
+            {
+                // one pole sections, allpass = lp - hp
+                const T v1 = (in - s1) * a1;
+                const T lp = v1 + s1;
+                s1 = lp + v1;
+                const T v2 = (lp - s2) * a1;
+                low = v2 + s2;
+                s2 = low + v2;
+                high = 2.0f * lp - in - low;
+            }
+            else
+            {
+                // state variable sections, allpass = in - 2k bp
+                const T v3 = in - s2;
+                const T bp = a1 * s1 + a2 * v3;
+                const T lp = s2 + a2 * s1 + a3 * v3;
+                s1 = 2.0f * bp - s1;
+                s2 = 2.0f * lp - s2;
+                const T w3 = lp - s4;
+                const T w1 = a1 * s3 + a2 * w3;
+                low = s4 + a2 * s3 + a3 * w3;
+                s3 = 2.0f * w1 - s3;
+                s4 = 2.0f * low - s4;
+                high = in - 2.0f * k * bp - low;
+            }
+        }
+
+    private:
+        static constexpr float k = 1.414213562f; // 1 / q, Butterworth
+
+        void updateCoefficients()
+        {
+            if (slope == CrossoverSlope::LR2)
+            {
+                a1 = g / (1.0f + g);
+            }
+            else
+            {
+                a1 = 1.0f / (1.0f + g * (g + k));
+                a2 = g * a1;
+                a3 = g * a2;
+            }
+        }
+
+        CrossoverSlope slope = CrossoverSlope::LR4;
+
+        // prewarped cutoff, kept for a change of slope
+        T g{};
+
+        // shared by both sections and the allpass, LR2 uses a1 only
+        T a1{};
+        T a2{};
+        T a3{};
+
+        // first and second section memories, LR2 uses s1 and s2
+        T s1{};
+        T s2{};
+        T s3{};
+        T s4{};
+    };
+
+    /// N BiQuads in series, in transposed direct form II
+    /// processBlock runs the stages as a wavefront, stage k works on sample t - k, so the
+    /// stages within one step are independent and their feedback chains overlap
+    /// setStages limits the number of active stages, as the quality of the Decimator
+    template <typename T, int N>
+    struct BiQuadCascade
+    {
+        using Coeffecients = typename BiQuad<T>::BiquadCoeffecients;
+
+        BiQuadCascade()
+        {
+            clear();
+        }
+
+        void setCoeffs (const int stage, const Coeffecients& c)
+        {
+            coeffs[stage] = c;
+        }
+
+        /// same coefficients for every stage
+        void setCoeffs (const Coeffecients& c)
+        {
+            for (auto& stage : coeffs)
+                stage = c;
+        }
+
+        void setStages (const int newStages)
+        {
+            stages = std::max (1, std::min (N, newStages));
+        }
+
+        int getStages() const
+        {
+            return stages;
+        }
+
+        void clear()
+        {
+            for (auto i = 0; i < N; ++i)
+            {
+                z1[i] = {};
+                z2[i] = {};
+            }
+        }
+
+        T process (const T in)
+        {
+            auto x = in;
+            for (auto k = 0; k < stages; ++k)
+                x = tick (k, x);
+            return x;
+        }
+
+        /// in and out may be the same buffer
+        void processBlock (const T* in, T* out, const int n)
+        {
+            if (n == 1)
+            {
+                out[0] = process (in[0]);
+                return;
+            }
+
+            // out holds each sample between stages, stage k reads out[t - k]
+            // written by stage k - 1 on the previous step
+            for (auto t = 0; t < n + stages - 1; ++t)
+            {
+                const auto first = std::max (0, t - n + 1);
+                const auto last = std::min (stages - 1, t);
+                for (auto k = first; k <= last; ++k)
+                {
+                    const auto i = t - k;
+                    out[i] = tick (k, k == 0 ? in[i] : out[i]);
+                }
+            }
+        }
+
+    private:
+        T tick (const int k, const T in)
+        {
+            const auto& c = coeffs[k];
+            const auto y = c.a0 * in + z1[k];
+            z1[k] = c.a1 * in - c.b1 * y + z2[k];
+            z2[k] = c.a2 * in - c.b2 * y;
+            return y * c.c0 + in * c.d0;
+        }
+
+        Coeffecients coeffs[N];
+        T z1[N];
+        T z2[N];
+        int stages{ N };
+    };
+
     /// IIR Decimator
     /// maxOversample, upsample tate
     /// maxQuality, number of sequential filters
     template <int maxOversample, int maxQuality, typename T>
     struct Decimator
     {
-        BiQuad<T> filters[maxQuality];
+        BiQuadCascade<T, maxQuality> filters;
 
         Decimator()
         {
-            for (auto i = 0; i < maxQuality; ++i)
-            {
-                // the maxOversample filter has been set at niquist, to remove unwanted
-                // noise in the audio spectrum
-                filters[i].setButterworthLp2 (10000.0f, 10000.0f / (1.0f * maxOversample));
-            }
+            setCutoff (maxOversample);
         }
 
         void setQuality (int q)
         {
-            quality = q;
+            filters.setStages (q);
         }
 
         void setOverSample (int newOverSample)
@@ -310,33 +633,29 @@ namespace sspo
             if (newOverSample != overSampleRate)
             {
                 overSampleRate = newOverSample;
-                for (auto i = 0; i < maxQuality; ++i)
-                {
-                    // the maxOversample filter has been set at niquist, to remove unwanted
-                    // noise in the audio spectrum
-                    filters[i].setButterworthLp2 (10000.0f, 10000.0f / (1.0f * overSampleRate));
-                }
+                setCutoff (overSampleRate);
             }
         }
 
         T process (const T* input)
         {
-            T x = 0;
-            for (auto i = 0; i < overSampleRate; ++i)
-            {
-                x = filters[0].process (input[i]);
-                for (auto j = 1; j < quality; ++j)
-                {
-                    x = filters[j].process (x);
-                }
-            }
+            filters.processBlock (input, scratch, overSampleRate);
             // we simply return the last sample
-            return x;
+            return scratch[overSampleRate - 1];
         }
 
     private:
-        int quality{ maxQuality };
+        void setCutoff (const int rate)
+        {
+            // the maxOversample filter has been set at niquist, to remove unwanted
+            // noise in the audio spectrum
+            BiQuad<T> design;
+            design.setButterworthLp2 (10000.0f, 10000.0f / (1.0f * rate));
+            filters.setCoeffs (design.coeffs);
+        }
+
         int overSampleRate{ maxOversample };
+        T scratch[maxOversample];
     };
 
     /// IIR upsample interpolator
@@ -345,21 +664,16 @@ namespace sspo
     template <int maxOversample, int maxQuality, typename T>
     struct Upsampler
     {
-        BiQuad<T> filters[maxQuality];
+        BiQuadCascade<T, maxQuality> filters;
 
         Upsampler()
         {
-            for (auto i = 0; i < maxQuality; ++i)
-            {
-                // the maxOversample filter has been set at niquist, to remove unwanted
-                // noise in the audio spectrum
-                filters[i].setButterworthLp2 (10000.0f, 10000.0f / (1.0f * maxOversample));
-            }
+            setCutoff (maxOversample);
         }
 
         void setQuality (int newQuality)
         {
-            quality = newQuality;
+            filters.setStages (newQuality);
         }
 
         void setOverSample (int newOverSample)
@@ -367,34 +681,415 @@ namespace sspo
             if (newOverSample != oversample)
             {
                 oversample = newOverSample;
-                for (auto i = 0; i < maxQuality; ++i)
-                {
-                    // the maxOversample filter has been set at niquist, to remove unwanted
-                    // noise in the audio spectrum
-                    filters[i].setButterworthLp2 (10000.0f, 10000.0f / (1.0f * oversample));
-                }
+                setCutoff (oversample);
             }
         }
 
         void process (T in, T* buffer)
         {
-            buffer[0] = doFilter (in);
+            buffer[0] = in;
             for (auto i = 1; i < oversample; ++i)
-                buffer[i] = doFilter (T (0) * oversample);
+                buffer[i] = T (0);
+            filters.processBlock (buffer, buffer, oversample);
         }
 
         T doFilter (T in)
         {
-            T x = filters[0].process (in);
-            for (auto i = 1; i < quality; ++i)
+            return filters.process (in);
+        }
+
+    private:
+        void setCutoff (const int rate)
+        {
+            // the maxOversample filter has been set at niquist, to remove unwanted
+            // noise in the audio spectrum
+            BiQuad<T> design;
+            design.setButterworthLp2 (10000.0f, 10000.0f / (1.0f * rate));
+            filters.setCoeffs (design.coeffs);
+        }
+
+        int oversample{ maxOversample };
+    };
+
+    enum class HalfBandPhase
+    {
+        Linear,
+        Minimum
+    };
+
+    /// One half-band FIR, split into its two polyphase branches, even taps h[0], h[2] ...
+    /// and odd taps h[1], h[3] ...
+    /// A linear phase half-band has every odd tap zero apart from the 0.5 centre tap,
+    /// so odd is null and that branch is a pure delay of oddDelay samples
+    struct HalfBandCoefficients
+    {
+        const float* even;
+        int evenLength;
+        const float* odd;
+        int oddLength;
+        int oddDelay;
+    };
+
+    /// Half-band designs for each stage of a 2x cascade, Kaiser windowed sinc, ~80dB stopband.
+    /// stage 0 runs between the base rate and 2x, it needs the steep 55 tap filter
+    /// (pass 0.2, stop 0.3 of its rate). Later stages only see the lower quarter of their band
+    /// so 23 taps are enough. The minimum phase versions share the magnitude responses
+    inline const HalfBandCoefficients& halfBandCoefficients (const int stage, const HalfBandPhase phase)
+    {
+        static const float linear55Even[] = {
+            -2.757287338e-05f, 1.479164182e-04f, -4.314343468e-04f, 9.904248040e-04f,
+            -1.976079088e-03f, 3.584227479e-03f, -6.066737897e-03f, 9.759497348e-03f,
+            -1.515311400e-02f, 2.307654844e-02f, -3.521981747e-02f, 5.593849129e-02f,
+            -1.013002098e-01f, 3.166778597e-01f, 3.166778597e-01f, -1.013002098e-01f,
+            5.593849129e-02f, -3.521981747e-02f, 2.307654844e-02f, -1.515311400e-02f,
+            9.759497348e-03f, -6.066737897e-03f, 3.584227479e-03f, -1.976079088e-03f,
+            9.904248040e-04f, -4.314343468e-04f, 1.479164182e-04f, -2.757287338e-05f,
+        };
+        static const float minimum55Even[] = {
+            6.178699306e-03f, 1.592917233e-01f, 4.077769397e-01f, -4.388885995e-02f,
+            -8.458230900e-02f, 1.103857571e-01f, -1.027712227e-01f, 8.637889655e-02f,
+            -6.939351326e-02f, 5.430218781e-02f, -4.165644314e-02f, 3.136424729e-02f,
+            -2.315838050e-02f, 1.673313493e-02f, -1.179569907e-02f, 8.083548623e-03f,
+            -5.354408360e-03f, 3.415443465e-03f, -2.084051419e-03f, 1.196834054e-03f,
+            -6.303716590e-04f, 2.914080542e-04f, -1.063152526e-04f, 2.027257094e-05f,
+            1.035266457e-05f, -1.034033955e-05f, 2.346658813e-06f, 1.231937425e-07f,
+        };
+        static const float minimum55Odd[] = {
+            4.606301216e-02f, 3.259347496e-01f, 2.596864272e-01f, -2.110460597e-01f,
+            1.202109586e-01f, -5.881525672e-02f, 2.334519364e-02f, -4.346553689e-03f,
+            -4.904821205e-03f, 8.552785692e-03f, -9.090862080e-03f, 8.041513935e-03f,
+            -6.327361562e-03f, 4.500872294e-03f, -2.872926140e-03f, 1.590328001e-03f,
+            -6.766881023e-04f, 1.101025293e-04f, 1.729661202e-04f, -2.649209987e-04f,
+            2.482880450e-04f, -1.851931398e-04f, 1.138396006e-04f, -5.643603942e-05f,
+            1.729299206e-05f, -3.339049722e-07f, -9.178070768e-07f,
+        };
+        static const float linear23Even[] = {
+            -6.767299062e-05f, 1.578727255e-03f, -8.359864811e-03f, 2.820193451e-02f,
+            -7.992506506e-02f, 3.085719411e-01f, 3.085719411e-01f, -7.992506506e-02f,
+            2.820193451e-02f, -8.359864811e-03f, 1.578727255e-03f, -6.767299062e-05f,
+        };
+        static const float minimum23Even[] = {
+            2.816120460e-02f, 3.773617866e-01f, 1.882392982e-01f, -1.510421358e-01f,
+            8.603593111e-02f, -4.049929692e-02f, 1.524641461e-02f, -4.184570397e-03f,
+            6.831043555e-04f, 2.691442077e-06f, -4.589935372e-06f, 1.625612009e-07f,
+        };
+        static const float minimum23Odd[] = {
+            1.588872013e-01f, 4.461201269e-01f, -1.352964850e-01f, 3.854054935e-02f,
+            -1.105613875e-02f, 4.405939652e-03f, -2.592724817e-03f, 1.369641270e-03f,
+            -4.128083010e-04f, 3.561547898e-05f, -9.175050087e-07f,
+        };
+
+        static const HalfBandCoefficients linear55{ linear55Even, 28, nullptr, 0, 13 };
+        static const HalfBandCoefficients linear23{ linear23Even, 12, nullptr, 0, 5 };
+        static const HalfBandCoefficients minimum55{ minimum55Even, 28, minimum55Odd, 27, 0 };
+        static const HalfBandCoefficients minimum23{ minimum23Even, 12, minimum23Odd, 11, 0 };
+
+        if (phase == HalfBandPhase::Linear)
+            return stage == 0 ? linear55 : linear23;
+        return stage == 0 ? minimum55 : minimum23;
+    }
+
+    /// group delay at DC, in samples at the filters high rate
+    inline float groupDelay (const HalfBandCoefficients& coeffs)
+    {
+        auto moment = 0.0f;
+        auto sum = 0.0f;
+        for (auto k = 0; k < coeffs.evenLength; ++k)
+        {
+            moment += 2.0f * k * coeffs.even[k];
+            sum += coeffs.even[k];
+        }
+        if (coeffs.odd == nullptr)
+        {
+            moment += (2.0f * coeffs.oddDelay + 1.0f) * 0.5f;
+            sum += 0.5f;
+        }
+        for (auto k = 0; k < coeffs.oddLength; ++k)
+        {
+            moment += (2.0f * k + 1.0f) * coeffs.odd[k];
+            sum += coeffs.odd[k];
+        }
+        return moment / sum;
+    }
+
+    /// 2x polyphase half-band interpolator / decimator stage
+    /// only the samples that are kept are computed
+    template <typename T>
+    struct HalfBandStage
+    {
+        static constexpr int maxTaps = 28;
+
+        HalfBandStage()
+        {
+            setCoefficients (halfBandCoefficients (0, HalfBandPhase::Linear));
+        }
+
+        void setCoefficients (const HalfBandCoefficients& newCoeffs)
+        {
+            coeffs = newCoeffs;
+            reset();
+        }
+
+        void reset()
+        {
+            std::fill (evenHistory, evenHistory + 2 * maxTaps, T (0.0f));
+            std::fill (oddHistory, oddHistory + 2 * maxTaps, T (0.0f));
+            lastIn = 0.0f;
+            pos = 0;
+        }
+
+        /// one sample in, two samples out, the gain of 2 replaces the energy lost to zero stuffing
+        void upsample (const T in, T* out)
+        {
+            advance();
+            push (evenHistory, in);
+            out[0] = 2.0f * dot (coeffs.even, coeffs.evenLength, evenHistory);
+            out[1] = coeffs.odd == nullptr ? evenHistory[pos + coeffs.oddDelay]
+                                           : 2.0f * dot (coeffs.odd, coeffs.oddLength, evenHistory);
+        }
+
+        /// two samples in, one sample out, aligned with in[0] as the upsampler output is.
+        /// in[1] only reaches the odd branch on the next call
+        T downsample (const T* in)
+        {
+            advance();
+            push (evenHistory, in[0]);
+            push (oddHistory, lastIn);
+            lastIn = in[1];
+            auto out = dot (coeffs.even, coeffs.evenLength, evenHistory);
+            if (coeffs.odd == nullptr)
+                return out + 0.5f * oddHistory[pos + coeffs.oddDelay];
+            return out + dot (coeffs.odd, coeffs.oddLength, oddHistory);
+        }
+
+    private:
+        // histories are written twice, so the taps can always be read as one run from pos
+        void advance()
+        {
+            pos = pos == 0 ? maxTaps - 1 : pos - 1;
+        }
+
+        void push (T* history, const T x)
+        {
+            history[pos] = x;
+            history[pos + maxTaps] = x;
+        }
+
+        T dot (const float* taps, const int length, const T* history) const
+        {
+            T acc = 0.0f;
+            for (auto k = 0; k < length; ++k)
+                acc += taps[k] * history[pos + k];
+            return acc;
+        }
+
+        HalfBandCoefficients coeffs;
+        T evenHistory[2 * maxTaps];
+        T oddHistory[2 * maxTaps];
+        T lastIn = 0.0f;
+        int pos = 0;
+    };
+
+    /// Cascade of 2x half-band stages, shared by HalfBandUpsampler and HalfBandDecimator
+    /// maxOversample, a power of 2 up to 16
+    template <int maxOversample, typename T>
+    struct HalfBandCascade
+    {
+        static_assert (maxOversample == 2 || maxOversample == 4 || maxOversample == 8 || maxOversample == 16,
+                       "half-band oversampling must be 2, 4, 8 or 16");
+        static constexpr int maxStages = maxOversample == 2 ? 1 : maxOversample == 4 ? 2 : maxOversample == 8 ? 3 : 4;
+
+        HalfBandCascade()
+        {
+            setStages();
+        }
+
+        /// rounded down to a power of 2, use getOverSample for the rate actually used
+        void setOverSample (int newOverSample)
+        {
+            auto newStageCount = 0;
+            while (newStageCount < maxStages && (2 << newStageCount) <= newOverSample)
+                ++newStageCount;
+            if (newStageCount != stageCount)
             {
-                x = filters[i].process (x);
+                stageCount = newStageCount;
+                reset();
+            }
+        }
+
+        void setPhase (const HalfBandPhase newPhase)
+        {
+            if (newPhase != phase)
+            {
+                phase = newPhase;
+                setStages();
+            }
+        }
+
+        int getOverSample() const
+        {
+            return 1 << stageCount;
+        }
+
+        /// latency in samples at the base rate
+        float getLatency() const
+        {
+            auto latency = 0.0f;
+            for (auto i = 0; i < stageCount; ++i)
+                latency += groupDelay (halfBandCoefficients (i, phase)) / (2 << i);
+            return latency;
+        }
+
+        void reset()
+        {
+            for (auto& s : stages)
+                s.reset();
+        }
+
+    protected:
+        void setStages()
+        {
+            for (auto i = 0; i < maxStages; ++i)
+                stages[i].setCoefficients (halfBandCoefficients (i, phase));
+        }
+
+        HalfBandStage<T> stages[maxStages];
+        int stageCount{ maxStages };
+        HalfBandPhase phase{ HalfBandPhase::Linear };
+    };
+
+    /// Polyphase half-band FIR upsample interpolator, a drop in for Upsampler
+    /// maxOversample, a power of 2 up to 16
+    template <int maxOversample, typename T>
+    struct HalfBandUpsampler : public HalfBandCascade<maxOversample, T>
+    {
+        using Base = HalfBandCascade<maxOversample, T>;
+
+        void process (T in, T* buffer)
+        {
+            buffer[0] = in;
+            auto count = 1;
+            for (auto s = 0; s < Base::stageCount; ++s)
+            {
+                std::copy (buffer, buffer + count, scratch);
+                for (auto i = 0; i < count; ++i)
+                    Base::stages[s].upsample (scratch[i], buffer + 2 * i);
+                count *= 2;
             }
-            return x;
         }
 
     private:
-        int quality{ maxQuality };
-        int oversample{ maxOversample };
+        T scratch[maxOversample / 2];
+    };
+
+    /// Polyphase half-band FIR decimator, a drop in for Decimator
+    /// maxOversample, a power of 2 up to 16
+    template <int maxOversample, typename T>
+    struct HalfBandDecimator : public HalfBandCascade<maxOversample, T>
+    {
+        using Base = HalfBandCascade<maxOversample, T>;
+
+        T process (const T* input)
+        {
+            auto count = Base::getOverSample();
+            std::copy (input, input + count, scratch);
+            for (auto s = Base::stageCount - 1; s >= 0; --s)
+            {
+                count /= 2;
+                for (auto i = 0; i < count; ++i)
+                    scratch[i] = Base::stages[s].downsample (scratch + 2 * i);
+            }
+            return scratch[0];
+        }
+
+    private:
+        T scratch[maxOversample];
+    };
+
+    /// The oversampling filters a composite can choose between, stored as a param value
+    enum OversampleFilter
+    {
+        IIR_OVERSAMPLE_FILTER,
+        LINEAR_PHASE_OVERSAMPLE_FILTER,
+        MINIMUM_PHASE_OVERSAMPLE_FILTER,
+        NUM_OVERSAMPLE_FILTERS
+    };
+
+    /// largest power of 2 not above n
+    constexpr int floorPowerOfTwo (const int n, const int p = 1)
+    {
+        return p * 2 > n ? p : floorPowerOfTwo (n, p * 2);
+    }
+
+    /// Upsampler and Decimator pair that can switch between the IIR filters
+    /// and the half-band FIRs, which only run at power of 2 rates
+    /// maxOversample, upsample rate
+    /// maxQuality, number of sequential IIR filters
+    template <int maxOversample, int maxQuality, typename T>
+    struct Resampler
+    {
+        void setFilter (const int newFilter)
+        {
+            filter = newFilter;
+            auto phase = filter == MINIMUM_PHASE_OVERSAMPLE_FILTER ? HalfBandPhase::Minimum
+                                                                   : HalfBandPhase::Linear;
+            halfBandUpsampler.setPhase (phase);
+            halfBandDecimator.setPhase (phase);
+        }
+
+        void setQuality (const int quality)
+        {
+            upsampler.setQuality (quality);
+            decimator.setQuality (quality);
+        }
+
+        void setOverSample (const int newOverSample)
+        {
+            overSample = newOverSample;
+            upsampler.setOverSample (overSample);
+            decimator.setOverSample (overSample);
+            halfBandUpsampler.setOverSample (overSample);
+            halfBandDecimator.setOverSample (overSample);
+        }
+
+        /// the rate actually used, the half-band filters round down to a power of 2
+        int getOverSample() const
+        {
+            return filter == IIR_OVERSAMPLE_FILTER ? overSample : halfBandUpsampler.getOverSample();
+        }
+
+        bool isHalfBand() const
+        {
+            return filter != IIR_OVERSAMPLE_FILTER;
+        }
+
+        /// round trip latency in samples at the base rate, the IIR delay depends on frequency
+        /// and is not reported
+        float getLatency() const
+        {
+            return isHalfBand() ? halfBandUpsampler.getLatency() + halfBandDecimator.getLatency() : 0.0f;
+        }
+
+        void upsample (const T in, T* buffer)
+        {
+            if (isHalfBand())
+                halfBandUpsampler.process (in, buffer);
+            else
+                upsampler.process (in, buffer);
+        }
+
+        T decimate (const T* buffer)
+        {
+            return isHalfBand() ? halfBandDecimator.process (buffer) : decimator.process (buffer);
+        }
+
+    private:
+        static constexpr int maxHalfBandOversample = floorPowerOfTwo (maxOversample);
+        Upsampler<maxOversample, maxQuality, T> upsampler;
+        Decimator<maxOversample, maxQuality, T> decimator;
+        HalfBandUpsampler<maxHalfBandOversample, T> halfBandUpsampler;
+        HalfBandDecimator<maxHalfBandOversample, T> halfBandDecimator;
+        int filter{ IIR_OVERSAMPLE_FILTER };
+        int overSample{ maxOversample };
     };
 } // namespace sspo
\ No newline at end of file
@@ -26,6 +26,9 @@
 #include <sstream>
 #include <vector>
 #include <array>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include "AudioMath.h"
 
 #include "simd/functions.hpp"
@@ -33,17 +36,6 @@
 #include "simd/sse_mathfun_extension.h"
 //#include "simd/vector.hpp"
 
-// Wave Shapes
-extern std::array<float, 4096> ThroughShape;
-extern std::array<float, 4096> DiodeFeedbackRedGreenShape;
-extern std::array<float, 4096> DiodeFeedbackOneAndOneShape;
-extern std::array<float, 4096> DiodeFeedbackOneAndTwoShape;
-extern std::array<float, 4096> DiodeFeedbackOneAndThreeShape;
-
-extern std::array<float, 4096> Vca1;
-extern std::array<float, 4096> Vca2;
-extern std::array<float, 4096> Vca3;
-
 using float_4 = ::rack::simd::float_4;
 
 namespace sspo
@@ -59,6 +51,24 @@ namespace sspo
         /// at 12 bit this gives us a resolution 2.4 / 4096 = 5.8597375e-4
         namespace WaveShaper
         {
+            /// Captured wave shapes, generated by generatewaveshapes.py from Docs/WaveShapes/Tables
+            /// into WaveShapes/WaveShapeData.cpp
+            namespace Codes
+            {
+                static constexpr int codeCount = 4095;
+                static constexpr float codeDivisor = 5120.0f;
+
+                extern const int16_t ThroughShape[codeCount];
+                extern const int16_t DiodeFeedbackRedGreenShape[codeCount];
+                extern const int16_t DiodeFeedbackOneAndOneShape[codeCount];
+                extern const int16_t DiodeFeedbackOneAndTwoShape[codeCount];
+                extern const int16_t DiodeFeedbackOneAndThreeShape[codeCount];
+
+                extern const int16_t Vca1[codeCount];
+                extern const int16_t Vca2[codeCount];
+                extern const int16_t Vca3[codeCount];
+            } // namespace Codes
+
             static constexpr auto length = 4096U;
             static constexpr auto mask = length - 2;
             static constexpr auto minValue = -1.2f;
@@ -80,26 +90,32 @@ namespace sspo
                 return linearInterpolate (*(source->data() + preIndex), *(source->data() + postIndex), fraction);
             }
 
-            // NOT WORKING
-            //            inline float_4 process (const Table* source, const float_4 in) noexcept
-            //            {
-            //                auto x = in;
-            //                auto index = (x - minValue) * recpInterval;
-            //                auto preIndex = rack::simd::floor (index); //& mask;
-            //                auto postIndex = (preIndex + 1);
-            //                auto fraction = index - preIndex;
-            //                auto* s = source->data();
-            //                float_4 lower = float_4 (*(s + static_cast<int> (preIndex[0])),
-            //                                         *(s + static_cast<int> (preIndex[1])),
-            //                                         *(s + static_cast<int> (preIndex[2])),
-            //                                         *(s + static_cast<int> (preIndex[3])));
-            //                float_4 upper = float_4{ *(s + static_cast<int> (postIndex[0])),
-            //                                         *(s + static_cast<int> (postIndex[1])),
-            //                                         *(s + static_cast<int> (postIndex[2])),
-            //                                         *(s + static_cast<int> (postIndex[3])) };
-            //
-            //                return linearInterpolate (lower, upper, fraction);
-            //            }
+            /// reads the interpolation pairs for four table indexes in one step
+            inline void gather (const float* source, const rack::simd::int32_4 index, float_4& lower, float_4& upper) noexcept
+            {
+#ifdef __AVX2__
+                lower = _mm_i32gather_ps (source, index.v, 4);
+                upper = _mm_i32gather_ps (source + 1, index.v, 4);
+#else
+                lower = float_4 (source[index[0]], source[index[1]], source[index[2]], source[index[3]]);
+                upper = float_4 (source[index[0] + 1], source[index[1] + 1], source[index[2] + 1], source[index[3] + 1]);
+#endif
+            }
+
+            /// simd version of process, matches the scalar version bit for bit.
+            /// index, mask, fraction and interpolation are vectorised, only the table read is per lane
+            inline float_4 process (const Table* source, const float_4 in) noexcept
+            {
+                auto index = (in - minValue) * recpInterval;
+                auto preIndex = rack::simd::int32_4 (index) & rack::simd::int32_4 (static_cast<int32_t> (mask));
+                auto fraction = index - float_4 (preIndex);
+
+                float_4 lower;
+                float_4 upper;
+                gather (source->data(), preIndex, lower, upper);
+
+                return linearInterpolate (lower, upper, fraction);
+            }
 
             inline Table makeTable (std::function<float (const float x)> funct)
             {
@@ -113,73 +129,163 @@ namespace sspo
                 return table;
             }
 
+            /// the integral of a table, used for antiderivative anti-aliasing.
+            /// trapezoidal integration in double precision, offset to be zero at 0v
+            /// so the stored values stay small
+            inline Table makeIntegralTable (const Table& source)
+            {
+                std::vector<double> sum (length, 0.0);
+                for (auto i = 1U; i < length; ++i)
+                    sum[i] = sum[i - 1] + 0.5 * (double (source[i - 1]) + double (source[i])) * interval;
+
+                const auto zeroIndex = static_cast<size_t> (-minValue * recpInterval);
+                Table integral;
+                for (auto i = 0U; i < length; ++i)
+                    integral[i] = static_cast<float> (sum[i] - sum[zeroIndex]);
+                return integral;
+            }
+
+            /// processIntegral reads the entry after the index, so its input range stops two
+            /// intervals short of maxValue, at index length - 2
+            static constexpr auto maxIntegralInput = maxValue - 2.0f * interval;
+
+            /// the upper clamp for shaping a signal, the captured tables hold length - 1
+            /// values so the last slot is 0, and must never be reached by the interpolation
+            static constexpr auto maxShapedInput = maxValue - interval * 3;
+
+            /// reads an integral table, the input must already be clamped to
+            /// [minValue, maxIntegralInput].
+            /// unlike process the index is not masked, as the integral must be continuous
+            inline float processIntegral (const Table* integral, const float in) noexcept
+            {
+                auto index = (in - minValue) * recpInterval;
+                int preIndex = int (index);
+                float fraction = index - preIndex;
+                return linearInterpolate (*(integral->data() + preIndex), *(integral->data() + preIndex + 1), fraction);
+            }
+
+            inline float_4 processIntegral (const Table* integral, const float_4 in) noexcept
+            {
+                auto index = (in - minValue) * recpInterval;
+                auto preIndex = rack::simd::int32_4 (index);
+                auto fraction = index - float_4 (preIndex);
+
+                float_4 lower;
+                float_4 upper;
+                gather (integral->data(), preIndex, lower, upper);
+
+                return linearInterpolate (lower, upper, fraction);
+            }
+
             class WaveShapers
             {
             public:
                 struct Definition
                 {
-                    Definition (Table* newTable, std::string newName)
+                    Definition (const Table* newTable, const Table* newIntegral, std::string newName)
                     {
                         table = newTable;
+                        integral = newIntegral;
                         name = newName;
                     }
-                    Table* table;
+                    const Table* table;
+                    const Table* integral;
                     std::string name;
                 };
 
-                size_t size()
+                size_t size() const
                 {
                     return shapes.size();
                 }
 
-                void addShape (Table* table, std::string name)
+                /// integral may be null, adaa then falls back to the plain shaper
+                void addShape (const Table* table, const Table* integral, std::string name)
+                {
+                    shapes.push_back (Definition (table, integral, name));
+                }
+
+                void addShape (const Table* table, std::string name)
                 {
-                    shapes.push_back (Definition (table, name));
+                    addShape (table, nullptr, name);
                 }
 
-                float process (float x, int definitionIndex)
+                const Table* getTable (int i) const
+                {
+                    return shapes[i].table;
+                }
+
+                const Table* getIntegral (int i) const
+                {
+                    return shapes[i].integral;
+                }
+
+                float process (float x, int definitionIndex) const
                 {
                     return WaveShaper::process (shapes[definitionIndex].table, x);
                 }
-                std::string getShapeName (int i)
+                std::string getShapeName (int i) const
                 {
                     return shapes[i].name;
                 }
 
-                float_4 process (const float_4 in, const int definitionIndex)
+                float_4 process (const float_4 in, const int definitionIndex) const
                 {
                     if (definitionIndex == 0)
                         return in;
                     auto x = rack::simd::clamp (in, minValue, maxValue - interval);
-                    return float_4 (process (x[0], definitionIndex),
-                                    process (x[1], definitionIndex),
-                                    process (x[2], definitionIndex),
-                                    process (x[3], definitionIndex));
+                    return WaveShaper::process (shapes[definitionIndex].table, x);
                 }
 
-                void process (float_4& out, const float_4 in, const int definitionIndex)
+                void process (float_4& out, const float_4 in, const int definitionIndex) const
                 {
                     if (definitionIndex == 0)
                     {
                         out = in;
                         return;
                     }
-                    auto x = rack::simd::clamp (in, minValue, maxValue - interval * 3);
-                    out = { process (x[0], definitionIndex),
-                            process (x[1], definitionIndex),
-                            process (x[2], definitionIndex),
-                            process (x[3], definitionIndex) };
-                    //                    out = WaveShaper::process (shapes[definitionIndex].table, x);
+                    auto x = rack::simd::clamp (in, minValue, maxShapedInput);
+                    out = WaveShaper::process (shapes[definitionIndex].table, x);
+                }
+
+                /// processes a block, such as an oversample buffer, in one pass.
+                /// the table and clamp limits are fetched once for the block,
+                /// in and out may be the same buffer
+                void processBlock (const float_4* in, float_4* out, const int n, const int definitionIndex) const
+                {
+                    if (definitionIndex == 0)
+                    {
+                        if (in != out)
+                            std::copy (in, in + n, out);
+                        return;
+                    }
+                    const auto* table = shapes[definitionIndex].table;
+                    const auto low = float_4 (minValue);
+                    const auto high = float_4 (maxShapedInput);
+                    for (auto i = 0; i < n; ++i)
+                        out[i] = WaveShaper::process (table, rack::simd::clamp (in[i], low, high));
+                }
+
+                void processBlock (const float* in, float* out, const int n, const int definitionIndex) const
+                {
+                    if (definitionIndex == 0)
+                    {
+                        if (in != out)
+                            std::copy (in, in + n, out);
+                        return;
+                    }
+                    const auto* table = shapes[definitionIndex].table;
+                    for (auto i = 0; i < n; ++i)
+                        out[i] = WaveShaper::process (table, std::min (std::max (in[i], minValue), maxShapedInput));
                 }
 
             private:
                 std::vector<Definition> shapes;
             };
 
-            class Nld : public WaveShapers
+            /// The procedurally generated Nld tables, built once and shared by every Nld
+            struct NldTables
             {
-            public:
-                Nld()
+                NldTables()
                 {
                     linearShape = makeTable ([] (const float x) -> float
                                              { return x; });
@@ -202,36 +308,16 @@ namespace sspo
                     arctanFiveShape = makeTable ([] (const float x) -> float
                                                  { return atanf (x * 5.0f) / atanf (5.0f); });
 
-                    addShape (&linearShape, "Linear");
-                    addShape (&tanhShape, "tanh(x)");
-                    addShape (&tanh2Shape, "tanh(2x)");
-                    addShape (&cosShape, "cos(x)");
-
-                    addShape (&arctanZeroFiveShape, "atan 0.5");
-                    addShape (&arctanOneShape, "atan 1.0");
-                    addShape (&arctanTwoShape, "atan 2.0");
-                    addShape (&arctanFiveShape, "atan 5.0");
-                    addShape (&ThroughShape, "TL074");
-                    addShape (&DiodeFeedbackOneAndOneShape, "1 and 1 Diode");
-                    addShape (&DiodeFeedbackRedGreenShape, "Green Red Led");
-                    addShape (&DiodeFeedbackOneAndTwoShape, "1 and 2 Diode");
-                    addShape (&DiodeFeedbackOneAndThreeShape, "1 and 3 Diode");
-                    addShape (&Vca1, "Vca 1");
-                    addShape (&Vca2, "Vca 2");
-                    addShape (&Vca3, "Vca 3");
-                };
-
-                float linearShaper (float x) { return x; }
-                float tanhShaper (float x) { return process (x, 1); }
-                float tanh2Shaper (float x) { return process (x, 2); }
-                float cosShaper (float x) { return process (x, 3); }
-
-                float_4 linearShaper (float_4 x) { return x; }
-                float_4 tanhShaper (float_4 x) { return process (x, 1); }
-                float_4 tanh2Shaper (float_4 x) { return process (x, 2); }
-                float_4 cosShaper (float_4 x) { return process (x, 3); }
+                    linearIntegral = makeIntegralTable (linearShape);
+                    tanhIntegral = makeIntegralTable (tanhShape);
+                    tanh2Integral = makeIntegralTable (tanh2Shape);
+                    cosIntegral = makeIntegralTable (cosShape);
+                    arctanZeroFiveIntegral = makeIntegralTable (arctanZeroFiveShape);
+                    arctanOneIntegral = makeIntegralTable (arctanOneShape);
+                    arctanTwoIntegral = makeIntegralTable (arctanTwoShape);
+                    arctanFiveIntegral = makeIntegralTable (arctanFiveShape);
+                }
 
-            private:
                 Table linearShape;
                 Table tanhShape;
                 Table tanh2Shape;
@@ -240,21 +326,233 @@ namespace sspo
                 Table arctanOneShape;
                 Table arctanTwoShape;
                 Table arctanFiveShape;
+
+                Table linearIntegral;
+                Table tanhIntegral;
+                Table tanh2Integral;
+                Table cosIntegral;
+                Table arctanZeroFiveIntegral;
+                Table arctanOneIntegral;
+                Table arctanTwoIntegral;
+                Table arctanFiveIntegral;
             };
 
-            static Nld nld;
+            /// built on first use, the inline function gives a single instance per plugin
+            inline const NldTables& sharedNldTables()
+            {
+                static const NldTables tables;
+                return tables;
+            }
+
+            /// expands captured codes to a table, the final bin has no capture and is left at 0
+            inline Table decodeTable (const int16_t* codes)
+            {
+                Table table;
+                table.fill (0.0f);
+                for (auto i = 0; i < Codes::codeCount; ++i)
+                    table[i] = codes[i] / Codes::codeDivisor;
+                return table;
+            }
+
+            /// the captured wave shapes and their integrals, decoded once on first use and shared
+            struct FixedShapes
+            {
+                FixedShapes()
+                {
+                    throughShape = decodeTable (Codes::ThroughShape);
+                    diodeOneAndOneShape = decodeTable (Codes::DiodeFeedbackOneAndOneShape);
+                    diodeRedGreenShape = decodeTable (Codes::DiodeFeedbackRedGreenShape);
+                    diodeOneAndTwoShape = decodeTable (Codes::DiodeFeedbackOneAndTwoShape);
+                    diodeOneAndThreeShape = decodeTable (Codes::DiodeFeedbackOneAndThreeShape);
+                    vca1Shape = decodeTable (Codes::Vca1);
+                    vca2Shape = decodeTable (Codes::Vca2);
+                    vca3Shape = decodeTable (Codes::Vca3);
+
+                    throughIntegral = makeIntegralTable (throughShape);
+                    diodeOneAndOneIntegral = makeIntegralTable (diodeOneAndOneShape);
+                    diodeRedGreenIntegral = makeIntegralTable (diodeRedGreenShape);
+                    diodeOneAndTwoIntegral = makeIntegralTable (diodeOneAndTwoShape);
+                    diodeOneAndThreeIntegral = makeIntegralTable (diodeOneAndThreeShape);
+                    vca1Integral = makeIntegralTable (vca1Shape);
+                    vca2Integral = makeIntegralTable (vca2Shape);
+                    vca3Integral = makeIntegralTable (vca3Shape);
+                }
+
+                Table throughShape;
+                Table diodeOneAndOneShape;
+                Table diodeRedGreenShape;
+                Table diodeOneAndTwoShape;
+                Table diodeOneAndThreeShape;
+                Table vca1Shape;
+                Table vca2Shape;
+                Table vca3Shape;
+
+                Table throughIntegral;
+                Table diodeOneAndOneIntegral;
+                Table diodeRedGreenIntegral;
+                Table diodeOneAndTwoIntegral;
+                Table diodeOneAndThreeIntegral;
+                Table vca1Integral;
+                Table vca2Integral;
+                Table vca3Integral;
+            };
+
+            inline const FixedShapes& sharedFixedShapes()
+            {
+                static const FixedShapes shapes;
+                return shapes;
+            }
+
+            class Nld : public WaveShapers
+            {
+            public:
+                Nld()
+                {
+                    const auto& t = sharedNldTables();
+                    const auto& fixed = sharedFixedShapes();
+                    addShape (&t.linearShape, &t.linearIntegral, "Linear");
+                    addShape (&t.tanhShape, &t.tanhIntegral, "tanh(x)");
+                    addShape (&t.tanh2Shape, &t.tanh2Integral, "tanh(2x)");
+                    addShape (&t.cosShape, &t.cosIntegral, "cos(x)");
+
+                    addShape (&t.arctanZeroFiveShape, &t.arctanZeroFiveIntegral, "atan 0.5");
+                    addShape (&t.arctanOneShape, &t.arctanOneIntegral, "atan 1.0");
+                    addShape (&t.arctanTwoShape, &t.arctanTwoIntegral, "atan 2.0");
+                    addShape (&t.arctanFiveShape, &t.arctanFiveIntegral, "atan 5.0");
+                    addShape (&fixed.throughShape, &fixed.throughIntegral, "TL074");
+                    addShape (&fixed.diodeOneAndOneShape, &fixed.diodeOneAndOneIntegral, "1 and 1 Diode");
+                    addShape (&fixed.diodeRedGreenShape, &fixed.diodeRedGreenIntegral, "Green Red Led");
+                    addShape (&fixed.diodeOneAndTwoShape, &fixed.diodeOneAndTwoIntegral, "1 and 2 Diode");
+                    addShape (&fixed.diodeOneAndThreeShape, &fixed.diodeOneAndThreeIntegral, "1 and 3 Diode");
+                    addShape (&fixed.vca1Shape, &fixed.vca1Integral, "Vca 1");
+                    addShape (&fixed.vca2Shape, &fixed.vca2Integral, "Vca 2");
+                    addShape (&fixed.vca3Shape, &fixed.vca3Integral, "Vca 3");
+                };
+
+                float linearShaper (float x) const { return x; }
+                float tanhShaper (float x) const { return process (x, 1); }
+                float tanh2Shaper (float x) const { return process (x, 2); }
+                float cosShaper (float x) const { return process (x, 3); }
+
+                float_4 linearShaper (float_4 x) const { return x; }
+                float_4 tanhShaper (float_4 x) const { return process (x, 1); }
+                float_4 tanh2Shaper (float_4 x) const { return process (x, 2); }
+                float_4 cosShaper (float_4 x) const { return process (x, 3); }
+            };
+
+            /// Plugin wide Nld, use in preference to constructing a local Nld
+            inline const Nld& nld()
+            {
+                static const Nld instance;
+                return instance;
+            }
 
             class Vca : public WaveShapers
             {
             public:
                 Vca()
                 {
-                    addShape (&Vca1, "VCA 1");
-                    addShape (&Vca2, "VCA 2");
-                    addShape (&Vca3, "VCA 3");
+                    const auto& fixed = sharedFixedShapes();
+                    addShape (&fixed.vca1Shape, &fixed.vca1Integral, "VCA 1");
+                    addShape (&fixed.vca2Shape, &fixed.vca2Integral, "VCA 2");
+                    addShape (&fixed.vca3Shape, &fixed.vca3Integral, "VCA 3");
+                }
+            };
+
+            /// First order antiderivative anti-aliasing (ADAA).
+            /// The shaper output is the mean of the shape between the previous and current
+            /// input, (F(x[n]) - F(x[n-1])) / (x[n] - x[n-1]), which suppresses aliasing
+            /// comparably to heavy oversampling, at the cost of a half sample delay.
+            /// Holds the previous input, so one instance is needed per signal path.
+            template <typename T>
+            class Adaa
+            {
+            public:
+                /// below this input difference the shape at the midpoint is used instead
+                static constexpr float minDelta = 1.0e-3f;
+
+                T process (const WaveShapers& shapers, const T in, const int definitionIndex)
+                {
+                    if (definitionIndex == 0)
+                        return in;
+                    const auto* table = shapers.getTable (definitionIndex);
+                    const auto* integral = shapers.getIntegral (definitionIndex);
+                    if (integral == nullptr)
+                        return shapers.process (in, definitionIndex);
+
+                    if (definitionIndex != lastDefinitionIndex)
+                    {
+                        lastDefinitionIndex = definitionIndex;
+                        integral1 = processIntegral (integral, x1);
+                    }
+                    return processAdaa (table, integral, in);
+                }
+
+                /// in and out may be the same buffer
+                void processBlock (const WaveShapers& shapers, const T* in, T* out, const int n, const int definitionIndex)
+                {
+                    const auto* table = shapers.getTable (definitionIndex);
+                    const auto* integral = shapers.getIntegral (definitionIndex);
+                    if (definitionIndex == 0 || integral == nullptr)
+                    {
+                        shapers.processBlock (in, out, n, definitionIndex);
+                        return;
+                    }
+                    if (definitionIndex != lastDefinitionIndex)
+                    {
+                        lastDefinitionIndex = definitionIndex;
+                        integral1 = processIntegral (integral, x1);
+                    }
+                    for (auto i = 0; i < n; ++i)
+                        out[i] = processAdaa (table, integral, in[i]);
                 }
+
+                void reset()
+                {
+                    x1 = T (0.0f);
+                    integral1 = T (0.0f);
+                    lastDefinitionIndex = -1;
+                }
+
+            private:
+                T processAdaa (const Table* table, const Table* integral, const T in)
+                {
+                    const auto x = clampInput (in);
+                    const auto integral0 = processIntegral (integral, x);
+                    const auto delta = x - x1;
+                    const auto useMidpoint = rack::simd::abs (delta) < minDelta;
+                    const auto midpoint = WaveShaper::process (table, (x + x1) * 0.5f);
+                    const auto out = rack::simd::ifelse (useMidpoint,
+                                                         midpoint,
+                                                         (integral0 - integral1) / rack::simd::ifelse (useMidpoint, T (1.0f), delta));
+                    x1 = x;
+                    integral1 = integral0;
+                    return out;
+                }
+
+                static float clampInput (const float in)
+                {
+                    return std::min (std::max (in, minValue), maxIntegralInput);
+                }
+
+                static float_4 clampInput (const float_4 in)
+                {
+                    return rack::simd::clamp (in, float_4 (minValue), float_4 (maxIntegralInput));
+                }
+
+                T x1{ 0.0f };
+                T integral1{ 0.0f };
+                int lastDefinitionIndex{ -1 };
             };
 
         } // namespace WaveShaper
     } // namespace AudioMath
+
+    /// The aliasing suppression a shaper composite can choose between, stored as a param value
+    enum Antialiasing
+    {
+        OVERSAMPLE_ANTIALIASING,
+        ADAA_ANTIALIASING,
+        NUM_ANTIALIASINGS
+    };
 } // namespace sspo
\ No newline at end of file
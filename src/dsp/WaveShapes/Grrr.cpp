@@ -1,4100 +0,0 @@
-//copyright Dave French, Curlymorphic 2023, GPL3 or later
-
-//4096 bin waveshaper -1.2 +1.2
-
-#include <array>
-std::array<float, 4096> Grrr{ -0.2173828125,
-                              -0.2173828125,
-                              -0.2173828125,
-                              -0.2173828125,
-                              -0.2173828125,
-                              -0.2173828125,
-                              -0.2173828125,
-                              -0.2173828125,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.216796875,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.2162109375,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.21562499999999998,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.2150390625,
-                              -0.214453125,
-                              -0.214453125,
-                              -0.214453125,
-                              -0.214453125,
-                              -0.214453125,
-                              -0.214453125,
-                              -0.214453125,
-                              -0.214453125,
-                              -0.214453125,
-                              -0.214453125,
-                              -0.214453125,
-                              -0.214453125,
-                              -0.214453125,
-                              -0.214453125,
-                              -0.214453125,
-                              -0.214453125,
-                              -0.214453125,
-                              -0.214453125,
-                              -0.214453125,
-                              -0.214453125,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.2138671875,
-                              -0.21328125,
-                              -0.2138671875,
-                              -0.21328125,
-                              -0.21328125,
-                              -0.21328125,
-                              -0.21328125,
-                              -0.21328125,
-                              -0.21328125,
-                              -0.21328125,
-                              -0.21328125,
-                              -0.21328125,
-                              -0.21328125,
-                              -0.21328125,
-                              -0.21328125,
-                              -0.21328125,
-                              -0.21328125,
-                              -0.21328125,
-                              -0.21328125,
-                              -0.21328125,
-                              -0.21328125,
-                              -0.21328125,
-                              -0.21328125,
-                              -0.21269531249999998,
-                              -0.21269531249999998,
-                              -0.21269531249999998,
-                              -0.21269531249999998,
-                              -0.21269531249999998,
-                              -0.21269531249999998,
-                              -0.21269531249999998,
-                              -0.21269531249999998,
-                              -0.21269531249999998,
-                              -0.21269531249999998,
-                              -0.21269531249999998,
-                              -0.21269531249999998,
-                              -0.21269531249999998,
-                              -0.21269531249999998,
-                              -0.21269531249999998,
-                              -0.21269531249999998,
-                              -0.21269531249999998,
-                              -0.21269531249999998,
-                              -0.21269531249999998,
-                              -0.21269531249999998,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.212109375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2115234375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2109375,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.2103515625,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.20976562499999998,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.2091796875,
-                              -0.20859375,
-                              -0.2091796875,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.20859375,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.2080078125,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.2080078125,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.207421875,
-                              -0.20683593749999998,
-                              -0.20683593749999998,
-                              -0.207421875,
-                              -0.20683593749999998,
-                              -0.20683593749999998,
-                              -0.20683593749999998,
-                              -0.20683593749999998,
-                              -0.20683593749999998,
-                              -0.20683593749999998,
-                              -0.20683593749999998,
-                              -0.20683593749999998,
-                              -0.20683593749999998,
-                              -0.20683593749999998,
-                              -0.20683593749999998,
-                              -0.20683593749999998,
-                              -0.20683593749999998,
-                              -0.20683593749999998,
-                              -0.20683593749999998,
-                              -0.20683593749999998,
-                              -0.20683593749999998,
-                              -0.20683593749999998,
-                              -0.20683593749999998,
-                              -0.20625,
-                              -0.20683593749999998,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.20625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.2056640625,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.205078125,
-                              -0.2044921875,
-                              -0.205078125,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.2044921875,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.20390624999999998,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.2033203125,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.202734375,
-                              -0.2021484375,
-                              -0.202734375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.2015625,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.20097656249999998,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.20097656249999998,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.200390625,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.1998046875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.19921875,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.1986328125,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.19804687499999998,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.1974609375,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.196875,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.1962890625,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19511718749999998,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.1939453125,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.193359375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.1927734375,
-                              -0.19218749999999998,
-                              -0.1927734375,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.19218749999999998,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.1916015625,
-                              -0.191015625,
-                              -0.1916015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.191015625,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18984375,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.18925781249999998,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.188671875,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1880859375,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1875,
-                              -0.1869140625,
-                              -0.1869140625,
-                              -0.1869140625,
-                              -0.1869140625,
-                              -0.1869140625,
-                              -0.1869140625,
-                              -0.1869140625,
-                              -0.1869140625,
-                              -0.1869140625,
-                              -0.1869140625,
-                              -0.1869140625,
-                              -0.1869140625,
-                              -0.1869140625,
-                              -0.18632812499999998,
-                              -0.18632812499999998,
-                              -0.18632812499999998,
-                              -0.18632812499999998,
-                              -0.18632812499999998,
-                              -0.18632812499999998,
-                              -0.1857421875,
-                              -0.1857421875,
-                              -0.18515625,
-                              -0.1845703125,
-                              -0.1845703125,
-                              -0.1845703125,
-                              -0.1845703125,
-                              -0.183984375,
-                              -0.183984375,
-                              -0.18339843749999998,
-                              -0.18339843749999998,
-                              -0.18339843749999998,
-                              -0.1828125,
-                              -0.1828125,
-                              -0.1822265625,
-                              -0.1822265625,
-                              -0.1822265625,
-                              -0.181640625,
-                              -0.181640625,
-                              -0.181640625,
-                              -0.1810546875,
-                              -0.1810546875,
-                              -0.18046874999999998,
-                              -0.18046874999999998,
-                              -0.1798828125,
-                              -0.1798828125,
-                              -0.1798828125,
-                              -0.179296875,
-                              -0.179296875,
-                              -0.179296875,
-                              -0.1787109375,
-                              -0.1787109375,
-                              -0.178125,
-                              -0.178125,
-                              -0.178125,
-                              -0.17753906249999998,
-                              -0.17753906249999998,
-                              -0.176953125,
-                              -0.176953125,
-                              -0.176953125,
-                              -0.1763671875,
-                              -0.1763671875,
-                              -0.17578125,
-                              -0.17578125,
-                              -0.17578125,
-                              -0.1751953125,
-                              -0.1751953125,
-                              -0.1751953125,
-                              -0.17460937499999998,
-                              -0.17460937499999998,
-                              -0.1740234375,
-                              -0.1740234375,
-                              -0.1740234375,
-                              -0.1734375,
-                              -0.1734375,
-                              -0.1734375,
-                              -0.1728515625,
-                              -0.1728515625,
-                              -0.172265625,
-                              -0.172265625,
-                              -0.17167968749999998,
-                              -0.17167968749999998,
-                              -0.17167968749999998,
-                              -0.17109375,
-                              -0.17109375,
-                              -0.17109375,
-                              -0.1705078125,
-                              -0.1705078125,
-                              -0.1705078125,
-                              -0.169921875,
-                              -0.169921875,
-                              -0.1693359375,
-                              -0.1693359375,
-                              -0.1693359375,
-                              -0.16874999999999998,
-                              -0.16874999999999998,
-                              -0.1681640625,
-                              -0.1681640625,
-                              -0.1681640625,
-                              -0.167578125,
-                              -0.167578125,
-                              -0.167578125,
-                              -0.1669921875,
-                              -0.1669921875,
-                              -0.16640625,
-                              -0.16640625,
-                              -0.16582031249999998,
-                              -0.16582031249999998,
-                              -0.16582031249999998,
-                              -0.165234375,
-                              -0.165234375,
-                              -0.165234375,
-                              -0.1646484375,
-                              -0.1646484375,
-                              -0.1640625,
-                              -0.1640625,
-                              -0.1640625,
-                              -0.1634765625,
-                              -0.1634765625,
-                              -0.1634765625,
-                              -0.16289062499999998,
-                              -0.16289062499999998,
-                              -0.1623046875,
-                              -0.1623046875,
-                              -0.1623046875,
-                              -0.16171875,
-                              -0.16171875,
-                              -0.16171875,
-                              -0.1611328125,
-                              -0.1611328125,
-                              -0.160546875,
-                              -0.160546875,
-                              -0.160546875,
-                              -0.15996093749999998,
-                              -0.15996093749999998,
-                              -0.159375,
-                              -0.159375,
-                              -0.159375,
-                              -0.1587890625,
-                              -0.1587890625,
-                              -0.158203125,
-                              -0.158203125,
-                              -0.158203125,
-                              -0.1576171875,
-                              -0.1576171875,
-                              -0.15703124999999998,
-                              -0.15703124999999998,
-                              -0.15703124999999998,
-                              -0.1564453125,
-                              -0.1564453125,
-                              -0.1564453125,
-                              -0.155859375,
-                              -0.155859375,
-                              -0.1552734375,
-                              -0.1552734375,
-                              -0.1552734375,
-                              -0.1546875,
-                              -0.1546875,
-                              -0.15410156249999998,
-                              -0.15410156249999998,
-                              -0.15410156249999998,
-                              -0.153515625,
-                              -0.153515625,
-                              -0.153515625,
-                              -0.1529296875,
-                              -0.1529296875,
-                              -0.15234375,
-                              -0.15234375,
-                              -0.15234375,
-                              -0.1517578125,
-                              -0.1517578125,
-                              -0.1517578125,
-                              -0.15117187499999998,
-                              -0.15117187499999998,
-                              -0.1505859375,
-                              -0.1505859375,
-                              -0.1505859375,
-                              -0.15,
-                              -0.15,
-                              -0.1494140625,
-                              -0.1494140625,
-                              -0.1494140625,
-                              -0.148828125,
-                              -0.148828125,
-                              -0.148828125,
-                              -0.14824218749999998,
-                              -0.14824218749999998,
-                              -0.14765625,
-                              -0.14765625,
-                              -0.14765625,
-                              -0.1470703125,
-                              -0.1470703125,
-                              -0.146484375,
-                              -0.146484375,
-                              -0.146484375,
-                              -0.1458984375,
-                              -0.1458984375,
-                              -0.1458984375,
-                              -0.14531249999999998,
-                              -0.14531249999999998,
-                              -0.1447265625,
-                              -0.1447265625,
-                              -0.1447265625,
-                              -0.144140625,
-                              -0.144140625,
-                              -0.1435546875,
-                              -0.1435546875,
-                              -0.1435546875,
-                              -0.14296875,
-                              -0.14296875,
-                              -0.14296875,
-                              -0.14238281249999998,
-                              -0.14238281249999998,
-                              -0.14238281249999998,
-                              -0.141796875,
-                              -0.141796875,
-                              -0.1412109375,
-                              -0.1412109375,
-                              -0.1412109375,
-                              -0.140625,
-                              -0.140625,
-                              -0.1400390625,
-                              -0.1400390625,
-                              -0.1400390625,
-                              -0.13945312499999998,
-                              -0.13945312499999998,
-                              -0.1388671875,
-                              -0.1388671875,
-                              -0.1388671875,
-                              -0.13828125,
-                              -0.13828125,
-                              -0.13828125,
-                              -0.1376953125,
-                              -0.1376953125,
-                              -0.137109375,
-                              -0.137109375,
-                              -0.137109375,
-                              -0.13652343749999998,
-                              -0.13652343749999998,
-                              -0.13652343749999998,
-                              -0.1359375,
-                              -0.1359375,
-                              -0.1353515625,
-                              -0.1353515625,
-                              -0.1353515625,
-                              -0.134765625,
-                              -0.134765625,
-                              -0.134765625,
-                              -0.1341796875,
-                              -0.1341796875,
-                              -0.13359374999999998,
-                              -0.13359374999999998,
-                              -0.13359374999999998,
-                              -0.1330078125,
-                              -0.1330078125,
-                              -0.1330078125,
-                              -0.132421875,
-                              -0.132421875,
-                              -0.1318359375,
-                              -0.1318359375,
-                              -0.1318359375,
-                              -0.13125,
-                              -0.13125,
-                              -0.13066406249999998,
-                              -0.13066406249999998,
-                              -0.13066406249999998,
-                              -0.130078125,
-                              -0.130078125,
-                              -0.1294921875,
-                              -0.1294921875,
-                              -0.1294921875,
-                              -0.12890625,
-                              -0.12890625,
-                              -0.12890625,
-                              -0.1283203125,
-                              -0.1283203125,
-                              -0.1283203125,
-                              -0.12773437499999998,
-                              -0.12773437499999998,
-                              -0.1271484375,
-                              -0.1271484375,
-                              -0.1271484375,
-                              -0.1265625,
-                              -0.1265625,
-                              -0.1259765625,
-                              -0.1259765625,
-                              -0.1259765625,
-                              -0.125390625,
-                              -0.125390625,
-                              -0.125390625,
-                              -0.1248046875,
-                              -0.1248046875,
-                              -0.12421874999999999,
-                              -0.12421874999999999,
-                              -0.12421874999999999,
-                              -0.1236328125,
-                              -0.1236328125,
-                              -0.1236328125,
-                              -0.123046875,
-                              -0.123046875,
-                              -0.12246093749999999,
-                              -0.12246093749999999,
-                              -0.12246093749999999,
-                              -0.121875,
-                              -0.121875,
-                              -0.121875,
-                              -0.12128906249999999,
-                              -0.12128906249999999,
-                              -0.120703125,
-                              -0.120703125,
-                              -0.120703125,
-                              -0.1201171875,
-                              -0.1201171875,
-                              -0.1201171875,
-                              -0.11953124999999999,
-                              -0.11953124999999999,
-                              -0.1189453125,
-                              -0.1189453125,
-                              -0.1189453125,
-                              -0.11835937499999999,
-                              -0.11835937499999999,
-                              -0.11835937499999999,
-                              -0.1177734375,
-                              -0.1177734375,
-                              -0.1171875,
-                              -0.1171875,
-                              -0.1171875,
-                              -0.11660156249999999,
-                              -0.11660156249999999,
-                              -0.116015625,
-                              -0.116015625,
-                              -0.116015625,
-                              -0.11542968749999999,
-                              -0.11542968749999999,
-                              -0.11542968749999999,
-                              -0.11484375,
-                              -0.11484375,
-                              -0.1142578125,
-                              -0.1142578125,
-                              -0.1142578125,
-                              -0.11367187499999999,
-                              -0.11367187499999999,
-                              -0.11367187499999999,
-                              -0.1130859375,
-                              -0.1130859375,
-                              -0.1130859375,
-                              -0.11249999999999999,
-                              -0.11249999999999999,
-                              -0.1119140625,
-                              -0.1119140625,
-                              -0.1119140625,
-                              -0.111328125,
-                              -0.111328125,
-                              -0.111328125,
-                              -0.11074218749999999,
-                              -0.11074218749999999,
-                              -0.11015625,
-                              -0.11015625,
-                              -0.11015625,
-                              -0.1095703125,
-                              -0.1095703125,
-                              -0.1095703125,
-                              -0.108984375,
-                              -0.108984375,
-                              -0.1083984375,
-                              -0.1083984375,
-                              -0.1083984375,
-                              -0.10781249999999999,
-                              -0.10781249999999999,
-                              -0.10781249999999999,
-                              -0.1072265625,
-                              -0.1072265625,
-                              -0.106640625,
-                              -0.106640625,
-                              -0.106640625,
-                              -0.1060546875,
-                              -0.1060546875,
-                              -0.1060546875,
-                              -0.10546875,
-                              -0.10546875,
-                              -0.10488281249999999,
-                              -0.10488281249999999,
-                              -0.10488281249999999,
-                              -0.104296875,
-                              -0.104296875,
-                              -0.1037109375,
-                              -0.1037109375,
-                              -0.1037109375,
-                              -0.103125,
-                              -0.103125,
-                              -0.103125,
-                              -0.1025390625,
-                              -0.1025390625,
-                              -0.1025390625,
-                              -0.10195312499999999,
-                              -0.10195312499999999,
-                              -0.1013671875,
-                              -0.1013671875,
-                              -0.1013671875,
-                              -0.10078125,
-                              -0.10078125,
-                              -0.1001953125,
-                              -0.1001953125,
-                              -0.1001953125,
-                              -0.099609375,
-                              -0.099609375,
-                              -0.099609375,
-                              -0.09902343749999999,
-                              -0.09902343749999999,
-                              -0.09902343749999999,
-                              -0.0984375,
-                              -0.0984375,
-                              -0.0978515625,
-                              -0.0978515625,
-                              -0.0978515625,
-                              -0.097265625,
-                              -0.097265625,
-                              -0.097265625,
-                              -0.0966796875,
-                              -0.0966796875,
-                              -0.09609374999999999,
-                              -0.09609374999999999,
-                              -0.09609374999999999,
-                              -0.0955078125,
-                              -0.0955078125,
-                              -0.0955078125,
-                              -0.094921875,
-                              -0.094921875,
-                              -0.0943359375,
-                              -0.0943359375,
-                              -0.0943359375,
-                              -0.09375,
-                              -0.09375,
-                              -0.09375,
-                              -0.09316406249999999,
-                              -0.09316406249999999,
-                              -0.092578125,
-                              -0.092578125,
-                              -0.092578125,
-                              -0.0919921875,
-                              -0.0919921875,
-                              -0.0919921875,
-                              -0.09140625,
-                              -0.09140625,
-                              -0.0908203125,
-                              -0.0908203125,
-                              -0.0908203125,
-                              -0.09023437499999999,
-                              -0.09023437499999999,
-                              -0.09023437499999999,
-                              -0.0896484375,
-                              -0.0896484375,
-                              -0.0890625,
-                              -0.0890625,
-                              -0.0890625,
-                              -0.0884765625,
-                              -0.0884765625,
-                              -0.0884765625,
-                              -0.087890625,
-                              -0.087890625,
-                              -0.08730468749999999,
-                              -0.08730468749999999,
-                              -0.08730468749999999,
-                              -0.08671875,
-                              -0.08671875,
-                              -0.08671875,
-                              -0.0861328125,
-                              -0.0861328125,
-                              -0.0861328125,
-                              -0.085546875,
-                              -0.085546875,
-                              -0.0849609375,
-                              -0.0849609375,
-                              -0.0849609375,
-                              -0.08437499999999999,
-                              -0.08437499999999999,
-                              -0.08437499999999999,
-                              -0.0837890625,
-                              -0.0837890625,
-                              -0.083203125,
-                              -0.083203125,
-                              -0.083203125,
-                              -0.0826171875,
-                              -0.0826171875,
-                              -0.0826171875,
-                              -0.08203125,
-                              -0.08203125,
-                              -0.08203125,
-                              -0.08144531249999999,
-                              -0.08144531249999999,
-                              -0.080859375,
-                              -0.080859375,
-                              -0.080859375,
-                              -0.0802734375,
-                              -0.0802734375,
-                              -0.0802734375,
-                              -0.0796875,
-                              -0.0796875,
-                              -0.0791015625,
-                              -0.0791015625,
-                              -0.0791015625,
-                              -0.07851562499999999,
-                              -0.07851562499999999,
-                              -0.07851562499999999,
-                              -0.0779296875,
-                              -0.0779296875,
-                              -0.0779296875,
-                              -0.07734375,
-                              -0.07734375,
-                              -0.0767578125,
-                              -0.0767578125,
-                              -0.0767578125,
-                              -0.076171875,
-                              -0.076171875,
-                              -0.076171875,
-                              -0.07558593749999999,
-                              -0.07558593749999999,
-                              -0.075,
-                              -0.075,
-                              -0.075,
-                              -0.0744140625,
-                              -0.0744140625,
-                              -0.0744140625,
-                              -0.073828125,
-                              -0.073828125,
-                              -0.0732421875,
-                              -0.0732421875,
-                              -0.0732421875,
-                              -0.07265624999999999,
-                              -0.07265624999999999,
-                              -0.07265624999999999,
-                              -0.0720703125,
-                              -0.0720703125,
-                              -0.0720703125,
-                              -0.071484375,
-                              -0.071484375,
-                              -0.071484375,
-                              -0.0708984375,
-                              -0.0708984375,
-                              -0.0703125,
-                              -0.0703125,
-                              -0.0703125,
-                              -0.06972656249999999,
-                              -0.06972656249999999,
-                              -0.06972656249999999,
-                              -0.069140625,
-                              -0.069140625,
-                              -0.0685546875,
-                              -0.0685546875,
-                              -0.0685546875,
-                              -0.06796875,
-                              -0.06796875,
-                              -0.06796875,
-                              -0.0673828125,
-                              -0.0673828125,
-                              -0.06679687499999999,
-                              -0.06679687499999999,
-                              -0.06679687499999999,
-                              -0.0662109375,
-                              -0.0662109375,
-                              -0.0662109375,
-                              -0.065625,
-                              -0.065625,
-                              -0.065625,
-                              -0.0650390625,
-                              -0.0650390625,
-                              -0.064453125,
-                              -0.064453125,
-                              -0.064453125,
-                              -0.06386718749999999,
-                              -0.06386718749999999,
-                              -0.06386718749999999,
-                              -0.06328125,
-                              -0.06328125,
-                              -0.0626953125,
-                              -0.0626953125,
-                              -0.0626953125,
-                              -0.062109374999999994,
-                              -0.062109374999999994,
-                              -0.062109374999999994,
-                              -0.0615234375,
-                              -0.0615234375,
-                              -0.0615234375,
-                              -0.0609375,
-                              -0.0609375,
-                              -0.0603515625,
-                              -0.0603515625,
-                              -0.0603515625,
-                              -0.059765624999999996,
-                              -0.059765624999999996,
-                              -0.059765624999999996,
-                              -0.059179687499999994,
-                              -0.059179687499999994,
-                              -0.059179687499999994,
-                              -0.05859375,
-                              -0.05859375,
-                              -0.0580078125,
-                              -0.0580078125,
-                              -0.0580078125,
-                              -0.0580078125,
-                              -0.057421875,
-                              -0.057421875,
-                              -0.056835937499999996,
-                              -0.056835937499999996,
-                              -0.056835937499999996,
-                              -0.056249999999999994,
-                              -0.056249999999999994,
-                              -0.0556640625,
-                              -0.0556640625,
-                              -0.0556640625,
-                              -0.055078125,
-                              -0.055078125,
-                              -0.055078125,
-                              -0.0544921875,
-                              -0.0544921875,
-                              -0.0544921875,
-                              -0.053906249999999996,
-                              -0.053906249999999996,
-                              -0.053906249999999996,
-                              -0.0533203125,
-                              -0.0533203125,
-                              -0.052734375,
-                              -0.052734375,
-                              -0.052734375,
-                              -0.0521484375,
-                              -0.0521484375,
-                              -0.0521484375,
-                              -0.0515625,
-                              -0.0515625,
-                              -0.050976562499999996,
-                              -0.050976562499999996,
-                              -0.050976562499999996,
-                              -0.050390625,
-                              -0.050390625,
-                              -0.050390625,
-                              -0.0498046875,
-                              -0.0498046875,
-                              -0.0498046875,
-                              -0.04921875,
-                              -0.04921875,
-                              -0.0486328125,
-                              -0.0486328125,
-                              -0.0486328125,
-                              -0.048046874999999996,
-                              -0.048046874999999996,
-                              -0.048046874999999996,
-                              -0.0474609375,
-                              -0.0474609375,
-                              -0.0474609375,
-                              -0.046875,
-                              -0.046875,
-                              -0.046875,
-                              -0.0462890625,
-                              -0.0462890625,
-                              -0.045703125,
-                              -0.045703125,
-                              -0.045703125,
-                              -0.045117187499999996,
-                              -0.045117187499999996,
-                              -0.045117187499999996,
-                              -0.04453125,
-                              -0.04453125,
-                              -0.04453125,
-                              -0.0439453125,
-                              -0.0439453125,
-                              -0.043359375,
-                              -0.043359375,
-                              -0.043359375,
-                              -0.0427734375,
-                              -0.0427734375,
-                              -0.0427734375,
-                              -0.042187499999999996,
-                              -0.042187499999999996,
-                              -0.0416015625,
-                              -0.0416015625,
-                              -0.0416015625,
-                              -0.041015625,
-                              -0.041015625,
-                              -0.041015625,
-                              -0.0404296875,
-                              -0.0404296875,
-                              -0.0404296875,
-                              -0.03984375,
-                              -0.03984375,
-                              -0.039257812499999996,
-                              -0.039257812499999996,
-                              -0.039257812499999996,
-                              -0.038671875,
-                              -0.038671875,
-                              -0.038671875,
-                              -0.0380859375,
-                              -0.0380859375,
-                              -0.0380859375,
-                              -0.0375,
-                              -0.0375,
-                              -0.0375,
-                              -0.0369140625,
-                              -0.0369140625,
-                              -0.036328124999999996,
-                              -0.036328124999999996,
-                              -0.036328124999999996,
-                              -0.0357421875,
-                              -0.0357421875,
-                              -0.0357421875,
-                              -0.03515625,
-                              -0.03515625,
-                              -0.03515625,
-                              -0.0345703125,
-                              -0.0345703125,
-                              -0.033984375,
-                              -0.033984375,
-                              -0.033984375,
-                              -0.033398437499999996,
-                              -0.033398437499999996,
-                              -0.033398437499999996,
-                              -0.0328125,
-                              -0.0328125,
-                              -0.0328125,
-                              -0.0322265625,
-                              -0.0322265625,
-                              -0.0322265625,
-                              -0.031640625,
-                              -0.031640625,
-                              -0.031054687499999997,
-                              -0.031054687499999997,
-                              -0.031054687499999997,
-                              -0.03046875,
-                              -0.03046875,
-                              -0.03046875,
-                              -0.029882812499999998,
-                              -0.029882812499999998,
-                              -0.029882812499999998,
-                              -0.029296875,
-                              -0.029296875,
-                              -0.029296875,
-                              -0.0287109375,
-                              -0.0287109375,
-                              -0.028124999999999997,
-                              -0.028124999999999997,
-                              -0.028124999999999997,
-                              -0.0275390625,
-                              -0.0275390625,
-                              -0.0275390625,
-                              -0.026953124999999998,
-                              -0.026953124999999998,
-                              -0.026953124999999998,
-                              -0.0263671875,
-                              -0.0263671875,
-                              -0.0263671875,
-                              -0.02578125,
-                              -0.02578125,
-                              -0.0251953125,
-                              -0.0251953125,
-                              -0.0251953125,
-                              -0.024609375,
-                              -0.024609375,
-                              -0.024609375,
-                              -0.024023437499999998,
-                              -0.024023437499999998,
-                              -0.024023437499999998,
-                              -0.0234375,
-                              -0.0234375,
-                              -0.0228515625,
-                              -0.0228515625,
-                              -0.0228515625,
-                              -0.022265625,
-                              -0.022265625,
-                              -0.022265625,
-                              -0.0216796875,
-                              -0.0216796875,
-                              -0.0216796875,
-                              -0.021093749999999998,
-                              -0.021093749999999998,
-                              -0.0205078125,
-                              -0.0205078125,
-                              -0.0205078125,
-                              -0.0205078125,
-                              -0.019921875,
-                              -0.019921875,
-                              -0.0193359375,
-                              -0.0193359375,
-                              -0.0193359375,
-                              -0.01875,
-                              -0.01875,
-                              -0.01875,
-                              -0.018164062499999998,
-                              -0.018164062499999998,
-                              -0.017578125,
-                              -0.017578125,
-                              -0.017578125,
-                              -0.017578125,
-                              -0.0169921875,
-                              -0.0169921875,
-                              -0.0169921875,
-                              -0.01640625,
-                              -0.01640625,
-                              -0.0158203125,
-                              -0.0158203125,
-                              -0.0158203125,
-                              -0.015234375,
-                              -0.015234375,
-                              -0.015234375,
-                              -0.0146484375,
-                              -0.0146484375,
-                              -0.0146484375,
-                              -0.014062499999999999,
-                              -0.014062499999999999,
-                              -0.013476562499999999,
-                              -0.013476562499999999,
-                              -0.013476562499999999,
-                              -0.013476562499999999,
-                              -0.012890625,
-                              -0.012890625,
-                              -0.0123046875,
-                              -0.0123046875,
-                              -0.0123046875,
-                              -0.01171875,
-                              -0.01171875,
-                              -0.01171875,
-                              -0.0111328125,
-                              -0.0111328125,
-                              -0.010546874999999999,
-                              -0.010546874999999999,
-                              -0.010546874999999999,
-                              -0.0099609375,
-                              -0.0099609375,
-                              -0.0099609375,
-                              -0.009375,
-                              -0.009375,
-                              -0.009375,
-                              -0.0087890625,
-                              -0.0087890625,
-                              -0.0087890625,
-                              -0.008203125,
-                              -0.008203125,
-                              -0.0076171875,
-                              -0.0076171875,
-                              -0.0076171875,
-                              -0.007031249999999999,
-                              -0.007031249999999999,
-                              -0.007031249999999999,
-                              -0.0064453125,
-                              -0.0064453125,
-                              -0.0064453125,
-                              -0.005859375,
-                              -0.005859375,
-                              -0.005859375,
-                              -0.0052734374999999995,
-                              -0.0052734374999999995,
-                              -0.0046875,
-                              -0.0046875,
-                              -0.0046875,
-                              -0.0046875,
-                              -0.0041015625,
-                              -0.0041015625,
-                              -0.0035156249999999997,
-                              -0.0035156249999999997,
-                              -0.0035156249999999997,
-                              -0.0029296875,
-                              -0.0029296875,
-                              -0.0029296875,
-                              -0.00234375,
-                              -0.00234375,
-                              -0.00234375,
-                              -0.0017578124999999998,
-                              -0.0017578124999999998,
-                              -0.001171875,
-                              -0.001171875,
-                              -0.001171875,
-                              -0.0005859375,
-                              -0.0005859375,
-                              -0.0005859375,
-                              0.0,
-                              0.0,
-                              0.0,
-                              0.0005859375,
-                              0.0005859375,
-                              0.0005859375,
-                              0.001171875,
-                              0.001171875,
-                              0.0017578124999999998,
-                              0.0017578124999999998,
-                              0.0017578124999999998,
-                              0.00234375,
-                              0.00234375,
-                              0.00234375,
-                              0.0029296875,
-                              0.0029296875,
-                              0.0029296875,
-                              0.0035156249999999997,
-                              0.0035156249999999997,
-                              0.0035156249999999997,
-                              0.0041015625,
-                              0.0041015625,
-                              0.0041015625,
-                              0.0046875,
-                              0.0046875,
-                              0.0046875,
-                              0.0052734374999999995,
-                              0.0052734374999999995,
-                              0.005859375,
-                              0.005859375,
-                              0.005859375,
-                              0.0064453125,
-                              0.0064453125,
-                              0.0064453125,
-                              0.007031249999999999,
-                              0.007031249999999999,
-                              0.007031249999999999,
-                              0.0076171875,
-                              0.0076171875,
-                              0.008203125,
-                              0.008203125,
-                              0.008203125,
-                              0.0087890625,
-                              0.0087890625,
-                              0.0087890625,
-                              0.009375,
-                              0.009375,
-                              0.009375,
-                              0.0099609375,
-                              0.0099609375,
-                              0.0099609375,
-                              0.010546874999999999,
-                              0.010546874999999999,
-                              0.010546874999999999,
-                              0.0111328125,
-                              0.0111328125,
-                              0.0111328125,
-                              0.01171875,
-                              0.01171875,
-                              0.0123046875,
-                              0.0123046875,
-                              0.0123046875,
-                              0.012890625,
-                              0.012890625,
-                              0.012890625,
-                              0.013476562499999999,
-                              0.013476562499999999,
-                              0.013476562499999999,
-                              0.014062499999999999,
-                              0.014062499999999999,
-                              0.014062499999999999,
-                              0.0146484375,
-                              0.0146484375,
-                              0.015234375,
-                              0.015234375,
-                              0.015234375,
-                              0.0158203125,
-                              0.0158203125,
-                              0.0158203125,
-                              0.01640625,
-                              0.01640625,
-                              0.01640625,
-                              0.0169921875,
-                              0.0169921875,
-                              0.0169921875,
-                              0.017578125,
-                              0.017578125,
-                              0.017578125,
-                              0.018164062499999998,
-                              0.018164062499999998,
-                              0.018164062499999998,
-                              0.01875,
-                              0.01875,
-                              0.0193359375,
-                              0.0193359375,
-                              0.0193359375,
-                              0.0193359375,
-                              0.019921875,
-                              0.019921875,
-                              0.0205078125,
-                              0.0205078125,
-                              0.0205078125,
-                              0.021093749999999998,
-                              0.021093749999999998,
-                              0.021093749999999998,
-                              0.0216796875,
-                              0.0216796875,
-                              0.0216796875,
-                              0.022265625,
-                              0.022265625,
-                              0.022265625,
-                              0.0228515625,
-                              0.0228515625,
-                              0.0228515625,
-                              0.0234375,
-                              0.0234375,
-                              0.0234375,
-                              0.024023437499999998,
-                              0.024023437499999998,
-                              0.024609375,
-                              0.024609375,
-                              0.024609375,
-                              0.0251953125,
-                              0.0251953125,
-                              0.0251953125,
-                              0.02578125,
-                              0.02578125,
-                              0.02578125,
-                              0.0263671875,
-                              0.0263671875,
-                              0.0263671875,
-                              0.026953124999999998,
-                              0.026953124999999998,
-                              0.026953124999999998,
-                              0.0275390625,
-                              0.0275390625,
-                              0.028124999999999997,
-                              0.028124999999999997,
-                              0.028124999999999997,
-                              0.0287109375,
-                              0.0287109375,
-                              0.0287109375,
-                              0.0287109375,
-                              0.029296875,
-                              0.029296875,
-                              0.029882812499999998,
-                              0.029882812499999998,
-                              0.029882812499999998,
-                              0.03046875,
-                              0.03046875,
-                              0.03046875,
-                              0.031054687499999997,
-                              0.031054687499999997,
-                              0.031640625,
-                              0.031640625,
-                              0.031640625,
-                              0.0322265625,
-                              0.0322265625,
-                              0.0322265625,
-                              0.0328125,
-                              0.0328125,
-                              0.0328125,
-                              0.033398437499999996,
-                              0.033398437499999996,
-                              0.033398437499999996,
-                              0.033984375,
-                              0.033984375,
-                              0.033984375,
-                              0.0345703125,
-                              0.0345703125,
-                              0.0345703125,
-                              0.03515625,
-                              0.03515625,
-                              0.03515625,
-                              0.0357421875,
-                              0.0357421875,
-                              0.0357421875,
-                              0.036328124999999996,
-                              0.036328124999999996,
-                              0.036328124999999996,
-                              0.0369140625,
-                              0.0369140625,
-                              0.0369140625,
-                              0.0375,
-                              0.0375,
-                              0.0380859375,
-                              0.0380859375,
-                              0.0380859375,
-                              0.038671875,
-                              0.038671875,
-                              0.038671875,
-                              0.039257812499999996,
-                              0.039257812499999996,
-                              0.039257812499999996,
-                              0.03984375,
-                              0.03984375,
-                              0.03984375,
-                              0.0404296875,
-                              0.0404296875,
-                              0.0404296875,
-                              0.041015625,
-                              0.041015625,
-                              0.041015625,
-                              0.0416015625,
-                              0.0416015625,
-                              0.0416015625,
-                              0.042187499999999996,
-                              0.042187499999999996,
-                              0.042187499999999996,
-                              0.0427734375,
-                              0.0427734375,
-                              0.043359375,
-                              0.043359375,
-                              0.043359375,
-                              0.043359375,
-                              0.0439453125,
-                              0.0439453125,
-                              0.04453125,
-                              0.04453125,
-                              0.04453125,
-                              0.045117187499999996,
-                              0.045117187499999996,
-                              0.045117187499999996,
-                              0.045703125,
-                              0.045703125,
-                              0.045703125,
-                              0.0462890625,
-                              0.0462890625,
-                              0.0462890625,
-                              0.046875,
-                              0.046875,
-                              0.0474609375,
-                              0.0474609375,
-                              0.0474609375,
-                              0.0474609375,
-                              0.048046874999999996,
-                              0.048046874999999996,
-                              0.0486328125,
-                              0.0486328125,
-                              0.0486328125,
-                              0.0486328125,
-                              0.04921875,
-                              0.04921875,
-                              0.0498046875,
-                              0.0498046875,
-                              0.0498046875,
-                              0.050390625,
-                              0.050390625,
-                              0.050390625,
-                              0.050976562499999996,
-                              0.050976562499999996,
-                              0.050976562499999996,
-                              0.0515625,
-                              0.0515625,
-                              0.0515625,
-                              0.0521484375,
-                              0.0521484375,
-                              0.0521484375,
-                              0.052734375,
-                              0.052734375,
-                              0.052734375,
-                              0.0533203125,
-                              0.0533203125,
-                              0.0533203125,
-                              0.053906249999999996,
-                              0.053906249999999996,
-                              0.053906249999999996,
-                              0.0544921875,
-                              0.0544921875,
-                              0.0544921875,
-                              0.055078125,
-                              0.055078125,
-                              0.055078125,
-                              0.0556640625,
-                              0.0556640625,
-                              0.0556640625,
-                              0.056249999999999994,
-                              0.056249999999999994,
-                              0.056249999999999994,
-                              0.056835937499999996,
-                              0.056835937499999996,
-                              0.056835937499999996,
-                              0.057421875,
-                              0.057421875,
-                              0.057421875,
-                              0.0580078125,
-                              0.0580078125,
-                              0.05859375,
-                              0.05859375,
-                              0.05859375,
-                              0.05859375,
-                              0.059179687499999994,
-                              0.059179687499999994,
-                              0.059765624999999996,
-                              0.059765624999999996,
-                              0.059765624999999996,
-                              0.0603515625,
-                              0.0603515625,
-                              0.0603515625,
-                              0.0609375,
-                              0.0609375,
-                              0.0609375,
-                              0.0615234375,
-                              0.0615234375,
-                              0.0615234375,
-                              0.062109374999999994,
-                              0.062109374999999994,
-                              0.062109374999999994,
-                              0.0626953125,
-                              0.0626953125,
-                              0.0626953125,
-                              0.06328125,
-                              0.06328125,
-                              0.06328125,
-                              0.06386718749999999,
-                              0.06386718749999999,
-                              0.06386718749999999,
-                              0.064453125,
-                              0.064453125,
-                              0.0650390625,
-                              0.0650390625,
-                              0.0650390625,
-                              0.0650390625,
-                              0.065625,
-                              0.065625,
-                              0.0662109375,
-                              0.0662109375,
-                              0.0662109375,
-                              0.0662109375,
-                              0.06679687499999999,
-                              0.06679687499999999,
-                              0.0673828125,
-                              0.0673828125,
-                              0.0673828125,
-                              0.0673828125,
-                              0.06796875,
-                              0.06796875,
-                              0.0685546875,
-                              0.0685546875,
-                              0.0685546875,
-                              0.069140625,
-                              0.069140625,
-                              0.069140625,
-                              0.06972656249999999,
-                              0.06972656249999999,
-                              0.06972656249999999,
-                              0.0703125,
-                              0.0703125,
-                              0.0703125,
-                              0.0708984375,
-                              0.0708984375,
-                              0.0708984375,
-                              0.071484375,
-                              0.071484375,
-                              0.071484375,
-                              0.0720703125,
-                              0.0720703125,
-                              0.0720703125,
-                              0.07265624999999999,
-                              0.07265624999999999,
-                              0.07265624999999999,
-                              0.0732421875,
-                              0.0732421875,
-                              0.0732421875,
-                              0.073828125,
-                              0.073828125,
-                              0.073828125,
-                              0.0744140625,
-                              0.0744140625,
-                              0.0744140625,
-                              0.075,
-                              0.075,
-                              0.075,
-                              0.07558593749999999,
-                              0.07558593749999999,
-                              0.07558593749999999,
-                              0.076171875,
-                              0.076171875,
-                              0.076171875,
-                              0.0767578125,
-                              0.0767578125,
-                              0.0767578125,
-                              0.07734375,
-                              0.07734375,
-                              0.07734375,
-                              0.0779296875,
-                              0.0779296875,
-                              0.0779296875,
-                              0.07851562499999999,
-                              0.07851562499999999,
-                              0.07851562499999999,
-                              0.0791015625,
-                              0.0791015625,
-                              0.0791015625,
-                              0.0796875,
-                              0.0796875,
-                              0.0796875,
-                              0.0802734375,
-                              0.0802734375,
-                              0.080859375,
-                              0.080859375,
-                              0.080859375,
-                              0.080859375,
-                              0.08144531249999999,
-                              0.08144531249999999,
-                              0.08144531249999999,
-                              0.08203125,
-                              0.08203125,
-                              0.08203125,
-                              0.0826171875,
-                              0.0826171875,
-                              0.083203125,
-                              0.083203125,
-                              0.083203125,
-                              0.083203125,
-                              0.0837890625,
-                              0.0837890625,
-                              0.08437499999999999,
-                              0.08437499999999999,
-                              0.08437499999999999,
-                              0.08437499999999999,
-                              0.0849609375,
-                              0.0849609375,
-                              0.085546875,
-                              0.085546875,
-                              0.085546875,
-                              0.085546875,
-                              0.0861328125,
-                              0.0861328125,
-                              0.08671875,
-                              0.08671875,
-                              0.08671875,
-                              0.08730468749999999,
-                              0.08730468749999999,
-                              0.08730468749999999,
-                              0.087890625,
-                              0.087890625,
-                              0.087890625,
-                              0.087890625,
-                              0.0884765625,
-                              0.0884765625,
-                              0.0890625,
-                              0.0890625,
-                              0.0890625,
-                              0.0896484375,
-                              0.0896484375,
-                              0.0896484375,
-                              0.09023437499999999,
-                              0.09023437499999999,
-                              0.09023437499999999,
-                              0.0908203125,
-                              0.0908203125,
-                              0.0908203125,
-                              0.09140625,
-                              0.09140625,
-                              0.09140625,
-                              0.0919921875,
-                              0.0919921875,
-                              0.0919921875,
-                              0.092578125,
-                              0.092578125,
-                              0.092578125,
-                              0.09316406249999999,
-                              0.09316406249999999,
-                              0.09316406249999999,
-                              0.09375,
-                              0.09375,
-                              0.09375,
-                              0.0943359375,
-                              0.0943359375,
-                              0.0943359375,
-                              0.094921875,
-                              0.094921875,
-                              0.094921875,
-                              0.0955078125,
-                              0.0955078125,
-                              0.0955078125,
-                              0.09609374999999999,
-                              0.09609374999999999,
-                              0.09609374999999999,
-                              0.0966796875,
-                              0.0966796875,
-                              0.0966796875,
-                              0.097265625,
-                              0.097265625,
-                              0.097265625,
-                              0.0978515625,
-                              0.0978515625,
-                              0.0978515625,
-                              0.0984375,
-                              0.0984375,
-                              0.0984375,
-                              0.09902343749999999,
-                              0.09902343749999999,
-                              0.09902343749999999,
-                              0.099609375,
-                              0.099609375,
-                              0.099609375,
-                              0.099609375,
-                              0.1001953125,
-                              0.1001953125,
-                              0.10078125,
-                              0.10078125,
-                              0.10078125,
-                              0.10078125,
-                              0.1013671875,
-                              0.1013671875,
-                              0.10195312499999999,
-                              0.10195312499999999,
-                              0.10195312499999999,
-                              0.10195312499999999,
-                              0.1025390625,
-                              0.1025390625,
-                              0.103125,
-                              0.103125,
-                              0.103125,
-                              0.1037109375,
-                              0.1037109375,
-                              0.1037109375,
-                              0.104296875,
-                              0.104296875,
-                              0.104296875,
-                              0.104296875,
-                              0.10488281249999999,
-                              0.10488281249999999,
-                              0.10546875,
-                              0.10546875,
-                              0.10546875,
-                              0.10546875,
-                              0.1060546875,
-                              0.1060546875,
-                              0.106640625,
-                              0.106640625,
-                              0.106640625,
-                              0.106640625,
-                              0.1072265625,
-                              0.1072265625,
-                              0.10781249999999999,
-                              0.10781249999999999,
-                              0.10781249999999999,
-                              0.1083984375,
-                              0.1083984375,
-                              0.1083984375,
-                              0.108984375,
-                              0.108984375,
-                              0.108984375,
-                              0.1095703125,
-                              0.1095703125,
-                              0.1095703125,
-                              0.11015625,
-                              0.11015625,
-                              0.11015625,
-                              0.11015625,
-                              0.11074218749999999,
-                              0.11074218749999999,
-                              0.111328125,
-                              0.111328125,
-                              0.111328125,
-                              0.111328125,
-                              0.1119140625,
-                              0.1119140625,
-                              0.11249999999999999,
-                              0.11249999999999999,
-                              0.11249999999999999,
-                              0.11249999999999999,
-                              0.1130859375,
-                              0.1130859375,
-                              0.11367187499999999,
-                              0.11367187499999999,
-                              0.11367187499999999,
-                              0.11367187499999999,
-                              0.1142578125,
-                              0.1142578125,
-                              0.11484375,
-                              0.11484375,
-                              0.11484375,
-                              0.11484375,
-                              0.11542968749999999,
-                              0.11542968749999999,
-                              0.116015625,
-                              0.116015625,
-                              0.116015625,
-                              0.116015625,
-                              0.11660156249999999,
-                              0.11660156249999999,
-                              0.1171875,
-                              0.1171875,
-                              0.1171875,
-                              0.1171875,
-                              0.1177734375,
-                              0.1177734375,
-                              0.11835937499999999,
-                              0.11835937499999999,
-                              0.11835937499999999,
-                              0.11835937499999999,
-                              0.1189453125,
-                              0.1189453125,
-                              0.11953124999999999,
-                              0.11953124999999999,
-                              0.11953124999999999,
-                              0.11953124999999999,
-                              0.1201171875,
-                              0.1201171875,
-                              0.1201171875,
-                              0.120703125,
-                              0.120703125,
-                              0.120703125,
-                              0.12128906249999999,
-                              0.12128906249999999,
-                              0.121875,
-                              0.121875,
-                              0.121875,
-                              0.121875,
-                              0.12246093749999999,
-                              0.12246093749999999,
-                              0.123046875,
-                              0.123046875,
-                              0.123046875,
-                              0.123046875,
-                              0.1236328125,
-                              0.1236328125,
-                              0.12421874999999999,
-                              0.12421874999999999,
-                              0.12421874999999999,
-                              0.12421874999999999,
-                              0.1248046875,
-                              0.1248046875,
-                              0.1248046875,
-                              0.125390625,
-                              0.125390625,
-                              0.125390625,
-                              0.1259765625,
-                              0.1259765625,
-                              0.1259765625,
-                              0.1265625,
-                              0.1265625,
-                              0.1265625,
-                              0.1271484375,
-                              0.1271484375,
-                              0.1271484375,
-                              0.12773437499999998,
-                              0.12773437499999998,
-                              0.12773437499999998,
-                              0.1283203125,
-                              0.1283203125,
-                              0.1283203125,
-                              0.1283203125,
-                              0.12890625,
-                              0.12890625,
-                              0.1294921875,
-                              0.1294921875,
-                              0.1294921875,
-                              0.130078125,
-                              0.130078125,
-                              0.130078125,
-                              0.13066406249999998,
-                              0.13066406249999998,
-                              0.13066406249999998,
-                              0.13066406249999998,
-                              0.13125,
-                              0.13125,
-                              0.1318359375,
-                              0.1318359375,
-                              0.1318359375,
-                              0.1318359375,
-                              0.132421875,
-                              0.132421875,
-                              0.1330078125,
-                              0.1330078125,
-                              0.1330078125,
-                              0.1330078125,
-                              0.13359374999999998,
-                              0.13359374999999998,
-                              0.1341796875,
-                              0.1341796875,
-                              0.1341796875,
-                              0.1341796875,
-                              0.134765625,
-                              0.134765625,
-                              0.1353515625,
-                              0.1353515625,
-                              0.1353515625,
-                              0.1353515625,
-                              0.1359375,
-                              0.1359375,
-                              0.1359375,
-                              0.1359375,
-                              0.13652343749999998,
-                              0.13652343749999998,
-                              0.137109375,
-                              0.137109375,
-                              0.137109375,
-                              0.1376953125,
-                              0.1376953125,
-                              0.1376953125,
-                              0.13828125,
-                              0.13828125,
-                              0.13828125,
-                              0.1388671875,
-                              0.1388671875,
-                              0.1388671875,
-                              0.13945312499999998,
-                              0.13945312499999998,
-                              0.13945312499999998,
-                              0.13945312499999998,
-                              0.1400390625,
-                              0.1400390625,
-                              0.140625,
-                              0.140625,
-                              0.140625,
-                              0.140625,
-                              0.1412109375,
-                              0.1412109375,
-                              0.141796875,
-                              0.141796875,
-                              0.141796875,
-                              0.141796875,
-                              0.14238281249999998,
-                              0.14238281249999998,
-                              0.14296875,
-                              0.14296875,
-                              0.14296875,
-                              0.14296875,
-                              0.1435546875,
-                              0.1435546875,
-                              0.1435546875,
-                              0.144140625,
-                              0.144140625,
-                              0.144140625,
-                              0.1447265625,
-                              0.1447265625,
-                              0.1447265625,
-                              0.14531249999999998,
-                              0.14531249999999998,
-                              0.14531249999999998,
-                              0.1458984375,
-                              0.1458984375,
-                              0.1458984375,
-                              0.146484375,
-                              0.146484375,
-                              0.146484375,
-                              0.1470703125,
-                              0.1470703125,
-                              0.1470703125,
-                              0.1470703125,
-                              0.14765625,
-                              0.14765625,
-                              0.14824218749999998,
-                              0.14824218749999998,
-                              0.14824218749999998,
-                              0.14824218749999998,
-                              0.148828125,
-                              0.148828125,
-                              0.148828125,
-                              0.1494140625,
-                              0.1494140625,
-                              0.1494140625,
-                              0.15,
-                              0.15,
-                              0.15,
-                              0.1505859375,
-                              0.1505859375,
-                              0.1505859375,
-                              0.15117187499999998,
-                              0.15117187499999998,
-                              0.15117187499999998,
-                              0.15117187499999998,
-                              0.1517578125,
-                              0.1517578125,
-                              0.15234375,
-                              0.15234375,
-                              0.15234375,
-                              0.15234375,
-                              0.1529296875,
-                              0.1529296875,
-                              0.153515625,
-                              0.153515625,
-                              0.153515625,
-                              0.153515625,
-                              0.15410156249999998,
-                              0.15410156249999998,
-                              0.1546875,
-                              0.1546875,
-                              0.1546875,
-                              0.1546875,
-                              0.1552734375,
-                              0.1552734375,
-                              0.1552734375,
-                              0.155859375,
-                              0.155859375,
-                              0.155859375,
-                              0.1564453125,
-                              0.1564453125,
-                              0.1564453125,
-                              0.15703124999999998,
-                              0.15703124999999998,
-                              0.15703124999999998,
-                              0.1576171875,
-                              0.1576171875,
-                              0.1576171875,
-                              0.1576171875,
-                              0.158203125,
-                              0.158203125,
-                              0.1587890625,
-                              0.1587890625,
-                              0.1587890625,
-                              0.1587890625,
-                              0.159375,
-                              0.159375,
-                              0.15996093749999998,
-                              0.15996093749999998,
-                              0.15996093749999998,
-                              0.15996093749999998,
-                              0.160546875,
-                              0.160546875,
-                              0.160546875,
-                              0.1611328125,
-                              0.1611328125,
-                              0.1611328125,
-                              0.16171875,
-                              0.16171875,
-                              0.16171875,
-                              0.16171875,
-                              0.1623046875,
-                              0.1623046875,
-                              0.16289062499999998,
-                              0.16289062499999998,
-                              0.16289062499999998,
-                              0.16289062499999998,
-                              0.1634765625,
-                              0.1634765625,
-                              0.1640625,
-                              0.1640625,
-                              0.1640625,
-                              0.1640625,
-                              0.1646484375,
-                              0.1646484375,
-                              0.165234375,
-                              0.165234375,
-                              0.165234375,
-                              0.165234375,
-                              0.16582031249999998,
-                              0.16582031249999998,
-                              0.16582031249999998,
-                              0.16640625,
-                              0.16640625,
-                              0.16640625,
-                              0.1669921875,
-                              0.1669921875,
-                              0.1669921875,
-                              0.1669921875,
-                              0.167578125,
-                              0.167578125,
-                              0.1681640625,
-                              0.1681640625,
-                              0.1681640625,
-                              0.1681640625,
-                              0.16874999999999998,
-                              0.16874999999999998,
-                              0.1693359375,
-                              0.1693359375,
-                              0.1693359375,
-                              0.1693359375,
-                              0.169921875,
-                              0.169921875,
-                              0.1705078125,
-                              0.1705078125,
-                              0.1705078125,
-                              0.1705078125,
-                              0.17109375,
-                              0.17109375,
-                              0.17109375,
-                              0.17109375,
-                              0.17167968749999998,
-                              0.17167968749999998,
-                              0.172265625,
-                              0.172265625,
-                              0.172265625,
-                              0.172265625,
-                              0.1728515625,
-                              0.1728515625,
-                              0.1734375,
-                              0.1734375,
-                              0.1734375,
-                              0.1734375,
-                              0.1740234375,
-                              0.1740234375,
-                              0.1740234375,
-                              0.17460937499999998,
-                              0.17460937499999998,
-                              0.17460937499999998,
-                              0.1751953125,
-                              0.1751953125,
-                              0.1751953125,
-                              0.1751953125,
-                              0.17578125,
-                              0.17578125,
-                              0.1763671875,
-                              0.1763671875,
-                              0.1763671875,
-                              0.1763671875,
-                              0.176953125,
-                              0.176953125,
-                              0.176953125,
-                              0.17753906249999998,
-                              0.17753906249999998,
-                              0.17753906249999998,
-                              0.178125,
-                              0.178125,
-                              0.178125,
-                              0.178125,
-                              0.1787109375,
-                              0.1787109375,
-                              0.179296875,
-                              0.179296875,
-                              0.179296875,
-                              0.179296875,
-                              0.1798828125,
-                              0.1798828125,
-                              0.18046874999999998,
-                              0.18046874999999998,
-                              0.18046874999999998,
-                              0.18046874999999998,
-                              0.1810546875,
-                              0.1810546875,
-                              0.181640625,
-                              0.181640625,
-                              0.181640625,
-                              0.181640625,
-                              0.1822265625,
-                              0.1822265625,
-                              0.1822265625,
-                              0.1822265625,
-                              0.1828125,
-                              0.1828125,
-                              0.18339843749999998,
-                              0.18339843749999998,
-                              0.18339843749999998,
-                              0.18339843749999998,
-                              0.183984375,
-                              0.183984375,
-                              0.1845703125,
-                              0.1845703125,
-                              0.1845703125,
-                              0.1845703125,
-                              0.18515625,
-                              0.18515625,
-                              0.18515625,
-                              0.18515625,
-                              0.1857421875,
-                              0.1857421875,
-                              0.18632812499999998,
-                              0.18632812499999998,
-                              0.18632812499999998,
-                              0.18632812499999998,
-                              0.1869140625,
-                              0.1869140625,
-                              0.1875,
-                              0.1875,
-                              0.1875,
-                              0.1875,
-                              0.1880859375,
-                              0.1880859375,
-                              0.1880859375,
-                              0.188671875,
-                              0.188671875,
-                              0.188671875,
-                              0.18925781249999998,
-                              0.18925781249999998,
-                              0.18925781249999998,
-                              0.18925781249999998,
-                              0.18984375,
-                              0.18984375,
-                              0.1904296875,
-                              0.1904296875,
-                              0.1904296875,
-                              0.1904296875,
-                              0.191015625,
-                              0.191015625,
-                              0.1916015625,
-                              0.1916015625,
-                              0.1916015625,
-                              0.1916015625,
-                              0.19218749999999998,
-                              0.19218749999999998,
-                              0.19218749999999998,
-                              0.19218749999999998,
-                              0.1927734375,
-                              0.1927734375,
-                              0.193359375,
-                              0.193359375,
-                              0.193359375,
-                              0.193359375,
-                              0.1939453125,
-                              0.1939453125,
-                              0.19453125,
-                              0.19453125,
-                              0.19453125,
-                              0.19453125,
-                              0.19511718749999998,
-                              0.19511718749999998,
-                              0.19511718749999998,
-                              0.19511718749999998,
-                              0.195703125,
-                              0.195703125,
-                              0.1962890625,
-                              0.195703125,
-                              0.1962890625,
-                              0.1962890625,
-                              0.196875,
-                              0.196875,
-                              0.196875,
-                              0.196875,
-                              0.1974609375,
-                              0.1974609375,
-                              0.19804687499999998,
-                              0.19804687499999998,
-                              0.19804687499999998,
-                              0.19804687499999998,
-                              0.1986328125,
-                              0.1986328125,
-                              0.1986328125,
-                              0.1986328125,
-                              0.19921875,
-                              0.19921875,
-                              0.1998046875,
-                              0.1998046875,
-                              0.1998046875,
-                              0.1998046875,
-                              0.200390625,
-                              0.200390625,
-                              0.20097656249999998,
-                              0.20097656249999998,
-                              0.20097656249999998,
-                              0.20097656249999998,
-                              0.2015625,
-                              0.2015625,
-                              0.2015625,
-                              0.2015625,
-                              0.2021484375,
-                              0.2021484375,
-                              0.202734375,
-                              0.202734375,
-                              0.202734375,
-                              0.202734375,
-                              0.2033203125,
-                              0.2033203125,
-                              0.20390624999999998,
-                              0.20390624999999998,
-                              0.20390624999999998,
-                              0.20390624999999998,
-                              0.2044921875,
-                              0.2044921875,
-                              0.2044921875,
-                              0.2044921875,
-                              0.205078125,
-                              0.205078125,
-                              0.2056640625,
-                              0.2056640625,
-                              0.2056640625,
-                              0.2056640625,
-                              0.20625,
-                              0.20625,
-                              0.20683593749999998,
-                              0.20683593749999998,
-                              0.20683593749999998,
-                              0.20683593749999998,
-                              0.207421875,
-                              0.207421875,
-                              0.207421875,
-                              0.207421875,
-                              0.2080078125,
-                              0.2080078125,
-                              0.20859375,
-                              0.20859375,
-                              0.20859375,
-                              0.20859375,
-                              0.2091796875,
-                              0.2091796875,
-                              0.2091796875,
-                              0.2091796875,
-                              0.20976562499999998,
-                              0.20976562499999998,
-                              0.2103515625,
-                              0.2103515625,
-                              0.2103515625,
-                              0.2103515625,
-                              0.2109375,
-                              0.2109375,
-                              0.2115234375,
-                              0.2115234375,
-                              0.2115234375,
-                              0.2115234375,
-                              0.212109375,
-                              0.212109375,
-                              0.212109375,
-                              0.212109375,
-                              0.21269531249999998,
-                              0.21269531249999998,
-                              0.21328125,
-                              0.21328125,
-                              0.21328125,
-                              0.21328125,
-                              0.2138671875,
-                              0.2138671875,
-                              0.214453125,
-                              0.214453125,
-                              0.214453125,
-                              0.214453125,
-                              0.2150390625,
-                              0.2150390625,
-                              0.2150390625,
-                              0.2150390625,
-                              0.21562499999999998,
-                              0.21562499999999998,
-                              0.2162109375,
-                              0.2162109375,
-                              0.2162109375,
-                              0.2162109375,
-                              0.216796875,
-                              0.216796875,
-                              0.2173828125,
-                              0.216796875,
-                              0.2173828125,
-                              0.2173828125,
-                              0.21796875,
-                              0.21796875,
-                              0.21796875,
-                              0.21796875,
-                              0.21855468749999998,
-                              0.21855468749999998,
-                              0.21855468749999998,
-                              0.219140625,
-                              0.219140625,
-                              0.219140625,
-                              0.2197265625,
-                              0.2197265625,
-                              0.2197265625,
-                              0.2197265625,
-                              0.2203125,
-                              0.2203125,
-                              0.2208984375,
-                              0.2208984375,
-                              0.2208984375,
-                              0.2208984375,
-                              0.22148437499999998,
-                              0.22148437499999998,
-                              0.22148437499999998,
-                              0.22148437499999998,
-                              0.2220703125,
-                              0.2220703125,
-                              0.22265625,
-                              0.22265625,
-                              0.22265625,
-                              0.22265625,
-                              0.2232421875,
-                              0.2232421875,
-                              0.2232421875,
-                              0.2232421875,
-                              0.223828125,
-                              0.223828125,
-                              0.22441406249999998,
-                              0.22441406249999998,
-                              0.22441406249999998,
-                              0.22441406249999998,
-                              0.22499999999999998,
-                              0.22499999999999998,
-                              0.22499999999999998,
-                              0.22499999999999998,
-                              0.2255859375,
-                              0.2255859375,
-                              0.226171875,
-                              0.226171875,
-                              0.226171875,
-                              0.226171875,
-                              0.2267578125,
-                              0.2267578125,
-                              0.22734374999999998,
-                              0.2267578125,
-                              0.22734374999999998,
-                              0.22734374999999998,
-                              0.22792968749999998,
-                              0.22792968749999998,
-                              0.22792968749999998,
-                              0.22792968749999998,
-                              0.228515625,
-                              0.228515625,
-                              0.2291015625,
-                              0.2291015625,
-                              0.2291015625,
-                              0.2291015625,
-                              0.2296875,
-                              0.2296875,
-                              0.2296875,
-                              0.2296875,
-                              0.23027343749999998,
-                              0.23027343749999998,
-                              0.23085937499999998,
-                              0.23085937499999998,
-                              0.23085937499999998,
-                              0.23085937499999998,
-                              0.2314453125,
-                              0.2314453125,
-                              0.2314453125,
-                              0.2314453125,
-                              0.23203125,
-                              0.23203125,
-                              0.2326171875,
-                              0.2326171875,
-                              0.2326171875,
-                              0.2326171875,
-                              0.23320312499999998,
-                              0.23320312499999998,
-                              0.23320312499999998,
-                              0.23320312499999998,
-                              0.23378906249999998,
-                              0.23378906249999998,
-                              0.234375,
-                              0.234375,
-                              0.234375,
-                              0.234375,
-                              0.2349609375,
-                              0.2349609375,
-                              0.235546875,
-                              0.2349609375,
-                              0.235546875,
-                              0.235546875,
-                              0.23613281249999998,
-                              0.23613281249999998,
-                              0.23613281249999998,
-                              0.23613281249999998,
-                              0.23671874999999998,
-                              0.23671874999999998,
-                              0.2373046875,
-                              0.2373046875,
-                              0.2373046875,
-                              0.2373046875,
-                              0.237890625,
-                              0.237890625,
-                              0.237890625,
-                              0.237890625,
-                              0.2384765625,
-                              0.2384765625,
-                              0.23906249999999998,
-                              0.23906249999999998,
-                              0.23906249999999998,
-                              0.23906249999999998,
-                              0.23964843749999998,
-                              0.23964843749999998,
-                              0.23964843749999998,
-                              0.23964843749999998,
-                              0.240234375,
-                              0.240234375,
-                              0.2408203125,
-                              0.2408203125,
-                              0.2408203125,
-                              0.2408203125,
-                              0.24140625,
-                              0.24140625,
-                              0.24140625,
-                              0.24140625,
-                              0.24199218749999998,
-                              0.24199218749999998,
-                              0.24199218749999998,
-                              0.24199218749999998,
-                              0.24257812499999998,
-                              0.24257812499999998,
-                              0.2431640625,
-                              0.2431640625,
-                              0.2431640625,
-                              0.2431640625,
-                              0.24375,
-                              0.24375,
-                              0.24375,
-                              0.24375,
-                              0.2443359375,
-                              0.2443359375,
-                              0.24492187499999998,
-                              0.24492187499999998,
-                              0.24492187499999998,
-                              0.24492187499999998,
-                              0.24550781249999998,
-                              0.24550781249999998,
-                              0.24609375,
-                              0.24550781249999998,
-                              0.24609375,
-                              0.24609375,
-                              0.2466796875,
-                              0.2466796875,
-                              0.2466796875,
-                              0.2466796875,
-                              0.247265625,
-                              0.247265625,
-                              0.24785156249999998,
-                              0.247265625,
-                              0.24785156249999998,
-                              0.24785156249999998,
-                              0.24843749999999998,
-                              0.24843749999999998,
-                              0.24843749999999998,
-                              0.24843749999999998,
-                              0.2490234375,
-                              0.2490234375,
-                              0.2490234375,
-                              0.2490234375,
-                              0.249609375,
-                              0.249609375,
-                              0.2501953125,
-                              0.2501953125,
-                              0.2501953125,
-                              0.2501953125,
-                              0.25078125,
-                              0.25078125,
-                              0.25078125,
-                              0.25078125,
-                              0.2513671875,
-                              0.2513671875,
-                              0.251953125,
-                              0.251953125,
-                              0.251953125,
-                              0.251953125,
-                              0.25253906249999997,
-                              0.25253906249999997,
-                              0.25253906249999997,
-                              0.25253906249999997,
-                              0.253125,
-                              0.253125,
-                              0.2537109375,
-                              0.253125,
-                              0.2537109375,
-                              0.2537109375,
-                              0.254296875,
-                              0.254296875,
-                              0.254296875,
-                              0.254296875,
-                              0.2548828125,
-                              0.2548828125,
-                              0.25546874999999997,
-                              0.25546874999999997,
-                              0.25546874999999997,
-                              0.25546874999999997,
-                              0.2560546875,
-                              0.2560546875,
-                              0.2560546875,
-                              0.2560546875,
-                              0.256640625,
-                              0.256640625,
-                              0.2572265625,
-                              0.2572265625,
-                              0.2572265625,
-                              0.2572265625,
-                              0.2578125,
-                              0.2578125,
-                              0.2578125,
-                              0.2578125,
-                              0.25839843749999997,
-                              0.25839843749999997,
-                              0.25839843749999997,
-                              0.25839843749999997,
-                              0.258984375,
-                              0.258984375,
-                              0.2595703125,
-                              0.2595703125,
-                              0.2595703125,
-                              0.2595703125,
-                              0.26015625,
-                              0.26015625,
-                              0.26015625,
-                              0.26015625,
-                              0.2607421875,
-                              0.2607421875,
-                              0.26132812499999997,
-                              0.26132812499999997,
-                              0.26132812499999997,
-                              0.26132812499999997,
-                              0.2619140625,
-                              0.2619140625,
-                              0.2619140625,
-                              0.2619140625,
-                              0.2625,
-                              0.2625,
-                              0.2630859375,
-                              0.2630859375,
-                              0.2630859375,
-                              0.2630859375,
-                              0.263671875,
-                              0.263671875,
-                              0.263671875,
-                              0.263671875,
-                              0.26425781249999997,
-                              0.26425781249999997,
-                              0.26425781249999997,
-                              0.26425781249999997,
-                              0.26484375,
-                              0.26484375,
-                              0.2654296875,
-                              0.2654296875,
-                              0.2654296875,
-                              0.2654296875,
-                              0.266015625,
-                              0.266015625,
-                              0.266015625,
-                              0.266015625,
-                              0.2666015625,
-                              0.2666015625,
-                              0.26718749999999997,
-                              0.26718749999999997,
-                              0.26718749999999997,
-                              0.26718749999999997,
-                              0.2677734375,
-                              0.2677734375,
-                              0.2677734375,
-                              0.2677734375,
-                              0.268359375,
-                              0.268359375,
-                              0.2689453125,
-                              0.2689453125,
-                              0.2689453125,
-                              0.2689453125,
-                              0.26953125,
-                              0.26953125,
-                              0.26953125,
-                              0.26953125,
-                              0.27011718749999997,
-                              0.27011718749999997,
-                              0.27011718749999997,
-                              0.27011718749999997,
-                              0.270703125,
-                              0.270703125,
-                              0.2712890625,
-                              0.2712890625,
-                              0.2712890625,
-                              0.2712890625,
-                              0.271875,
-                              0.271875,
-                              0.271875,
-                              0.271875,
-                              0.2724609375,
-                              0.2724609375,
-                              0.27304687499999997,
-                              0.27304687499999997,
-                              0.27304687499999997,
-                              0.27304687499999997,
-                              0.2736328125,
-                              0.2736328125,
-                              0.2736328125,
-                              0.2736328125,
-                              0.27421875,
-                              0.27421875,
-                              0.2748046875,
-                              0.2748046875,
-                              0.2748046875,
-                              0.2748046875,
-                              0.275390625,
-                              0.275390625,
-                              0.275390625,
-                              0.275390625,
-                              0.27597656249999997,
-                              0.27597656249999997,
-                              0.27597656249999997,
-                              0.27597656249999997,
-                              0.2765625,
-                              0.2765625,
-                              0.2771484375,
-                              0.2765625,
-                              0.2771484375,
-                              0.2771484375,
-                              0.277734375,
-                              0.277734375,
-                              0.277734375,
-                              0.277734375,
-                              0.2783203125,
-                              0.2783203125,
-                              0.27890624999999997,
-                              0.2783203125,
-                              0.27890624999999997,
-                              0.27890624999999997,
-                              0.2794921875,
-                              0.2794921875,
-                              0.2794921875,
-                              0.2794921875,
-                              0.280078125,
-                              0.280078125,
-                              0.280078125,
-                              0.280078125,
-                              0.2806640625,
-                              0.2806640625,
-                              0.28125,
-                              0.2806640625,
-                              0.28125,
-                              0.28125,
-                              0.28183593749999997,
-                              0.28183593749999997,
-                              0.28183593749999997,
-                              0.28183593749999997,
-                              0.282421875,
-                              0.282421875,
-                              0.2830078125,
-                              0.282421875,
-                              0.2830078125,
-                              0.2830078125,
-                              0.28359375,
-                              0.28359375,
-                              0.28359375,
-                              0.28359375,
-                              0.2841796875,
-                              0.2841796875,
-                              0.2841796875,
-                              0.2841796875,
-                              0.28476562499999997,
-                              0.28476562499999997,
-                              0.2853515625,
-                              0.2853515625,
-                              0.2853515625,
-                              0.2853515625,
-                              0.2859375,
-                              0.2859375,
-                              0.2859375,
-                              0.2859375,
-                              0.2865234375,
-                              0.2865234375,
-                              0.2865234375,
-                              0.2865234375,
-                              0.287109375,
-                              0.287109375,
-                              0.287109375,
-                              0.287109375,
-                              0.28769531249999997,
-                              0.28769531249999997,
-                              0.28828125,
-                              0.28769531249999997,
-                              0.28828125,
-                              0.28828125,
-                              0.2888671875,
-                              0.2888671875,
-                              0.2888671875,
-                              0.2888671875,
-                              0.289453125,
-                              0.289453125,
-                              0.2900390625,
-                              0.289453125,
-                              0.2900390625,
-                              0.2900390625,
-                              0.29062499999999997,
-                              0.29062499999999997,
-                              0.29062499999999997,
-                              0.29062499999999997,
-                              0.2912109375,
-                              0.2912109375,
-                              0.2912109375,
-                              0.2912109375,
-                              0.291796875,
-                              0.291796875,
-                              0.2923828125,
-                              0.291796875,
-                              0.2923828125,
-                              0.2923828125,
-                              0.29296875,
-                              0.29296875,
-                              0.29296875,
-                              0.29296875,
-                              0.29355468749999997,
-                              0.29355468749999997,
-                              0.294140625,
-                              0.29355468749999997,
-                              0.294140625,
-                              0.294140625,
-                              0.2947265625,
-                              0.2947265625,
-                              0.2947265625,
-                              0.2947265625,
-                              0.2953125,
-                              0.2953125,
-                              0.2953125,
-                              0.2953125,
-                              0.2958984375,
-                              0.2958984375,
-                              0.29648437499999997,
-                              0.2958984375,
-                              0.29648437499999997,
-                              0.29648437499999997,
-                              0.2970703125,
-                              0.2970703125,
-                              0.2970703125,
-                              0.2970703125,
-                              0.29765625,
-                              0.29765625,
-                              0.2982421875,
-                              0.29765625,
-                              0.2982421875,
-                              0.2982421875,
-                              0.298828125,
-                              0.298828125,
-                              0.298828125,
-                              0.298828125,
-                              0.29941406249999997,
-                              0.29941406249999997,
-                              0.29941406249999997,
-                              0.29941406249999997,
-                              0.3,
-                              0.3,
-                              0.3005859375,
-                              0.3,
-                              0.3005859375,
-                              0.3005859375,
-                              0.301171875,
-                              0.3005859375,
-                              0.301171875,
-                              0.301171875,
-                              0.3017578125,
-                              0.3017578125,
-                              0.3017578125,
-                              0.3017578125,
-                              0.30234374999999997,
-                              0.30234374999999997,
-                              0.30234374999999997,
-                              0.30234374999999997,
-                              0.3029296875,
-                              0.3029296875,
-                              0.3029296875,
-                              0.3029296875,
-                              0.303515625,
-                              0.303515625,
-                              0.3041015625,
-                              0.303515625,
-                              0.3041015625,
-                              0.3041015625,
-                              0.3046875,
-                              0.3041015625,
-                              0.3046875,
-                              0.3046875,
-                              0.30527343749999997,
-                              0.30527343749999997,
-                              0.30527343749999997,
-                              0.30527343749999997,
-                              0.305859375,
-                              0.305859375,
-                              0.305859375,
-                              0.305859375,
-                              0.3064453125,
-                              0.3064453125,
-                              0.30703125,
-                              0.3064453125,
-                              0.30703125,
-                              0.30703125,
-                              0.3076171875,
-                              0.3076171875,
-                              0.3076171875,
-                              0.3076171875,
-                              0.30820312499999997,
-                              0.30820312499999997,
-                              0.30820312499999997,
-                              0.30820312499999997,
-                              0.3087890625,
-                              0.3087890625,
-                              0.309375,
-                              0.3087890625,
-                              0.309375,
-                              0.309375,
-                              0.3099609375,
-                              0.3099609375,
-                              0.3099609375,
-                              0.3099609375,
-                              0.310546875,
-                              0.310546875,
-                              0.310546875,
-                              0.310546875,
-                              0.31113281249999997,
-                              0.31113281249999997,
-                              0.31171875,
-                              0.31113281249999997,
-                              0.31171875,
-                              0.31171875,
-                              0.3123046875,
-                              0.3123046875,
-                              0.3123046875,
-                              0.3123046875,
-                              0.312890625,
-                              0.312890625,
-                              0.312890625,
-                              0.312890625,
-                              0.3134765625,
-                              0.3134765625,
-                              0.31406249999999997,
-                              0.3134765625,
-                              0.31406249999999997,
-                              0.31406249999999997,
-                              0.3146484375,
-                              0.3146484375,
-                              0.3146484375,
-                              0.3146484375,
-                              0.315234375,
-                              0.315234375,
-                              0.315234375,
-                              0.315234375,
-                              0.3158203125,
-                              0.3158203125,
-                              0.31640625,
-                              0.3158203125,
-                              0.31640625,
-                              0.31640625,
-                              0.31699218749999997,
-                              0.31699218749999997,
-                              0.31699218749999997,
-                              0.31699218749999997,
-                              0.317578125,
-                              0.317578125,
-                              0.317578125,
-                              0.317578125,
-                              0.3181640625,
-                              0.3181640625,
-                              0.3181640625,
-                              0.3181640625,
-                              0.31875,
-                              0.31875,
-                              0.3193359375,
-                              0.3193359375,
-                              0.3193359375,
-                              0.3193359375,
-                              0.31992187499999997,
-                              0.31992187499999997,
-                              0.31992187499999997,
-                              0.31992187499999997,
-                              0.3205078125,
-                              0.3205078125,
-                              0.3205078125,
-                              0.3205078125,
-                              0.32109375,
-                              0.32109375,
-                              0.3216796875,
-                              0.32109375,
-                              0.3216796875,
-                              0.3216796875,
-                              0.322265625,
-                              0.322265625,
-                              0.322265625,
-                              0.322265625,
-                              0.32285156249999997,
-                              0.32285156249999997,
-                              0.32285156249999997,
-                              0.32285156249999997,
-                              0.3234375,
-                              0.3234375,
-                              0.3234375,
-                              0.3234375,
-                              0.3240234375,
-                              0.3240234375,
-                              0.324609375,
-                              0.324609375,
-                              0.324609375,
-                              0.324609375,
-                              0.3251953125,
-                              0.3251953125,
-                              0.3251953125,
-                              0.3251953125,
-                              0.32578124999999997,
-                              0.32578124999999997,
-                              0.32578124999999997,
-                              0.32578124999999997,
-                              0.3263671875,
-                              0.3263671875,
-                              0.326953125,
-                              0.3263671875,
-                              0.326953125,
-                              0.326953125,
-                              0.3275390625,
-                              0.3275390625,
-                              0.3275390625,
-                              0.3275390625,
-                              0.328125,
-                              0.328125,
-                              0.328125,
-                              0.328125,
-                              0.32871093749999997,
-                              0.32871093749999997,
-                              0.32871093749999997,
-                              0.32871093749999997,
-                              0.329296875,
-                              0.329296875,
-                              0.329296875,
-                              0.329296875,
-                              0.3298828125,
-                              0.3298828125,
-                              0.33046875,
-                              0.33046875,
-                              0.33046875,
-                              0.33046875,
-                              0.3310546875,
-                              0.3310546875,
-                              0.3310546875,
-                              0.3310546875,
-                              0.33164062499999997,
-                              0.33164062499999997,
-                              0.33164062499999997,
-                              0.33164062499999997,
-                              0.3322265625,
-                              0.3322265625,
-                              0.3328125,
-                              0.3322265625,
-                              0.3328125,
-                              0.3328125,
-                              0.3333984375,
-                              0.3333984375,
-                              0.3333984375,
-                              0.3333984375,
-                              0.333984375,
-                              0.333984375,
-                              0.333984375,
-                              0.333984375,
-                              0.33457031249999997,
-                              0.33457031249999997,
-                              0.33515625,
-                              0.33457031249999997,
-                              0.33515625,
-                              0.33515625,
-                              0.3357421875,
-                              0.3357421875,
-                              0.3357421875,
-                              0.3357421875,
-                              0.336328125,
-                              0.336328125,
-                              0.336328125,
-                              0.336328125,
-                              0.3369140625,
-                              0.3369140625,
-                              0.3369140625,
-                              0.3369140625,
-                              0.33749999999999997,
-                              0.33749999999999997,
-                              0.3380859375,
-                              0.33749999999999997,
-                              0.3380859375,
-                              0.3380859375,
-                              0.338671875,
-                              0.3380859375,
-                              0.338671875,
-                              0.338671875,
-                              0.3392578125,
-                              0.338671875,
-                              0.3392578125,
-                              0.3392578125,
-                              0.33984375,
-                              0.33984375,
-                              0.33984375,
-                              0.33984375,
-                              0.34042968749999997,
-                              0.34042968749999997,
-                              0.34042968749999997,
-                              0.34042968749999997,
-                              0.341015625,
-                              0.341015625,
-                              0.3416015625,
-                              0.341015625,
-                              0.3416015625,
-                              0.3416015625,
-                              0.3421875,
-                              0.3421875,
-                              0.3421875,
-                              0.3421875,
-                              0.3427734375,
-                              0.3427734375,
-                              0.3427734375,
-                              0.3427734375,
-                              0.34335937499999997,
-                              0.34335937499999997,
-                              0.34335937499999997,
-                              0.34335937499999997,
-                              0.3439453125,
-                              0.3439453125,
-                              0.34453125,
-                              0.3439453125,
-                              0.34453125,
-                              0.34453125,
-                              0.3451171875,
-                              0.34453125,
-                              0.3451171875,
-                              0.3451171875,
-                              0.345703125,
-                              0.3451171875,
-                              0.345703125,
-                              0.345703125,
-                              0.34628906249999997,
-                              0.345703125,
-                              0.34628906249999997,
-                              0.34628906249999997,
-                              0.34628906249999997,
-                              0.34628906249999997,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.346875,
-                              0.34628906249999997,
-                              0.34628906249999997,
-                              0.34628906249999997,
-                              0.34628906249999997,
-                              0.34628906249999997,
-                              0.34628906249999997,
-                              0.34628906249999997,
-                              0.34628906249999997,
-                              0.34628906249999997,
-                              0.34628906249999997,
-                              0.34628906249999997,
-                              0.34628906249999997,
-                              0.34628906249999997,
-                              0.345703125,
-                              0.345703125,
-                              0.345703125,
-                              0.345703125,
-                              0.345703125,
-                              0.345703125,
-                              0.345703125,
-                              0.345703125,
-                              0.345703125,
-                              0.345703125,
-                              0.345703125,
-                              0.345703125,
-                              0.345703125,
-                              0.345703125,
-                              0.345703125,
-                              0.345703125,
-                              0.3451171875,
-                              0.3451171875,
-                              0.3451171875,
-                              0.3451171875,
-                              0.3451171875,
-                              0.3451171875,
-                              0.3451171875,
-                              0.3451171875,
-                              0.3451171875,
-                              0.3451171875,
-                              0.3451171875,
-                              0.3451171875,
-                              0.3451171875,
-                              0.3451171875,
-                              0.34453125,
-                              0.34453125,
-                              0.34453125,
-                              0.34453125,
-                              0.34453125,
-                              0.34453125,
-                              0.34453125,
-                              0.34453125,
-                              0.34453125,
-                              0.34453125,
-                              0.34453125,
-                              0.34453125,
-                              0.34453125,
-                              0.34453125,
-                              0.3439453125,
-                              0.3439453125,
-                              0.3439453125,
-                              0.3439453125,
-                              0.3439453125,
-                              0.3439453125,
-                              0.3439453125,
-                              0.3439453125,
-                              0.3439453125,
-                              0.3439453125,
-                              0.3439453125,
-                              0.3439453125,
-                              0.3439453125,
-                              0.3439453125,
-                              0.3439453125,
-                              0.34335937499999997,
-                              0.34335937499999997,
-                              0.34335937499999997,
-                              0.34335937499999997,
-                              0.34335937499999997,
-                              0.34335937499999997,
-                              0.34335937499999997,
-                              0.34335937499999997,
-                              0.34335937499999997,
-                              0.34335937499999997,
-                              0.34335937499999997,
-                              0.34335937499999997,
-                              0.34335937499999997,
-                              0.34335937499999997,
-                              0.34335937499999997,
-                              0.34335937499999997,
-                              0.3427734375,
-                              0.3427734375,
-                              0.3427734375,
-                              0.3427734375,
-                              0.3427734375,
-                              0.3427734375,
-                              0.3427734375,
-                              0.3427734375,
-                              0.3427734375,
-                              0.3427734375,
-                              0.3427734375,
-                              0.3427734375,
-                              0.3427734375,
-                              0.3421875,
-                              0.3421875,
-                              0.3421875,
-                              0.3421875,
-                              0.3421875,
-                              0.3421875,
-                              0.3421875,
-                              0.3421875,
-                              0.3421875,
-                              0.3421875,
-                              0.3421875,
-                              0.3421875,
-                              0.3421875,
-                              0.3421875,
-                              0.3421875 };
\ No newline at end of file
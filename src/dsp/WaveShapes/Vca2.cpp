@@ -1,4099 +0,0 @@
-//copyright Dave French, Curlymorphic 2023, GPL3 or later
-
-//4096 bin waveshaper -1.2 +1.2
-#include <array>
-std::array<float, 4096> Vca2{ -0.9621093749999999,
-                              -0.9626953125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.9638671875,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.9638671875,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.9626953125,
-                              -0.96328125,
-                              -0.96328125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9626953125,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9621093749999999,
-                              -0.9615234374999999,
-                              -0.9621093749999999,
-                              -0.9615234374999999,
-                              -0.9615234374999999,
-                              -0.9615234374999999,
-                              -0.9615234374999999,
-                              -0.9615234374999999,
-                              -0.9615234374999999,
-                              -0.9615234374999999,
-                              -0.9615234374999999,
-                              -0.9615234374999999,
-                              -0.9615234374999999,
-                              -0.9615234374999999,
-                              -0.9615234374999999,
-                              -0.9615234374999999,
-                              -0.9615234374999999,
-                              -0.9609375,
-                              -0.9615234374999999,
-                              -0.9615234374999999,
-                              -0.9615234374999999,
-                              -0.9609375,
-                              -0.9609375,
-                              -0.9609375,
-                              -0.9609375,
-                              -0.9609375,
-                              -0.9609375,
-                              -0.9609375,
-                              -0.9609375,
-                              -0.9609375,
-                              -0.9609375,
-                              -0.9609375,
-                              -0.9609375,
-                              -0.9603515625,
-                              -0.9603515625,
-                              -0.9603515625,
-                              -0.9603515625,
-                              -0.9603515625,
-                              -0.9603515625,
-                              -0.9603515625,
-                              -0.9603515625,
-                              -0.9603515625,
-                              -0.9603515625,
-                              -0.959765625,
-                              -0.9603515625,
-                              -0.959765625,
-                              -0.959765625,
-                              -0.959765625,
-                              -0.959765625,
-                              -0.959765625,
-                              -0.959765625,
-                              -0.9591796874999999,
-                              -0.9591796874999999,
-                              -0.9591796874999999,
-                              -0.9591796874999999,
-                              -0.9591796874999999,
-                              -0.9591796874999999,
-                              -0.9591796874999999,
-                              -0.9591796874999999,
-                              -0.9585937499999999,
-                              -0.9585937499999999,
-                              -0.9585937499999999,
-                              -0.9580078125,
-                              -0.9580078125,
-                              -0.9580078125,
-                              -0.9580078125,
-                              -0.957421875,
-                              -0.957421875,
-                              -0.9568359375,
-                              -0.9568359375,
-                              -0.9568359375,
-                              -0.9562499999999999,
-                              -0.9568359375,
-                              -0.9556640624999999,
-                              -0.9556640624999999,
-                              -0.955078125,
-                              -0.9556640624999999,
-                              -0.9544921875,
-                              -0.9544921875,
-                              -0.9544921875,
-                              -0.95390625,
-                              -0.95390625,
-                              -0.9533203124999999,
-                              -0.9527343749999999,
-                              -0.9527343749999999,
-                              -0.9521484375,
-                              -0.9521484375,
-                              -0.9515625,
-                              -0.9515625,
-                              -0.9509765625,
-                              -0.9509765625,
-                              -0.9503906249999999,
-                              -0.9503906249999999,
-                              -0.9498046874999999,
-                              -0.9498046874999999,
-                              -0.94921875,
-                              -0.94921875,
-                              -0.948046875,
-                              -0.948046875,
-                              -0.9474609374999999,
-                              -0.9474609374999999,
-                              -0.9468749999999999,
-                              -0.9468749999999999,
-                              -0.9462890625,
-                              -0.945703125,
-                              -0.9451171875,
-                              -0.9451171875,
-                              -0.9445312499999999,
-                              -0.9445312499999999,
-                              -0.943359375,
-                              -0.943359375,
-                              -0.9427734375,
-                              -0.9427734375,
-                              -0.9416015624999999,
-                              -0.9416015624999999,
-                              -0.9410156249999999,
-                              -0.9410156249999999,
-                              -0.93984375,
-                              -0.93984375,
-                              -0.9392578125,
-                              -0.9392578125,
-                              -0.9380859374999999,
-                              -0.9380859374999999,
-                              -0.9375,
-                              -0.9375,
-                              -0.936328125,
-                              -0.936328125,
-                              -0.9357421874999999,
-                              -0.9351562499999999,
-                              -0.9345703125,
-                              -0.9345703125,
-                              -0.9333984375,
-                              -0.9333984375,
-                              -0.9328124999999999,
-                              -0.9322265624999999,
-                              -0.931640625,
-                              -0.931640625,
-                              -0.93046875,
-                              -0.93046875,
-                              -0.9292968749999999,
-                              -0.9292968749999999,
-                              -0.9287109375,
-                              -0.9287109375,
-                              -0.9275390625,
-                              -0.9275390625,
-                              -0.9263671874999999,
-                              -0.9263671874999999,
-                              -0.9251953125,
-                              -0.9251953125,
-                              -0.9240234374999999,
-                              -0.9240234374999999,
-                              -0.9234374999999999,
-                              -0.9228515625,
-                              -0.922265625,
-                              -0.922265625,
-                              -0.9210937499999999,
-                              -0.9210937499999999,
-                              -0.919921875,
-                              -0.919921875,
-                              -0.91875,
-                              -0.91875,
-                              -0.9175781249999999,
-                              -0.9175781249999999,
-                              -0.91640625,
-                              -0.91640625,
-                              -0.9158203125,
-                              -0.9152343749999999,
-                              -0.9146484374999999,
-                              -0.9146484374999999,
-                              -0.9134765625,
-                              -0.9134765625,
-                              -0.9123046874999999,
-                              -0.9123046874999999,
-                              -0.9111328125,
-                              -0.9111328125,
-                              -0.9099609375,
-                              -0.9099609375,
-                              -0.9087890624999999,
-                              -0.9087890624999999,
-                              -0.908203125,
-                              -0.9076171875,
-                              -0.90703125,
-                              -0.90703125,
-                              -0.9058593749999999,
-                              -0.9052734375,
-                              -0.9046875,
-                              -0.9046875,
-                              -0.9035156249999999,
-                              -0.9035156249999999,
-                              -0.90234375,
-                              -0.90234375,
-                              -0.901171875,
-                              -0.901171875,
-                              -0.8999999999999999,
-                              -0.8999999999999999,
-                              -0.898828125,
-                              -0.898828125,
-                              -0.8976562499999999,
-                              -0.8976562499999999,
-                              -0.8970703125,
-                              -0.896484375,
-                              -0.8958984375,
-                              -0.8953125,
-                              -0.8947265624999999,
-                              -0.8947265624999999,
-                              -0.8935546875,
-                              -0.8935546875,
-                              -0.89296875,
-                              -0.8923828125,
-                              -0.8917968749999999,
-                              -0.8912109375,
-                              -0.890625,
-                              -0.890625,
-                              -0.889453125,
-                              -0.889453125,
-                              -0.88828125,
-                              -0.88828125,
-                              -0.887109375,
-                              -0.887109375,
-                              -0.8859374999999999,
-                              -0.8859374999999999,
-                              -0.884765625,
-                              -0.884765625,
-                              -0.88359375,
-                              -0.88359375,
-                              -0.882421875,
-                              -0.882421875,
-                              -0.8818359375,
-                              -0.88125,
-                              -0.8806640625,
-                              -0.8800781249999999,
-                              -0.8794921875,
-                              -0.8794921875,
-                              -0.8783203125,
-                              -0.8783203125,
-                              -0.8771484374999999,
-                              -0.8771484374999999,
-                              -0.8759765625,
-                              -0.8759765625,
-                              -0.8748046875,
-                              -0.8748046875,
-                              -0.8736328125,
-                              -0.8736328125,
-                              -0.8724609375,
-                              -0.8724609375,
-                              -0.8712890624999999,
-                              -0.8712890624999999,
-                              -0.870703125,
-                              -0.8701171875,
-                              -0.86953125,
-                              -0.8689453125,
-                              -0.8683593749999999,
-                              -0.8677734375,
-                              -0.8671875,
-                              -0.8671875,
-                              -0.866015625,
-                              -0.866015625,
-                              -0.86484375,
-                              -0.86484375,
-                              -0.863671875,
-                              -0.863671875,
-                              -0.8624999999999999,
-                              -0.8624999999999999,
-                              -0.861328125,
-                              -0.861328125,
-                              -0.86015625,
-                              -0.86015625,
-                              -0.8595703124999999,
-                              -0.858984375,
-                              -0.8583984375,
-                              -0.8578125,
-                              -0.8572265625,
-                              -0.8566406249999999,
-                              -0.8560546875,
-                              -0.8560546875,
-                              -0.8548828125,
-                              -0.8548828125,
-                              -0.8537109374999999,
-                              -0.8537109374999999,
-                              -0.8525390625,
-                              -0.8525390625,
-                              -0.8513671875,
-                              -0.8513671875,
-                              -0.8501953125,
-                              -0.8501953125,
-                              -0.8490234375,
-                              -0.8490234375,
-                              -0.8478515624999999,
-                              -0.8478515624999999,
-                              -0.8466796875,
-                              -0.8466796875,
-                              -0.8455078125,
-                              -0.8455078125,
-                              -0.8443359375,
-                              -0.8443359375,
-                              -0.84375,
-                              -0.8431640625,
-                              -0.8419921874999999,
-                              -0.8419921874999999,
-                              -0.84140625,
-                              -0.84140625,
-                              -0.840234375,
-                              -0.840234375,
-                              -0.8390624999999999,
-                              -0.8390624999999999,
-                              -0.837890625,
-                              -0.837890625,
-                              -0.83671875,
-                              -0.83671875,
-                              -0.835546875,
-                              -0.835546875,
-                              -0.834375,
-                              -0.834375,
-                              -0.8332031249999999,
-                              -0.8332031249999999,
-                              -0.83203125,
-                              -0.83203125,
-                              -0.830859375,
-                              -0.830859375,
-                              -0.8296875,
-                              -0.8296875,
-                              -0.828515625,
-                              -0.828515625,
-                              -0.8279296875,
-                              -0.8273437499999999,
-                              -0.8267578125,
-                              -0.826171875,
-                              -0.8255859375,
-                              -0.825,
-                              -0.8244140624999999,
-                              -0.823828125,
-                              -0.8232421875,
-                              -0.8232421875,
-                              -0.8220703125,
-                              -0.8220703125,
-                              -0.8208984375,
-                              -0.8208984375,
-                              -0.8197265625,
-                              -0.8197265625,
-                              -0.8185546874999999,
-                              -0.8185546874999999,
-                              -0.8173828125,
-                              -0.8173828125,
-                              -0.8162109375,
-                              -0.8162109375,
-                              -0.8150390625,
-                              -0.8150390625,
-                              -0.814453125,
-                              -0.8138671875,
-                              -0.81328125,
-                              -0.8126953124999999,
-                              -0.812109375,
-                              -0.8115234375,
-                              -0.8109375,
-                              -0.8103515625,
-                              -0.8097656249999999,
-                              -0.8091796875,
-                              -0.80859375,
-                              -0.8080078125,
-                              -0.807421875,
-                              -0.807421875,
-                              -0.80625,
-                              -0.80625,
-                              -0.805078125,
-                              -0.805078125,
-                              -0.8039062499999999,
-                              -0.8039062499999999,
-                              -0.802734375,
-                              -0.802734375,
-                              -0.8015625,
-                              -0.8015625,
-                              -0.800390625,
-                              -0.800390625,
-                              -0.79921875,
-                              -0.79921875,
-                              -0.7980468749999999,
-                              -0.7980468749999999,
-                              -0.796875,
-                              -0.796875,
-                              -0.795703125,
-                              -0.795703125,
-                              -0.79453125,
-                              -0.79453125,
-                              -0.793359375,
-                              -0.793359375,
-                              -0.7927734375,
-                              -0.7921874999999999,
-                              -0.7916015625,
-                              -0.791015625,
-                              -0.7904296875,
-                              -0.78984375,
-                              -0.7892578124999999,
-                              -0.7892578124999999,
-                              -0.7880859375,
-                              -0.7875,
-                              -0.7869140625,
-                              -0.7869140625,
-                              -0.7857421875,
-                              -0.7857421875,
-                              -0.7845703125,
-                              -0.7845703125,
-                              -0.7833984374999999,
-                              -0.7833984374999999,
-                              -0.7822265625,
-                              -0.7822265625,
-                              -0.7810546875,
-                              -0.7810546875,
-                              -0.7798828125,
-                              -0.7798828125,
-                              -0.7787109375,
-                              -0.7787109375,
-                              -0.7775390624999999,
-                              -0.7775390624999999,
-                              -0.7763671875,
-                              -0.7763671875,
-                              -0.7751953125,
-                              -0.7751953125,
-                              -0.7740234375,
-                              -0.7740234375,
-                              -0.7728515625,
-                              -0.7728515625,
-                              -0.772265625,
-                              -0.7716796874999999,
-                              -0.77109375,
-                              -0.7705078125,
-                              -0.769921875,
-                              -0.7693359375,
-                              -0.7687499999999999,
-                              -0.7687499999999999,
-                              -0.767578125,
-                              -0.7669921875,
-                              -0.76640625,
-                              -0.76640625,
-                              -0.765234375,
-                              -0.765234375,
-                              -0.7640625,
-                              -0.7640625,
-                              -0.7628906249999999,
-                              -0.7628906249999999,
-                              -0.76171875,
-                              -0.76171875,
-                              -0.760546875,
-                              -0.760546875,
-                              -0.759375,
-                              -0.759375,
-                              -0.758203125,
-                              -0.758203125,
-                              -0.7570312499999999,
-                              -0.7570312499999999,
-                              -0.755859375,
-                              -0.755859375,
-                              -0.7546875,
-                              -0.7546875,
-                              -0.753515625,
-                              -0.753515625,
-                              -0.75234375,
-                              -0.75234375,
-                              -0.7511718749999999,
-                              -0.7511718749999999,
-                              -0.7505859375,
-                              -0.7505859375,
-                              -0.7494140625,
-                              -0.7494140625,
-                              -0.7482421874999999,
-                              -0.7482421874999999,
-                              -0.7470703125,
-                              -0.7470703125,
-                              -0.7458984375,
-                              -0.7458984375,
-                              -0.7447265625,
-                              -0.7447265625,
-                              -0.7435546875,
-                              -0.7435546875,
-                              -0.7423828124999999,
-                              -0.7423828124999999,
-                              -0.7412109375,
-                              -0.7412109375,
-                              -0.7400390625,
-                              -0.7400390625,
-                              -0.7388671875,
-                              -0.7388671875,
-                              -0.7376953125,
-                              -0.7376953125,
-                              -0.7365234374999999,
-                              -0.7365234374999999,
-                              -0.7353515625,
-                              -0.7353515625,
-                              -0.7341796875,
-                              -0.7341796875,
-                              -0.7330078125,
-                              -0.7330078125,
-                              -0.7318359375,
-                              -0.7318359375,
-                              -0.7306640624999999,
-                              -0.7306640624999999,
-                              -0.730078125,
-                              -0.7294921875,
-                              -0.7283203125,
-                              -0.7283203125,
-                              -0.7277343749999999,
-                              -0.7271484375,
-                              -0.7265625,
-                              -0.7259765625,
-                              -0.725390625,
-                              -0.7248046874999999,
-                              -0.72421875,
-                              -0.7236328125,
-                              -0.723046875,
-                              -0.7224609375,
-                              -0.7218749999999999,
-                              -0.7212890625,
-                              -0.720703125,
-                              -0.7201171875,
-                              -0.71953125,
-                              -0.7189453124999999,
-                              -0.718359375,
-                              -0.718359375,
-                              -0.7171875,
-                              -0.7171875,
-                              -0.7160156249999999,
-                              -0.7160156249999999,
-                              -0.71484375,
-                              -0.71484375,
-                              -0.713671875,
-                              -0.713671875,
-                              -0.7125,
-                              -0.7125,
-                              -0.711328125,
-                              -0.711328125,
-                              -0.7101562499999999,
-                              -0.7101562499999999,
-                              -0.708984375,
-                              -0.708984375,
-                              -0.7078125,
-                              -0.7078125,
-                              -0.706640625,
-                              -0.706640625,
-                              -0.70546875,
-                              -0.70546875,
-                              -0.7042968749999999,
-                              -0.7042968749999999,
-                              -0.703125,
-                              -0.703125,
-                              -0.701953125,
-                              -0.701953125,
-                              -0.70078125,
-                              -0.70078125,
-                              -0.699609375,
-                              -0.699609375,
-                              -0.6990234375,
-                              -0.6984374999999999,
-                              -0.697265625,
-                              -0.697265625,
-                              -0.6966796875,
-                              -0.69609375,
-                              -0.6955078124999999,
-                              -0.694921875,
-                              -0.6943359375,
-                              -0.69375,
-                              -0.6931640625,
-                              -0.6925781249999999,
-                              -0.6919921875,
-                              -0.69140625,
-                              -0.6908203125,
-                              -0.690234375,
-                              -0.6896484374999999,
-                              -0.6890625,
-                              -0.6884765625,
-                              -0.687890625,
-                              -0.6873046875,
-                              -0.6867187499999999,
-                              -0.6861328125,
-                              -0.6861328125,
-                              -0.6849609375,
-                              -0.6849609375,
-                              -0.6837890624999999,
-                              -0.6837890624999999,
-                              -0.6826171875,
-                              -0.6826171875,
-                              -0.6814453125,
-                              -0.6814453125,
-                              -0.6802734375,
-                              -0.6802734375,
-                              -0.6791015625,
-                              -0.6791015625,
-                              -0.6779296874999999,
-                              -0.6779296874999999,
-                              -0.6767578125,
-                              -0.6767578125,
-                              -0.6755859375,
-                              -0.6755859375,
-                              -0.6744140625,
-                              -0.6744140625,
-                              -0.6732421875,
-                              -0.6732421875,
-                              -0.67265625,
-                              -0.6720703124999999,
-                              -0.671484375,
-                              -0.6708984375,
-                              -0.6697265625,
-                              -0.6697265625,
-                              -0.6691406249999999,
-                              -0.6685546875,
-                              -0.66796875,
-                              -0.6673828125,
-                              -0.666796875,
-                              -0.6662109374999999,
-                              -0.665625,
-                              -0.6650390625,
-                              -0.664453125,
-                              -0.6638671875,
-                              -0.6632812499999999,
-                              -0.6626953125,
-                              -0.662109375,
-                              -0.6615234375,
-                              -0.6609375,
-                              -0.6603515624999999,
-                              -0.659765625,
-                              -0.6591796875,
-                              -0.65859375,
-                              -0.6580078125,
-                              -0.6574218749999999,
-                              -0.6568359375,
-                              -0.65625,
-                              -0.6556640625,
-                              -0.655078125,
-                              -0.655078125,
-                              -0.65390625,
-                              -0.65390625,
-                              -0.652734375,
-                              -0.652734375,
-                              -0.6515624999999999,
-                              -0.6515624999999999,
-                              -0.650390625,
-                              -0.650390625,
-                              -0.64921875,
-                              -0.6486328124999999,
-                              -0.648046875,
-                              -0.648046875,
-                              -0.646875,
-                              -0.646875,
-                              -0.6457031249999999,
-                              -0.6457031249999999,
-                              -0.64453125,
-                              -0.64453125,
-                              -0.643359375,
-                              -0.643359375,
-                              -0.6421875,
-                              -0.6421875,
-                              -0.641015625,
-                              -0.641015625,
-                              -0.6398437499999999,
-                              -0.6398437499999999,
-                              -0.638671875,
-                              -0.638671875,
-                              -0.6375,
-                              -0.6375,
-                              -0.636328125,
-                              -0.636328125,
-                              -0.63515625,
-                              -0.63515625,
-                              -0.6339843749999999,
-                              -0.6339843749999999,
-                              -0.6328125,
-                              -0.6328125,
-                              -0.631640625,
-                              -0.631640625,
-                              -0.63046875,
-                              -0.63046875,
-                              -0.629296875,
-                              -0.629296875,
-                              -0.6281249999999999,
-                              -0.6281249999999999,
-                              -0.626953125,
-                              -0.626953125,
-                              -0.62578125,
-                              -0.62578125,
-                              -0.624609375,
-                              -0.624609375,
-                              -0.6234375,
-                              -0.6234375,
-                              -0.6222656249999999,
-                              -0.6222656249999999,
-                              -0.6216796875,
-                              -0.62109375,
-                              -0.6205078125,
-                              -0.619921875,
-                              -0.6193359374999999,
-                              -0.61875,
-                              -0.6181640625,
-                              -0.617578125,
-                              -0.6169921875,
-                              -0.6164062499999999,
-                              -0.6158203125,
-                              -0.615234375,
-                              -0.6146484375,
-                              -0.6140625,
-                              -0.6134765624999999,
-                              -0.612890625,
-                              -0.6123046875,
-                              -0.61171875,
-                              -0.6111328125,
-                              -0.6105468749999999,
-                              -0.6099609375,
-                              -0.609375,
-                              -0.6087890625,
-                              -0.608203125,
-                              -0.6076171874999999,
-                              -0.60703125,
-                              -0.6064453125,
-                              -0.605859375,
-                              -0.6052734375,
-                              -0.6046874999999999,
-                              -0.6041015625,
-                              -0.603515625,
-                              -0.603515625,
-                              -0.6029296875,
-                              -0.6017578124999999,
-                              -0.6017578124999999,
-                              -0.6005859375,
-                              -0.6005859375,
-                              -0.6,
-                              -0.5994140625,
-                              -0.5982421875,
-                              -0.5982421875,
-                              -0.59765625,
-                              -0.5970703125,
-                              -0.596484375,
-                              -0.5958984374999999,
-                              -0.5947265625,
-                              -0.5947265625,
-                              -0.594140625,
-                              -0.5935546875,
-                              -0.5929687499999999,
-                              -0.5923828125,
-                              -0.591796875,
-                              -0.5912109375,
-                              -0.590625,
-                              -0.5900390624999999,
-                              -0.589453125,
-                              -0.5888671875,
-                              -0.5876953125,
-                              -0.5876953125,
-                              -0.5871093749999999,
-                              -0.5865234375,
-                              -0.5859375,
-                              -0.5853515625,
-                              -0.584765625,
-                              -0.5841796874999999,
-                              -0.58359375,
-                              -0.5830078125,
-                              -0.582421875,
-                              -0.5818359375,
-                              -0.5812499999999999,
-                              -0.5806640625,
-                              -0.580078125,
-                              -0.5794921875,
-                              -0.57890625,
-                              -0.5783203124999999,
-                              -0.577734375,
-                              -0.5771484375,
-                              -0.5765625,
-                              -0.5759765625,
-                              -0.5753906249999999,
-                              -0.5748046875,
-                              -0.57421875,
-                              -0.5736328125,
-                              -0.573046875,
-                              -0.5724609374999999,
-                              -0.571875,
-                              -0.5712890625,
-                              -0.570703125,
-                              -0.5701171875,
-                              -0.5695312499999999,
-                              -0.5689453125,
-                              -0.568359375,
-                              -0.5677734375,
-                              -0.5671875,
-                              -0.5666015624999999,
-                              -0.566015625,
-                              -0.566015625,
-                              -0.56484375,
-                              -0.56484375,
-                              -0.5636718749999999,
-                              -0.5636718749999999,
-                              -0.5625,
-                              -0.5625,
-                              -0.561328125,
-                              -0.561328125,
-                              -0.56015625,
-                              -0.56015625,
-                              -0.558984375,
-                              -0.558984375,
-                              -0.5578124999999999,
-                              -0.5572265625,
-                              -0.556640625,
-                              -0.556640625,
-                              -0.55546875,
-                              -0.55546875,
-                              -0.554296875,
-                              -0.554296875,
-                              -0.553125,
-                              -0.553125,
-                              -0.5519531249999999,
-                              -0.5519531249999999,
-                              -0.55078125,
-                              -0.55078125,
-                              -0.549609375,
-                              -0.549609375,
-                              -0.5484375,
-                              -0.5484375,
-                              -0.547265625,
-                              -0.547265625,
-                              -0.5460937499999999,
-                              -0.5460937499999999,
-                              -0.544921875,
-                              -0.544921875,
-                              -0.54375,
-                              -0.54375,
-                              -0.542578125,
-                              -0.542578125,
-                              -0.54140625,
-                              -0.54140625,
-                              -0.5402343749999999,
-                              -0.5402343749999999,
-                              -0.5390625,
-                              -0.5390625,
-                              -0.537890625,
-                              -0.537890625,
-                              -0.53671875,
-                              -0.53671875,
-                              -0.535546875,
-                              -0.535546875,
-                              -0.5349609375,
-                              -0.5343749999999999,
-                              -0.533203125,
-                              -0.533203125,
-                              -0.53203125,
-                              -0.53203125,
-                              -0.530859375,
-                              -0.530859375,
-                              -0.5296875,
-                              -0.5296875,
-                              -0.5291015625,
-                              -0.5285156249999999,
-                              -0.5279296875,
-                              -0.52734375,
-                              -0.5267578125,
-                              -0.526171875,
-                              -0.5255859374999999,
-                              -0.525,
-                              -0.5244140625,
-                              -0.523828125,
-                              -0.5232421875,
-                              -0.5226562499999999,
-                              -0.5220703125,
-                              -0.521484375,
-                              -0.5208984375,
-                              -0.5203125,
-                              -0.5197265624999999,
-                              -0.519140625,
-                              -0.5185546875,
-                              -0.51796875,
-                              -0.5173828125,
-                              -0.5167968749999999,
-                              -0.5162109375,
-                              -0.515625,
-                              -0.5150390625,
-                              -0.514453125,
-                              -0.5138671874999999,
-                              -0.51328125,
-                              -0.5126953125,
-                              -0.512109375,
-                              -0.5115234375,
-                              -0.5109374999999999,
-                              -0.5103515625,
-                              -0.509765625,
-                              -0.5091796875,
-                              -0.50859375,
-                              -0.5080078124999999,
-                              -0.507421875,
-                              -0.5068359375,
-                              -0.50625,
-                              -0.5056640625,
-                              -0.5050781249999999,
-                              -0.5044921875,
-                              -0.50390625,
-                              -0.5033203125,
-                              -0.502734375,
-                              -0.5021484374999999,
-                              -0.5015625,
-                              -0.5009765625,
-                              -0.500390625,
-                              -0.49980468749999996,
-                              -0.49921875,
-                              -0.49863281249999997,
-                              -0.498046875,
-                              -0.4974609375,
-                              -0.49687499999999996,
-                              -0.4962890625,
-                              -0.49570312499999997,
-                              -0.4951171875,
-                              -0.49453125,
-                              -0.49394531249999996,
-                              -0.493359375,
-                              -0.49277343749999997,
-                              -0.4921875,
-                              -0.4916015625,
-                              -0.4916015625,
-                              -0.4904296875,
-                              -0.4904296875,
-                              -0.4892578125,
-                              -0.4892578125,
-                              -0.48808593749999996,
-                              -0.48808593749999996,
-                              -0.48691406249999997,
-                              -0.48691406249999997,
-                              -0.4857421875,
-                              -0.4857421875,
-                              -0.4845703125,
-                              -0.48398437499999997,
-                              -0.4833984375,
-                              -0.4833984375,
-                              -0.48222656249999996,
-                              -0.48222656249999996,
-                              -0.48105468749999997,
-                              -0.48046875,
-                              -0.4798828125,
-                              -0.47929687499999996,
-                              -0.4787109375,
-                              -0.47812499999999997,
-                              -0.4775390625,
-                              -0.4775390625,
-                              -0.47636718749999996,
-                              -0.47636718749999996,
-                              -0.47519531249999997,
-                              -0.474609375,
-                              -0.4740234375,
-                              -0.4740234375,
-                              -0.4728515625,
-                              -0.4728515625,
-                              -0.4716796875,
-                              -0.4716796875,
-                              -0.47050781249999996,
-                              -0.47050781249999996,
-                              -0.46933593749999997,
-                              -0.46933593749999997,
-                              -0.4681640625,
-                              -0.4681640625,
-                              -0.4669921875,
-                              -0.4669921875,
-                              -0.4658203125,
-                              -0.4658203125,
-                              -0.46464843749999996,
-                              -0.46464843749999996,
-                              -0.46347656249999997,
-                              -0.46347656249999997,
-                              -0.4623046875,
-                              -0.4623046875,
-                              -0.4611328125,
-                              -0.4611328125,
-                              -0.4599609375,
-                              -0.459375,
-                              -0.45878906249999996,
-                              -0.45878906249999996,
-                              -0.45761718749999997,
-                              -0.45761718749999997,
-                              -0.4564453125,
-                              -0.4564453125,
-                              -0.4552734375,
-                              -0.45468749999999997,
-                              -0.45468749999999997,
-                              -0.4541015625,
-                              -0.453515625,
-                              -0.45292968749999996,
-                              -0.45234375,
-                              -0.45175781249999997,
-                              -0.451171875,
-                              -0.4505859375,
-                              -0.44999999999999996,
-                              -0.4494140625,
-                              -0.44882812499999997,
-                              -0.4482421875,
-                              -0.44765625,
-                              -0.4470703125,
-                              -0.446484375,
-                              -0.44589843749999997,
-                              -0.4453125,
-                              -0.4447265625,
-                              -0.444140625,
-                              -0.4435546875,
-                              -0.44296874999999997,
-                              -0.4423828125,
-                              -0.441796875,
-                              -0.4412109375,
-                              -0.440625,
-                              -0.44003906249999997,
-                              -0.439453125,
-                              -0.4388671875,
-                              -0.43828125,
-                              -0.4376953125,
-                              -0.43710937499999997,
-                              -0.4365234375,
-                              -0.4359375,
-                              -0.4353515625,
-                              -0.434765625,
-                              -0.43417968749999997,
-                              -0.43359375,
-                              -0.4330078125,
-                              -0.432421875,
-                              -0.4318359375,
-                              -0.43124999999999997,
-                              -0.4306640625,
-                              -0.430078125,
-                              -0.4294921875,
-                              -0.42890625,
-                              -0.42832031249999997,
-                              -0.427734375,
-                              -0.4271484375,
-                              -0.4265625,
-                              -0.4259765625,
-                              -0.42539062499999997,
-                              -0.4248046875,
-                              -0.42421875,
-                              -0.4236328125,
-                              -0.423046875,
-                              -0.42246093749999997,
-                              -0.421875,
-                              -0.4212890625,
-                              -0.420703125,
-                              -0.4201171875,
-                              -0.41953124999999997,
-                              -0.4189453125,
-                              -0.418359375,
-                              -0.4177734375,
-                              -0.4171875,
-                              -0.41660156249999997,
-                              -0.416015625,
-                              -0.4154296875,
-                              -0.41484375,
-                              -0.4142578125,
-                              -0.41367187499999997,
-                              -0.4130859375,
-                              -0.4125,
-                              -0.4119140625,
-                              -0.411328125,
-                              -0.41074218749999997,
-                              -0.41015625,
-                              -0.4095703125,
-                              -0.408984375,
-                              -0.4083984375,
-                              -0.40781249999999997,
-                              -0.4072265625,
-                              -0.406640625,
-                              -0.4060546875,
-                              -0.40546875,
-                              -0.40488281249999997,
-                              -0.404296875,
-                              -0.4037109375,
-                              -0.403125,
-                              -0.4025390625,
-                              -0.40195312499999997,
-                              -0.4013671875,
-                              -0.40078125,
-                              -0.4001953125,
-                              -0.399609375,
-                              -0.39902343749999997,
-                              -0.3984375,
-                              -0.3978515625,
-                              -0.397265625,
-                              -0.3966796875,
-                              -0.39609374999999997,
-                              -0.3955078125,
-                              -0.394921875,
-                              -0.3943359375,
-                              -0.39375,
-                              -0.39316406249999997,
-                              -0.392578125,
-                              -0.3919921875,
-                              -0.39140625,
-                              -0.3908203125,
-                              -0.39023437499999997,
-                              -0.3896484375,
-                              -0.3890625,
-                              -0.3884765625,
-                              -0.387890625,
-                              -0.38730468749999997,
-                              -0.38671875,
-                              -0.3861328125,
-                              -0.385546875,
-                              -0.3849609375,
-                              -0.38437499999999997,
-                              -0.3837890625,
-                              -0.383203125,
-                              -0.3826171875,
-                              -0.38203125,
-                              -0.38144531249999997,
-                              -0.380859375,
-                              -0.3802734375,
-                              -0.3796875,
-                              -0.3796875,
-                              -0.37851562499999997,
-                              -0.37851562499999997,
-                              -0.37734375,
-                              -0.37734375,
-                              -0.376171875,
-                              -0.376171875,
-                              -0.37558593749999997,
-                              -0.375,
-                              -0.373828125,
-                              -0.373828125,
-                              -0.3732421875,
-                              -0.37265624999999997,
-                              -0.371484375,
-                              -0.371484375,
-                              -0.3703125,
-                              -0.3703125,
-                              -0.369140625,
-                              -0.369140625,
-                              -0.3685546875,
-                              -0.36796875,
-                              -0.36679687499999997,
-                              -0.36679687499999997,
-                              -0.3662109375,
-                              -0.365625,
-                              -0.364453125,
-                              -0.364453125,
-                              -0.36386718749999997,
-                              -0.36328125,
-                              -0.362109375,
-                              -0.362109375,
-                              -0.3615234375,
-                              -0.36093749999999997,
-                              -0.3603515625,
-                              -0.359765625,
-                              -0.3591796875,
-                              -0.35859375,
-                              -0.35800781249999997,
-                              -0.357421875,
-                              -0.3568359375,
-                              -0.35625,
-                              -0.3556640625,
-                              -0.35507812499999997,
-                              -0.3544921875,
-                              -0.35390625,
-                              -0.3533203125,
-                              -0.352734375,
-                              -0.35214843749999997,
-                              -0.3515625,
-                              -0.3509765625,
-                              -0.350390625,
-                              -0.3498046875,
-                              -0.34921874999999997,
-                              -0.3486328125,
-                              -0.348046875,
-                              -0.3474609375,
-                              -0.346875,
-                              -0.34628906249999997,
-                              -0.345703125,
-                              -0.3451171875,
-                              -0.34453125,
-                              -0.3439453125,
-                              -0.34335937499999997,
-                              -0.3427734375,
-                              -0.3421875,
-                              -0.3416015625,
-                              -0.341015625,
-                              -0.34042968749999997,
-                              -0.33984375,
-                              -0.3392578125,
-                              -0.338671875,
-                              -0.3380859375,
-                              -0.33749999999999997,
-                              -0.3369140625,
-                              -0.336328125,
-                              -0.3357421875,
-                              -0.33515625,
-                              -0.33457031249999997,
-                              -0.333984375,
-                              -0.3333984375,
-                              -0.3328125,
-                              -0.3322265625,
-                              -0.33164062499999997,
-                              -0.3310546875,
-                              -0.33046875,
-                              -0.3298828125,
-                              -0.329296875,
-                              -0.32871093749999997,
-                              -0.328125,
-                              -0.3275390625,
-                              -0.326953125,
-                              -0.3263671875,
-                              -0.32578124999999997,
-                              -0.3251953125,
-                              -0.324609375,
-                              -0.3240234375,
-                              -0.3234375,
-                              -0.32285156249999997,
-                              -0.322265625,
-                              -0.3216796875,
-                              -0.32109375,
-                              -0.3205078125,
-                              -0.31992187499999997,
-                              -0.3193359375,
-                              -0.31875,
-                              -0.3181640625,
-                              -0.317578125,
-                              -0.31699218749999997,
-                              -0.31640625,
-                              -0.3158203125,
-                              -0.315234375,
-                              -0.3146484375,
-                              -0.31406249999999997,
-                              -0.3134765625,
-                              -0.312890625,
-                              -0.3123046875,
-                              -0.31171875,
-                              -0.31113281249999997,
-                              -0.310546875,
-                              -0.3099609375,
-                              -0.309375,
-                              -0.3087890625,
-                              -0.30820312499999997,
-                              -0.3076171875,
-                              -0.30703125,
-                              -0.3064453125,
-                              -0.305859375,
-                              -0.305859375,
-                              -0.30527343749999997,
-                              -0.3046875,
-                              -0.3041015625,
-                              -0.303515625,
-                              -0.3029296875,
-                              -0.30234374999999997,
-                              -0.3017578125,
-                              -0.301171875,
-                              -0.3005859375,
-                              -0.3,
-                              -0.29941406249999997,
-                              -0.298828125,
-                              -0.2982421875,
-                              -0.29765625,
-                              -0.2970703125,
-                              -0.29648437499999997,
-                              -0.2958984375,
-                              -0.2953125,
-                              -0.2947265625,
-                              -0.294140625,
-                              -0.29355468749999997,
-                              -0.29296875,
-                              -0.2923828125,
-                              -0.291796875,
-                              -0.2912109375,
-                              -0.29062499999999997,
-                              -0.2900390625,
-                              -0.289453125,
-                              -0.2888671875,
-                              -0.28828125,
-                              -0.28769531249999997,
-                              -0.287109375,
-                              -0.2865234375,
-                              -0.2859375,
-                              -0.2853515625,
-                              -0.28476562499999997,
-                              -0.2841796875,
-                              -0.28359375,
-                              -0.2830078125,
-                              -0.282421875,
-                              -0.28183593749999997,
-                              -0.28125,
-                              -0.2806640625,
-                              -0.280078125,
-                              -0.2794921875,
-                              -0.27890624999999997,
-                              -0.2783203125,
-                              -0.277734375,
-                              -0.2771484375,
-                              -0.2765625,
-                              -0.27597656249999997,
-                              -0.275390625,
-                              -0.2748046875,
-                              -0.27421875,
-                              -0.2736328125,
-                              -0.27304687499999997,
-                              -0.2724609375,
-                              -0.271875,
-                              -0.2712890625,
-                              -0.270703125,
-                              -0.27011718749999997,
-                              -0.26953125,
-                              -0.2689453125,
-                              -0.268359375,
-                              -0.268359375,
-                              -0.26718749999999997,
-                              -0.2666015625,
-                              -0.266015625,
-                              -0.266015625,
-                              -0.26484375,
-                              -0.26425781249999997,
-                              -0.263671875,
-                              -0.2630859375,
-                              -0.2625,
-                              -0.2619140625,
-                              -0.26132812499999997,
-                              -0.2607421875,
-                              -0.26015625,
-                              -0.2595703125,
-                              -0.258984375,
-                              -0.25839843749999997,
-                              -0.2578125,
-                              -0.2578125,
-                              -0.256640625,
-                              -0.256640625,
-                              -0.2560546875,
-                              -0.25546874999999997,
-                              -0.2548828125,
-                              -0.2537109375,
-                              -0.253125,
-                              -0.25253906249999997,
-                              -0.251953125,
-                              -0.251953125,
-                              -0.25078125,
-                              -0.25078125,
-                              -0.2501953125,
-                              -0.249609375,
-                              -0.24843749999999998,
-                              -0.24843749999999998,
-                              -0.24785156249999998,
-                              -0.247265625,
-                              -0.24609375,
-                              -0.24609375,
-                              -0.24550781249999998,
-                              -0.24492187499999998,
-                              -0.2443359375,
-                              -0.24375,
-                              -0.24257812499999998,
-                              -0.24257812499999998,
-                              -0.24199218749999998,
-                              -0.24140625,
-                              -0.2408203125,
-                              -0.240234375,
-                              -0.23906249999999998,
-                              -0.23906249999999998,
-                              -0.2384765625,
-                              -0.237890625,
-                              -0.2373046875,
-                              -0.23671874999999998,
-                              -0.23613281249999998,
-                              -0.235546875,
-                              -0.2349609375,
-                              -0.234375,
-                              -0.23378906249999998,
-                              -0.23320312499999998,
-                              -0.2326171875,
-                              -0.23203125,
-                              -0.2314453125,
-                              -0.23085937499999998,
-                              -0.23027343749999998,
-                              -0.2296875,
-                              -0.2291015625,
-                              -0.228515625,
-                              -0.22792968749999998,
-                              -0.22734374999999998,
-                              -0.2267578125,
-                              -0.226171875,
-                              -0.2255859375,
-                              -0.22499999999999998,
-                              -0.22441406249999998,
-                              -0.223828125,
-                              -0.2232421875,
-                              -0.22265625,
-                              -0.2220703125,
-                              -0.22148437499999998,
-                              -0.2208984375,
-                              -0.2203125,
-                              -0.2197265625,
-                              -0.219140625,
-                              -0.21855468749999998,
-                              -0.21796875,
-                              -0.2173828125,
-                              -0.216796875,
-                              -0.2162109375,
-                              -0.21562499999999998,
-                              -0.2150390625,
-                              -0.214453125,
-                              -0.2138671875,
-                              -0.21328125,
-                              -0.21269531249999998,
-                              -0.212109375,
-                              -0.2115234375,
-                              -0.2109375,
-                              -0.2103515625,
-                              -0.20976562499999998,
-                              -0.2091796875,
-                              -0.20859375,
-                              -0.2080078125,
-                              -0.207421875,
-                              -0.20683593749999998,
-                              -0.20625,
-                              -0.2056640625,
-                              -0.205078125,
-                              -0.2044921875,
-                              -0.20390624999999998,
-                              -0.2033203125,
-                              -0.202734375,
-                              -0.2021484375,
-                              -0.2021484375,
-                              -0.20097656249999998,
-                              -0.200390625,
-                              -0.1998046875,
-                              -0.19921875,
-                              -0.1986328125,
-                              -0.19804687499999998,
-                              -0.1974609375,
-                              -0.196875,
-                              -0.1962890625,
-                              -0.195703125,
-                              -0.195703125,
-                              -0.19453125,
-                              -0.19453125,
-                              -0.1939453125,
-                              -0.193359375,
-                              -0.1927734375,
-                              -0.19218749999999998,
-                              -0.1916015625,
-                              -0.1904296875,
-                              -0.1904296875,
-                              -0.18984375,
-                              -0.18925781249999998,
-                              -0.188671875,
-                              -0.1880859375,
-                              -0.1869140625,
-                              -0.1869140625,
-                              -0.18632812499999998,
-                              -0.1857421875,
-                              -0.18515625,
-                              -0.1845703125,
-                              -0.183984375,
-                              -0.18339843749999998,
-                              -0.1828125,
-                              -0.1822265625,
-                              -0.181640625,
-                              -0.1810546875,
-                              -0.18046874999999998,
-                              -0.1798828125,
-                              -0.179296875,
-                              -0.1787109375,
-                              -0.178125,
-                              -0.17753906249999998,
-                              -0.176953125,
-                              -0.1763671875,
-                              -0.17578125,
-                              -0.1751953125,
-                              -0.17460937499999998,
-                              -0.1740234375,
-                              -0.1734375,
-                              -0.1728515625,
-                              -0.172265625,
-                              -0.17167968749999998,
-                              -0.17109375,
-                              -0.1705078125,
-                              -0.169921875,
-                              -0.1693359375,
-                              -0.16874999999999998,
-                              -0.1681640625,
-                              -0.167578125,
-                              -0.1669921875,
-                              -0.16640625,
-                              -0.16582031249999998,
-                              -0.165234375,
-                              -0.1646484375,
-                              -0.1640625,
-                              -0.1634765625,
-                              -0.16289062499999998,
-                              -0.1623046875,
-                              -0.16171875,
-                              -0.1611328125,
-                              -0.160546875,
-                              -0.15996093749999998,
-                              -0.159375,
-                              -0.1587890625,
-                              -0.158203125,
-                              -0.1576171875,
-                              -0.1576171875,
-                              -0.15703124999999998,
-                              -0.1564453125,
-                              -0.155859375,
-                              -0.1552734375,
-                              -0.1546875,
-                              -0.153515625,
-                              -0.153515625,
-                              -0.1529296875,
-                              -0.15234375,
-                              -0.15117187499999998,
-                              -0.15117187499999998,
-                              -0.1505859375,
-                              -0.15,
-                              -0.148828125,
-                              -0.148828125,
-                              -0.14824218749999998,
-                              -0.14765625,
-                              -0.1470703125,
-                              -0.146484375,
-                              -0.1458984375,
-                              -0.14531249999999998,
-                              -0.1447265625,
-                              -0.144140625,
-                              -0.1435546875,
-                              -0.14296875,
-                              -0.14238281249999998,
-                              -0.141796875,
-                              -0.1412109375,
-                              -0.140625,
-                              -0.1400390625,
-                              -0.13945312499999998,
-                              -0.1388671875,
-                              -0.13828125,
-                              -0.1376953125,
-                              -0.137109375,
-                              -0.13652343749999998,
-                              -0.1359375,
-                              -0.1353515625,
-                              -0.134765625,
-                              -0.1341796875,
-                              -0.13359374999999998,
-                              -0.1330078125,
-                              -0.132421875,
-                              -0.1318359375,
-                              -0.13125,
-                              -0.13066406249999998,
-                              -0.130078125,
-                              -0.1294921875,
-                              -0.12890625,
-                              -0.1283203125,
-                              -0.12773437499999998,
-                              -0.1271484375,
-                              -0.1265625,
-                              -0.1259765625,
-                              -0.125390625,
-                              -0.1248046875,
-                              -0.12421874999999999,
-                              -0.1236328125,
-                              -0.123046875,
-                              -0.12246093749999999,
-                              -0.121875,
-                              -0.12128906249999999,
-                              -0.120703125,
-                              -0.120703125,
-                              -0.1201171875,
-                              -0.11953124999999999,
-                              -0.1189453125,
-                              -0.11835937499999999,
-                              -0.1177734375,
-                              -0.1171875,
-                              -0.11660156249999999,
-                              -0.116015625,
-                              -0.11542968749999999,
-                              -0.11484375,
-                              -0.1142578125,
-                              -0.11367187499999999,
-                              -0.1130859375,
-                              -0.11249999999999999,
-                              -0.1119140625,
-                              -0.111328125,
-                              -0.11074218749999999,
-                              -0.11015625,
-                              -0.1095703125,
-                              -0.108984375,
-                              -0.1083984375,
-                              -0.10781249999999999,
-                              -0.1072265625,
-                              -0.106640625,
-                              -0.1060546875,
-                              -0.10546875,
-                              -0.10488281249999999,
-                              -0.104296875,
-                              -0.1037109375,
-                              -0.103125,
-                              -0.1025390625,
-                              -0.10195312499999999,
-                              -0.1013671875,
-                              -0.10078125,
-                              -0.1001953125,
-                              -0.099609375,
-                              -0.09902343749999999,
-                              -0.0984375,
-                              -0.0978515625,
-                              -0.097265625,
-                              -0.0966796875,
-                              -0.09609374999999999,
-                              -0.0955078125,
-                              -0.094921875,
-                              -0.094921875,
-                              -0.09375,
-                              -0.09316406249999999,
-                              -0.09316406249999999,
-                              -0.092578125,
-                              -0.0919921875,
-                              -0.09140625,
-                              -0.0908203125,
-                              -0.09023437499999999,
-                              -0.0896484375,
-                              -0.0890625,
-                              -0.0884765625,
-                              -0.087890625,
-                              -0.08730468749999999,
-                              -0.08671875,
-                              -0.0861328125,
-                              -0.085546875,
-                              -0.0849609375,
-                              -0.08437499999999999,
-                              -0.0837890625,
-                              -0.083203125,
-                              -0.0826171875,
-                              -0.08203125,
-                              -0.08144531249999999,
-                              -0.080859375,
-                              -0.0802734375,
-                              -0.0796875,
-                              -0.0796875,
-                              -0.07851562499999999,
-                              -0.0779296875,
-                              -0.07734375,
-                              -0.07734375,
-                              -0.076171875,
-                              -0.076171875,
-                              -0.07558593749999999,
-                              -0.075,
-                              -0.0744140625,
-                              -0.073828125,
-                              -0.0732421875,
-                              -0.07265624999999999,
-                              -0.0720703125,
-                              -0.071484375,
-                              -0.0708984375,
-                              -0.0703125,
-                              -0.06972656249999999,
-                              -0.069140625,
-                              -0.0685546875,
-                              -0.06796875,
-                              -0.0673828125,
-                              -0.06679687499999999,
-                              -0.0662109375,
-                              -0.065625,
-                              -0.0650390625,
-                              -0.064453125,
-                              -0.06386718749999999,
-                              -0.06328125,
-                              -0.0626953125,
-                              -0.062109374999999994,
-                              -0.0615234375,
-                              -0.0615234375,
-                              -0.0603515625,
-                              -0.0603515625,
-                              -0.059179687499999994,
-                              -0.059179687499999994,
-                              -0.05859375,
-                              -0.0580078125,
-                              -0.057421875,
-                              -0.056835937499999996,
-                              -0.056249999999999994,
-                              -0.0556640625,
-                              -0.055078125,
-                              -0.0544921875,
-                              -0.053906249999999996,
-                              -0.0533203125,
-                              -0.052734375,
-                              -0.0521484375,
-                              -0.0515625,
-                              -0.050976562499999996,
-                              -0.050390625,
-                              -0.0498046875,
-                              -0.04921875,
-                              -0.0486328125,
-                              -0.048046874999999996,
-                              -0.0474609375,
-                              -0.0474609375,
-                              -0.046875,
-                              -0.0462890625,
-                              -0.045703125,
-                              -0.045117187499999996,
-                              -0.04453125,
-                              -0.0439453125,
-                              -0.043359375,
-                              -0.0427734375,
-                              -0.042187499999999996,
-                              -0.0416015625,
-                              -0.041015625,
-                              -0.0404296875,
-                              -0.03984375,
-                              -0.039257812499999996,
-                              -0.038671875,
-                              -0.0380859375,
-                              -0.0375,
-                              -0.0369140625,
-                              -0.036328124999999996,
-                              -0.0357421875,
-                              -0.03515625,
-                              -0.0345703125,
-                              -0.033984375,
-                              -0.033398437499999996,
-                              -0.033398437499999996,
-                              -0.0322265625,
-                              -0.0322265625,
-                              -0.031640625,
-                              -0.031054687499999997,
-                              -0.03046875,
-                              -0.029882812499999998,
-                              -0.029296875,
-                              -0.0287109375,
-                              -0.028124999999999997,
-                              -0.0275390625,
-                              -0.026953124999999998,
-                              -0.0263671875,
-                              -0.02578125,
-                              -0.0251953125,
-                              -0.024609375,
-                              -0.024023437499999998,
-                              -0.0234375,
-                              -0.0228515625,
-                              -0.022265625,
-                              -0.022265625,
-                              -0.021093749999999998,
-                              -0.021093749999999998,
-                              -0.0205078125,
-                              -0.019921875,
-                              -0.0193359375,
-                              -0.01875,
-                              -0.018164062499999998,
-                              -0.017578125,
-                              -0.0169921875,
-                              -0.01640625,
-                              -0.0158203125,
-                              -0.015234375,
-                              -0.0146484375,
-                              -0.014062499999999999,
-                              -0.013476562499999999,
-                              -0.012890625,
-                              -0.0123046875,
-                              -0.01171875,
-                              -0.01171875,
-                              -0.0111328125,
-                              -0.010546874999999999,
-                              -0.0099609375,
-                              -0.009375,
-                              -0.0087890625,
-                              -0.008203125,
-                              -0.0076171875,
-                              -0.007031249999999999,
-                              -0.0064453125,
-                              -0.005859375,
-                              -0.0052734374999999995,
-                              -0.0046875,
-                              -0.0041015625,
-                              -0.0035156249999999997,
-                              -0.0029296875,
-                              -0.00234375,
-                              -0.00234375,
-                              -0.001171875,
-                              -0.001171875,
-                              -0.0005859375,
-                              0.0,
-                              0.0005859375,
-                              0.001171875,
-                              0.0017578124999999998,
-                              0.00234375,
-                              0.0029296875,
-                              0.0035156249999999997,
-                              0.0041015625,
-                              0.0046875,
-                              0.0052734374999999995,
-                              0.0052734374999999995,
-                              0.005859375,
-                              0.0064453125,
-                              0.007031249999999999,
-                              0.0076171875,
-                              0.008203125,
-                              0.0087890625,
-                              0.009375,
-                              0.0099609375,
-                              0.010546874999999999,
-                              0.0111328125,
-                              0.01171875,
-                              0.0123046875,
-                              0.012890625,
-                              0.013476562499999999,
-                              0.014062499999999999,
-                              0.014062499999999999,
-                              0.015234375,
-                              0.015234375,
-                              0.01640625,
-                              0.01640625,
-                              0.0169921875,
-                              0.017578125,
-                              0.018164062499999998,
-                              0.01875,
-                              0.0193359375,
-                              0.019921875,
-                              0.0205078125,
-                              0.021093749999999998,
-                              0.0216796875,
-                              0.022265625,
-                              0.0228515625,
-                              0.0228515625,
-                              0.0234375,
-                              0.024023437499999998,
-                              0.024609375,
-                              0.0251953125,
-                              0.02578125,
-                              0.0263671875,
-                              0.026953124999999998,
-                              0.0275390625,
-                              0.028124999999999997,
-                              0.0287109375,
-                              0.029296875,
-                              0.029882812499999998,
-                              0.03046875,
-                              0.031054687499999997,
-                              0.031640625,
-                              0.031640625,
-                              0.0328125,
-                              0.0328125,
-                              0.033398437499999996,
-                              0.033984375,
-                              0.0345703125,
-                              0.03515625,
-                              0.0357421875,
-                              0.036328124999999996,
-                              0.0369140625,
-                              0.0375,
-                              0.0380859375,
-                              0.038671875,
-                              0.039257812499999996,
-                              0.03984375,
-                              0.0404296875,
-                              0.0404296875,
-                              0.041015625,
-                              0.0416015625,
-                              0.042187499999999996,
-                              0.0427734375,
-                              0.043359375,
-                              0.0439453125,
-                              0.04453125,
-                              0.045117187499999996,
-                              0.045703125,
-                              0.0462890625,
-                              0.046875,
-                              0.0474609375,
-                              0.048046874999999996,
-                              0.0486328125,
-                              0.04921875,
-                              0.0498046875,
-                              0.050390625,
-                              0.050976562499999996,
-                              0.0515625,
-                              0.0515625,
-                              0.0521484375,
-                              0.052734375,
-                              0.0533203125,
-                              0.053906249999999996,
-                              0.0544921875,
-                              0.055078125,
-                              0.0556640625,
-                              0.056249999999999994,
-                              0.056835937499999996,
-                              0.057421875,
-                              0.0580078125,
-                              0.05859375,
-                              0.059179687499999994,
-                              0.059765624999999996,
-                              0.0603515625,
-                              0.0603515625,
-                              0.0615234375,
-                              0.0615234375,
-                              0.0626953125,
-                              0.0626953125,
-                              0.06328125,
-                              0.06386718749999999,
-                              0.064453125,
-                              0.0650390625,
-                              0.065625,
-                              0.0662109375,
-                              0.06679687499999999,
-                              0.0673828125,
-                              0.06796875,
-                              0.0685546875,
-                              0.069140625,
-                              0.06972656249999999,
-                              0.0703125,
-                              0.0708984375,
-                              0.071484375,
-                              0.0720703125,
-                              0.07265624999999999,
-                              0.0732421875,
-                              0.073828125,
-                              0.073828125,
-                              0.075,
-                              0.075,
-                              0.076171875,
-                              0.076171875,
-                              0.0767578125,
-                              0.07734375,
-                              0.0779296875,
-                              0.07851562499999999,
-                              0.0791015625,
-                              0.0796875,
-                              0.0802734375,
-                              0.080859375,
-                              0.08144531249999999,
-                              0.08203125,
-                              0.0826171875,
-                              0.083203125,
-                              0.0837890625,
-                              0.08437499999999999,
-                              0.0849609375,
-                              0.085546875,
-                              0.0861328125,
-                              0.08671875,
-                              0.08730468749999999,
-                              0.087890625,
-                              0.0884765625,
-                              0.0890625,
-                              0.0896484375,
-                              0.09023437499999999,
-                              0.0908203125,
-                              0.0908203125,
-                              0.0919921875,
-                              0.0919921875,
-                              0.09316406249999999,
-                              0.09316406249999999,
-                              0.0943359375,
-                              0.0943359375,
-                              0.094921875,
-                              0.0955078125,
-                              0.09609374999999999,
-                              0.0966796875,
-                              0.097265625,
-                              0.0978515625,
-                              0.0984375,
-                              0.09902343749999999,
-                              0.099609375,
-                              0.1001953125,
-                              0.10078125,
-                              0.1013671875,
-                              0.10195312499999999,
-                              0.1025390625,
-                              0.103125,
-                              0.1037109375,
-                              0.104296875,
-                              0.10488281249999999,
-                              0.10546875,
-                              0.1060546875,
-                              0.106640625,
-                              0.1072265625,
-                              0.10781249999999999,
-                              0.1083984375,
-                              0.108984375,
-                              0.108984375,
-                              0.11015625,
-                              0.11015625,
-                              0.111328125,
-                              0.1119140625,
-                              0.11249999999999999,
-                              0.11249999999999999,
-                              0.1130859375,
-                              0.11367187499999999,
-                              0.11484375,
-                              0.11484375,
-                              0.11542968749999999,
-                              0.116015625,
-                              0.11660156249999999,
-                              0.1171875,
-                              0.1177734375,
-                              0.11835937499999999,
-                              0.1189453125,
-                              0.11953124999999999,
-                              0.1201171875,
-                              0.120703125,
-                              0.121875,
-                              0.121875,
-                              0.12246093749999999,
-                              0.123046875,
-                              0.1236328125,
-                              0.12421874999999999,
-                              0.1248046875,
-                              0.125390625,
-                              0.1259765625,
-                              0.1265625,
-                              0.1271484375,
-                              0.12773437499999998,
-                              0.1283203125,
-                              0.12890625,
-                              0.1294921875,
-                              0.130078125,
-                              0.13066406249999998,
-                              0.13066406249999998,
-                              0.1318359375,
-                              0.1318359375,
-                              0.1330078125,
-                              0.1330078125,
-                              0.1341796875,
-                              0.1341796875,
-                              0.1353515625,
-                              0.1353515625,
-                              0.13652343749999998,
-                              0.13652343749999998,
-                              0.137109375,
-                              0.1376953125,
-                              0.1388671875,
-                              0.1388671875,
-                              0.13945312499999998,
-                              0.1400390625,
-                              0.140625,
-                              0.1412109375,
-                              0.141796875,
-                              0.14238281249999998,
-                              0.1435546875,
-                              0.1435546875,
-                              0.144140625,
-                              0.1447265625,
-                              0.14531249999999998,
-                              0.1458984375,
-                              0.146484375,
-                              0.1470703125,
-                              0.14765625,
-                              0.14824218749999998,
-                              0.148828125,
-                              0.1494140625,
-                              0.15,
-                              0.1505859375,
-                              0.15117187499999998,
-                              0.1517578125,
-                              0.15234375,
-                              0.1529296875,
-                              0.153515625,
-                              0.15410156249999998,
-                              0.1546875,
-                              0.1552734375,
-                              0.155859375,
-                              0.1564453125,
-                              0.15703124999999998,
-                              0.1576171875,
-                              0.158203125,
-                              0.1587890625,
-                              0.159375,
-                              0.15996093749999998,
-                              0.160546875,
-                              0.1611328125,
-                              0.16171875,
-                              0.1623046875,
-                              0.16289062499999998,
-                              0.16289062499999998,
-                              0.1640625,
-                              0.1646484375,
-                              0.165234375,
-                              0.16582031249999998,
-                              0.16640625,
-                              0.16640625,
-                              0.167578125,
-                              0.167578125,
-                              0.16874999999999998,
-                              0.16874999999999998,
-                              0.169921875,
-                              0.169921875,
-                              0.17109375,
-                              0.17109375,
-                              0.172265625,
-                              0.172265625,
-                              0.1734375,
-                              0.1734375,
-                              0.17460937499999998,
-                              0.17460937499999998,
-                              0.17578125,
-                              0.17578125,
-                              0.176953125,
-                              0.176953125,
-                              0.178125,
-                              0.178125,
-                              0.179296875,
-                              0.179296875,
-                              0.1798828125,
-                              0.18046874999999998,
-                              0.1810546875,
-                              0.181640625,
-                              0.1828125,
-                              0.1828125,
-                              0.18339843749999998,
-                              0.183984375,
-                              0.1845703125,
-                              0.18515625,
-                              0.18632812499999998,
-                              0.18632812499999998,
-                              0.1869140625,
-                              0.1875,
-                              0.1880859375,
-                              0.188671875,
-                              0.18925781249999998,
-                              0.18984375,
-                              0.1904296875,
-                              0.191015625,
-                              0.1916015625,
-                              0.19218749999999998,
-                              0.1927734375,
-                              0.193359375,
-                              0.1939453125,
-                              0.19453125,
-                              0.19511718749999998,
-                              0.195703125,
-                              0.1962890625,
-                              0.196875,
-                              0.1974609375,
-                              0.19804687499999998,
-                              0.1986328125,
-                              0.19921875,
-                              0.1998046875,
-                              0.200390625,
-                              0.20097656249999998,
-                              0.2015625,
-                              0.2021484375,
-                              0.202734375,
-                              0.2033203125,
-                              0.20390624999999998,
-                              0.2044921875,
-                              0.2044921875,
-                              0.2056640625,
-                              0.20625,
-                              0.20683593749999998,
-                              0.20683593749999998,
-                              0.2080078125,
-                              0.2080078125,
-                              0.2091796875,
-                              0.20976562499999998,
-                              0.2103515625,
-                              0.2109375,
-                              0.2115234375,
-                              0.2115234375,
-                              0.21269531249999998,
-                              0.21328125,
-                              0.2138671875,
-                              0.2138671875,
-                              0.2150390625,
-                              0.2150390625,
-                              0.2162109375,
-                              0.216796875,
-                              0.2173828125,
-                              0.21796875,
-                              0.21855468749999998,
-                              0.21855468749999998,
-                              0.2197265625,
-                              0.2203125,
-                              0.2208984375,
-                              0.2208984375,
-                              0.2220703125,
-                              0.2220703125,
-                              0.2232421875,
-                              0.2232421875,
-                              0.22441406249999998,
-                              0.22441406249999998,
-                              0.2255859375,
-                              0.2255859375,
-                              0.2267578125,
-                              0.2267578125,
-                              0.22792968749999998,
-                              0.22792968749999998,
-                              0.2291015625,
-                              0.2291015625,
-                              0.23027343749999998,
-                              0.23027343749999998,
-                              0.2314453125,
-                              0.2314453125,
-                              0.2326171875,
-                              0.2326171875,
-                              0.23320312499999998,
-                              0.23378906249999998,
-                              0.2349609375,
-                              0.2349609375,
-                              0.235546875,
-                              0.23613281249999998,
-                              0.23671874999999998,
-                              0.2373046875,
-                              0.237890625,
-                              0.2384765625,
-                              0.23964843749999998,
-                              0.23964843749999998,
-                              0.240234375,
-                              0.2408203125,
-                              0.24140625,
-                              0.24199218749999998,
-                              0.24257812499999998,
-                              0.2431640625,
-                              0.24375,
-                              0.2443359375,
-                              0.24492187499999998,
-                              0.24550781249999998,
-                              0.24609375,
-                              0.2466796875,
-                              0.247265625,
-                              0.24785156249999998,
-                              0.24843749999999998,
-                              0.2490234375,
-                              0.249609375,
-                              0.2501953125,
-                              0.25078125,
-                              0.2513671875,
-                              0.251953125,
-                              0.25253906249999997,
-                              0.253125,
-                              0.2537109375,
-                              0.254296875,
-                              0.2548828125,
-                              0.25546874999999997,
-                              0.2560546875,
-                              0.256640625,
-                              0.2572265625,
-                              0.2578125,
-                              0.25839843749999997,
-                              0.258984375,
-                              0.2595703125,
-                              0.26015625,
-                              0.2607421875,
-                              0.26132812499999997,
-                              0.2619140625,
-                              0.2625,
-                              0.2630859375,
-                              0.263671875,
-                              0.26425781249999997,
-                              0.26484375,
-                              0.2654296875,
-                              0.266015625,
-                              0.2666015625,
-                              0.26718749999999997,
-                              0.2677734375,
-                              0.268359375,
-                              0.2689453125,
-                              0.26953125,
-                              0.27011718749999997,
-                              0.270703125,
-                              0.2712890625,
-                              0.271875,
-                              0.2724609375,
-                              0.27304687499999997,
-                              0.2736328125,
-                              0.27421875,
-                              0.2748046875,
-                              0.275390625,
-                              0.27597656249999997,
-                              0.2765625,
-                              0.2771484375,
-                              0.277734375,
-                              0.2783203125,
-                              0.27890624999999997,
-                              0.27890624999999997,
-                              0.2794921875,
-                              0.280078125,
-                              0.28125,
-                              0.28125,
-                              0.282421875,
-                              0.282421875,
-                              0.28359375,
-                              0.28359375,
-                              0.28476562499999997,
-                              0.28476562499999997,
-                              0.2859375,
-                              0.2859375,
-                              0.287109375,
-                              0.287109375,
-                              0.28828125,
-                              0.28828125,
-                              0.289453125,
-                              0.289453125,
-                              0.29062499999999997,
-                              0.29062499999999997,
-                              0.291796875,
-                              0.291796875,
-                              0.29296875,
-                              0.29296875,
-                              0.294140625,
-                              0.294140625,
-                              0.2953125,
-                              0.2953125,
-                              0.2958984375,
-                              0.29648437499999997,
-                              0.2970703125,
-                              0.29765625,
-                              0.2982421875,
-                              0.298828125,
-                              0.29941406249999997,
-                              0.3,
-                              0.3005859375,
-                              0.301171875,
-                              0.3017578125,
-                              0.30234374999999997,
-                              0.3029296875,
-                              0.303515625,
-                              0.3041015625,
-                              0.3046875,
-                              0.30527343749999997,
-                              0.305859375,
-                              0.3064453125,
-                              0.30703125,
-                              0.3076171875,
-                              0.30820312499999997,
-                              0.3087890625,
-                              0.309375,
-                              0.3099609375,
-                              0.310546875,
-                              0.31113281249999997,
-                              0.31171875,
-                              0.3123046875,
-                              0.312890625,
-                              0.3134765625,
-                              0.31406249999999997,
-                              0.3146484375,
-                              0.315234375,
-                              0.3158203125,
-                              0.3158203125,
-                              0.31699218749999997,
-                              0.31699218749999997,
-                              0.3181640625,
-                              0.3181640625,
-                              0.3193359375,
-                              0.3193359375,
-                              0.3205078125,
-                              0.3205078125,
-                              0.3216796875,
-                              0.3216796875,
-                              0.32285156249999997,
-                              0.3234375,
-                              0.3240234375,
-                              0.3240234375,
-                              0.3251953125,
-                              0.3251953125,
-                              0.3263671875,
-                              0.3263671875,
-                              0.3275390625,
-                              0.328125,
-                              0.32871093749999997,
-                              0.32871093749999997,
-                              0.3298828125,
-                              0.3298828125,
-                              0.3310546875,
-                              0.33164062499999997,
-                              0.3322265625,
-                              0.3322265625,
-                              0.3333984375,
-                              0.3333984375,
-                              0.33457031249999997,
-                              0.33457031249999997,
-                              0.3357421875,
-                              0.3357421875,
-                              0.3369140625,
-                              0.3369140625,
-                              0.3380859375,
-                              0.3380859375,
-                              0.3392578125,
-                              0.3392578125,
-                              0.34042968749999997,
-                              0.34042968749999997,
-                              0.3416015625,
-                              0.3421875,
-                              0.3427734375,
-                              0.3427734375,
-                              0.3439453125,
-                              0.3439453125,
-                              0.3451171875,
-                              0.3451171875,
-                              0.34628906249999997,
-                              0.34628906249999997,
-                              0.3474609375,
-                              0.348046875,
-                              0.3486328125,
-                              0.3486328125,
-                              0.3498046875,
-                              0.3498046875,
-                              0.3509765625,
-                              0.3509765625,
-                              0.35214843749999997,
-                              0.35214843749999997,
-                              0.3533203125,
-                              0.3533203125,
-                              0.3544921875,
-                              0.3544921875,
-                              0.3556640625,
-                              0.3556640625,
-                              0.35625,
-                              0.3568359375,
-                              0.35800781249999997,
-                              0.35800781249999997,
-                              0.3591796875,
-                              0.3591796875,
-                              0.3603515625,
-                              0.3603515625,
-                              0.3615234375,
-                              0.3615234375,
-                              0.3626953125,
-                              0.3626953125,
-                              0.36386718749999997,
-                              0.36386718749999997,
-                              0.3650390625,
-                              0.3650390625,
-                              0.3662109375,
-                              0.3662109375,
-                              0.3673828125,
-                              0.3673828125,
-                              0.3685546875,
-                              0.3685546875,
-                              0.36972656249999997,
-                              0.36972656249999997,
-                              0.3708984375,
-                              0.3708984375,
-                              0.3720703125,
-                              0.3720703125,
-                              0.3732421875,
-                              0.3732421875,
-                              0.373828125,
-                              0.3744140625,
-                              0.375,
-                              0.37558593749999997,
-                              0.3767578125,
-                              0.3767578125,
-                              0.37734375,
-                              0.3779296875,
-                              0.3791015625,
-                              0.3791015625,
-                              0.3796875,
-                              0.3802734375,
-                              0.38144531249999997,
-                              0.38144531249999997,
-                              0.38203125,
-                              0.3826171875,
-                              0.383203125,
-                              0.3837890625,
-                              0.38437499999999997,
-                              0.3849609375,
-                              0.385546875,
-                              0.3861328125,
-                              0.38671875,
-                              0.38730468749999997,
-                              0.3884765625,
-                              0.3884765625,
-                              0.3896484375,
-                              0.3896484375,
-                              0.3908203125,
-                              0.3908203125,
-                              0.39140625,
-                              0.3919921875,
-                              0.392578125,
-                              0.39316406249999997,
-                              0.39375,
-                              0.3943359375,
-                              0.394921875,
-                              0.3955078125,
-                              0.39609374999999997,
-                              0.3966796875,
-                              0.397265625,
-                              0.3978515625,
-                              0.3984375,
-                              0.39902343749999997,
-                              0.399609375,
-                              0.4001953125,
-                              0.40078125,
-                              0.4013671875,
-                              0.40195312499999997,
-                              0.4025390625,
-                              0.403125,
-                              0.4037109375,
-                              0.40488281249999997,
-                              0.40488281249999997,
-                              0.4060546875,
-                              0.4060546875,
-                              0.406640625,
-                              0.4072265625,
-                              0.40781249999999997,
-                              0.4083984375,
-                              0.4095703125,
-                              0.4095703125,
-                              0.41015625,
-                              0.41074218749999997,
-                              0.411328125,
-                              0.4119140625,
-                              0.4125,
-                              0.4130859375,
-                              0.41367187499999997,
-                              0.4142578125,
-                              0.41484375,
-                              0.4154296875,
-                              0.416015625,
-                              0.41660156249999997,
-                              0.4171875,
-                              0.4177734375,
-                              0.418359375,
-                              0.4189453125,
-                              0.41953124999999997,
-                              0.4201171875,
-                              0.420703125,
-                              0.4212890625,
-                              0.421875,
-                              0.42246093749999997,
-                              0.423046875,
-                              0.4236328125,
-                              0.42421875,
-                              0.4248046875,
-                              0.42539062499999997,
-                              0.4259765625,
-                              0.4265625,
-                              0.4271484375,
-                              0.427734375,
-                              0.427734375,
-                              0.42890625,
-                              0.42890625,
-                              0.430078125,
-                              0.4306640625,
-                              0.43124999999999997,
-                              0.43124999999999997,
-                              0.432421875,
-                              0.4330078125,
-                              0.43359375,
-                              0.43359375,
-                              0.434765625,
-                              0.434765625,
-                              0.4359375,
-                              0.4359375,
-                              0.43710937499999997,
-                              0.43710937499999997,
-                              0.43828125,
-                              0.43828125,
-                              0.439453125,
-                              0.439453125,
-                              0.440625,
-                              0.440625,
-                              0.441796875,
-                              0.4423828125,
-                              0.44296874999999997,
-                              0.44296874999999997,
-                              0.444140625,
-                              0.444140625,
-                              0.4453125,
-                              0.44589843749999997,
-                              0.446484375,
-                              0.4470703125,
-                              0.44765625,
-                              0.4482421875,
-                              0.44882812499999997,
-                              0.44882812499999997,
-                              0.44999999999999996,
-                              0.44999999999999996,
-                              0.451171875,
-                              0.451171875,
-                              0.45234375,
-                              0.45234375,
-                              0.453515625,
-                              0.453515625,
-                              0.45468749999999997,
-                              0.45468749999999997,
-                              0.45585937499999996,
-                              0.45585937499999996,
-                              0.45703125,
-                              0.45703125,
-                              0.458203125,
-                              0.458203125,
-                              0.459375,
-                              0.459375,
-                              0.46054687499999997,
-                              0.46054687499999997,
-                              0.46171874999999996,
-                              0.46171874999999996,
-                              0.462890625,
-                              0.462890625,
-                              0.4640625,
-                              0.4640625,
-                              0.465234375,
-                              0.465234375,
-                              0.46640624999999997,
-                              0.46640624999999997,
-                              0.46757812499999996,
-                              0.46757812499999996,
-                              0.46875,
-                              0.46875,
-                              0.469921875,
-                              0.469921875,
-                              0.47109375,
-                              0.47109375,
-                              0.47226562499999997,
-                              0.47226562499999997,
-                              0.47343749999999996,
-                              0.47343749999999996,
-                              0.474609375,
-                              0.474609375,
-                              0.47578125,
-                              0.47578125,
-                              0.476953125,
-                              0.476953125,
-                              0.47812499999999997,
-                              0.47812499999999997,
-                              0.47929687499999996,
-                              0.47929687499999996,
-                              0.48046875,
-                              0.48046875,
-                              0.481640625,
-                              0.481640625,
-                              0.4828125,
-                              0.4828125,
-                              0.48398437499999997,
-                              0.48398437499999997,
-                              0.48515624999999996,
-                              0.48515624999999996,
-                              0.486328125,
-                              0.486328125,
-                              0.4875,
-                              0.4875,
-                              0.488671875,
-                              0.488671875,
-                              0.48984374999999997,
-                              0.48984374999999997,
-                              0.49101562499999996,
-                              0.49101562499999996,
-                              0.4921875,
-                              0.4921875,
-                              0.493359375,
-                              0.493359375,
-                              0.49453125,
-                              0.49453125,
-                              0.49570312499999997,
-                              0.49570312499999997,
-                              0.49687499999999996,
-                              0.49687499999999996,
-                              0.498046875,
-                              0.498046875,
-                              0.49921875,
-                              0.49921875,
-                              0.500390625,
-                              0.500390625,
-                              0.5015625,
-                              0.5015625,
-                              0.502734375,
-                              0.502734375,
-                              0.50390625,
-                              0.50390625,
-                              0.5050781249999999,
-                              0.5050781249999999,
-                              0.50625,
-                              0.50625,
-                              0.507421875,
-                              0.507421875,
-                              0.50859375,
-                              0.50859375,
-                              0.509765625,
-                              0.509765625,
-                              0.5109374999999999,
-                              0.5109374999999999,
-                              0.512109375,
-                              0.512109375,
-                              0.51328125,
-                              0.51328125,
-                              0.514453125,
-                              0.514453125,
-                              0.515625,
-                              0.515625,
-                              0.5167968749999999,
-                              0.5167968749999999,
-                              0.51796875,
-                              0.51796875,
-                              0.519140625,
-                              0.519140625,
-                              0.5203125,
-                              0.5203125,
-                              0.521484375,
-                              0.521484375,
-                              0.5226562499999999,
-                              0.5226562499999999,
-                              0.523828125,
-                              0.523828125,
-                              0.525,
-                              0.525,
-                              0.526171875,
-                              0.526171875,
-                              0.52734375,
-                              0.52734375,
-                              0.5285156249999999,
-                              0.5285156249999999,
-                              0.5296875,
-                              0.5296875,
-                              0.530859375,
-                              0.530859375,
-                              0.53203125,
-                              0.53203125,
-                              0.533203125,
-                              0.533203125,
-                              0.5343749999999999,
-                              0.5343749999999999,
-                              0.535546875,
-                              0.535546875,
-                              0.53671875,
-                              0.53671875,
-                              0.537890625,
-                              0.537890625,
-                              0.5390625,
-                              0.5390625,
-                              0.5402343749999999,
-                              0.5402343749999999,
-                              0.54140625,
-                              0.54140625,
-                              0.5419921875,
-                              0.542578125,
-                              0.54375,
-                              0.54375,
-                              0.544921875,
-                              0.544921875,
-                              0.5460937499999999,
-                              0.5460937499999999,
-                              0.547265625,
-                              0.547265625,
-                              0.5484375,
-                              0.5484375,
-                              0.549609375,
-                              0.549609375,
-                              0.55078125,
-                              0.55078125,
-                              0.5519531249999999,
-                              0.5519531249999999,
-                              0.553125,
-                              0.553125,
-                              0.554296875,
-                              0.554296875,
-                              0.55546875,
-                              0.55546875,
-                              0.556640625,
-                              0.556640625,
-                              0.5578124999999999,
-                              0.5578124999999999,
-                              0.558984375,
-                              0.558984375,
-                              0.56015625,
-                              0.56015625,
-                              0.561328125,
-                              0.561328125,
-                              0.5625,
-                              0.5625,
-                              0.5636718749999999,
-                              0.5636718749999999,
-                              0.56484375,
-                              0.56484375,
-                              0.566015625,
-                              0.566015625,
-                              0.5671875,
-                              0.5671875,
-                              0.568359375,
-                              0.568359375,
-                              0.5695312499999999,
-                              0.5695312499999999,
-                              0.570703125,
-                              0.570703125,
-                              0.571875,
-                              0.571875,
-                              0.573046875,
-                              0.573046875,
-                              0.57421875,
-                              0.57421875,
-                              0.5753906249999999,
-                              0.5753906249999999,
-                              0.5765625,
-                              0.5765625,
-                              0.577734375,
-                              0.5771484375,
-                              0.5783203124999999,
-                              0.5783203124999999,
-                              0.5794921875,
-                              0.5794921875,
-                              0.5806640625,
-                              0.5806640625,
-                              0.5818359375,
-                              0.5818359375,
-                              0.5830078125,
-                              0.5830078125,
-                              0.5841796874999999,
-                              0.5841796874999999,
-                              0.5853515625,
-                              0.5853515625,
-                              0.5865234375,
-                              0.5865234375,
-                              0.5876953125,
-                              0.5876953125,
-                              0.5888671875,
-                              0.5888671875,
-                              0.5900390624999999,
-                              0.590625,
-                              0.5912109375,
-                              0.5912109375,
-                              0.5923828125,
-                              0.5923828125,
-                              0.5935546875,
-                              0.5935546875,
-                              0.5947265625,
-                              0.5947265625,
-                              0.5958984374999999,
-                              0.5958984374999999,
-                              0.5970703125,
-                              0.5970703125,
-                              0.5982421875,
-                              0.5982421875,
-                              0.5994140625,
-                              0.5994140625,
-                              0.6005859375,
-                              0.6005859375,
-                              0.6017578124999999,
-                              0.6017578124999999,
-                              0.6029296875,
-                              0.6029296875,
-                              0.6041015625,
-                              0.6041015625,
-                              0.6052734375,
-                              0.6052734375,
-                              0.6064453125,
-                              0.6064453125,
-                              0.6076171874999999,
-                              0.6076171874999999,
-                              0.6087890625,
-                              0.6087890625,
-                              0.6099609375,
-                              0.6099609375,
-                              0.6111328125,
-                              0.6111328125,
-                              0.6123046875,
-                              0.6123046875,
-                              0.6134765624999999,
-                              0.6134765624999999,
-                              0.6146484375,
-                              0.6146484375,
-                              0.6158203125,
-                              0.6158203125,
-                              0.6169921875,
-                              0.6169921875,
-                              0.6181640625,
-                              0.6181640625,
-                              0.6193359374999999,
-                              0.6193359374999999,
-                              0.6205078125,
-                              0.6205078125,
-                              0.6216796875,
-                              0.6216796875,
-                              0.6228515625,
-                              0.6228515625,
-                              0.6240234375,
-                              0.6240234375,
-                              0.6251953124999999,
-                              0.6251953124999999,
-                              0.6263671875,
-                              0.6263671875,
-                              0.6275390625,
-                              0.6275390625,
-                              0.6287109375,
-                              0.6287109375,
-                              0.6298828125,
-                              0.6298828125,
-                              0.6310546874999999,
-                              0.6310546874999999,
-                              0.6322265625,
-                              0.6322265625,
-                              0.6333984375,
-                              0.6333984375,
-                              0.6345703125,
-                              0.6345703125,
-                              0.6357421875,
-                              0.6357421875,
-                              0.6369140624999999,
-                              0.6369140624999999,
-                              0.6380859375,
-                              0.6380859375,
-                              0.6392578125,
-                              0.6392578125,
-                              0.6404296875,
-                              0.6404296875,
-                              0.6416015625,
-                              0.6416015625,
-                              0.6427734374999999,
-                              0.6427734374999999,
-                              0.6439453125,
-                              0.6439453125,
-                              0.6451171875,
-                              0.6451171875,
-                              0.6462890625,
-                              0.6462890625,
-                              0.6474609375,
-                              0.6474609375,
-                              0.6486328124999999,
-                              0.6486328124999999,
-                              0.6498046875,
-                              0.6498046875,
-                              0.6509765625,
-                              0.6509765625,
-                              0.6521484375,
-                              0.6521484375,
-                              0.6533203125,
-                              0.6533203125,
-                              0.6544921874999999,
-                              0.6544921874999999,
-                              0.6556640625,
-                              0.6556640625,
-                              0.6568359375,
-                              0.6568359375,
-                              0.6580078125,
-                              0.6580078125,
-                              0.6591796875,
-                              0.6591796875,
-                              0.6603515624999999,
-                              0.6603515624999999,
-                              0.6615234375,
-                              0.6615234375,
-                              0.6626953125,
-                              0.6626953125,
-                              0.6638671875,
-                              0.6638671875,
-                              0.6650390625,
-                              0.6650390625,
-                              0.6662109374999999,
-                              0.6662109374999999,
-                              0.6673828125,
-                              0.6673828125,
-                              0.6685546875,
-                              0.6685546875,
-                              0.6697265625,
-                              0.6697265625,
-                              0.6708984375,
-                              0.6708984375,
-                              0.6720703124999999,
-                              0.6720703124999999,
-                              0.6732421875,
-                              0.6732421875,
-                              0.6744140625,
-                              0.6744140625,
-                              0.6755859375,
-                              0.6755859375,
-                              0.6767578125,
-                              0.6767578125,
-                              0.6779296874999999,
-                              0.6779296874999999,
-                              0.6791015625,
-                              0.6791015625,
-                              0.6802734375,
-                              0.6802734375,
-                              0.6814453125,
-                              0.6814453125,
-                              0.6826171875,
-                              0.6826171875,
-                              0.6837890624999999,
-                              0.6837890624999999,
-                              0.6849609375,
-                              0.6849609375,
-                              0.6861328125,
-                              0.6861328125,
-                              0.6873046875,
-                              0.6873046875,
-                              0.6884765625,
-                              0.6884765625,
-                              0.6896484374999999,
-                              0.6896484374999999,
-                              0.6908203125,
-                              0.6908203125,
-                              0.6919921875,
-                              0.6919921875,
-                              0.6931640625,
-                              0.6931640625,
-                              0.6943359375,
-                              0.6943359375,
-                              0.6955078124999999,
-                              0.6955078124999999,
-                              0.6966796875,
-                              0.6966796875,
-                              0.6978515625,
-                              0.6978515625,
-                              0.6990234375,
-                              0.6990234375,
-                              0.7001953125,
-                              0.7001953125,
-                              0.7013671874999999,
-                              0.7013671874999999,
-                              0.7025390625,
-                              0.7025390625,
-                              0.7037109375,
-                              0.7037109375,
-                              0.7048828125,
-                              0.7048828125,
-                              0.7060546875,
-                              0.7060546875,
-                              0.7072265624999999,
-                              0.7072265624999999,
-                              0.7083984375,
-                              0.7083984375,
-                              0.7095703125,
-                              0.7095703125,
-                              0.7107421875,
-                              0.7107421875,
-                              0.7119140625,
-                              0.7119140625,
-                              0.7130859374999999,
-                              0.7130859374999999,
-                              0.7142578125,
-                              0.7142578125,
-                              0.7154296875,
-                              0.7154296875,
-                              0.7166015625,
-                              0.7166015625,
-                              0.7177734375,
-                              0.7177734375,
-                              0.7189453124999999,
-                              0.7189453124999999,
-                              0.7201171875,
-                              0.7201171875,
-                              0.7212890625,
-                              0.7212890625,
-                              0.7224609375,
-                              0.7224609375,
-                              0.7236328125,
-                              0.7236328125,
-                              0.7248046874999999,
-                              0.7248046874999999,
-                              0.7259765625,
-                              0.7259765625,
-                              0.7271484375,
-                              0.7271484375,
-                              0.7277343749999999,
-                              0.7283203125,
-                              0.7294921875,
-                              0.7294921875,
-                              0.7306640624999999,
-                              0.7306640624999999,
-                              0.7318359375,
-                              0.7318359375,
-                              0.7330078125,
-                              0.7330078125,
-                              0.7341796875,
-                              0.7341796875,
-                              0.7353515625,
-                              0.7353515625,
-                              0.7365234374999999,
-                              0.7365234374999999,
-                              0.7376953125,
-                              0.7376953125,
-                              0.7388671875,
-                              0.7388671875,
-                              0.7400390625,
-                              0.7400390625,
-                              0.7412109375,
-                              0.7412109375,
-                              0.7423828124999999,
-                              0.7423828124999999,
-                              0.7435546875,
-                              0.7435546875,
-                              0.7447265625,
-                              0.7447265625,
-                              0.7458984375,
-                              0.7458984375,
-                              0.7470703125,
-                              0.7470703125,
-                              0.7482421874999999,
-                              0.7482421874999999,
-                              0.7494140625,
-                              0.7494140625,
-                              0.7505859375,
-                              0.7505859375,
-                              0.7517578125,
-                              0.7517578125,
-                              0.7529296875,
-                              0.7529296875,
-                              0.7541015624999999,
-                              0.7541015624999999,
-                              0.7552734375,
-                              0.7552734375,
-                              0.7564453125,
-                              0.7564453125,
-                              0.7576171875,
-                              0.7576171875,
-                              0.7587890625,
-                              0.7587890625,
-                              0.7599609374999999,
-                              0.7599609374999999,
-                              0.7611328125,
-                              0.7611328125,
-                              0.7623046875,
-                              0.7623046875,
-                              0.7634765625,
-                              0.7634765625,
-                              0.7646484375,
-                              0.7646484375,
-                              0.7658203124999999,
-                              0.7658203124999999,
-                              0.7669921875,
-                              0.7669921875,
-                              0.7681640625,
-                              0.7681640625,
-                              0.7693359375,
-                              0.7693359375,
-                              0.7705078125,
-                              0.7705078125,
-                              0.7716796874999999,
-                              0.7716796874999999,
-                              0.7728515625,
-                              0.7728515625,
-                              0.7740234375,
-                              0.7740234375,
-                              0.7751953125,
-                              0.7751953125,
-                              0.7763671875,
-                              0.7763671875,
-                              0.7775390624999999,
-                              0.7775390624999999,
-                              0.7787109375,
-                              0.7787109375,
-                              0.7798828125,
-                              0.7798828125,
-                              0.7810546875,
-                              0.7810546875,
-                              0.7822265625,
-                              0.7822265625,
-                              0.7833984374999999,
-                              0.7833984374999999,
-                              0.7845703125,
-                              0.7845703125,
-                              0.7857421875,
-                              0.7857421875,
-                              0.7869140625,
-                              0.7869140625,
-                              0.7880859375,
-                              0.7880859375,
-                              0.7892578124999999,
-                              0.7892578124999999,
-                              0.7904296875,
-                              0.7904296875,
-                              0.7916015625,
-                              0.7916015625,
-                              0.7927734375,
-                              0.7927734375,
-                              0.7939453125,
-                              0.7939453125,
-                              0.7951171874999999,
-                              0.7951171874999999,
-                              0.7962890625,
-                              0.7962890625,
-                              0.7974609375,
-                              0.7974609375,
-                              0.7986328125,
-                              0.7986328125,
-                              0.7998046875,
-                              0.7998046875,
-                              0.8009765624999999,
-                              0.8009765624999999,
-                              0.8021484375,
-                              0.8015625,
-                              0.802734375,
-                              0.8033203125,
-                              0.8039062499999999,
-                              0.8044921875,
-                              0.8056640625,
-                              0.805078125,
-                              0.8068359374999999,
-                              0.80625,
-                              0.8080078125,
-                              0.8080078125,
-                              0.8091796875,
-                              0.80859375,
-                              0.8103515625,
-                              0.8103515625,
-                              0.8109375,
-                              0.8115234375,
-                              0.812109375,
-                              0.8126953124999999,
-                              0.8138671875,
-                              0.8138671875,
-                              0.8150390625,
-                              0.8150390625,
-                              0.8156249999999999,
-                              0.8156249999999999,
-                              0.8173828125,
-                              0.816796875,
-                              0.8185546874999999,
-                              0.81796875,
-                              0.819140625,
-                              0.8197265625,
-                              0.8203125,
-                              0.8203125,
-                              0.8220703125,
-                              0.8214843749999999,
-                              0.82265625,
-                              0.82265625,
-                              0.8244140624999999,
-                              0.8244140624999999,
-                              0.8255859375,
-                              0.825,
-                              0.8267578125,
-                              0.826171875,
-                              0.8279296875,
-                              0.8279296875,
-                              0.828515625,
-                              0.828515625,
-                              0.8302734374999999,
-                              0.8296875,
-                              0.830859375,
-                              0.8314453125,
-                              0.8326171875,
-                              0.8326171875,
-                              0.8337890625,
-                              0.8337890625,
-                              0.8349609375,
-                              0.8349609375,
-                              0.8361328124999999,
-                              0.8361328124999999,
-                              0.8373046875,
-                              0.83671875,
-                              0.8384765625,
-                              0.8384765625,
-                              0.8396484375,
-                              0.8390624999999999,
-                              0.840234375,
-                              0.840234375,
-                              0.84140625,
-                              0.84140625,
-                              0.842578125,
-                              0.842578125,
-                              0.8443359375,
-                              0.84375,
-                              0.8449218749999999,
-                              0.8449218749999999,
-                              0.84609375,
-                              0.84609375,
-                              0.8478515624999999,
-                              0.8478515624999999,
-                              0.8490234375,
-                              0.8484375,
-                              0.8501953125,
-                              0.849609375,
-                              0.8513671875,
-                              0.8507812499999999,
-                              0.851953125,
-                              0.851953125,
-                              0.8537109374999999,
-                              0.853125,
-                              0.854296875,
-                              0.854296875,
-                              0.85546875,
-                              0.85546875,
-                              0.8572265625,
-                              0.8572265625,
-                              0.8583984375,
-                              0.8578125,
-                              0.858984375,
-                              0.858984375,
-                              0.86015625,
-                              0.86015625,
-                              0.861328125,
-                              0.861328125,
-                              0.8624999999999999,
-                              0.8624999999999999,
-                              0.863671875,
-                              0.863671875,
-                              0.86484375,
-                              0.86484375,
-                              0.866015625,
-                              0.866015625,
-                              0.8677734375,
-                              0.8671875,
-                              0.8683593749999999,
-                              0.8683593749999999,
-                              0.86953125,
-                              0.86953125,
-                              0.8712890624999999,
-                              0.870703125,
-                              0.8724609375,
-                              0.871875,
-                              0.873046875,
-                              0.873046875,
-                              0.8742187499999999,
-                              0.8742187499999999,
-                              0.875390625,
-                              0.875390625,
-                              0.8771484374999999,
-                              0.8765625,
-                              0.877734375,
-                              0.877734375,
-                              0.87890625,
-                              0.87890625,
-                              0.8800781249999999,
-                              0.8800781249999999,
-                              0.88125,
-                              0.88125,
-                              0.882421875,
-                              0.882421875,
-                              0.88359375,
-                              0.88359375,
-                              0.884765625,
-                              0.884765625,
-                              0.8859374999999999,
-                              0.8859374999999999,
-                              0.887109375,
-                              0.887109375,
-                              0.88828125,
-                              0.88828125,
-                              0.889453125,
-                              0.889453125,
-                              0.890625,
-                              0.890625,
-                              0.8917968749999999,
-                              0.8917968749999999,
-                              0.89296875,
-                              0.89296875,
-                              0.894140625,
-                              0.894140625,
-                              0.8953125,
-                              0.8953125,
-                              0.896484375,
-                              0.896484375,
-                              0.8976562499999999,
-                              0.8976562499999999,
-                              0.898828125,
-                              0.898828125,
-                              0.8999999999999999,
-                              0.8999999999999999,
-                              0.901171875,
-                              0.901171875,
-                              0.90234375,
-                              0.90234375,
-                              0.9035156249999999,
-                              0.9035156249999999,
-                              0.9046875,
-                              0.9046875,
-                              0.9058593749999999,
-                              0.9058593749999999,
-                              0.90703125,
-                              0.90703125,
-                              0.908203125,
-                              0.908203125,
-                              0.9093749999999999,
-                              0.9093749999999999,
-                              0.910546875,
-                              0.910546875,
-                              0.9117187499999999,
-                              0.9117187499999999,
-                              0.912890625,
-                              0.912890625,
-                              0.9140625,
-                              0.9140625,
-                              0.9152343749999999,
-                              0.9152343749999999,
-                              0.91640625,
-                              0.91640625,
-                              0.9175781249999999,
-                              0.9175781249999999,
-                              0.91875,
-                              0.91875,
-                              0.919921875,
-                              0.919921875,
-                              0.9210937499999999,
-                              0.9210937499999999,
-                              0.922265625,
-                              0.922265625,
-                              0.9234374999999999,
-                              0.9234374999999999,
-                              0.924609375,
-                              0.924609375,
-                              0.92578125,
-                              0.92578125,
-                              0.9269531249999999,
-                              0.9269531249999999,
-                              0.928125,
-                              0.928125,
-                              0.9292968749999999,
-                              0.9292968749999999,
-                              0.93046875,
-                              0.93046875,
-                              0.931640625,
-                              0.931640625,
-                              0.9328124999999999,
-                              0.9328124999999999,
-                              0.933984375,
-                              0.933984375,
-                              0.9351562499999999,
-                              0.9351562499999999,
-                              0.936328125,
-                              0.936328125,
-                              0.9375,
-                              0.9375,
-                              0.9386718749999999,
-                              0.9386718749999999,
-                              0.93984375,
-                              0.93984375,
-                              0.9410156249999999,
-                              0.9410156249999999,
-                              0.9421875,
-                              0.9421875,
-                              0.943359375,
-                              0.943359375,
-                              0.9445312499999999,
-                              0.9445312499999999,
-                              0.945703125,
-                              0.945703125,
-                              0.9468749999999999,
-                              0.9468749999999999,
-                              0.948046875,
-                              0.948046875,
-                              0.94921875,
-                              0.94921875,
-                              0.9503906249999999,
-                              0.9503906249999999,
-                              0.9515625,
-                              0.9515625,
-                              0.9527343749999999,
-                              0.9521484375,
-                              0.95390625,
-                              0.95390625,
-                              0.955078125,
-                              0.955078125,
-                              0.9562499999999999,
-                              0.9562499999999999,
-                              0.957421875,
-                              0.957421875,
-                              0.9585937499999999,
-                              0.9580078125,
-                              0.959765625,
-                              0.9591796874999999,
-                              0.9609375,
-                              0.9609375,
-                              0.9621093749999999,
-                              0.9621093749999999,
-                              0.96328125,
-                              0.9626953125,
-                              0.9644531249999999,
-                              0.9638671875,
-                              0.965625,
-                              0.9650390624999999,
-                              0.966796875,
-                              0.966796875,
-                              0.9679687499999999,
-                              0.9679687499999999,
-                              0.969140625,
-                              0.9685546875,
-                              0.9703124999999999,
-                              0.9697265625,
-                              0.971484375,
-                              0.971484375,
-                              0.97265625,
-                              0.9720703125,
-                              0.9732421874999999,
-                              0.9738281249999999,
-                              0.975,
-                              0.975,
-                              0.9755859375,
-                              0.9755859375,
-                              0.97734375,
-                              0.9767578124999999,
-                              0.978515625,
-                              0.9779296875,
-                              0.9796874999999999,
-                              0.9791015624999999,
-                              0.9802734375,
-                              0.9802734375,
-                              0.9820312499999999,
-                              0.9820312499999999,
-                              0.9826171874999999,
-                              0.9826171874999999,
-                              0.984375,
-                              0.9837890625,
-                              0.9849609374999999,
-                              0.9849609374999999,
-                              0.9861328125,
-                              0.9855468749999999,
-                              0.9873046875,
-                              0.98671875,
-                              0.9878906249999999,
-                              0.9878906249999999,
-                              0.9890625,
-                              0.9890625,
-                              0.990234375,
-                              0.990234375,
-                              0.9908203124999999,
-                              0.9908203124999999,
-                              0.9914062499999999,
-                              0.9914062499999999,
-                              0.992578125,
-                              0.992578125,
-                              0.9931640625,
-                              0.9931640625,
-                              0.9943359374999999,
-                              0.9943359374999999,
-                              0.9943359374999999,
-                              0.9943359374999999,
-                              0.994921875,
-                              0.9955078125,
-                              0.99609375,
-                              0.99609375,
-                              0.9966796874999999,
-                              0.99609375,
-                              0.9966796874999999,
-                              0.9966796874999999,
-                              0.9972656249999999,
-                              0.9972656249999999,
-                              0.9978515625,
-                              0.9978515625,
-                              0.9978515625,
-                              0.9978515625,
-                              0.9984375,
-                              0.9984375,
-                              0.9984375,
-                              0.9984375,
-                              0.9990234375,
-                              0.9990234375,
-                              0.9996093749999999,
-                              0.9990234375,
-                              0.9996093749999999,
-                              0.9996093749999999,
-                              1.0001953125,
-                              0.9996093749999999,
-                              0.9996093749999999,
-                              0.9996093749999999,
-                              1.0001953125,
-                              1.0001953125,
-                              1.0001953125,
-                              1.0001953125,
-                              1.0001953125,
-                              1.0001953125,
-                              1.00078125,
-                              1.00078125,
-                              1.00078125,
-                              1.00078125,
-                              1.00078125,
-                              1.0001953125,
-                              1.00078125,
-                              1.00078125,
-                              1.0013671874999999,
-                              1.0013671874999999,
-                              1.0013671874999999,
-                              1.0013671874999999,
-                              1.0013671874999999,
-                              1.0013671874999999,
-                              1.0013671874999999,
-                              1.0013671874999999,
-                              1.0013671874999999,
-                              1.001953125,
-                              1.001953125,
-                              1.001953125,
-                              1.001953125,
-                              1.001953125,
-                              1.001953125,
-                              1.001953125,
-                              1.001953125,
-                              1.001953125,
-                              1.001953125,
-                              1.001953125,
-                              1.0025390625,
-                              1.0025390625,
-                              1.0025390625,
-                              1.0025390625,
-                              1.0025390625,
-                              1.0025390625,
-                              1.0025390625,
-                              1.0025390625,
-                              1.0025390625,
-                              1.0025390625,
-                              1.003125,
-                              1.003125,
-                              1.003125,
-                              1.003125,
-                              1.003125,
-                              1.003125,
-                              1.003125,
-                              1.003125,
-                              1.0025390625,
-                              1.003125,
-                              1.003125,
-                              1.0037109375,
-                              1.003125,
-                              1.003125,
-                              1.0037109375,
-                              1.0037109375,
-                              1.0037109375,
-                              1.0037109375,
-                              1.0037109375,
-                              1.003125,
-                              1.003125,
-                              1.0037109375,
-                              1.0037109375,
-                              1.0037109375,
-                              1.0037109375,
-                              1.0037109375,
-                              1.0037109375,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0048828125,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0048828125,
-                              1.0048828125,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0048828125,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0042968749999999,
-                              1.0048828125,
-                              1.0048828125,
-                              1.00546875,
-                              1.0048828125,
-                              1.0048828125,
-                              1.0048828125,
-                              1.00546875,
-                              1.0048828125,
-                              1.0048828125,
-                              1.0048828125,
-                              1.0048828125,
-                              1.0048828125,
-                              1.00546875,
-                              1.00546875,
-                              1.0048828125,
-                              1.00546875,
-                              1.0048828125,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.0048828125,
-                              1.00546875,
-                              1.0048828125,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.0060546875,
-                              1.0048828125,
-                              1.0060546875,
-                              1.0048828125,
-                              1.00546875,
-                              1.00546875,
-                              1.0060546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.0048828125,
-                              1.0048828125,
-                              1.0048828125,
-                              1.00546875,
-                              1.0048828125,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.0048828125,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.0048828125,
-                              1.00546875,
-                              1.0060546875,
-                              1.00546875,
-                              1.00546875,
-                              1.0048828125,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.0060546875,
-                              1.00546875,
-                              1.00546875,
-                              1.0048828125,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.0048828125,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.0048828125,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.0060546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.0060546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.0048828125,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.0048828125,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.0060546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.00546875,
-                              1.0060546875,
-                              1.00546875,
-                              1.0060546875 };
\ No newline at end of file
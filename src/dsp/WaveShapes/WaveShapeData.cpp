@@ -0,0 +1,2093 @@
+//copyright Dave French, Curlymorphic 2023, GPL3 or later
+
+// GENERATED by generatewaveshapes.py from Docs/WaveShapes/Tables, do not edit
+// 4096 bin waveshaper -1.2 +1.2, stored as integer capture codes, value = code / 5120
+
+#include <cstdint>
+
+namespace sspo
+{
+namespace AudioMath
+{
+namespace WaveShaper
+{
+namespace Codes
+{
+static constexpr int codeCount = 4095;
+
+extern const int16_t ThroughShape[codeCount] = {
+    -4653, -4653, -4653, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656,
+    -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656,
+    -4656, -4653, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656, -4656,
+    -4656, -4656, -4653, -4656, -4656, -4656, -4656, -4656, -4653, -4653, -4656, -4656, -4653, -4653, -4653, -4653,
+    -4653, -4653, -4656, -4653, -4653, -4653, -4653, -4653, -4653, -4656, -4653, -4653, -4653, -4653, -4653, -4653,
+    -4653, -4653, -4653, -4653, -4653, -4653, -4653, -4653, -4653, -4653, -4653, -4653, -4653, -4653, -4653, -4653,
+    -4653, -4653, -4653, -4653, -4653, -4653, -4653, -4653, -4653, -4653, -4653, -4653, -4653, -4653, -4653, -4650,
+    -4650, -4653, -4650, -4653, -4653, -4650, -4653, -4650, -4653, -4650, -4650, -4650, -4653, -4653, -4650, -4650,
+    -4650, -4650, -4650, -4650, -4650, -4650, -4650, -4650, -4650, -4650, -4650, -4650, -4650, -4650, -4650, -4650,
+    -4650, -4650, -4650, -4650, -4650, -4650, -4650, -4650, -4650, -4650, -4650, -4650, -4650, -4650, -4650, -4650,
+    -4650, -4650, -4650, -4650, -4650, -4650, -4650, -4647, -4650, -4650, -4647, -4647, -4647, -4647, -4650, -4647,
+    -4650, -4647, -4647, -4650, -4647, -4647, -4650, -4647, -4647, -4647, -4647, -4647, -4647, -4647, -4647, -4647,
+    -4647, -4650, -4647, -4647, -4647, -4647, -4647, -4647, -4647, -4647, -4647, -4647, -4647, -4647, -4647, -4647,
+    -4647, -4647, -4647, -4647, -4647, -4647, -4647, -4647, -4644, -4647, -4647, -4647, -4647, -4647, -4644, -4644,
+    -4644, -4647, -4644, -4647, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644,
+    -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644,
+    -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644, -4644,
+    -4644, -4641, -4644, -4644, -4641, -4641, -4641, -4641, -4641, -4641, -4641, -4641, -4641, -4641, -4641, -4641,
+    -4641, -4641, -4641, -4641, -4641, -4641, -4641, -4641, -4641, -4641, -4641, -4641, -4641, -4641, -4641, -4641,
+    -4641, -4641, -4641, -4641, -4638, -4641, -4641, -4638, -4638, -4638, -4638, -4641, -4638, -4641, -4641, -4638,
+    -4638, -4638, -4638, -4638, -4638, -4638, -4638, -4638, -4638, -4638, -4638, -4638, -4638, -4638, -4638, -4638,
+    -4638, -4638, -4638, -4638, -4638, -4638, -4638, -4638, -4638, -4638, -4635, -4638, -4635, -4635, -4635, -4638,
+    -4635, -4635, -4635, -4635, -4635, -4635, -4635, -4635, -4635, -4635, -4635, -4635, -4632, -4635, -4635, -4635,
+    -4635, -4635, -4635, -4635, -4635, -4635, -4635, -4635, -4632, -4632, -4635, -4632, -4632, -4632, -4632, -4632,
+    -4632, -4632, -4632, -4632, -4632, -4632, -4632, -4632, -4632, -4632, -4632, -4632, -4632, -4632, -4632, -4632,
+    -4632, -4629, -4629, -4632, -4629, -4629, -4629, -4629, -4629, -4629, -4629, -4629, -4629, -4629, -4629, -4629,
+    -4629, -4629, -4629, -4629, -4626, -4629, -4629, -4629, -4626, -4626, -4626, -4626, -4626, -4626, -4626, -4626,
+    -4626, -4626, -4626, -4626, -4626, -4626, -4626, -4623, -4623, -4626, -4623, -4626, -4623, -4623, -4623, -4623,
+    -4623, -4623, -4623, -4623, -4623, -4623, -4623, -4620, -4623, -4620, -4623, -4623, -4620, -4623, -4620, -4620,
+    -4620, -4620, -4620, -4620, -4620, -4620, -4620, -4617, -4617, -4617, -4617, -4617, -4617, -4617, -4617, -4617,
+    -4617, -4617, -4617, -4617, -4614, -4614, -4614, -4614, -4614, -4614, -4614, -4614, -4614, -4611, -4611, -4611,
+    -4611, -4611, -4611, -4611, -4611, -4608, -4608, -4608, -4608, -4608, -4608, -4608, -4608, -4605, -4605, -4605,
+    -4605, -4605, -4605, -4602, -4602, -4602, -4599, -4602, -4599, -4599, -4596, -4596, -4596, -4596, -4596, -4593,
+    -4593, -4593, -4590, -4590, -4587, -4584, -4584, -4584, -4581, -4581, -4578, -4575, -4575, -4572, -4569, -4569,
+    -4563, -4563, -4560, -4557, -4554, -4551, -4548, -4545, -4542, -4539, -4536, -4533, -4530, -4527, -4524, -4521,
+    -4518, -4515, -4512, -4509, -4506, -4503, -4500, -4497, -4494, -4491, -4488, -4485, -4482, -4479, -4476, -4473,
+    -4470, -4467, -4464, -4461, -4458, -4455, -4452, -4449, -4446, -4443, -4440, -4437, -4434, -4431, -4428, -4425,
+    -4422, -4419, -4416, -4413, -4410, -4407, -4404, -4401, -4398, -4395, -4392, -4389, -4386, -4383, -4380, -4377,
+    -4374, -4371, -4368, -4365, -4362, -4359, -4356, -4353, -4350, -4347, -4344, -4341, -4338, -4335, -4332, -4329,
+    -4326, -4323, -4320, -4317, -4314, -4311, -4308, -4305, -4302, -4299, -4296, -4293, -4290, -4287, -4284, -4281,
+    -4278, -4275, -4272, -4269, -4266, -4263, -4260, -4257, -4254, -4251, -4248, -4245, -4242, -4239, -4236, -4233,
+    -4230, -4227, -4224, -4221, -4218, -4215, -4212, -4209, -4206, -4203, -4200, -4197, -4194, -4191, -4188, -4185,
+    -4182, -4179, -4176, -4173, -4170, -4167, -4164, -4161, -4158, -4155, -4152, -4149, -4146, -4143, -4140, -4137,
+    -4134, -4131, -4128, -4125, -4122, -4119, -4116, -4113, -4110, -4107, -4104, -4101, -4098, -4095, -4092, -4089,
+    -4086, -4083, -4080, -4077, -4074, -4071, -4068, -4065, -4062, -4059, -4056, -4053, -4050, -4047, -4044, -4041,
+    -4038, -4035, -4032, -4029, -4026, -4023, -4020, -4017, -4014, -4008, -4008, -4005, -4002, -3999, -3996, -3993,
+    -3990, -3984, -3984, -3981, -3975, -3975, -3972, -3969, -3963, -3963, -3957, -3957, -3954, -3951, -3948, -3942,
+    -3942, -3936, -3936, -3933, -3927, -3924, -3921, -3918, -3915, -3912, -3909, -3909, -3903, -3903, -3900, -3897,
+    -3894, -3891, -3888, -3885, -3882, -3879, -3876, -3870, -3870, -3864, -3864, -3861, -3858, -3852, -3852, -3846,
+    -3846, -3843, -3840, -3837, -3834, -3828, -3828, -3822, -3819, -3816, -3813, -3813, -3807, -3804, -3804, -3801,
+    -3798, -3795, -3789, -3789, -3783, -3780, -3777, -3777, -3771, -3771, -3768, -3762, -3759, -3756, -3756, -3750,
+    -3747, -3744, -3744, -3741, -3735, -3732, -3732, -3726, -3723, -3720, -3717, -3714, -3711, -3708, -3708, -3702,
+    -3699, -3696, -3693, -3690, -3687, -3684, -3681, -3678, -3675, -3672, -3669, -3666, -3663, -3660, -3657, -3654,
+    -3651, -3648, -3648, -3642, -3639, -3636, -3633, -3630, -3627, -3624, -3621, -3618, -3615, -3612, -3609, -3606,
+    -3603, -3600, -3597, -3594, -3591, -3588, -3585, -3582, -3579, -3576, -3573, -3570, -3567, -3564, -3561, -3558,
+    -3555, -3552, -3549, -3546, -3543, -3540, -3537, -3534, -3531, -3528, -3525, -3522, -3519, -3516, -3513, -3510,
+    -3507, -3504, -3501, -3498, -3495, -3492, -3489, -3486, -3483, -3480, -3477, -3474, -3471, -3468, -3465, -3462,
+    -3459, -3456, -3453, -3450, -3447, -3444, -3441, -3438, -3435, -3432, -3429, -3426, -3423, -3420, -3417, -3414,
+    -3411, -3408, -3405, -3402, -3399, -3396, -3393, -3390, -3387, -3384, -3381, -3378, -3375, -3372, -3369, -3366,
+    -3363, -3360, -3357, -3354, -3351, -3348, -3345, -3342, -3339, -3336, -3333, -3330, -3327, -3324, -3321, -3318,
+    -3315, -3312, -3309, -3306, -3303, -3300, -3297, -3294, -3291, -3288, -3285, -3282, -3279, -3276, -3273, -3270,
+    -3267, -3264, -3261, -3258, -3255, -3252, -3249, -3246, -3243, -3240, -3237, -3234, -3231, -3225, -3225, -3222,
+    -3219, -3216, -3213, -3210, -3207, -3204, -3201, -3198, -3195, -3192, -3189, -3186, -3180, -3180, -3177, -3174,
+    -3171, -3168, -3165, -3162, -3159, -3153, -3153, -3147, -3147, -3144, -3138, -3135, -3135, -3129, -3129, -3123,
+    -3120, -3117, -3114, -3111, -3108, -3105, -3102, -3099, -3096, -3093, -3090, -3087, -3084, -3081, -3078, -3075,
+    -3072, -3069, -3069, -3063, -3060, -3057, -3054, -3051, -3048, -3045, -3042, -3039, -3036, -3033, -3030, -3027,
+    -3024, -3021, -3018, -3015, -3012, -3009, -3006, -3003, -3000, -2997, -2994, -2991, -2988, -2985, -2982, -2979,
+    -2976, -2973, -2970, -2967, -2964, -2961, -2958, -2955, -2952, -2949, -2946, -2943, -2940, -2937, -2934, -2931,
+    -2928, -2925, -2922, -2919, -2916, -2913, -2910, -2907, -2904, -2901, -2898, -2895, -2892, -2889, -2886, -2883,
+    -2880, -2877, -2874, -2871, -2868, -2865, -2862, -2859, -2856, -2853, -2850, -2844, -2844, -2841, -2838, -2835,
+    -2832, -2829, -2826, -2823, -2820, -2814, -2814, -2811, -2808, -2805, -2802, -2796, -2793, -2790, -2790, -2787,
+    -2784, -2781, -2778, -2775, -2772, -2769, -2763, -2763, -2760, -2757, -2754, -2751, -2748, -2742, -2742, -2739,
+    -2736, -2733, -2730, -2727, -2724, -2718, -2718, -2712, -2712, -2709, -2706, -2700, -2700, -2694, -2694, -2691,
+    -2688, -2685, -2679, -2679, -2673, -2673, -2670, -2667, -2664, -2658, -2658, -2652, -2652, -2646, -2646, -2640,
+    -2637, -2637, -2634, -2631, -2628, -2622, -2622, -2619, -2616, -2610, -2610, -2607, -2601, -2598, -2595, -2592,
+    -2589, -2589, -2586, -2580, -2580, -2574, -2574, -2571, -2565, -2565, -2559, -2556, -2556, -2550, -2550, -2544,
+    -2544, -2541, -2538, -2535, -2532, -2526, -2526, -2520, -2520, -2514, -2514, -2508, -2505, -2502, -2499, -2496,
+    -2496, -2490, -2490, -2484, -2481, -2481, -2475, -2472, -2469, -2466, -2463, -2460, -2457, -2454, -2451, -2448,
+    -2445, -2442, -2442, -2436, -2436, -2430, -2427, -2424, -2421, -2418, -2415, -2412, -2409, -2406, -2403, -2400,
+    -2397, -2394, -2391, -2388, -2385, -2382, -2379, -2379, -2373, -2370, -2367, -2364, -2361, -2358, -2355, -2355,
+    -2349, -2346, -2346, -2340, -2340, -2334, -2331, -2328, -2325, -2322, -2319, -2316, -2313, -2310, -2307, -2304,
+    -2301, -2298, -2295, -2292, -2289, -2286, -2286, -2280, -2277, -2274, -2271, -2268, -2265, -2262, -2259, -2256,
+    -2253, -2250, -2247, -2244, -2241, -2238, -2235, -2232, -2229, -2226, -2223, -2220, -2217, -2214, -2211, -2208,
+    -2205, -2202, -2199, -2196, -2193, -2190, -2187, -2184, -2181, -2178, -2175, -2172, -2169, -2166, -2163, -2160,
+    -2157, -2154, -2151, -2148, -2145, -2142, -2139, -2136, -2133, -2130, -2127, -2124, -2121, -2118, -2115, -2112,
+    -2109, -2106, -2103, -2100, -2097, -2094, -2091, -2088, -2085, -2082, -2079, -2076, -2073, -2067, -2067, -2064,
+    -2061, -2058, -2055, -2052, -2049, -2046, -2043, -2040, -2037, -2034, -2031, -2028, -2025, -2022, -2019, -2016,
+    -2013, -2010, -2007, -2004, -2001, -1998, -1995, -1992, -1989, -1986, -1983, -1980, -1974, -1971, -1971, -1968,
+    -1965, -1962, -1959, -1956, -1953, -1950, -1947, -1944, -1941, -1935, -1935, -1932, -1929, -1926, -1923, -1920,
+    -1917, -1914, -1911, -1908, -1905, -1902, -1899, -1896, -1893, -1887, -1887, -1881, -1881, -1878, -1875, -1872,
+    -1869, -1866, -1863, -1860, -1857, -1854, -1851, -1845, -1845, -1842, -1839, -1836, -1833, -1827, -1827, -1821,
+    -1821, -1815, -1815, -1809, -1809, -1806, -1803, -1797, -1797, -1791, -1788, -1788, -1785, -1779, -1779, -1776,
+    -1773, -1767, -1767, -1764, -1758, -1758, -1755, -1749, -1746, -1746, -1740, -1737, -1734, -1731, -1728, -1725,
+    -1722, -1719, -1719, -1716, -1713, -1707, -1704, -1701, -1701, -1695, -1692, -1689, -1686, -1683, -1680, -1677,
+    -1674, -1671, -1668, -1665, -1662, -1659, -1659, -1653, -1653, -1647, -1647, -1641, -1638, -1635, -1632, -1629,
+    -1626, -1623, -1623, -1617, -1614, -1611, -1608, -1605, -1602, -1599, -1596, -1593, -1590, -1587, -1584, -1581,
+    -1578, -1575, -1575, -1572, -1569, -1563, -1563, -1557, -1554, -1551, -1551, -1548, -1545, -1542, -1539, -1536,
+    -1533, -1530, -1527, -1521, -1518, -1515, -1515, -1512, -1509, -1506, -1503, -1497, -1497, -1494, -1491, -1488,
+    -1482, -1479, -1479, -1476, -1473, -1467, -1467, -1464, -1458, -1455, -1455, -1449, -1446, -1443, -1443, -1437,
+    -1437, -1431, -1431, -1425, -1425, -1419, -1419, -1413, -1410, -1407, -1407, -1401, -1398, -1395, -1395, -1389,
+    -1386, -1383, -1383, -1377, -1377, -1371, -1371, -1365, -1365, -1359, -1356, -1353, -1350, -1347, -1347, -1344,
+    -1338, -1335, -1332, -1329, -1326, -1323, -1320, -1317, -1314, -1311, -1308, -1305, -1302, -1299, -1296, -1293,
+    -1290, -1287, -1284, -1281, -1278, -1275, -1275, -1269, -1266, -1263, -1260, -1257, -1254, -1251, -1248, -1245,
+    -1242, -1239, -1236, -1233, -1230, -1227, -1224, -1221, -1218, -1215, -1212, -1209, -1206, -1203, -1200, -1197,
+    -1194, -1191, -1191, -1185, -1185, -1179, -1176, -1173, -1170, -1167, -1164, -1161, -1161, -1155, -1152, -1149,
+    -1149, -1143, -1140, -1137, -1134, -1131, -1128, -1125, -1122, -1119, -1116, -1113, -1110, -1107, -1104, -1101,
+    -1098, -1095, -1092, -1089, -1086, -1083, -1080, -1077, -1074, -1071, -1068, -1065, -1062, -1059, -1056, -1053,
+    -1050, -1047, -1044, -1041, -1038, -1035, -1032, -1029, -1026, -1023, -1020, -1017, -1014, -1011, -1008, -1005,
+    -1002, -999, -996, -993, -990, -987, -984, -981, -978, -975, -972, -969, -966, -963, -960, -957,
+    -954, -951, -948, -945, -942, -939, -936, -930, -930, -927, -924, -921, -918, -915, -912, -909,
+    -906, -903, -900, -897, -894, -891, -888, -882, -882, -879, -876, -870, -870, -867, -864, -861,
+    -858, -855, -852, -846, -846, -843, -840, -837, -834, -831, -828, -825, -822, -816, -816, -813,
+    -810, -807, -804, -801, -798, -795, -792, -789, -786, -783, -780, -777, -774, -771, -768, -765,
+    -762, -759, -756, -750, -750, -747, -744, -738, -738, -735, -732, -729, -726, -720, -720, -714,
+    -714, -708, -708, -705, -702, -699, -696, -690, -690, -687, -684, -678, -678, -672, -672, -666,
+    -666, -663, -660, -654, -651, -648, -645, -642, -642, -636, -636, -630, -630, -624, -624, -618,
+    -618, -612, -609, -606, -606, -600, -600, -594, -594, -588, -588, -582, -582, -576, -576, -570,
+    -567, -564, -564, -558, -555, -552, -552, -546, -546, -540, -537, -534, -534, -528, -525, -522,
+    -522, -516, -516, -510, -507, -504, -501, -498, -498, -492, -492, -486, -483, -480, -477, -474,
+    -471, -468, -465, -462, -459, -456, -453, -450, -447, -444, -441, -438, -435, -432, -429, -426,
+    -426, -420, -420, -414, -411, -408, -405, -402, -399, -396, -393, -390, -387, -384, -381, -378,
+    -375, -372, -369, -366, -363, -360, -357, -354, -351, -348, -345, -342, -339, -336, -333, -330,
+    -327, -324, -321, -318, -315, -312, -309, -306, -303, -300, -297, -294, -291, -288, -285, -282,
+    -279, -276, -273, -270, -267, -264, -261, -258, -255, -252, -249, -246, -243, -240, -237, -234,
+    -231, -228, -225, -222, -219, -216, -213, -210, -210, -204, -201, -198, -195, -192, -189, -186,
+    -183, -180, -177, -174, -171, -168, -165, -162, -159, -156, -153, -150, -147, -144, -141, -138,
+    -135, -132, -129, -126, -123, -120, -117, -114, -111, -108, -105, -102, -99, -96, -93, -90,
+    -87, -81, -81, -75, -75, -69, -66, -63, -63, -57, -57, -51, -48, -45, -42, -39,
+    -36, -33, -30, -27, -27, -21, -18, -15, -12, -9, -9, -3, 0, 3, 3, 6,
+    12, 15, 18, 21, 24, 27, 30, 33, 33, 39, 39, 45, 45, 51, 51, 57,
+    57, 63, 63, 69, 69, 75, 78, 81, 81, 87, 87, 93, 96, 96, 99, 105,
+    105, 111, 111, 117, 117, 123, 126, 129, 129, 135, 135, 141, 141, 147, 150, 153,
+    153, 156, 159, 165, 165, 168, 171, 174, 177, 183, 186, 189, 189, 195, 195, 201,
+    201, 207, 207, 213, 216, 219, 222, 225, 228, 231, 234, 237, 237, 243, 246, 249,
+    249, 255, 258, 261, 261, 267, 270, 273, 273, 279, 282, 285, 288, 291, 294, 297,
+    300, 303, 306, 309, 312, 315, 318, 324, 324, 327, 330, 333, 336, 339, 342, 345,
+    345, 351, 354, 357, 357, 363, 366, 369, 372, 375, 378, 381, 384, 387, 390, 393,
+    396, 399, 402, 405, 408, 411, 414, 417, 420, 423, 426, 429, 432, 435, 438, 441,
+    444, 447, 450, 453, 456, 459, 462, 465, 468, 471, 474, 477, 480, 483, 486, 489,
+    492, 498, 498, 501, 504, 507, 510, 516, 516, 522, 522, 525, 528, 531, 534, 537,
+    540, 543, 546, 552, 552, 555, 558, 564, 564, 567, 570, 573, 576, 579, 582, 585,
+    588, 591, 594, 597, 600, 603, 606, 612, 612, 615, 618, 621, 624, 627, 630, 636,
+    636, 639, 642, 648, 648, 651, 654, 657, 660, 663, 666, 672, 672, 678, 678, 684,
+    684, 687, 690, 696, 696, 702, 702, 708, 708, 711, 714, 717, 720, 726, 729, 729,
+    732, 735, 738, 741, 744, 747, 750, 753, 756, 759, 762, 768, 768, 774, 774, 780,
+    780, 786, 786, 789, 792, 795, 798, 804, 804, 810, 810, 816, 816, 822, 822, 828,
+    828, 831, 834, 840, 840, 846, 846, 852, 852, 858, 858, 864, 864, 870, 870, 876,
+    876, 882, 882, 888, 888, 894, 894, 900, 900, 906, 906, 909, 912, 918, 921, 924,
+    924, 930, 930, 936, 936, 942, 945, 948, 948, 954, 957, 960, 960, 966, 969, 972,
+    972, 978, 978, 984, 984, 990, 993, 996, 996, 1002, 1005, 1008, 1008, 1014, 1017, 1020,
+    1020, 1026, 1029, 1032, 1035, 1038, 1038, 1044, 1047, 1050, 1053, 1056, 1059, 1062, 1065, 1068,
+    1071, 1074, 1077, 1080, 1083, 1086, 1089, 1092, 1095, 1098, 1101, 1104, 1107, 1110, 1113, 1116,
+    1119, 1122, 1125, 1128, 1128, 1134, 1137, 1140, 1140, 1146, 1149, 1152, 1155, 1158, 1161, 1164,
+    1167, 1170, 1173, 1176, 1179, 1182, 1185, 1188, 1191, 1194, 1197, 1200, 1203, 1206, 1209, 1212,
+    1212, 1218, 1221, 1224, 1227, 1230, 1233, 1236, 1239, 1242, 1245, 1248, 1248, 1254, 1257, 1260,
+    1263, 1266, 1269, 1272, 1275, 1278, 1281, 1284, 1287, 1290, 1293, 1296, 1299, 1302, 1305, 1308,
+    1311, 1314, 1317, 1320, 1323, 1326, 1329, 1332, 1335, 1338, 1341, 1344, 1347, 1350, 1353, 1356,
+    1359, 1362, 1365, 1368, 1371, 1374, 1377, 1380, 1383, 1389, 1389, 1392, 1395, 1398, 1401, 1404,
+    1407, 1410, 1413, 1416, 1419, 1422, 1425, 1431, 1431, 1434, 1437, 1443, 1443, 1449, 1449, 1455,
+    1455, 1461, 1461, 1464, 1467, 1473, 1473, 1479, 1479, 1485, 1485, 1491, 1491, 1497, 1497, 1500,
+    1503, 1506, 1509, 1512, 1515, 1518, 1521, 1524, 1524, 1530, 1533, 1536, 1539, 1542, 1542, 1548,
+    1551, 1554, 1557, 1560, 1563, 1566, 1569, 1572, 1575, 1578, 1581, 1584, 1587, 1590, 1593, 1596,
+    1599, 1602, 1605, 1608, 1611, 1614, 1617, 1623, 1623, 1626, 1629, 1632, 1635, 1638, 1641, 1644,
+    1647, 1650, 1653, 1656, 1659, 1662, 1665, 1668, 1671, 1674, 1677, 1683, 1683, 1689, 1689, 1695,
+    1695, 1698, 1701, 1704, 1707, 1710, 1713, 1716, 1719, 1722, 1725, 1728, 1731, 1734, 1737, 1740,
+    1743, 1749, 1749, 1755, 1755, 1761, 1761, 1767, 1767, 1773, 1773, 1776, 1779, 1785, 1785, 1788,
+    1791, 1794, 1797, 1803, 1803, 1809, 1809, 1815, 1815, 1821, 1821, 1827, 1827, 1830, 1833, 1836,
+    1839, 1845, 1845, 1848, 1851, 1857, 1857, 1863, 1863, 1869, 1869, 1875, 1875, 1881, 1881, 1884,
+    1887, 1890, 1893, 1896, 1899, 1905, 1905, 1911, 1911, 1917, 1917, 1923, 1923, 1926, 1929, 1935,
+    1935, 1938, 1941, 1947, 1947, 1953, 1956, 1956, 1959, 1965, 1965, 1971, 1971, 1977, 1977, 1983,
+    1983, 1989, 1989, 1995, 1995, 2001, 2001, 2007, 2007, 2013, 2013, 2019, 2019, 2025, 2025, 2031,
+    2031, 2037, 2037, 2043, 2043, 2049, 2049, 2055, 2055, 2061, 2061, 2067, 2067, 2073, 2073, 2079,
+    2079, 2085, 2085, 2091, 2091, 2097, 2097, 2103, 2103, 2109, 2112, 2115, 2118, 2121, 2124, 2127,
+    2127, 2133, 2133, 2139, 2139, 2145, 2145, 2151, 2154, 2157, 2160, 2163, 2166, 2169, 2172, 2175,
+    2175, 2181, 2184, 2187, 2187, 2193, 2196, 2199, 2199, 2205, 2208, 2211, 2214, 2217, 2220, 2223,
+    2226, 2229, 2229, 2235, 2235, 2241, 2244, 2247, 2250, 2253, 2256, 2259, 2262, 2265, 2268, 2271,
+    2271, 2277, 2277, 2283, 2286, 2289, 2292, 2295, 2295, 2301, 2304, 2307, 2310, 2313, 2316, 2319,
+    2322, 2325, 2328, 2331, 2334, 2337, 2340, 2343, 2343, 2349, 2352, 2355, 2358, 2361, 2364, 2367,
+    2367, 2373, 2376, 2379, 2382, 2385, 2388, 2391, 2391, 2397, 2400, 2403, 2406, 2409, 2412, 2415,
+    2418, 2421, 2424, 2427, 2430, 2433, 2436, 2439, 2442, 2445, 2448, 2451, 2454, 2460, 2460, 2463,
+    2466, 2469, 2472, 2475, 2478, 2481, 2484, 2487, 2490, 2493, 2496, 2499, 2502, 2505, 2508, 2511,
+    2514, 2517, 2520, 2523, 2526, 2529, 2532, 2535, 2538, 2541, 2544, 2550, 2550, 2556, 2556, 2559,
+    2562, 2568, 2568, 2571, 2574, 2580, 2580, 2583, 2586, 2592, 2592, 2595, 2598, 2604, 2604, 2607,
+    2610, 2616, 2616, 2622, 2622, 2628, 2628, 2634, 2634, 2640, 2640, 2646, 2646, 2652, 2652, 2658,
+    2658, 2664, 2664, 2667, 2670, 2673, 2676, 2679, 2682, 2688, 2688, 2694, 2694, 2700, 2700, 2706,
+    2706, 2712, 2712, 2715, 2718, 2724, 2724, 2727, 2730, 2736, 2736, 2742, 2742, 2748, 2748, 2754,
+    2754, 2760, 2760, 2766, 2766, 2772, 2772, 2775, 2778, 2784, 2784, 2790, 2790, 2796, 2796, 2802,
+    2802, 2808, 2808, 2814, 2814, 2820, 2820, 2826, 2826, 2832, 2832, 2838, 2838, 2844, 2844, 2850,
+    2850, 2856, 2856, 2862, 2862, 2868, 2871, 2871, 2874, 2880, 2880, 2886, 2886, 2892, 2892, 2898,
+    2901, 2904, 2904, 2910, 2910, 2916, 2919, 2922, 2922, 2928, 2928, 2934, 2934, 2940, 2940, 2946,
+    2946, 2952, 2952, 2958, 2958, 2964, 2967, 2970, 2970, 2976, 2976, 2982, 2982, 2988, 2991, 2994,
+    2994, 3000, 3000, 3006, 3006, 3012, 3015, 3018, 3018, 3024, 3024, 3030, 3033, 3036, 3036, 3042,
+    3045, 3051, 3051, 3054, 3057, 3063, 3063, 3066, 3069, 3075, 3075, 3078, 3081, 3087, 3087, 3090,
+    3093, 3099, 3099, 3102, 3105, 3111, 3111, 3117, 3117, 3123, 3123, 3126, 3129, 3135, 3135, 3138,
+    3141, 3147, 3147, 3153, 3153, 3159, 3159, 3165, 3165, 3171, 3171, 3174, 3177, 3180, 3183, 3189,
+    3189, 3195, 3195, 3198, 3201, 3204, 3207, 3213, 3213, 3219, 3219, 3222, 3225, 3231, 3231, 3234,
+    3237, 3243, 3243, 3249, 3249, 3255, 3255, 3261, 3261, 3267, 3267, 3273, 3273, 3279, 3279, 3285,
+    3285, 3291, 3291, 3294, 3297, 3303, 3303, 3309, 3309, 3315, 3315, 3321, 3321, 3327, 3327, 3333,
+    3333, 3339, 3339, 3345, 3345, 3351, 3351, 3357, 3357, 3363, 3366, 3366, 3369, 3375, 3375, 3381,
+    3381, 3387, 3387, 3393, 3393, 3399, 3399, 3405, 3405, 3411, 3411, 3417, 3417, 3423, 3423, 3429,
+    3429, 3435, 3435, 3441, 3441, 3447, 3447, 3453, 3453, 3459, 3459, 3465, 3465, 3471, 3471, 3477,
+    3477, 3483, 3486, 3489, 3489, 3495, 3495, 3501, 3501, 3507, 3507, 3513, 3516, 3519, 3519, 3525,
+    3525, 3531, 3531, 3537, 3537, 3543, 3543, 3549, 3549, 3555, 3558, 3561, 3561, 3567, 3570, 3573,
+    3573, 3579, 3579, 3585, 3588, 3591, 3591, 3597, 3597, 3603, 3603, 3609, 3612, 3615, 3615, 3621,
+    3621, 3627, 3627, 3633, 3636, 3639, 3642, 3645, 3648, 3651, 3654, 3657, 3660, 3663, 3666, 3669,
+    3669, 3675, 3675, 3681, 3684, 3687, 3690, 3693, 3696, 3699, 3702, 3705, 3708, 3711, 3714, 3717,
+    3720, 3723, 3726, 3729, 3732, 3735, 3738, 3741, 3744, 3750, 3750, 3753, 3756, 3759, 3762, 3765,
+    3768, 3771, 3774, 3777, 3780, 3783, 3786, 3789, 3792, 3798, 3798, 3804, 3804, 3810, 3810, 3813,
+    3816, 3819, 3822, 3825, 3825, 3831, 3834, 3837, 3840, 3843, 3843, 3849, 3852, 3855, 3858, 3861,
+    3864, 3867, 3870, 3873, 3876, 3882, 3879, 3885, 3888, 3891, 3894, 3897, 3900, 3906, 3906, 3909,
+    3912, 3918, 3918, 3921, 3924, 3927, 3930, 3933, 3936, 3939, 3942, 3945, 3948, 3951, 3954, 3960,
+    3960, 3966, 3966, 3969, 3972, 3975, 3978, 3981, 3984, 3990, 3990, 3996, 3996, 4002, 4002, 4005,
+    4008, 4014, 4014, 4017, 4020, 4026, 4026, 4032, 4032, 4038, 4038, 4044, 4044, 4050, 4050, 4053,
+    4056, 4059, 4062, 4068, 4068, 4071, 4074, 4080, 4080, 4086, 4086, 4092, 4092, 4098, 4098, 4101,
+    4104, 4110, 4110, 4116, 4116, 4122, 4122, 4128, 4128, 4134, 4134, 4140, 4140, 4146, 4146, 4152,
+    4152, 4158, 4158, 4161, 4164, 4170, 4170, 4176, 4176, 4182, 4182, 4188, 4188, 4194, 4194, 4200,
+    4200, 4206, 4206, 4209, 4212, 4218, 4218, 4221, 4224, 4230, 4230, 4236, 4236, 4242, 4242, 4248,
+    4248, 4254, 4254, 4257, 4260, 4266, 4266, 4272, 4272, 4278, 4278, 4284, 4284, 4290, 4290, 4296,
+    4296, 4302, 4302, 4308, 4308, 4314, 4314, 4320, 4320, 4326, 4326, 4332, 4332, 4338, 4338, 4344,
+    4344, 4350, 4350, 4356, 4356, 4362, 4362, 4368, 4368, 4374, 4374, 4380, 4380, 4386, 4389, 4392,
+    4392, 4398, 4398, 4404, 4404, 4410, 4410, 4416, 4416, 4422, 4422, 4428, 4428, 4434, 4434, 4440,
+    4440, 4446, 4446, 4452, 4452, 4458, 4458, 4464, 4464, 4470, 4470, 4476, 4479, 4482, 4482, 4488,
+    4488, 4494, 4494, 4500, 4500, 4506, 4506, 4512, 4512, 4518, 4521, 4524, 4524, 4530, 4533, 4536,
+    4536, 4542, 4545, 4548, 4548, 4554, 4557, 4560, 4560, 4566, 4569, 4572, 4575, 4578, 4578, 4584,
+    4584, 4590, 4590, 4596, 4596, 4602, 4602, 4608, 4608, 4614, 4614, 4620, 4623, 4626, 4629, 4632,
+    4635, 4638, 4638, 4644, 4644, 4650, 4653, 4656, 4659, 4662, 4665, 4668, 4671, 4674, 4677, 4680,
+    4683, 4686, 4686, 4692, 4695, 4698, 4701, 4704, 4704, 4710, 4713, 4716, 4719, 4722, 4725, 4728,
+    4731, 4734, 4737, 4740, 4743, 4746, 4749, 4752, 4752, 4758, 4761, 4764, 4764, 4770, 4773, 4776,
+    4776, 4782, 4785, 4788, 4791, 4797, 4797, 4800, 4803, 4806, 4809, 4812, 4815, 4821, 4821, 4824,
+    4827, 4830, 4833, 4836, 4839, 4845, 4845, 4848, 4851, 4857, 4857, 4860, 4863, 4869, 4869, 4872,
+    4872, 4878, 4878, 4884, 4884, 4890, 4890, 4893, 4896, 4899, 4899, 4899, 4902, 4899, 4899, 4899,
+    4899, 4899, 4899, 4899, 4902, 4902, 4899, 4899, 4902, 4902, 4899, 4902, 4902, 4902, 4902, 4902,
+    4902, 4902, 4902, 4902, 4902, 4902, 4902, 4902, 4902, 4902, 4902, 4899, 4899, 4902, 4899, 4899,
+    4899, 4902, 4902, 4902, 4899, 4899, 4899, 4899, 4899, 4902, 4899, 4899, 4902, 4899, 4902, 4899,
+    4899, 4902, 4902, 4899, 4899, 4899, 4902, 4899, 4899, 4902, 4899, 4899, 4902, 4902, 4902, 4899,
+    4899, 4899, 4899, 4899, 4899, 4902, 4899, 4899, 4899, 4899, 4902, 4902, 4902, 4899, 4899, 4899,
+    4899, 4902, 4899, 4902, 4902, 4899, 4899, 4899, 4902, 4902, 4902, 4899, 4899, 4899, 4899, 4899,
+    4899, 4899, 4899, 4899, 4899, 4902, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4902, 4899, 4899,
+    4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4902, 4899, 4902, 4899, 4899,
+    4899, 4899, 4902, 4899, 4899, 4902, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899,
+    4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4902, 4899, 4899, 4899,
+    4899, 4899, 4899, 4899, 4899, 4902, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899,
+    4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899,
+    4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899,
+    4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899,
+    4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899,
+    4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899,
+    4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899,
+    4902, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899,
+    4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899,
+    4899, 4899, 4899, 4899, 4899, 4902, 4899, 4899, 4899, 4902, 4899, 4899, 4899, 4899, 4899, 4899,
+    4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899,
+    4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899,
+    4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899,
+    4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899,
+    4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899, 4899,
+};
+
+extern const int16_t DiodeFeedbackRedGreenShape[codeCount] = {
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4773, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4767, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4773, -4776,
+    -4773, -4776, -4773, -4776, -4776, -4773, -4776, -4776, -4773, -4773, -4773, -4773, -4773, -4773, -4773, -4773,
+    -4776, -4773, -4773, -4776, -4773, -4773, -4773, -4776, -4776, -4776, -4773, -4773, -4773, -4773, -4773, -4773,
+    -4773, -4773, -4773, -4773, -4773, -4773, -4773, -4773, -4773, -4773, -4773, -4773, -4773, -4773, -4773, -4773,
+    -4773, -4773, -4773, -4773, -4773, -4773, -4773, -4773, -4773, -4773, -4773, -4773, -4773, -4773, -4773, -4773,
+    -4773, -4773, -4773, -4773, -4773, -4773, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770,
+    -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4770, -4767,
+    -4767, -4767, -4767, -4767, -4767, -4767, -4767, -4767, -4767, -4767, -4767, -4767, -4767, -4764, -4764, -4764,
+    -4767, -4764, -4764, -4764, -4764, -4764, -4764, -4764, -4764, -4764, -4764, -4764, -4764, -4764, -4764, -4761,
+    -4764, -4764, -4761, -4761, -4761, -4761, -4761, -4761, -4761, -4761, -4761, -4761, -4761, -4758, -4758, -4758,
+    -4758, -4758, -4758, -4758, -4758, -4758, -4758, -4758, -4758, -4758, -4758, -4755, -4755, -4755, -4755, -4755,
+    -4755, -4755, -4755, -4755, -4755, -4755, -4752, -4752, -4752, -4752, -4752, -4752, -4752, -4752, -4749, -4749,
+    -4749, -4749, -4749, -4749, -4749, -4749, -4749, -4746, -4749, -4746, -4746, -4746, -4746, -4743, -4743, -4743,
+    -4743, -4743, -4743, -4743, -4743, -4740, -4740, -4740, -4740, -4740, -4740, -4737, -4737, -4737, -4737, -4737,
+    -4737, -4737, -4734, -4734, -4734, -4731, -4731, -4731, -4731, -4728, -4728, -4725, -4728, -4725, -4725, -4725,
+    -4722, -4722, -4722, -4719, -4719, -4719, -4716, -4716, -4713, -4713, -4710, -4710, -4710, -4707, -4704, -4704,
+    -4701, -4698, -4698, -4695, -4692, -4689, -4689, -4686, -4683, -4680, -4677, -4674, -4674, -4668, -4668, -4662,
+    -4662, -4656, -4656, -4650, -4650, -4644, -4644, -4638, -4638, -4632, -4632, -4626, -4626, -4620, -4620, -4614,
+    -4614, -4608, -4608, -4602, -4599, -4596, -4593, -4590, -4590, -4584, -4581, -4578, -4575, -4572, -4569, -4566,
+    -4563, -4560, -4557, -4551, -4551, -4548, -4545, -4542, -4539, -4533, -4533, -4527, -4527, -4524, -4521, -4515,
+    -4515, -4509, -4509, -4503, -4503, -4497, -4497, -4494, -4491, -4485, -4485, -4479, -4479, -4473, -4473, -4467,
+    -4467, -4461, -4461, -4455, -4455, -4449, -4449, -4443, -4443, -4437, -4437, -4431, -4431, -4425, -4425, -4419,
+    -4419, -4413, -4413, -4407, -4407, -4401, -4398, -4395, -4395, -4389, -4386, -4383, -4383, -4377, -4374, -4371,
+    -4368, -4365, -4365, -4359, -4359, -4353, -4350, -4347, -4347, -4341, -4338, -4335, -4332, -4329, -4329, -4323,
+    -4320, -4317, -4314, -4308, -4308, -4305, -4302, -4296, -4296, -4290, -4290, -4287, -4284, -4278, -4278, -4275,
+    -4272, -4266, -4266, -4260, -4260, -4254, -4254, -4248, -4248, -4242, -4242, -4236, -4236, -4230, -4230, -4224,
+    -4224, -4218, -4218, -4212, -4212, -4206, -4206, -4200, -4200, -4194, -4194, -4188, -4188, -4182, -4179, -4176,
+    -4176, -4170, -4167, -4164, -4164, -4158, -4158, -4152, -4149, -4146, -4143, -4140, -4140, -4134, -4134, -4128,
+    -4125, -4122, -4119, -4116, -4113, -4110, -4107, -4104, -4101, -4095, -4095, -4092, -4089, -4086, -4083, -4080,
+    -4080, -4074, -4074, -4068, -4068, -4062, -4062, -4056, -4056, -4050, -4047, -4044, -4044, -4038, -4035, -4032,
+    -4029, -4026, -4023, -4020, -4017, -4014, -4011, -4008, -4005, -4002, -3999, -3996, -3993, -3987, -3987, -3984,
+    -3981, -3978, -3975, -3972, -3969, -3963, -3963, -3957, -3957, -3951, -3951, -3945, -3945, -3939, -3939, -3933,
+    -3933, -3927, -3927, -3921, -3921, -3915, -3915, -3909, -3909, -3903, -3903, -3897, -3894, -3891, -3888, -3885,
+    -3885, -3879, -3876, -3873, -3873, -3867, -3864, -3861, -3858, -3855, -3852, -3849, -3846, -3843, -3840, -3837,
+    -3834, -3831, -3828, -3825, -3822, -3819, -3816, -3810, -3810, -3807, -3804, -3798, -3798, -3792, -3792, -3789,
+    -3786, -3780, -3780, -3777, -3774, -3768, -3768, -3762, -3762, -3756, -3756, -3750, -3750, -3744, -3744, -3738,
+    -3738, -3732, -3732, -3729, -3726, -3720, -3720, -3714, -3714, -3708, -3705, -3702, -3699, -3696, -3693, -3690,
+    -3690, -3684, -3681, -3678, -3678, -3672, -3669, -3666, -3666, -3660, -3657, -3654, -3651, -3648, -3645, -3642,
+    -3639, -3636, -3633, -3630, -3627, -3624, -3621, -3618, -3615, -3612, -3609, -3606, -3603, -3600, -3597, -3594,
+    -3591, -3588, -3585, -3582, -3579, -3576, -3573, -3567, -3567, -3561, -3561, -3555, -3555, -3549, -3549, -3543,
+    -3543, -3537, -3537, -3531, -3531, -3525, -3525, -3519, -3516, -3513, -3513, -3507, -3507, -3501, -3498, -3495,
+    -3495, -3492, -3489, -3483, -3483, -3480, -3477, -3471, -3468, -3465, -3462, -3459, -3456, -3453, -3450, -3447,
+    -3444, -3441, -3438, -3435, -3432, -3429, -3426, -3423, -3420, -3417, -3414, -3411, -3408, -3402, -3402, -3399,
+    -3396, -3393, -3390, -3387, -3384, -3381, -3378, -3375, -3372, -3369, -3366, -3360, -3360, -3354, -3351, -3348,
+    -3348, -3342, -3342, -3336, -3336, -3330, -3330, -3324, -3321, -3318, -3315, -3312, -3309, -3306, -3303, -3300,
+    -3300, -3294, -3294, -3288, -3288, -3282, -3282, -3276, -3276, -3270, -3270, -3264, -3264, -3258, -3255, -3252,
+    -3249, -3246, -3243, -3240, -3237, -3234, -3234, -3228, -3225, -3222, -3219, -3216, -3213, -3210, -3207, -3204,
+    -3201, -3198, -3195, -3192, -3189, -3186, -3183, -3180, -3177, -3174, -3171, -3165, -3165, -3162, -3159, -3153,
+    -3153, -3147, -3147, -3141, -3141, -3138, -3135, -3132, -3126, -3123, -3123, -3117, -3114, -3111, -3108, -3105,
+    -3105, -3099, -3096, -3093, -3090, -3087, -3084, -3081, -3078, -3075, -3075, -3069, -3066, -3063, -3060, -3057,
+    -3054, -3051, -3048, -3045, -3042, -3039, -3036, -3033, -3030, -3027, -3024, -3021, -3018, -3015, -3012, -3009,
+    -3006, -3003, -3000, -2997, -2994, -2988, -2988, -2982, -2982, -2976, -2976, -2970, -2967, -2964, -2964, -2958,
+    -2955, -2952, -2949, -2946, -2943, -2940, -2937, -2934, -2931, -2928, -2925, -2922, -2919, -2916, -2913, -2910,
+    -2907, -2904, -2901, -2898, -2895, -2892, -2889, -2886, -2883, -2877, -2877, -2874, -2871, -2865, -2865, -2862,
+    -2859, -2856, -2853, -2850, -2847, -2844, -2841, -2838, -2835, -2832, -2829, -2826, -2823, -2820, -2817, -2814,
+    -2811, -2805, -2802, -2799, -2796, -2793, -2790, -2787, -2784, -2781, -2778, -2775, -2775, -2769, -2766, -2763,
+    -2760, -2757, -2754, -2751, -2748, -2745, -2742, -2739, -2736, -2733, -2730, -2727, -2724, -2721, -2718, -2715,
+    -2712, -2709, -2706, -2700, -2700, -2694, -2694, -2688, -2688, -2682, -2682, -2679, -2676, -2670, -2670, -2667,
+    -2664, -2658, -2655, -2652, -2649, -2646, -2643, -2640, -2637, -2634, -2631, -2628, -2625, -2622, -2619, -2616,
+    -2613, -2610, -2607, -2604, -2601, -2598, -2595, -2592, -2589, -2586, -2583, -2580, -2577, -2574, -2571, -2565,
+    -2565, -2562, -2559, -2556, -2553, -2547, -2547, -2544, -2541, -2535, -2535, -2529, -2526, -2523, -2520, -2520,
+    -2517, -2514, -2511, -2505, -2505, -2499, -2499, -2496, -2493, -2487, -2487, -2481, -2478, -2478, -2475, -2469,
+    -2469, -2463, -2463, -2457, -2454, -2451, -2448, -2445, -2442, -2439, -2436, -2433, -2430, -2427, -2424, -2421,
+    -2418, -2415, -2412, -2409, -2406, -2403, -2400, -2397, -2394, -2391, -2388, -2382, -2382, -2379, -2376, -2373,
+    -2370, -2367, -2364, -2361, -2358, -2352, -2349, -2346, -2346, -2340, -2337, -2334, -2331, -2328, -2325, -2322,
+    -2322, -2316, -2313, -2310, -2307, -2304, -2301, -2298, -2295, -2292, -2289, -2286, -2283, -2280, -2277, -2274,
+    -2271, -2268, -2265, -2262, -2259, -2256, -2253, -2250, -2247, -2244, -2241, -2235, -2232, -2229, -2226, -2223,
+    -2220, -2217, -2214, -2211, -2208, -2205, -2202, -2199, -2196, -2196, -2190, -2187, -2184, -2181, -2178, -2175,
+    -2172, -2169, -2166, -2163, -2160, -2157, -2154, -2148, -2148, -2145, -2142, -2139, -2133, -2133, -2130, -2127,
+    -2121, -2121, -2118, -2112, -2112, -2106, -2106, -2103, -2097, -2094, -2091, -2088, -2085, -2082, -2079, -2076,
+    -2073, -2070, -2067, -2064, -2061, -2058, -2055, -2052, -2046, -2046, -2043, -2040, -2037, -2034, -2028, -2025,
+    -2025, -2019, -2019, -2013, -2013, -2010, -2004, -2001, -2001, -1995, -1995, -1989, -1986, -1983, -1980, -1977,
+    -1974, -1971, -1968, -1965, -1962, -1959, -1953, -1953, -1950, -1947, -1944, -1941, -1935, -1935, -1932, -1929,
+    -1926, -1923, -1920, -1914, -1914, -1911, -1908, -1902, -1899, -1896, -1893, -1890, -1887, -1884, -1881, -1878,
+    -1875, -1869, -1869, -1866, -1863, -1860, -1857, -1854, -1851, -1848, -1845, -1842, -1839, -1833, -1833, -1830,
+    -1824, -1821, -1818, -1815, -1812, -1809, -1806, -1803, -1800, -1797, -1794, -1791, -1788, -1785, -1782, -1779,
+    -1773, -1773, -1770, -1767, -1764, -1758, -1758, -1755, -1749, -1749, -1743, -1740, -1737, -1734, -1731, -1731,
+    -1725, -1722, -1719, -1716, -1713, -1710, -1707, -1704, -1701, -1698, -1695, -1692, -1689, -1686, -1683, -1680,
+    -1677, -1674, -1671, -1668, -1662, -1659, -1656, -1653, -1650, -1647, -1644, -1641, -1638, -1635, -1632, -1629,
+    -1626, -1623, -1620, -1617, -1614, -1611, -1608, -1605, -1602, -1599, -1593, -1590, -1587, -1584, -1581, -1578,
+    -1575, -1572, -1569, -1566, -1563, -1560, -1557, -1554, -1551, -1545, -1545, -1542, -1539, -1536, -1533, -1530,
+    -1527, -1524, -1518, -1518, -1512, -1509, -1506, -1503, -1500, -1497, -1494, -1491, -1488, -1485, -1479, -1476,
+    -1473, -1470, -1467, -1464, -1461, -1458, -1455, -1452, -1449, -1446, -1443, -1440, -1437, -1434, -1428, -1425,
+    -1422, -1419, -1416, -1413, -1410, -1407, -1404, -1401, -1398, -1395, -1389, -1386, -1383, -1380, -1377, -1374,
+    -1371, -1368, -1362, -1359, -1356, -1353, -1350, -1347, -1344, -1341, -1338, -1332, -1329, -1326, -1323, -1320,
+    -1317, -1314, -1311, -1308, -1305, -1302, -1296, -1293, -1290, -1287, -1284, -1281, -1275, -1272, -1269, -1266,
+    -1263, -1257, -1254, -1251, -1248, -1245, -1242, -1239, -1233, -1230, -1227, -1221, -1218, -1215, -1212, -1206,
+    -1203, -1200, -1197, -1191, -1188, -1185, -1179, -1176, -1170, -1167, -1161, -1158, -1155, -1149, -1146, -1140,
+    -1134, -1131, -1125, -1122, -1116, -1110, -1101, -1095, -1089, -1080, -1071, -1062, -1050, -1035, -1020, -1008,
+    -993, -972, -954, -939, -915, -897, -873, -858, -834, -819, -795, -777, -753, -735, -714, -702,
+    -675, -660, -636, -615, -594, -579, -555, -537, -510, -495, -474, -459, -435, -417, -393, -381,
+    -357, -339, -318, -297, -273, -258, -234, -219, -195, -177, -156, -138, -117, -99, -72, -60,
+    -39, -18, 6, 21, 45, 60, 87, 99, 123, 141, 165, 183, 204, 222, 246, 261,
+    288, 306, 330, 345, 366, 381, 408, 426, 447, 462, 489, 504, 528, 543, 570, 585,
+    606, 624, 648, 666, 687, 705, 729, 744, 768, 783, 807, 822, 846, 861, 879, 891,
+    909, 921, 933, 942, 954, 960, 969, 975, 984, 987, 993, 999, 1005, 1008, 1014, 1017,
+    1023, 1026, 1032, 1035, 1041, 1044, 1047, 1053, 1056, 1059, 1062, 1068, 1071, 1074, 1080, 1080,
+    1086, 1089, 1095, 1095, 1101, 1104, 1107, 1110, 1113, 1119, 1122, 1125, 1128, 1131, 1137, 1140,
+    1143, 1146, 1149, 1152, 1155, 1158, 1164, 1167, 1170, 1173, 1176, 1179, 1182, 1185, 1191, 1194,
+    1197, 1200, 1203, 1206, 1209, 1212, 1218, 1218, 1224, 1227, 1230, 1233, 1236, 1239, 1242, 1245,
+    1251, 1251, 1257, 1260, 1263, 1266, 1269, 1272, 1275, 1278, 1284, 1284, 1290, 1290, 1296, 1296,
+    1302, 1302, 1308, 1311, 1314, 1317, 1320, 1323, 1326, 1329, 1332, 1335, 1341, 1344, 1347, 1347,
+    1353, 1356, 1359, 1362, 1365, 1368, 1371, 1374, 1377, 1380, 1383, 1386, 1392, 1395, 1398, 1401,
+    1404, 1407, 1410, 1413, 1416, 1419, 1422, 1425, 1428, 1431, 1437, 1437, 1443, 1446, 1449, 1449,
+    1455, 1458, 1461, 1464, 1467, 1470, 1473, 1476, 1479, 1482, 1488, 1488, 1494, 1497, 1500, 1500,
+    1503, 1509, 1512, 1512, 1518, 1521, 1524, 1527, 1530, 1533, 1536, 1539, 1542, 1545, 1548, 1551,
+    1554, 1557, 1560, 1563, 1566, 1569, 1572, 1575, 1581, 1581, 1584, 1587, 1593, 1593, 1599, 1599,
+    1605, 1608, 1611, 1614, 1617, 1620, 1623, 1626, 1629, 1629, 1635, 1638, 1641, 1644, 1650, 1650,
+    1656, 1656, 1662, 1665, 1668, 1668, 1674, 1677, 1680, 1680, 1686, 1689, 1692, 1695, 1698, 1701,
+    1704, 1704, 1710, 1713, 1716, 1719, 1722, 1725, 1728, 1731, 1737, 1737, 1740, 1743, 1746, 1749,
+    1755, 1755, 1761, 1761, 1767, 1767, 1773, 1773, 1779, 1782, 1785, 1788, 1791, 1794, 1797, 1800,
+    1803, 1806, 1809, 1812, 1815, 1818, 1821, 1824, 1830, 1830, 1836, 1836, 1842, 1842, 1848, 1851,
+    1854, 1857, 1860, 1863, 1866, 1869, 1872, 1875, 1878, 1881, 1884, 1887, 1890, 1893, 1899, 1899,
+    1902, 1905, 1911, 1911, 1917, 1917, 1923, 1923, 1926, 1929, 1935, 1935, 1941, 1941, 1947, 1947,
+    1953, 1956, 1959, 1962, 1965, 1968, 1971, 1974, 1977, 1980, 1983, 1986, 1989, 1992, 1998, 1998,
+    2004, 2004, 2007, 2010, 2016, 2016, 2022, 2022, 2028, 2028, 2034, 2034, 2040, 2040, 2046, 2046,
+    2052, 2055, 2058, 2061, 2064, 2067, 2070, 2073, 2076, 2079, 2082, 2085, 2088, 2091, 2097, 2097,
+    2100, 2103, 2109, 2109, 2112, 2115, 2121, 2121, 2127, 2127, 2130, 2133, 2139, 2139, 2145, 2145,
+    2151, 2151, 2157, 2160, 2163, 2163, 2169, 2172, 2175, 2178, 2181, 2184, 2187, 2190, 2196, 2196,
+    2202, 2202, 2205, 2208, 2211, 2214, 2217, 2220, 2226, 2226, 2232, 2232, 2235, 2238, 2244, 2244,
+    2250, 2253, 2256, 2256, 2262, 2265, 2268, 2271, 2274, 2277, 2280, 2283, 2286, 2289, 2292, 2295,
+    2298, 2301, 2307, 2307, 2310, 2313, 2316, 2319, 2325, 2325, 2331, 2331, 2337, 2337, 2343, 2343,
+    2349, 2349, 2355, 2355, 2361, 2364, 2367, 2367, 2373, 2376, 2379, 2382, 2385, 2388, 2391, 2394,
+    2397, 2400, 2403, 2406, 2409, 2412, 2415, 2418, 2424, 2424, 2427, 2430, 2436, 2436, 2442, 2442,
+    2448, 2448, 2454, 2454, 2460, 2460, 2466, 2469, 2472, 2472, 2478, 2481, 2484, 2487, 2490, 2490,
+    2496, 2496, 2502, 2502, 2508, 2508, 2514, 2514, 2520, 2520, 2526, 2526, 2532, 2535, 2538, 2541,
+    2544, 2547, 2550, 2553, 2556, 2559, 2565, 2565, 2568, 2571, 2574, 2577, 2580, 2583, 2589, 2589,
+    2595, 2595, 2601, 2601, 2607, 2607, 2613, 2613, 2619, 2619, 2625, 2625, 2631, 2634, 2637, 2640,
+    2643, 2646, 2652, 2652, 2655, 2658, 2661, 2664, 2667, 2667, 2673, 2676, 2679, 2682, 2685, 2688,
+    2691, 2694, 2697, 2700, 2706, 2706, 2709, 2712, 2715, 2718, 2724, 2724, 2730, 2730, 2736, 2736,
+    2742, 2742, 2748, 2751, 2754, 2754, 2760, 2760, 2766, 2769, 2772, 2772, 2778, 2781, 2784, 2787,
+    2790, 2793, 2796, 2799, 2802, 2805, 2808, 2811, 2814, 2817, 2820, 2823, 2826, 2829, 2832, 2835,
+    2841, 2841, 2847, 2847, 2853, 2853, 2859, 2859, 2865, 2865, 2871, 2871, 2877, 2877, 2883, 2883,
+    2889, 2889, 2895, 2895, 2901, 2901, 2907, 2907, 2913, 2916, 2919, 2922, 2925, 2928, 2931, 2934,
+    2937, 2940, 2943, 2946, 2949, 2952, 2958, 2958, 2964, 2964, 2967, 2970, 2976, 2976, 2982, 2982,
+    2985, 2988, 2994, 2994, 3000, 3000, 3006, 3006, 3012, 3012, 3018, 3018, 3024, 3027, 3030, 3030,
+    3036, 3039, 3042, 3045, 3048, 3051, 3054, 3057, 3060, 3063, 3066, 3069, 3072, 3072, 3078, 3081,
+    3087, 3087, 3093, 3093, 3096, 3102, 3105, 3105, 3111, 3111, 3117, 3117, 3123, 3123, 3129, 3129,
+    3135, 3138, 3141, 3141, 3147, 3147, 3153, 3153, 3159, 3159, 3165, 3165, 3171, 3174, 3177, 3177,
+    3183, 3186, 3189, 3192, 3195, 3198, 3201, 3204, 3207, 3210, 3213, 3216, 3219, 3222, 3228, 3228,
+    3234, 3234, 3240, 3240, 3246, 3246, 3252, 3252, 3258, 3261, 3264, 3264, 3270, 3270, 3276, 3276,
+    3282, 3282, 3288, 3288, 3294, 3297, 3300, 3300, 3306, 3306, 3312, 3315, 3318, 3318, 3324, 3324,
+    3330, 3333, 3336, 3339, 3342, 3345, 3348, 3351, 3354, 3357, 3360, 3363, 3366, 3369, 3375, 3375,
+    3381, 3381, 3387, 3387, 3393, 3393, 3399, 3399, 3405, 3405, 3411, 3411, 3417, 3417, 3423, 3423,
+    3429, 3429, 3435, 3435, 3441, 3444, 3447, 3447, 3453, 3456, 3459, 3462, 3465, 3468, 3471, 3471,
+    3477, 3477, 3483, 3483, 3489, 3492, 3495, 3498, 3504, 3504, 3510, 3510, 3513, 3516, 3519, 3522,
+    3525, 3528, 3534, 3534, 3540, 3540, 3546, 3546, 3552, 3552, 3558, 3558, 3564, 3564, 3570, 3570,
+    3576, 3576, 3582, 3582, 3588, 3588, 3594, 3594, 3600, 3600, 3606, 3606, 3612, 3615, 3618, 3618,
+    3624, 3627, 3630, 3633, 3636, 3636, 3645, 3645, 3648, 3651, 3657, 3657, 3663, 3663, 3669, 3669,
+    3672, 3675, 3681, 3681, 3684, 3687, 3693, 3693, 3696, 3699, 3705, 3705, 3711, 3711, 3717, 3717,
+    3723, 3723, 3729, 3729, 3735, 3735, 3741, 3741, 3747, 3747, 3753, 3756, 3759, 3759, 3765, 3765,
+    3771, 3774, 3777, 3780, 3783, 3786, 3789, 3792, 3795, 3795, 3801, 3804, 3810, 3810, 3816, 3816,
+    3822, 3822, 3828, 3828, 3831, 3834, 3840, 3840, 3846, 3846, 3852, 3852, 3858, 3858, 3864, 3864,
+    3870, 3870, 3876, 3876, 3882, 3882, 3888, 3888, 3894, 3894, 3900, 3903, 3906, 3909, 3912, 3912,
+    3921, 3918, 3924, 3927, 3930, 3933, 3936, 3939, 3942, 3945, 3951, 3951, 3954, 3957, 3960, 3963,
+    3969, 3969, 3975, 3975, 3981, 3981, 3987, 3987, 3993, 3993, 3999, 3999, 4005, 4005, 4011, 4011,
+    4017, 4017, 4023, 4023, 4029, 4032, 4035, 4035, 4041, 4044, 4047, 4050, 4056, 4056, 4059, 4059,
+    4065, 4065, 4071, 4071, 4077, 4077, 4083, 4083, 4089, 4089, 4095, 4095, 4101, 4101, 4107, 4107,
+    4113, 4113, 4119, 4119, 4125, 4125, 4131, 4131, 4137, 4137, 4143, 4146, 4149, 4152, 4155, 4158,
+    4161, 4164, 4167, 4170, 4176, 4176, 4182, 4182, 4188, 4188, 4194, 4194, 4200, 4200, 4206, 4206,
+    4212, 4212, 4218, 4218, 4224, 4224, 4230, 4230, 4236, 4236, 4242, 4242, 4248, 4248, 4254, 4254,
+    4260, 4260, 4266, 4266, 4272, 4272, 4278, 4278, 4284, 4284, 4290, 4293, 4296, 4299, 4302, 4302,
+    4308, 4311, 4314, 4317, 4320, 4323, 4326, 4329, 4335, 4335, 4341, 4341, 4347, 4347, 4353, 4353,
+    4359, 4359, 4365, 4365, 4371, 4371, 4377, 4377, 4383, 4383, 4389, 4389, 4395, 4398, 4401, 4401,
+    4407, 4407, 4413, 4413, 4419, 4419, 4428, 4425, 4434, 4434, 4440, 4440, 4443, 4446, 4452, 4449,
+    4455, 4458, 4461, 4461, 4470, 4467, 4473, 4476, 4482, 4479, 4488, 4485, 4491, 4494, 4500, 4500,
+    4506, 4506, 4512, 4512, 4518, 4518, 4524, 4524, 4530, 4530, 4536, 4536, 4542, 4542, 4548, 4548,
+    4554, 4554, 4560, 4560, 4566, 4566, 4572, 4572, 4578, 4578, 4584, 4584, 4590, 4590, 4596, 4596,
+    4602, 4602, 4608, 4611, 4614, 4614, 4623, 4623, 4626, 4629, 4635, 4635, 4641, 4641, 4647, 4647,
+    4653, 4653, 4659, 4659, 4665, 4662, 4668, 4671, 4677, 4677, 4683, 4683, 4689, 4689, 4695, 4695,
+    4701, 4701, 4707, 4707, 4713, 4713, 4719, 4719, 4725, 4725, 4731, 4731, 4740, 4737, 4746, 4743,
+    4749, 4752, 4755, 4755, 4761, 4761, 4767, 4767, 4773, 4776, 4782, 4782, 4788, 4788, 4794, 4794,
+    4800, 4800, 4806, 4806, 4812, 4812, 4818, 4818, 4824, 4824, 4830, 4830, 4836, 4836, 4842, 4842,
+    4845, 4848, 4854, 4851, 4860, 4860, 4866, 4866, 4872, 4872, 4878, 4878, 4884, 4884, 4890, 4890,
+    4896, 4896, 4902, 4902, 4908, 4908, 4914, 4914, 4920, 4920, 4926, 4929, 4932, 4932, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4941, 4941, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4941, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4935, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4935, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4935, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4935, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4935, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4935, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4935, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4935, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4935, 4935, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4935, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4935, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4935, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4935, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4935, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4941, 4938, 4938, 4938, 4938, 4941,
+    4938, 4938, 4938, 4938, 4941, 4938, 4938, 4938, 4938, 4941, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+    4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938, 4938,
+};
+
+extern const int16_t DiodeFeedbackOneAndOneShape[codeCount] = {
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4728, -4725,
+    -4725, -4725, -4725, -4725, -4728, -4725, -4725, -4725, -4725, -4725, -4725, -4728, -4725, -4725, -4725, -4725,
+    -4728, -4728, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4722, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4722, -4725, -4725, -4725, -4722, -4722, -4725, -4725, -4722, -4725, -4725,
+    -4725, -4722, -4725, -4725, -4725, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4725, -4722, -4722,
+    -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722,
+    -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722,
+    -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4719, -4722, -4722, -4722, -4722, -4719, -4719, -4722,
+    -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719,
+    -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4716, -4716, -4719,
+    -4716, -4719, -4716, -4716, -4716, -4716, -4719, -4719, -4716, -4716, -4716, -4716, -4716, -4716, -4716, -4716,
+    -4716, -4716, -4716, -4716, -4716, -4716, -4716, -4713, -4716, -4713, -4713, -4713, -4713, -4713, -4713, -4713,
+    -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4710, -4710, -4710, -4710, -4710, -4710, -4710,
+    -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4707, -4707, -4707, -4707, -4707,
+    -4707, -4707, -4707, -4707, -4707, -4707, -4704, -4704, -4704, -4704, -4704, -4704, -4704, -4704, -4704, -4701,
+    -4704, -4701, -4701, -4701, -4701, -4701, -4701, -4701, -4701, -4698, -4701, -4698, -4698, -4698, -4698, -4698,
+    -4698, -4695, -4695, -4695, -4695, -4695, -4695, -4695, -4695, -4692, -4692, -4692, -4692, -4692, -4692, -4689,
+    -4689, -4689, -4689, -4689, -4689, -4686, -4686, -4686, -4686, -4683, -4683, -4683, -4683, -4680, -4680, -4680,
+    -4680, -4680, -4677, -4677, -4677, -4674, -4674, -4674, -4671, -4671, -4671, -4668, -4668, -4665, -4665, -4662,
+    -4662, -4659, -4659, -4656, -4656, -4653, -4653, -4650, -4650, -4644, -4644, -4641, -4641, -4635, -4635, -4629,
+    -4629, -4623, -4623, -4617, -4617, -4614, -4611, -4608, -4605, -4602, -4599, -4596, -4593, -4587, -4587, -4584,
+    -4581, -4578, -4575, -4572, -4572, -4563, -4563, -4557, -4557, -4554, -4551, -4545, -4545, -4539, -4539, -4536,
+    -4533, -4527, -4527, -4521, -4521, -4515, -4515, -4509, -4509, -4503, -4503, -4497, -4497, -4491, -4491, -4485,
+    -4485, -4479, -4479, -4473, -4473, -4467, -4467, -4461, -4461, -4455, -4455, -4449, -4449, -4443, -4440, -4437,
+    -4434, -4431, -4431, -4425, -4425, -4419, -4416, -4413, -4413, -4407, -4407, -4398, -4398, -4395, -4392, -4389,
+    -4386, -4380, -4380, -4377, -4374, -4371, -4371, -4365, -4362, -4356, -4356, -4350, -4350, -4344, -4344, -4338,
+    -4338, -4332, -4332, -4329, -4326, -4320, -4320, -4314, -4314, -4311, -4308, -4302, -4302, -4296, -4296, -4293,
+    -4290, -4284, -4284, -4278, -4278, -4272, -4272, -4266, -4266, -4260, -4260, -4254, -4254, -4248, -4248, -4242,
+    -4242, -4236, -4236, -4230, -4230, -4224, -4224, -4218, -4218, -4212, -4212, -4206, -4203, -4200, -4200, -4194,
+    -4194, -4188, -4188, -4182, -4182, -4176, -4176, -4170, -4170, -4164, -4164, -4158, -4158, -4152, -4149, -4146,
+    -4143, -4140, -4137, -4134, -4134, -4128, -4128, -4122, -4119, -4116, -4113, -4110, -4107, -4104, -4101, -4098,
+    -4098, -4092, -4089, -4086, -4083, -4080, -4077, -4071, -4071, -4065, -4065, -4062, -4059, -4053, -4053, -4047,
+    -4047, -4041, -4041, -4038, -4035, -4032, -4029, -4023, -4023, -4017, -4017, -4011, -4011, -4005, -4005, -4002,
+    -3999, -3993, -3993, -3987, -3987, -3981, -3981, -3975, -3975, -3969, -3969, -3963, -3963, -3957, -3957, -3951,
+    -3948, -3945, -3945, -3939, -3939, -3933, -3933, -3927, -3927, -3921, -3918, -3915, -3912, -3909, -3906, -3903,
+    -3900, -3897, -3894, -3891, -3888, -3885, -3882, -3879, -3876, -3873, -3870, -3864, -3864, -3858, -3858, -3852,
+    -3852, -3846, -3846, -3843, -3840, -3834, -3834, -3828, -3828, -3822, -3822, -3816, -3816, -3810, -3810, -3804,
+    -3804, -3801, -3798, -3792, -3792, -3786, -3786, -3780, -3780, -3774, -3774, -3768, -3768, -3762, -3762, -3756,
+    -3756, -3750, -3750, -3744, -3744, -3738, -3735, -3732, -3729, -3726, -3726, -3720, -3720, -3714, -3714, -3708,
+    -3708, -3702, -3702, -3696, -3693, -3690, -3687, -3684, -3684, -3678, -3675, -3672, -3669, -3666, -3663, -3660,
+    -3657, -3654, -3651, -3645, -3645, -3642, -3639, -3636, -3633, -3627, -3627, -3624, -3621, -3615, -3615, -3612,
+    -3609, -3606, -3603, -3597, -3597, -3591, -3591, -3585, -3585, -3579, -3579, -3573, -3573, -3567, -3567, -3561,
+    -3561, -3555, -3555, -3549, -3549, -3543, -3543, -3537, -3534, -3531, -3531, -3525, -3525, -3519, -3516, -3513,
+    -3513, -3507, -3504, -3501, -3498, -3492, -3492, -3489, -3489, -3483, -3480, -3477, -3474, -3471, -3468, -3465,
+    -3462, -3459, -3456, -3453, -3450, -3447, -3444, -3438, -3438, -3432, -3432, -3429, -3426, -3420, -3420, -3417,
+    -3417, -3411, -3408, -3405, -3405, -3399, -3396, -3393, -3390, -3387, -3384, -3381, -3378, -3375, -3372, -3369,
+    -3366, -3363, -3360, -3357, -3354, -3348, -3348, -3345, -3342, -3339, -3336, -3330, -3330, -3324, -3324, -3321,
+    -3318, -3315, -3312, -3309, -3303, -3300, -3300, -3294, -3294, -3288, -3288, -3282, -3282, -3276, -3276, -3270,
+    -3270, -3264, -3264, -3258, -3258, -3252, -3249, -3246, -3243, -3240, -3237, -3234, -3231, -3228, -3225, -3222,
+    -3222, -3216, -3213, -3210, -3207, -3204, -3201, -3198, -3195, -3192, -3189, -3186, -3183, -3180, -3177, -3174,
+    -3171, -3168, -3165, -3162, -3159, -3153, -3153, -3150, -3147, -3141, -3141, -3135, -3135, -3129, -3129, -3126,
+    -3123, -3120, -3117, -3111, -3111, -3105, -3102, -3099, -3096, -3093, -3093, -3087, -3087, -3081, -3081, -3075,
+    -3075, -3069, -3069, -3063, -3060, -3057, -3054, -3051, -3048, -3042, -3042, -3039, -3036, -3033, -3030, -3027,
+    -3027, -3021, -3018, -3015, -3012, -3009, -3006, -3003, -3000, -2997, -2994, -2991, -2988, -2982, -2982, -2979,
+    -2976, -2970, -2970, -2967, -2964, -2958, -2958, -2955, -2952, -2946, -2946, -2940, -2940, -2934, -2934, -2928,
+    -2928, -2922, -2922, -2916, -2916, -2910, -2907, -2904, -2901, -2898, -2895, -2892, -2889, -2886, -2886, -2880,
+    -2880, -2874, -2871, -2868, -2865, -2862, -2859, -2856, -2853, -2850, -2847, -2844, -2841, -2838, -2835, -2832,
+    -2829, -2826, -2823, -2820, -2817, -2811, -2811, -2805, -2805, -2802, -2799, -2793, -2793, -2790, -2787, -2781,
+    -2781, -2775, -2775, -2772, -2769, -2766, -2763, -2757, -2757, -2751, -2748, -2745, -2742, -2739, -2736, -2733,
+    -2733, -2727, -2724, -2721, -2718, -2715, -2712, -2709, -2706, -2703, -2700, -2697, -2694, -2691, -2688, -2685,
+    -2682, -2679, -2676, -2673, -2670, -2667, -2664, -2661, -2658, -2655, -2652, -2649, -2646, -2643, -2640, -2637,
+    -2634, -2631, -2628, -2625, -2622, -2619, -2616, -2613, -2610, -2607, -2604, -2601, -2598, -2595, -2592, -2589,
+    -2586, -2580, -2580, -2577, -2574, -2571, -2568, -2562, -2562, -2559, -2556, -2550, -2550, -2544, -2544, -2538,
+    -2538, -2532, -2529, -2526, -2523, -2520, -2520, -2514, -2511, -2508, -2505, -2502, -2499, -2496, -2493, -2490,
+    -2487, -2484, -2481, -2478, -2475, -2472, -2469, -2466, -2463, -2460, -2457, -2454, -2451, -2445, -2445, -2442,
+    -2439, -2436, -2433, -2430, -2427, -2421, -2421, -2415, -2415, -2409, -2409, -2406, -2403, -2397, -2394, -2391,
+    -2391, -2385, -2385, -2379, -2376, -2373, -2373, -2367, -2367, -2361, -2358, -2355, -2352, -2349, -2346, -2343,
+    -2340, -2337, -2334, -2331, -2328, -2325, -2322, -2319, -2316, -2313, -2310, -2304, -2304, -2301, -2298, -2292,
+    -2292, -2286, -2286, -2280, -2277, -2277, -2274, -2268, -2268, -2262, -2262, -2256, -2253, -2250, -2247, -2244,
+    -2244, -2238, -2235, -2232, -2232, -2226, -2226, -2220, -2217, -2214, -2211, -2208, -2205, -2202, -2199, -2196,
+    -2193, -2190, -2187, -2184, -2181, -2178, -2175, -2172, -2169, -2166, -2163, -2160, -2157, -2154, -2151, -2148,
+    -2145, -2142, -2139, -2133, -2133, -2127, -2127, -2121, -2121, -2115, -2115, -2109, -2106, -2103, -2100, -2097,
+    -2094, -2091, -2088, -2085, -2082, -2079, -2076, -2073, -2070, -2067, -2064, -2061, -2058, -2052, -2052, -2049,
+    -2046, -2043, -2040, -2037, -2034, -2031, -2028, -2025, -2022, -2019, -2016, -2013, -2010, -2004, -2004, -1998,
+    -1998, -1992, -1992, -1986, -1983, -1980, -1977, -1974, -1974, -1968, -1965, -1962, -1959, -1956, -1953, -1950,
+    -1947, -1944, -1941, -1938, -1935, -1932, -1929, -1926, -1923, -1920, -1917, -1914, -1911, -1908, -1905, -1902,
+    -1899, -1896, -1893, -1890, -1887, -1884, -1881, -1875, -1872, -1869, -1869, -1863, -1863, -1857, -1857, -1854,
+    -1851, -1848, -1845, -1842, -1839, -1833, -1833, -1830, -1827, -1821, -1821, -1818, -1815, -1809, -1806, -1806,
+    -1803, -1797, -1797, -1791, -1791, -1785, -1782, -1779, -1776, -1773, -1770, -1767, -1764, -1761, -1758, -1755,
+    -1752, -1749, -1746, -1743, -1740, -1737, -1734, -1731, -1728, -1725, -1722, -1719, -1716, -1713, -1710, -1707,
+    -1704, -1701, -1698, -1692, -1689, -1686, -1683, -1683, -1677, -1674, -1671, -1668, -1665, -1662, -1659, -1659,
+    -1653, -1650, -1647, -1644, -1641, -1638, -1635, -1632, -1629, -1626, -1623, -1620, -1617, -1614, -1611, -1608,
+    -1605, -1602, -1599, -1596, -1590, -1587, -1587, -1584, -1578, -1575, -1572, -1569, -1566, -1563, -1560, -1557,
+    -1557, -1551, -1548, -1545, -1545, -1539, -1536, -1533, -1530, -1527, -1524, -1521, -1518, -1515, -1512, -1509,
+    -1506, -1503, -1500, -1497, -1494, -1491, -1488, -1485, -1482, -1479, -1473, -1473, -1470, -1467, -1464, -1461,
+    -1458, -1455, -1452, -1446, -1443, -1440, -1437, -1434, -1431, -1431, -1425, -1422, -1419, -1416, -1413, -1410,
+    -1407, -1404, -1401, -1398, -1395, -1392, -1389, -1386, -1383, -1380, -1377, -1374, -1371, -1365, -1365, -1359,
+    -1359, -1356, -1353, -1347, -1344, -1344, -1341, -1335, -1335, -1332, -1326, -1323, -1320, -1317, -1314, -1311,
+    -1308, -1305, -1302, -1299, -1296, -1293, -1290, -1287, -1284, -1281, -1275, -1275, -1269, -1266, -1263, -1263,
+    -1257, -1257, -1251, -1248, -1245, -1242, -1239, -1236, -1236, -1230, -1227, -1224, -1221, -1218, -1215, -1212,
+    -1209, -1206, -1203, -1200, -1197, -1194, -1188, -1185, -1185, -1179, -1176, -1173, -1170, -1167, -1164, -1161,
+    -1158, -1155, -1152, -1149, -1146, -1143, -1140, -1137, -1134, -1131, -1128, -1125, -1122, -1119, -1116, -1113,
+    -1107, -1107, -1101, -1098, -1095, -1095, -1089, -1086, -1083, -1080, -1077, -1074, -1071, -1068, -1065, -1062,
+    -1059, -1056, -1053, -1050, -1047, -1044, -1038, -1035, -1035, -1029, -1026, -1023, -1023, -1017, -1017, -1011,
+    -1008, -1005, -1002, -999, -996, -993, -990, -987, -984, -981, -978, -975, -972, -969, -966, -963,
+    -960, -957, -951, -948, -945, -942, -939, -936, -933, -930, -927, -924, -921, -918, -915, -912,
+    -909, -906, -900, -897, -894, -891, -888, -885, -882, -879, -876, -873, -870, -867, -864, -861,
+    -858, -852, -852, -849, -843, -840, -837, -834, -831, -828, -825, -822, -819, -813, -813, -810,
+    -804, -801, -798, -795, -792, -789, -786, -783, -780, -777, -774, -771, -765, -762, -759, -759,
+    -753, -750, -747, -744, -741, -738, -732, -732, -726, -723, -720, -717, -714, -711, -708, -705,
+    -702, -699, -696, -690, -687, -684, -681, -678, -675, -672, -669, -666, -663, -660, -654, -654,
+    -651, -645, -642, -639, -636, -633, -630, -624, -621, -618, -615, -612, -609, -606, -600, -600,
+    -594, -591, -588, -585, -579, -576, -573, -570, -567, -564, -558, -558, -552, -549, -546, -543,
+    -540, -537, -534, -531, -525, -522, -519, -516, -510, -507, -504, -501, -495, -492, -489, -486,
+    -480, -477, -474, -471, -465, -462, -459, -456, -450, -447, -441, -438, -435, -429, -426, -420,
+    -417, -414, -408, -405, -399, -393, -387, -384, -378, -372, -366, -363, -354, -345, -339, -333,
+    -318, -309, -297, -285, -270, -255, -231, -219, -195, -177, -156, -141, -114, -99, -75, -63,
+    -39, -21, 0, 15, 36, 54, 72, 84, 105, 117, 129, 138, 147, 153, 162, 168,
+    174, 180, 186, 192, 198, 204, 207, 213, 219, 222, 228, 231, 237, 240, 246, 249,
+    255, 255, 261, 264, 270, 273, 279, 282, 285, 288, 294, 297, 300, 306, 309, 312,
+    315, 318, 324, 324, 330, 333, 336, 339, 345, 348, 351, 354, 357, 360, 363, 369,
+    372, 375, 378, 381, 387, 390, 393, 396, 399, 402, 405, 411, 414, 417, 420, 423,
+    426, 429, 432, 435, 441, 444, 447, 450, 453, 456, 462, 462, 468, 471, 474, 474,
+    480, 483, 486, 489, 495, 495, 501, 504, 504, 510, 513, 516, 519, 522, 528, 528,
+    534, 534, 540, 543, 546, 549, 552, 555, 558, 561, 564, 570, 573, 573, 579, 582,
+    585, 588, 591, 594, 597, 600, 606, 606, 612, 612, 618, 618, 624, 627, 630, 633,
+    636, 639, 642, 645, 648, 651, 654, 657, 660, 663, 669, 672, 675, 678, 681, 684,
+    687, 690, 693, 696, 699, 702, 708, 711, 714, 714, 720, 720, 726, 729, 732, 735,
+    738, 741, 744, 747, 753, 753, 756, 759, 762, 765, 771, 771, 777, 780, 783, 786,
+    789, 792, 795, 798, 801, 804, 807, 810, 813, 816, 822, 822, 828, 831, 834, 834,
+    840, 840, 846, 849, 852, 855, 858, 861, 864, 867, 870, 873, 876, 879, 882, 885,
+    891, 891, 897, 897, 903, 903, 909, 909, 915, 918, 921, 924, 927, 930, 933, 936,
+    939, 942, 945, 948, 951, 954, 960, 960, 963, 966, 972, 975, 978, 981, 984, 987,
+    990, 990, 996, 999, 1002, 1005, 1008, 1011, 1014, 1017, 1020, 1023, 1026, 1029, 1035, 1035,
+    1038, 1041, 1047, 1050, 1053, 1053, 1059, 1062, 1065, 1068, 1071, 1074, 1077, 1080, 1083, 1086,
+    1089, 1092, 1095, 1098, 1101, 1104, 1107, 1110, 1113, 1116, 1119, 1122, 1125, 1128, 1134, 1134,
+    1137, 1140, 1146, 1146, 1152, 1152, 1158, 1158, 1164, 1167, 1170, 1173, 1176, 1176, 1182, 1185,
+    1188, 1191, 1194, 1197, 1200, 1203, 1206, 1209, 1212, 1215, 1218, 1221, 1224, 1227, 1233, 1236,
+    1239, 1239, 1245, 1248, 1251, 1251, 1257, 1260, 1263, 1266, 1269, 1272, 1275, 1278, 1281, 1281,
+    1287, 1290, 1293, 1296, 1302, 1302, 1305, 1308, 1311, 1314, 1317, 1320, 1326, 1326, 1332, 1332,
+    1338, 1338, 1344, 1347, 1350, 1353, 1356, 1356, 1362, 1362, 1368, 1371, 1374, 1377, 1380, 1383,
+    1386, 1389, 1392, 1395, 1398, 1401, 1404, 1407, 1410, 1413, 1416, 1419, 1422, 1425, 1428, 1431,
+    1437, 1437, 1443, 1446, 1449, 1449, 1455, 1458, 1461, 1464, 1467, 1470, 1473, 1476, 1479, 1479,
+    1485, 1488, 1491, 1494, 1497, 1500, 1503, 1506, 1509, 1512, 1515, 1518, 1524, 1524, 1527, 1530,
+    1536, 1536, 1539, 1542, 1545, 1548, 1551, 1554, 1557, 1560, 1563, 1566, 1569, 1572, 1578, 1578,
+    1581, 1584, 1590, 1590, 1593, 1596, 1602, 1602, 1608, 1608, 1614, 1614, 1620, 1623, 1626, 1629,
+    1632, 1635, 1638, 1641, 1644, 1647, 1650, 1653, 1656, 1656, 1662, 1665, 1668, 1671, 1674, 1677,
+    1680, 1683, 1686, 1689, 1692, 1695, 1698, 1701, 1704, 1707, 1713, 1713, 1719, 1719, 1725, 1725,
+    1731, 1731, 1737, 1737, 1743, 1746, 1749, 1749, 1755, 1758, 1761, 1764, 1767, 1770, 1773, 1776,
+    1779, 1782, 1785, 1788, 1791, 1794, 1797, 1800, 1803, 1806, 1809, 1812, 1815, 1818, 1824, 1824,
+    1830, 1830, 1836, 1836, 1842, 1842, 1848, 1848, 1854, 1854, 1860, 1860, 1866, 1869, 1872, 1872,
+    1875, 1878, 1884, 1884, 1890, 1890, 1896, 1896, 1902, 1902, 1908, 1908, 1914, 1917, 1920, 1920,
+    1926, 1926, 1932, 1932, 1938, 1938, 1944, 1947, 1950, 1950, 1956, 1959, 1962, 1965, 1968, 1971,
+    1974, 1977, 1980, 1983, 1986, 1989, 1992, 1992, 1998, 2001, 2007, 2007, 2010, 2013, 2016, 2019,
+    2025, 2025, 2031, 2031, 2034, 2037, 2043, 2043, 2049, 2049, 2055, 2055, 2061, 2061, 2067, 2067,
+    2073, 2073, 2079, 2082, 2085, 2085, 2091, 2091, 2097, 2097, 2103, 2106, 2109, 2112, 2118, 2118,
+    2121, 2124, 2127, 2130, 2133, 2136, 2139, 2142, 2145, 2148, 2154, 2154, 2157, 2160, 2166, 2166,
+    2169, 2172, 2178, 2178, 2184, 2184, 2190, 2190, 2196, 2196, 2202, 2202, 2208, 2208, 2214, 2214,
+    2220, 2220, 2226, 2226, 2232, 2232, 2238, 2238, 2244, 2247, 2250, 2253, 2256, 2259, 2262, 2262,
+    2268, 2271, 2274, 2277, 2283, 2283, 2286, 2289, 2295, 2295, 2298, 2301, 2304, 2307, 2310, 2313,
+    2319, 2319, 2322, 2325, 2331, 2331, 2334, 2337, 2340, 2343, 2349, 2349, 2355, 2355, 2361, 2361,
+    2367, 2367, 2373, 2373, 2379, 2379, 2385, 2388, 2391, 2391, 2397, 2397, 2403, 2406, 2409, 2409,
+    2415, 2415, 2421, 2424, 2427, 2430, 2433, 2436, 2439, 2442, 2448, 2448, 2451, 2454, 2457, 2460,
+    2463, 2466, 2469, 2472, 2475, 2478, 2484, 2484, 2490, 2490, 2496, 2496, 2502, 2502, 2508, 2508,
+    2514, 2514, 2520, 2520, 2526, 2526, 2532, 2532, 2538, 2538, 2544, 2544, 2550, 2550, 2556, 2559,
+    2562, 2562, 2568, 2568, 2574, 2577, 2580, 2583, 2586, 2589, 2592, 2595, 2598, 2601, 2604, 2607,
+    2610, 2613, 2616, 2619, 2622, 2625, 2631, 2631, 2634, 2637, 2640, 2643, 2649, 2649, 2655, 2655,
+    2658, 2658, 2664, 2667, 2670, 2673, 2676, 2679, 2682, 2685, 2688, 2691, 2697, 2697, 2703, 2703,
+    2706, 2709, 2715, 2715, 2721, 2721, 2727, 2727, 2733, 2733, 2739, 2739, 2745, 2745, 2751, 2751,
+    2757, 2757, 2763, 2763, 2769, 2769, 2775, 2775, 2781, 2781, 2787, 2790, 2793, 2793, 2799, 2802,
+    2805, 2805, 2811, 2814, 2817, 2820, 2823, 2826, 2829, 2832, 2838, 2838, 2844, 2844, 2847, 2850,
+    2856, 2856, 2859, 2862, 2865, 2868, 2871, 2874, 2880, 2880, 2883, 2886, 2892, 2892, 2898, 2898,
+    2904, 2904, 2910, 2910, 2916, 2916, 2922, 2922, 2928, 2928, 2934, 2934, 2940, 2940, 2946, 2946,
+    2952, 2952, 2958, 2958, 2964, 2964, 2970, 2973, 2976, 2976, 2982, 2985, 2988, 2991, 2994, 2997,
+    3000, 3003, 3006, 3009, 3012, 3012, 3021, 3018, 3027, 3027, 3030, 3033, 3036, 3039, 3045, 3045,
+    3048, 3051, 3054, 3057, 3060, 3063, 3069, 3069, 3072, 3075, 3081, 3081, 3087, 3087, 3093, 3093,
+    3099, 3099, 3105, 3105, 3111, 3111, 3117, 3117, 3123, 3123, 3129, 3129, 3135, 3135, 3141, 3141,
+    3147, 3147, 3153, 3153, 3159, 3159, 3165, 3165, 3171, 3171, 3177, 3177, 3186, 3186, 3189, 3192,
+    3195, 3198, 3201, 3204, 3207, 3210, 3213, 3213, 3222, 3219, 3225, 3228, 3234, 3234, 3237, 3240,
+    3243, 3246, 3252, 3252, 3258, 3258, 3264, 3264, 3270, 3270, 3273, 3276, 3282, 3282, 3288, 3288,
+    3294, 3294, 3300, 3300, 3306, 3306, 3312, 3312, 3318, 3318, 3324, 3327, 3330, 3330, 3336, 3336,
+    3342, 3342, 3348, 3351, 3354, 3354, 3360, 3360, 3366, 3369, 3372, 3372, 3378, 3381, 3384, 3384,
+    3390, 3393, 3396, 3399, 3405, 3405, 3411, 3411, 3414, 3417, 3423, 3423, 3429, 3429, 3435, 3432,
+    3438, 3438, 3444, 3444, 3450, 3450, 3456, 3456, 3462, 3462, 3468, 3468, 3474, 3477, 3480, 3480,
+    3486, 3486, 3492, 3492, 3498, 3501, 3504, 3504, 3510, 3510, 3519, 3519, 3525, 3525, 3531, 3531,
+    3534, 3537, 3543, 3543, 3549, 3549, 3552, 3555, 3561, 3561, 3567, 3567, 3570, 3573, 3579, 3579,
+    3585, 3585, 3591, 3591, 3597, 3597, 3603, 3603, 3609, 3609, 3615, 3615, 3621, 3621, 3627, 3627,
+    3633, 3633, 3639, 3639, 3645, 3645, 3651, 3651, 3657, 3657, 3663, 3663, 3669, 3669, 3675, 3675,
+    3681, 3681, 3687, 3687, 3693, 3696, 3699, 3702, 3705, 3705, 3714, 3714, 3717, 3720, 3726, 3726,
+    3729, 3732, 3735, 3738, 3744, 3744, 3750, 3750, 3753, 3756, 3762, 3762, 3768, 3768, 3774, 3774,
+    3780, 3780, 3786, 3786, 3792, 3792, 3798, 3798, 3804, 3804, 3810, 3810, 3816, 3816, 3822, 3822,
+    3828, 3828, 3834, 3834, 3840, 3840, 3846, 3846, 3852, 3852, 3858, 3858, 3864, 3864, 3870, 3870,
+    3876, 3876, 3882, 3882, 3888, 3888, 3894, 3894, 3900, 3900, 3906, 3906, 3912, 3912, 3918, 3918,
+    3924, 3927, 3933, 3933, 3939, 3939, 3942, 3942, 3948, 3948, 3954, 3954, 3960, 3960, 3966, 3969,
+    3975, 3975, 3981, 3981, 3987, 3987, 3993, 3993, 3999, 3999, 4005, 4005, 4011, 4011, 4017, 4017,
+    4023, 4023, 4029, 4029, 4035, 4035, 4041, 4041, 4047, 4047, 4053, 4053, 4059, 4059, 4065, 4065,
+    4071, 4071, 4077, 4077, 4083, 4083, 4089, 4089, 4095, 4095, 4101, 4101, 4107, 4107, 4113, 4113,
+    4119, 4119, 4125, 4128, 4131, 4131, 4137, 4137, 4143, 4143, 4152, 4149, 4158, 4155, 4164, 4164,
+    4167, 4167, 4173, 4176, 4182, 4179, 4188, 4188, 4194, 4194, 4200, 4200, 4206, 4206, 4212, 4212,
+    4215, 4215, 4221, 4221, 4230, 4227, 4233, 4233, 4239, 4242, 4245, 4245, 4254, 4254, 4260, 4257,
+    4263, 4263, 4272, 4272, 4278, 4278, 4284, 4284, 4290, 4290, 4296, 4296, 4302, 4302, 4308, 4308,
+    4314, 4314, 4320, 4320, 4326, 4326, 4332, 4332, 4338, 4338, 4344, 4344, 4350, 4350, 4356, 4356,
+    4362, 4362, 4368, 4368, 4374, 4374, 4380, 4380, 4386, 4386, 4392, 4392, 4398, 4398, 4404, 4404,
+    4410, 4410, 4416, 4416, 4422, 4422, 4428, 4428, 4434, 4434, 4440, 4440, 4446, 4449, 4455, 4452,
+    4458, 4458, 4464, 4464, 4470, 4473, 4476, 4476, 4482, 4485, 4491, 4491, 4494, 4497, 4503, 4503,
+    4509, 4509, 4515, 4515, 4518, 4521, 4527, 4524, 4533, 4533, 4539, 4539, 4545, 4545, 4551, 4551,
+    4557, 4557, 4563, 4563, 4569, 4569, 4575, 4575, 4581, 4581, 4587, 4587, 4593, 4593, 4599, 4599,
+    4605, 4605, 4611, 4611, 4617, 4617, 4623, 4623, 4629, 4629, 4635, 4635, 4641, 4641, 4647, 4647,
+    4653, 4653, 4659, 4659, 4665, 4665, 4671, 4671, 4677, 4680, 4683, 4686, 4689, 4689, 4695, 4695,
+    4701, 4701, 4710, 4707, 4713, 4716, 4719, 4719, 4725, 4728, 4734, 4731, 4740, 4740, 4746, 4746,
+    4752, 4752, 4758, 4758, 4764, 4761, 4770, 4767, 4776, 4776, 4782, 4782, 4788, 4788, 4794, 4794,
+    4800, 4800, 4806, 4803, 4812, 4812, 4818, 4815, 4824, 4824, 4827, 4827, 4827, 4827, 4827, 4827,
+    4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827,
+    4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827,
+    4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4824, 4827, 4827, 4827,
+    4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4824, 4827, 4827, 4824, 4827, 4824, 4827,
+    4824, 4827, 4827, 4824, 4824, 4824, 4824, 4824, 4827, 4824, 4824, 4824, 4827, 4824, 4824, 4824,
+    4824, 4824, 4827, 4824, 4827, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824,
+    4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824,
+    4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824,
+    4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824,
+    4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824,
+    4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824,
+    4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824,
+    4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824,
+    4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824,
+    4827, 4824, 4824, 4827, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824,
+    4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824,
+    4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4827, 4824, 4824,
+    4827, 4824, 4824, 4824, 4824, 4824, 4827, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824, 4824,
+    4824, 4824, 4824, 4824, 4827, 4824, 4827, 4824, 4824, 4827, 4824, 4824, 4827, 4824, 4824, 4824,
+    4824, 4824, 4827, 4827, 4824, 4824, 4827, 4827, 4824, 4827, 4827, 4827, 4827, 4827, 4827, 4827,
+    4827, 4824, 4827, 4827, 4824, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827,
+    4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827,
+    4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827,
+    4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827,
+    4827, 4824, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827,
+    4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4827, 4824, 4827, 4827, 4827, 4827, 4827,
+    4827, 4824, 4827, 4827, 4827, 4827, 4824, 4827, 4827, 4827, 4827, 4827, 4827, 4824, 4827, 4827,
+    4827, 4824, 4827, 4827, 4824, 4827, 4824, 4827, 4824, 4827, 4824, 4824, 4827, 4827, 4827, 4824,
+    4827, 4827, 4827, 4827, 4824, 4827, 4824, 4824, 4827, 4827, 4824, 4827, 4824, 4824, 4824, 4827,
+    4827, 4824, 4824, 4824, 4827, 4824, 4824, 4827, 4824, 4827, 4824, 4827, 4824, 4827, 4824, 4824,
+    4827, 4827, 4827, 4824, 4824, 4824, 4824, 4827, 4824, 4824, 4824, 4824, 4824, 4824, 4827, 4827,
+    4824, 4827, 4827, 4824, 4824, 4827, 4827, 4827, 4827, 4827, 4824, 4827, 4824, 4827, 4824, 4827,
+    4827, 4824, 4827, 4827, 4827, 4827, 4824, 4824, 4827, 4824, 4824, 4827, 4824, 4824, 4827, 4827,
+    4827, 4827, 4824, 4827, 4827, 4827, 4827, 4824, 4824, 4827, 4827, 4827, 4824, 4827, 4827, 4824,
+    4824, 4824, 4824, 4824, 4827, 4824, 4824, 4824, 4827, 4827, 4824, 4827, 4824, 4827, 4824,
+};
+
+extern const int16_t DiodeFeedbackOneAndTwoShape[codeCount] = {
+    -4713, -4713, -4716, -4716, -4716, -4716, -4716, -4713, -4716, -4716, -4716, -4716, -4716, -4716, -4716, -4716,
+    -4716, -4716, -4716, -4716, -4713, -4716, -4716, -4713, -4713, -4716, -4716, -4713, -4716, -4716, -4716, -4713,
+    -4716, -4716, -4713, -4716, -4716, -4716, -4713, -4713, -4716, -4713, -4716, -4713, -4716, -4716, -4716, -4716,
+    -4716, -4716, -4713, -4713, -4713, -4716, -4716, -4713, -4716, -4713, -4716, -4716, -4716, -4713, -4716, -4716,
+    -4713, -4713, -4716, -4716, -4713, -4716, -4713, -4713, -4713, -4713, -4713, -4716, -4713, -4716, -4713, -4716,
+    -4713, -4713, -4716, -4713, -4713, -4716, -4713, -4713, -4713, -4716, -4713, -4716, -4713, -4716, -4716, -4716,
+    -4713, -4713, -4713, -4716, -4716, -4713, -4713, -4716, -4713, -4713, -4716, -4713, -4713, -4713, -4713, -4713,
+    -4716, -4716, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4716, -4713,
+    -4713, -4716, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713,
+    -4713, -4713, -4716, -4713, -4713, -4713, -4713, -4713, -4716, -4713, -4713, -4713, -4713, -4713, -4713, -4713,
+    -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713,
+    -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4716, -4713, -4713, -4713, -4713, -4713,
+    -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713,
+    -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713,
+    -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713,
+    -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713,
+    -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713,
+    -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713,
+    -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713,
+    -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713,
+    -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713,
+    -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713,
+    -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713,
+    -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713,
+    -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4710, -4713, -4710, -4713,
+    -4710, -4710, -4710, -4713, -4710, -4713, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4713, -4710, -4710,
+    -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710,
+    -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710,
+    -4707, -4707, -4707, -4710, -4707, -4707, -4707, -4710, -4707, -4707, -4707, -4707, -4707, -4707, -4707, -4707,
+    -4707, -4707, -4707, -4707, -4707, -4707, -4707, -4707, -4707, -4707, -4707, -4707, -4707, -4707, -4707, -4707,
+    -4707, -4704, -4704, -4704, -4704, -4704, -4704, -4704, -4704, -4704, -4704, -4704, -4704, -4704, -4704, -4704,
+    -4704, -4704, -4704, -4704, -4704, -4704, -4701, -4701, -4701, -4701, -4701, -4701, -4701, -4701, -4701, -4701,
+    -4701, -4701, -4698, -4701, -4701, -4701, -4698, -4701, -4698, -4698, -4701, -4698, -4698, -4698, -4698, -4698,
+    -4698, -4698, -4698, -4695, -4698, -4698, -4695, -4695, -4695, -4695, -4695, -4695, -4695, -4695, -4695, -4695,
+    -4695, -4695, -4692, -4692, -4692, -4692, -4692, -4692, -4689, -4692, -4692, -4692, -4689, -4689, -4689, -4689,
+    -4689, -4689, -4689, -4686, -4686, -4686, -4686, -4686, -4686, -4686, -4683, -4683, -4683, -4683, -4683, -4683,
+    -4680, -4683, -4680, -4680, -4680, -4680, -4677, -4680, -4677, -4677, -4677, -4677, -4677, -4674, -4674, -4674,
+    -4674, -4671, -4671, -4671, -4668, -4668, -4668, -4668, -4668, -4665, -4665, -4665, -4662, -4662, -4662, -4659,
+    -4659, -4659, -4656, -4656, -4653, -4653, -4650, -4650, -4647, -4647, -4644, -4644, -4641, -4641, -4638, -4635,
+    -4632, -4632, -4626, -4626, -4620, -4620, -4617, -4614, -4611, -4611, -4605, -4605, -4599, -4599, -4593, -4593,
+    -4587, -4587, -4581, -4581, -4575, -4575, -4569, -4569, -4563, -4563, -4557, -4557, -4551, -4551, -4545, -4545,
+    -4539, -4539, -4533, -4533, -4527, -4527, -4521, -4518, -4515, -4515, -4509, -4506, -4503, -4500, -4497, -4494,
+    -4491, -4488, -4485, -4485, -4476, -4476, -4473, -4473, -4467, -4464, -4458, -4458, -4452, -4452, -4446, -4446,
+    -4443, -4440, -4437, -4434, -4428, -4428, -4422, -4422, -4416, -4416, -4410, -4410, -4404, -4404, -4398, -4398,
+    -4392, -4392, -4386, -4386, -4380, -4380, -4374, -4374, -4368, -4368, -4362, -4362, -4356, -4356, -4350, -4350,
+    -4344, -4344, -4338, -4338, -4332, -4332, -4326, -4326, -4320, -4317, -4314, -4314, -4308, -4308, -4302, -4302,
+    -4296, -4296, -4290, -4287, -4284, -4281, -4278, -4275, -4272, -4269, -4266, -4263, -4260, -4257, -4251, -4251,
+    -4245, -4245, -4242, -4239, -4236, -4233, -4227, -4227, -4224, -4221, -4215, -4215, -4209, -4209, -4203, -4206,
+    -4200, -4200, -4194, -4191, -4188, -4185, -4179, -4179, -4176, -4173, -4170, -4167, -4164, -4161, -4155, -4155,
+    -4149, -4149, -4146, -4143, -4140, -4137, -4131, -4131, -4125, -4125, -4119, -4119, -4113, -4113, -4107, -4107,
+    -4101, -4101, -4095, -4095, -4089, -4089, -4083, -4083, -4077, -4074, -4071, -4071, -4065, -4065, -4059, -4059,
+    -4053, -4053, -4047, -4047, -4041, -4041, -4035, -4035, -4029, -4029, -4023, -4020, -4017, -4014, -4011, -4011,
+    -4005, -4005, -3999, -3996, -3993, -3990, -3987, -3984, -3978, -3978, -3972, -3972, -3966, -3966, -3960, -3960,
+    -3957, -3954, -3948, -3948, -3945, -3942, -3936, -3936, -3930, -3930, -3924, -3924, -3918, -3918, -3912, -3912,
+    -3906, -3906, -3900, -3900, -3894, -3894, -3888, -3885, -3882, -3882, -3876, -3876, -3870, -3870, -3864, -3864,
+    -3858, -3858, -3852, -3852, -3846, -3843, -3840, -3840, -3834, -3831, -3828, -3828, -3822, -3819, -3816, -3816,
+    -3810, -3810, -3804, -3804, -3798, -3795, -3792, -3789, -3786, -3783, -3780, -3777, -3774, -3771, -3768, -3765,
+    -3762, -3759, -3753, -3753, -3750, -3747, -3744, -3741, -3738, -3735, -3729, -3729, -3726, -3723, -3720, -3717,
+    -3714, -3711, -3708, -3705, -3699, -3699, -3693, -3693, -3687, -3687, -3681, -3681, -3675, -3675, -3669, -3669,
+    -3663, -3663, -3657, -3657, -3651, -3651, -3645, -3645, -3639, -3636, -3633, -3633, -3627, -3627, -3621, -3621,
+    -3615, -3612, -3609, -3606, -3603, -3603, -3597, -3594, -3591, -3591, -3585, -3582, -3579, -3576, -3573, -3570,
+    -3564, -3564, -3561, -3558, -3552, -3552, -3549, -3546, -3543, -3540, -3537, -3534, -3528, -3528, -3522, -3522,
+    -3516, -3516, -3510, -3510, -3504, -3504, -3498, -3498, -3492, -3492, -3486, -3486, -3480, -3480, -3474, -3474,
+    -3468, -3468, -3462, -3462, -3456, -3456, -3450, -3447, -3444, -3441, -3438, -3438, -3432, -3432, -3426, -3426,
+    -3420, -3420, -3414, -3414, -3408, -3408, -3402, -3402, -3396, -3396, -3393, -3390, -3384, -3384, -3378, -3378,
+    -3372, -3372, -3366, -3366, -3360, -3360, -3354, -3354, -3348, -3348, -3342, -3342, -3336, -3333, -3330, -3327,
+    -3324, -3324, -3318, -3318, -3312, -3309, -3306, -3303, -3300, -3297, -3294, -3291, -3288, -3285, -3282, -3279,
+    -3276, -3273, -3270, -3267, -3261, -3261, -3255, -3255, -3249, -3249, -3246, -3243, -3240, -3237, -3231, -3231,
+    -3228, -3225, -3219, -3219, -3216, -3213, -3207, -3207, -3201, -3201, -3195, -3195, -3189, -3189, -3183, -3183,
+    -3177, -3177, -3171, -3171, -3165, -3165, -3159, -3159, -3153, -3150, -3147, -3147, -3141, -3138, -3135, -3135,
+    -3129, -3126, -3123, -3123, -3117, -3114, -3111, -3108, -3105, -3102, -3099, -3096, -3093, -3090, -3087, -3084,
+    -3078, -3078, -3072, -3072, -3069, -3066, -3060, -3060, -3054, -3054, -3048, -3048, -3042, -3042, -3036, -3036,
+    -3030, -3030, -3024, -3024, -3018, -3018, -3015, -3012, -3006, -3006, -3000, -3000, -2994, -2991, -2988, -2988,
+    -2982, -2982, -2976, -2973, -2970, -2967, -2964, -2961, -2958, -2958, -2952, -2949, -2946, -2943, -2940, -2937,
+    -2934, -2931, -2928, -2925, -2922, -2919, -2916, -2913, -2910, -2907, -2904, -2901, -2898, -2895, -2889, -2889,
+    -2886, -2883, -2880, -2877, -2871, -2871, -2865, -2865, -2859, -2859, -2853, -2853, -2847, -2847, -2844, -2841,
+    -2838, -2835, -2829, -2829, -2823, -2823, -2817, -2817, -2811, -2811, -2805, -2802, -2799, -2796, -2793, -2790,
+    -2787, -2784, -2781, -2778, -2775, -2772, -2769, -2766, -2763, -2760, -2757, -2754, -2751, -2748, -2745, -2742,
+    -2739, -2736, -2730, -2730, -2727, -2724, -2721, -2718, -2715, -2712, -2706, -2706, -2700, -2700, -2694, -2694,
+    -2688, -2685, -2682, -2682, -2676, -2673, -2670, -2670, -2664, -2664, -2658, -2658, -2652, -2649, -2646, -2646,
+    -2640, -2640, -2634, -2634, -2628, -2628, -2622, -2622, -2619, -2613, -2610, -2610, -2604, -2601, -2598, -2598,
+    -2592, -2592, -2586, -2583, -2580, -2577, -2574, -2571, -2568, -2565, -2562, -2559, -2556, -2553, -2550, -2547,
+    -2544, -2541, -2538, -2535, -2532, -2529, -2526, -2523, -2520, -2517, -2514, -2511, -2505, -2505, -2502, -2499,
+    -2493, -2493, -2490, -2487, -2481, -2481, -2475, -2475, -2469, -2469, -2463, -2463, -2457, -2457, -2451, -2451,
+    -2445, -2445, -2439, -2436, -2433, -2430, -2427, -2424, -2421, -2418, -2415, -2412, -2409, -2406, -2403, -2400,
+    -2397, -2394, -2391, -2388, -2385, -2382, -2379, -2376, -2373, -2370, -2367, -2364, -2361, -2358, -2352, -2352,
+    -2346, -2346, -2340, -2340, -2334, -2334, -2328, -2328, -2325, -2322, -2316, -2316, -2310, -2310, -2304, -2304,
+    -2298, -2298, -2292, -2289, -2286, -2283, -2280, -2277, -2274, -2271, -2268, -2265, -2262, -2259, -2256, -2253,
+    -2250, -2247, -2244, -2241, -2238, -2235, -2232, -2229, -2226, -2223, -2217, -2217, -2214, -2211, -2208, -2205,
+    -2202, -2199, -2193, -2193, -2190, -2187, -2181, -2181, -2175, -2175, -2169, -2169, -2163, -2163, -2157, -2154,
+    -2151, -2151, -2145, -2142, -2139, -2136, -2133, -2130, -2127, -2124, -2121, -2118, -2115, -2112, -2109, -2106,
+    -2103, -2100, -2097, -2094, -2091, -2088, -2085, -2082, -2079, -2076, -2073, -2070, -2064, -2064, -2058, -2058,
+    -2055, -2052, -2046, -2043, -2040, -2037, -2034, -2034, -2028, -2025, -2022, -2022, -2016, -2013, -2010, -2007,
+    -2004, -2001, -1998, -1995, -1992, -1989, -1986, -1983, -1980, -1977, -1974, -1971, -1968, -1965, -1959, -1959,
+    -1956, -1953, -1947, -1947, -1941, -1941, -1935, -1935, -1932, -1929, -1923, -1923, -1917, -1917, -1911, -1911,
+    -1905, -1902, -1899, -1899, -1893, -1890, -1887, -1884, -1881, -1878, -1875, -1872, -1869, -1866, -1863, -1863,
+    -1857, -1857, -1851, -1851, -1845, -1842, -1839, -1836, -1833, -1830, -1827, -1824, -1821, -1818, -1815, -1812,
+    -1809, -1806, -1803, -1800, -1797, -1794, -1788, -1788, -1785, -1782, -1779, -1776, -1770, -1770, -1767, -1764,
+    -1761, -1758, -1755, -1752, -1746, -1746, -1740, -1737, -1737, -1731, -1728, -1725, -1722, -1719, -1716, -1713,
+    -1710, -1707, -1704, -1701, -1698, -1695, -1692, -1689, -1686, -1683, -1680, -1677, -1671, -1671, -1668, -1665,
+    -1662, -1659, -1656, -1653, -1650, -1647, -1644, -1641, -1635, -1632, -1632, -1629, -1623, -1623, -1617, -1614,
+    -1614, -1608, -1605, -1602, -1599, -1596, -1593, -1590, -1587, -1584, -1581, -1578, -1575, -1572, -1569, -1566,
+    -1563, -1560, -1557, -1554, -1551, -1548, -1545, -1542, -1539, -1536, -1533, -1530, -1527, -1524, -1521, -1518,
+    -1512, -1512, -1509, -1506, -1503, -1500, -1494, -1491, -1488, -1488, -1482, -1482, -1476, -1473, -1470, -1467,
+    -1464, -1461, -1458, -1455, -1452, -1449, -1446, -1443, -1440, -1437, -1434, -1431, -1428, -1425, -1422, -1419,
+    -1416, -1413, -1410, -1407, -1404, -1401, -1395, -1395, -1389, -1389, -1383, -1383, -1377, -1374, -1374, -1368,
+    -1365, -1362, -1359, -1356, -1353, -1350, -1347, -1344, -1341, -1338, -1335, -1332, -1329, -1326, -1323, -1320,
+    -1317, -1314, -1311, -1308, -1302, -1299, -1296, -1296, -1293, -1290, -1284, -1281, -1278, -1275, -1272, -1269,
+    -1266, -1263, -1260, -1257, -1254, -1251, -1248, -1245, -1242, -1239, -1236, -1230, -1230, -1227, -1221, -1221,
+    -1215, -1212, -1209, -1209, -1203, -1200, -1197, -1197, -1191, -1188, -1185, -1182, -1179, -1176, -1173, -1170,
+    -1167, -1164, -1161, -1158, -1155, -1152, -1149, -1146, -1143, -1140, -1134, -1131, -1131, -1125, -1122, -1122,
+    -1116, -1113, -1110, -1107, -1104, -1101, -1098, -1095, -1092, -1089, -1086, -1083, -1080, -1077, -1074, -1071,
+    -1068, -1065, -1062, -1059, -1053, -1053, -1050, -1047, -1041, -1038, -1035, -1032, -1029, -1026, -1023, -1020,
+    -1017, -1014, -1011, -1008, -1005, -1002, -999, -996, -993, -987, -984, -981, -978, -975, -972, -972,
+    -966, -963, -960, -957, -954, -951, -948, -945, -942, -939, -936, -930, -930, -927, -921, -918,
+    -915, -915, -909, -906, -903, -900, -897, -894, -891, -888, -882, -882, -876, -873, -870, -870,
+    -864, -861, -858, -855, -852, -849, -846, -843, -840, -837, -831, -831, -828, -825, -819, -816,
+    -813, -810, -807, -804, -801, -798, -795, -792, -789, -786, -783, -777, -774, -771, -768, -765,
+    -762, -759, -756, -753, -750, -747, -744, -738, -738, -732, -729, -726, -723, -720, -717, -714,
+    -711, -708, -705, -702, -696, -693, -690, -687, -684, -681, -678, -675, -672, -666, -663, -660,
+    -660, -654, -651, -648, -645, -642, -639, -636, -633, -627, -624, -621, -618, -615, -612, -609,
+    -603, -603, -597, -594, -591, -588, -585, -579, -579, -573, -570, -567, -564, -561, -555, -552,
+    -549, -546, -543, -540, -537, -534, -528, -525, -522, -519, -516, -510, -507, -504, -501, -498,
+    -492, -489, -486, -483, -477, -474, -471, -468, -465, -459, -456, -453, -447, -444, -438, -435,
+    -432, -426, -423, -420, -414, -411, -408, -402, -396, -393, -390, -384, -378, -372, -369, -360,
+    -357, -348, -345, -336, -330, -321, -309, -300, -288, -273, -258, -240, -225, -201, -189, -171,
+    -153, -129, -111, -90, -69, -48, -30, -9, 6, 30, 45, 69, 87, 114, 129, 147,
+    168, 186, 207, 228, 243, 261, 279, 300, 315, 330, 342, 360, 372, 390, 396, 411,
+    417, 429, 438, 447, 453, 462, 468, 477, 483, 489, 498, 504, 507, 516, 519, 528,
+    531, 537, 540, 546, 552, 558, 561, 567, 573, 576, 582, 588, 591, 597, 600, 603,
+    609, 615, 618, 621, 627, 630, 633, 639, 642, 648, 651, 654, 660, 663, 666, 672,
+    675, 681, 684, 687, 690, 696, 699, 705, 708, 711, 714, 720, 723, 726, 729, 735,
+    738, 741, 744, 750, 753, 756, 759, 765, 768, 771, 774, 777, 780, 786, 789, 792,
+    795, 801, 804, 807, 810, 816, 819, 822, 825, 828, 831, 837, 840, 843, 846, 849,
+    855, 858, 861, 864, 867, 870, 876, 879, 882, 885, 888, 894, 897, 900, 903, 906,
+    909, 912, 915, 921, 921, 927, 930, 936, 939, 942, 945, 948, 951, 954, 957, 960,
+    966, 969, 972, 975, 978, 981, 984, 990, 993, 996, 999, 1002, 1005, 1011, 1011, 1014,
+    1020, 1023, 1026, 1029, 1032, 1035, 1038, 1041, 1047, 1050, 1053, 1056, 1059, 1062, 1065, 1071,
+    1071, 1077, 1080, 1083, 1086, 1089, 1092, 1098, 1101, 1104, 1104, 1110, 1113, 1116, 1119, 1122,
+    1125, 1131, 1134, 1137, 1140, 1143, 1146, 1149, 1152, 1155, 1158, 1161, 1164, 1170, 1173, 1176,
+    1179, 1182, 1185, 1188, 1191, 1194, 1197, 1200, 1206, 1209, 1209, 1215, 1218, 1221, 1224, 1227,
+    1230, 1236, 1236, 1242, 1245, 1248, 1251, 1254, 1257, 1260, 1263, 1266, 1269, 1272, 1275, 1278,
+    1284, 1287, 1290, 1293, 1296, 1299, 1302, 1305, 1308, 1314, 1314, 1320, 1320, 1326, 1329, 1332,
+    1335, 1338, 1341, 1347, 1347, 1350, 1353, 1359, 1359, 1365, 1365, 1371, 1374, 1377, 1380, 1383,
+    1383, 1389, 1392, 1395, 1398, 1401, 1404, 1407, 1413, 1416, 1419, 1422, 1425, 1428, 1431, 1434,
+    1437, 1440, 1443, 1446, 1449, 1452, 1455, 1461, 1461, 1467, 1470, 1473, 1476, 1479, 1482, 1485,
+    1488, 1491, 1494, 1500, 1500, 1506, 1509, 1512, 1515, 1518, 1521, 1524, 1527, 1530, 1533, 1536,
+    1539, 1542, 1545, 1548, 1551, 1554, 1557, 1560, 1563, 1569, 1569, 1575, 1575, 1581, 1581, 1587,
+    1587, 1593, 1593, 1599, 1602, 1605, 1608, 1611, 1614, 1617, 1620, 1626, 1629, 1632, 1635, 1638,
+    1641, 1644, 1647, 1650, 1653, 1656, 1659, 1662, 1665, 1671, 1671, 1677, 1677, 1683, 1683, 1689,
+    1689, 1695, 1698, 1701, 1704, 1707, 1710, 1713, 1716, 1719, 1722, 1725, 1728, 1731, 1734, 1740,
+    1743, 1746, 1749, 1752, 1752, 1758, 1761, 1764, 1767, 1773, 1773, 1776, 1779, 1785, 1785, 1788,
+    1791, 1797, 1797, 1803, 1803, 1809, 1809, 1815, 1818, 1821, 1824, 1827, 1830, 1833, 1836, 1839,
+    1842, 1845, 1848, 1851, 1854, 1860, 1860, 1866, 1866, 1872, 1872, 1878, 1878, 1884, 1887, 1890,
+    1890, 1896, 1899, 1902, 1905, 1911, 1911, 1917, 1917, 1920, 1923, 1929, 1929, 1935, 1935, 1941,
+    1941, 1947, 1947, 1953, 1953, 1959, 1962, 1965, 1968, 1974, 1974, 1980, 1980, 1983, 1986, 1989,
+    1992, 1995, 1998, 2004, 2004, 2010, 2013, 2016, 2019, 2022, 2025, 2028, 2031, 2034, 2037, 2040,
+    2043, 2046, 2049, 2052, 2055, 2061, 2061, 2067, 2067, 2073, 2076, 2079, 2079, 2085, 2088, 2091,
+    2094, 2097, 2100, 2103, 2106, 2109, 2112, 2115, 2118, 2124, 2124, 2127, 2130, 2133, 2136, 2142,
+    2142, 2148, 2148, 2154, 2154, 2160, 2160, 2166, 2169, 2172, 2175, 2178, 2181, 2184, 2187, 2190,
+    2190, 2196, 2199, 2202, 2205, 2208, 2211, 2214, 2217, 2220, 2223, 2226, 2229, 2232, 2235, 2238,
+    2241, 2247, 2247, 2253, 2253, 2259, 2259, 2265, 2265, 2271, 2274, 2277, 2280, 2283, 2286, 2289,
+    2292, 2295, 2298, 2301, 2304, 2307, 2310, 2313, 2316, 2319, 2322, 2328, 2328, 2334, 2334, 2337,
+    2340, 2346, 2346, 2352, 2355, 2358, 2361, 2364, 2364, 2370, 2373, 2376, 2379, 2385, 2385, 2388,
+    2391, 2397, 2397, 2403, 2403, 2409, 2409, 2412, 2415, 2421, 2421, 2427, 2427, 2433, 2433, 2439,
+    2442, 2445, 2448, 2451, 2454, 2460, 2460, 2463, 2466, 2472, 2472, 2475, 2478, 2484, 2484, 2490,
+    2490, 2496, 2496, 2502, 2502, 2508, 2511, 2514, 2517, 2520, 2523, 2526, 2529, 2532, 2535, 2538,
+    2541, 2547, 2547, 2550, 2553, 2556, 2559, 2565, 2565, 2571, 2571, 2577, 2577, 2583, 2583, 2589,
+    2589, 2595, 2598, 2601, 2601, 2607, 2607, 2613, 2613, 2619, 2622, 2625, 2628, 2631, 2634, 2637,
+    2640, 2643, 2646, 2649, 2652, 2658, 2658, 2664, 2664, 2670, 2670, 2676, 2676, 2682, 2682, 2688,
+    2688, 2694, 2694, 2700, 2703, 2706, 2709, 2712, 2712, 2718, 2721, 2724, 2724, 2730, 2733, 2736,
+    2739, 2742, 2745, 2748, 2751, 2757, 2757, 2763, 2763, 2766, 2769, 2775, 2775, 2781, 2781, 2787,
+    2787, 2793, 2793, 2799, 2799, 2805, 2808, 2811, 2811, 2817, 2820, 2823, 2826, 2829, 2832, 2835,
+    2838, 2841, 2844, 2850, 2850, 2853, 2856, 2862, 2862, 2868, 2868, 2874, 2874, 2880, 2880, 2886,
+    2886, 2892, 2892, 2898, 2901, 2904, 2904, 2910, 2913, 2916, 2919, 2922, 2925, 2928, 2931, 2934,
+    2937, 2940, 2943, 2949, 2949, 2955, 2955, 2961, 2961, 2967, 2967, 2970, 2973, 2979, 2979, 2982,
+    2985, 2988, 2991, 2997, 2997, 3003, 3003, 3009, 3009, 3015, 3018, 3021, 3021, 3027, 3027, 3033,
+    3033, 3039, 3042, 3045, 3048, 3051, 3054, 3057, 3060, 3063, 3066, 3069, 3072, 3075, 3078, 3084,
+    3084, 3087, 3090, 3096, 3096, 3102, 3105, 3108, 3108, 3114, 3114, 3120, 3120, 3126, 3126, 3132,
+    3135, 3138, 3141, 3144, 3144, 3150, 3153, 3156, 3159, 3165, 3165, 3171, 3171, 3174, 3177, 3183,
+    3183, 3189, 3189, 3195, 3195, 3198, 3201, 3207, 3207, 3213, 3213, 3219, 3219, 3225, 3225, 3231,
+    3234, 3237, 3237, 3243, 3246, 3249, 3252, 3255, 3255, 3261, 3264, 3267, 3270, 3273, 3276, 3282,
+    3282, 3285, 3288, 3294, 3294, 3300, 3300, 3306, 3306, 3312, 3312, 3315, 3318, 3324, 3324, 3330,
+    3330, 3336, 3339, 3342, 3345, 3348, 3351, 3354, 3354, 3360, 3363, 3366, 3369, 3372, 3375, 3378,
+    3381, 3384, 3387, 3390, 3393, 3396, 3399, 3405, 3405, 3408, 3411, 3414, 3417, 3423, 3423, 3429,
+    3429, 3435, 3435, 3441, 3441, 3447, 3447, 3453, 3453, 3459, 3459, 3465, 3465, 3471, 3471, 3477,
+    3477, 3483, 3483, 3489, 3489, 3495, 3495, 3501, 3501, 3507, 3510, 3513, 3516, 3519, 3522, 3525,
+    3528, 3534, 3534, 3537, 3540, 3546, 3546, 3552, 3552, 3558, 3558, 3564, 3564, 3570, 3570, 3576,
+    3576, 3582, 3582, 3588, 3588, 3594, 3594, 3600, 3600, 3606, 3609, 3612, 3615, 3618, 3621, 3627,
+    3627, 3630, 3633, 3636, 3639, 3642, 3645, 3648, 3651, 3657, 3657, 3663, 3663, 3669, 3669, 3675,
+    3675, 3681, 3681, 3687, 3687, 3693, 3693, 3699, 3699, 3705, 3705, 3711, 3711, 3717, 3720, 3723,
+    3726, 3729, 3729, 3735, 3738, 3741, 3744, 3747, 3750, 3753, 3756, 3762, 3762, 3768, 3768, 3771,
+    3774, 3777, 3777, 3783, 3786, 3789, 3789, 3795, 3795, 3804, 3804, 3807, 3807, 3813, 3816, 3819,
+    3822, 3828, 3828, 3834, 3834, 3840, 3840, 3846, 3846, 3852, 3852, 3858, 3858, 3864, 3864, 3870,
+    3870, 3876, 3876, 3882, 3882, 3888, 3888, 3894, 3894, 3900, 3903, 3906, 3906, 3912, 3915, 3918,
+    3918, 3924, 3924, 3930, 3933, 3936, 3939, 3942, 3945, 3951, 3951, 3957, 3957, 3963, 3963, 3969,
+    3969, 3975, 3975, 3981, 3981, 3987, 3987, 3993, 3993, 3999, 3999, 4005, 4005, 4011, 4011, 4017,
+    4017, 4023, 4023, 4029, 4029, 4038, 4035, 4041, 4041, 4047, 4050, 4053, 4056, 4062, 4062, 4065,
+    4068, 4074, 4074, 4080, 4080, 4086, 4086, 4092, 4092, 4098, 4098, 4104, 4104, 4110, 4110, 4116,
+    4116, 4122, 4122, 4128, 4128, 4134, 4134, 4140, 4140, 4146, 4146, 4152, 4152, 4158, 4158, 4164,
+    4164, 4170, 4170, 4176, 4176, 4182, 4182, 4188, 4188, 4194, 4194, 4200, 4200, 4209, 4206, 4212,
+    4212, 4218, 4221, 4224, 4227, 4233, 4233, 4239, 4239, 4242, 4245, 4251, 4248, 4254, 4257, 4263,
+    4263, 4269, 4269, 4275, 4275, 4281, 4281, 4287, 4287, 4293, 4293, 4299, 4299, 4305, 4305, 4311,
+    4311, 4317, 4320, 4323, 4323, 4329, 4332, 4335, 4335, 4341, 4344, 4347, 4347, 4353, 4353, 4359,
+    4359, 4365, 4365, 4374, 4374, 4377, 4380, 4386, 4383, 4392, 4392, 4398, 4398, 4404, 4404, 4410,
+    4410, 4416, 4416, 4422, 4422, 4428, 4428, 4434, 4434, 4440, 4440, 4446, 4446, 4452, 4452, 4458,
+    4458, 4464, 4464, 4470, 4470, 4479, 4476, 4482, 4485, 4488, 4488, 4494, 4497, 4500, 4500, 4509,
+    4506, 4515, 4515, 4521, 4521, 4527, 4527, 4533, 4533, 4539, 4539, 4545, 4545, 4551, 4551, 4557,
+    4557, 4563, 4560, 4569, 4569, 4575, 4575, 4581, 4581, 4587, 4587, 4593, 4593, 4599, 4599, 4605,
+    4605, 4611, 4611, 4617, 4617, 4623, 4623, 4629, 4629, 4635, 4635, 4644, 4641, 4647, 4647, 4653,
+    4653, 4659, 4659, 4665, 4665, 4671, 4674, 4680, 4680, 4683, 4686, 4689, 4692, 4698, 4698, 4701,
+    4704, 4710, 4710, 4716, 4716, 4722, 4722, 4728, 4728, 4734, 4734, 4740, 4740, 4746, 4746, 4752,
+    4752, 4758, 4758, 4764, 4764, 4770, 4770, 4776, 4776, 4782, 4782, 4788, 4791, 4794, 4794, 4800,
+    4800, 4806, 4806, 4812, 4815, 4821, 4818, 4824, 4827, 4830, 4830, 4839, 4839, 4845, 4845, 4851,
+    4848, 4857, 4857, 4860, 4863, 4869, 4869, 4872, 4872, 4878, 4878, 4878, 4878, 4881, 4878, 4881,
+    4878, 4881, 4878, 4881, 4881, 4881, 4881, 4881, 4881, 4881, 4881, 4881, 4881, 4881, 4878, 4881,
+    4881, 4881, 4878, 4881, 4881, 4881, 4881, 4881, 4881, 4881, 4878, 4878, 4881, 4881, 4878, 4881,
+    4878, 4881, 4878, 4881, 4878, 4878, 4878, 4878, 4878, 4881, 4878, 4878, 4878, 4881, 4881, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4881, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4881, 4878, 4878, 4881, 4881, 4881, 4881, 4881,
+    4878, 4881, 4881, 4878, 4881, 4881, 4881, 4878, 4881, 4881, 4881, 4878, 4881, 4881, 4881, 4881,
+    4878, 4881, 4878, 4881, 4881, 4881, 4881, 4881, 4881, 4881, 4881, 4881, 4881, 4881, 4878, 4881,
+    4881, 4881, 4881, 4881, 4881, 4878, 4878, 4881, 4881, 4881, 4878, 4881, 4878, 4878, 4881, 4878,
+    4878, 4878, 4881, 4881, 4881, 4881, 4881, 4878, 4881, 4878, 4881, 4878, 4878, 4881, 4878, 4881,
+    4881, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4881, 4878, 4881, 4881,
+    4878, 4878, 4878, 4881, 4881, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4881, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4881, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4881, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+    4878, 4881, 4878, 4878, 4881, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4881, 4878, 4878,
+    4881, 4881, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878, 4878,
+};
+
+extern const int16_t DiodeFeedbackOneAndThreeShape[codeCount] = {
+    -4725, -4722, -4725, -4722, -4722, -4725, -4722, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4722, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4722, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4725, -4725, -4725, -4722, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4722, -4725, -4725, -4725, -4722, -4725, -4722, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4725, -4722, -4725, -4725, -4722, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4725,
+    -4725, -4725, -4722, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4722, -4725, -4725, -4725, -4725, -4725,
+    -4722, -4725, -4722, -4725, -4725, -4725, -4725, -4725, -4725, -4725, -4722, -4722, -4725, -4725, -4725, -4725,
+    -4722, -4725, -4722, -4722, -4725, -4722, -4722, -4725, -4725, -4722, -4725, -4725, -4722, -4725, -4722, -4722,
+    -4725, -4722, -4722, -4722, -4725, -4725, -4725, -4722, -4722, -4722, -4722, -4725, -4725, -4725, -4722, -4725,
+    -4722, -4725, -4722, -4725, -4722, -4722, -4725, -4722, -4722, -4725, -4722, -4725, -4722, -4725, -4725, -4725,
+    -4725, -4725, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4725, -4722, -4722, -4725, -4725, -4722, -4725,
+    -4722, -4722, -4725, -4722, -4722, -4722, -4722, -4722, -4725, -4725, -4722, -4722, -4722, -4722, -4725, -4722,
+    -4725, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4725, -4725, -4725, -4722, -4722, -4722,
+    -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4725, -4722, -4722, -4725, -4722, -4722, -4725, -4722, -4722,
+    -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722,
+    -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4725, -4722, -4722, -4722, -4722, -4722,
+    -4722, -4722, -4722, -4722, -4722, -4725, -4722, -4722, -4722, -4722, -4722, -4725, -4722, -4722, -4722, -4722,
+    -4722, -4722, -4725, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722,
+    -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4725, -4722, -4722, -4722, -4722,
+    -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722,
+    -4722, -4722, -4722, -4725, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722,
+    -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722,
+    -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722,
+    -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4722,
+    -4719, -4719, -4722, -4722, -4722, -4722, -4722, -4722, -4722, -4719, -4719, -4719, -4719, -4719, -4719, -4722,
+    -4719, -4719, -4719, -4719, -4719, -4722, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719,
+    -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4719, -4716, -4716,
+    -4719, -4716, -4716, -4716, -4719, -4716, -4716, -4719, -4716, -4716, -4716, -4716, -4716, -4716, -4716, -4716,
+    -4716, -4716, -4716, -4716, -4716, -4716, -4716, -4716, -4716, -4716, -4716, -4716, -4713, -4713, -4713, -4713,
+    -4716, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4713, -4710,
+    -4713, -4713, -4713, -4710, -4710, -4713, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710, -4710,
+    -4710, -4710, -4707, -4710, -4710, -4707, -4707, -4707, -4707, -4707, -4707, -4707, -4707, -4707, -4707, -4707,
+    -4707, -4707, -4704, -4704, -4704, -4704, -4704, -4704, -4704, -4704, -4704, -4704, -4701, -4701, -4701, -4701,
+    -4701, -4701, -4701, -4701, -4701, -4701, -4698, -4698, -4698, -4698, -4698, -4698, -4698, -4698, -4695, -4698,
+    -4695, -4695, -4695, -4695, -4695, -4695, -4692, -4692, -4692, -4692, -4692, -4692, -4692, -4692, -4689, -4689,
+    -4689, -4689, -4686, -4686, -4686, -4686, -4686, -4686, -4686, -4683, -4683, -4683, -4680, -4680, -4680, -4680,
+    -4680, -4680, -4677, -4677, -4674, -4674, -4674, -4674, -4671, -4671, -4668, -4668, -4668, -4668, -4665, -4665,
+    -4662, -4662, -4659, -4659, -4656, -4656, -4653, -4653, -4647, -4647, -4644, -4644, -4638, -4638, -4632, -4635,
+    -4629, -4629, -4623, -4623, -4617, -4617, -4611, -4611, -4605, -4605, -4599, -4599, -4593, -4593, -4587, -4587,
+    -4581, -4581, -4575, -4575, -4569, -4569, -4563, -4563, -4557, -4557, -4551, -4551, -4545, -4545, -4539, -4539,
+    -4533, -4533, -4527, -4527, -4521, -4518, -4515, -4515, -4509, -4509, -4503, -4503, -4497, -4494, -4491, -4491,
+    -4485, -4485, -4479, -4479, -4473, -4470, -4467, -4464, -4461, -4458, -4455, -4452, -4446, -4446, -4440, -4440,
+    -4437, -4434, -4428, -4431, -4425, -4422, -4416, -4416, -4410, -4410, -4404, -4404, -4398, -4398, -4392, -4392,
+    -4386, -4386, -4380, -4380, -4374, -4374, -4368, -4368, -4362, -4362, -4356, -4356, -4350, -4350, -4344, -4344,
+    -4338, -4338, -4332, -4332, -4326, -4326, -4320, -4320, -4314, -4314, -4308, -4308, -4302, -4302, -4296, -4293,
+    -4290, -4290, -4284, -4284, -4278, -4275, -4272, -4272, -4266, -4263, -4260, -4257, -4251, -4251, -4248, -4248,
+    -4239, -4239, -4233, -4233, -4227, -4227, -4224, -4221, -4215, -4218, -4209, -4209, -4206, -4203, -4197, -4200,
+    -4194, -4194, -4188, -4185, -4182, -4182, -4176, -4173, -4170, -4167, -4164, -4161, -4158, -4155, -4149, -4149,
+    -4146, -4143, -4137, -4137, -4134, -4131, -4128, -4125, -4119, -4119, -4113, -4113, -4107, -4107, -4101, -4101,
+    -4095, -4095, -4089, -4089, -4083, -4083, -4077, -4077, -4071, -4071, -4065, -4065, -4059, -4059, -4053, -4053,
+    -4047, -4047, -4041, -4041, -4035, -4035, -4029, -4029, -4023, -4023, -4017, -4017, -4011, -4008, -4005, -4005,
+    -3999, -3996, -3993, -3993, -3984, -3987, -3981, -3981, -3975, -3972, -3969, -3966, -3963, -3960, -3954, -3954,
+    -3951, -3948, -3945, -3942, -3936, -3936, -3933, -3930, -3924, -3924, -3918, -3918, -3912, -3912, -3906, -3906,
+    -3900, -3900, -3894, -3894, -3888, -3888, -3882, -3882, -3876, -3876, -3870, -3870, -3864, -3864, -3858, -3858,
+    -3852, -3852, -3846, -3846, -3840, -3840, -3834, -3831, -3828, -3828, -3822, -3819, -3816, -3813, -3810, -3810,
+    -3804, -3804, -3798, -3798, -3792, -3792, -3786, -3783, -3780, -3780, -3771, -3771, -3768, -3765, -3762, -3762,
+    -3756, -3753, -3750, -3750, -3741, -3741, -3738, -3735, -3729, -3729, -3726, -3723, -3717, -3717, -3711, -3711,
+    -3708, -3705, -3699, -3699, -3693, -3693, -3687, -3687, -3681, -3681, -3675, -3675, -3669, -3669, -3663, -3663,
+    -3657, -3657, -3651, -3651, -3645, -3645, -3639, -3639, -3633, -3630, -3627, -3627, -3621, -3621, -3615, -3615,
+    -3609, -3609, -3603, -3603, -3597, -3594, -3591, -3588, -3585, -3582, -3579, -3576, -3573, -3570, -3567, -3564,
+    -3561, -3558, -3555, -3552, -3546, -3546, -3543, -3540, -3534, -3534, -3531, -3528, -3525, -3522, -3516, -3519,
+    -3513, -3510, -3504, -3504, -3498, -3498, -3492, -3492, -3486, -3486, -3480, -3480, -3474, -3474, -3468, -3468,
+    -3462, -3462, -3456, -3456, -3450, -3450, -3444, -3444, -3438, -3438, -3432, -3429, -3426, -3426, -3420, -3420,
+    -3417, -3414, -3411, -3408, -3405, -3402, -3396, -3396, -3390, -3390, -3384, -3384, -3381, -3378, -3372, -3372,
+    -3366, -3366, -3360, -3360, -3354, -3351, -3348, -3348, -3342, -3342, -3336, -3333, -3330, -3330, -3324, -3324,
+    -3318, -3318, -3312, -3309, -3306, -3303, -3300, -3297, -3294, -3294, -3288, -3285, -3282, -3279, -3276, -3273,
+    -3270, -3267, -3261, -3261, -3258, -3255, -3252, -3249, -3243, -3243, -3240, -3237, -3231, -3231, -3228, -3225,
+    -3222, -3219, -3216, -3213, -3207, -3207, -3201, -3201, -3195, -3195, -3189, -3189, -3183, -3183, -3177, -3177,
+    -3171, -3171, -3165, -3162, -3159, -3159, -3153, -3150, -3147, -3144, -3141, -3138, -3135, -3135, -3129, -3126,
+    -3123, -3120, -3117, -3117, -3111, -3108, -3105, -3102, -3099, -3096, -3093, -3090, -3084, -3084, -3078, -3078,
+    -3075, -3072, -3069, -3066, -3063, -3060, -3054, -3054, -3048, -3048, -3042, -3042, -3036, -3036, -3030, -3030,
+    -3027, -3024, -3021, -3018, -3015, -3012, -3006, -3006, -3000, -3000, -2994, -2991, -2988, -2988, -2982, -2982,
+    -2976, -2973, -2970, -2967, -2964, -2964, -2958, -2958, -2952, -2949, -2946, -2943, -2940, -2937, -2934, -2931,
+    -2928, -2925, -2922, -2919, -2916, -2913, -2910, -2907, -2904, -2901, -2898, -2895, -2892, -2889, -2883, -2883,
+    -2880, -2877, -2871, -2871, -2865, -2865, -2862, -2859, -2853, -2853, -2850, -2847, -2841, -2841, -2835, -2835,
+    -2829, -2829, -2823, -2823, -2817, -2814, -2811, -2811, -2805, -2805, -2799, -2796, -2793, -2790, -2787, -2784,
+    -2781, -2778, -2775, -2772, -2769, -2766, -2763, -2760, -2757, -2754, -2751, -2748, -2745, -2742, -2739, -2739,
+    -2733, -2730, -2724, -2724, -2721, -2718, -2715, -2712, -2709, -2706, -2700, -2700, -2694, -2694, -2691, -2688,
+    -2685, -2682, -2676, -2676, -2673, -2670, -2664, -2664, -2658, -2658, -2652, -2652, -2646, -2643, -2640, -2640,
+    -2634, -2634, -2631, -2628, -2625, -2622, -2616, -2616, -2610, -2610, -2604, -2604, -2598, -2598, -2592, -2592,
+    -2586, -2586, -2580, -2577, -2574, -2571, -2568, -2565, -2562, -2562, -2556, -2556, -2550, -2547, -2544, -2541,
+    -2538, -2535, -2532, -2529, -2526, -2523, -2520, -2517, -2514, -2511, -2508, -2505, -2502, -2499, -2493, -2493,
+    -2490, -2487, -2481, -2481, -2478, -2475, -2469, -2469, -2463, -2463, -2457, -2457, -2451, -2451, -2445, -2445,
+    -2439, -2439, -2433, -2433, -2427, -2424, -2421, -2421, -2415, -2412, -2409, -2406, -2403, -2400, -2397, -2394,
+    -2391, -2388, -2385, -2382, -2379, -2376, -2373, -2370, -2367, -2364, -2361, -2358, -2355, -2352, -2349, -2346,
+    -2343, -2340, -2337, -2334, -2328, -2328, -2322, -2322, -2319, -2316, -2310, -2307, -2304, -2304, -2298, -2298,
+    -2292, -2292, -2286, -2283, -2280, -2277, -2274, -2274, -2265, -2265, -2262, -2259, -2256, -2253, -2250, -2247,
+    -2244, -2244, -2238, -2235, -2232, -2229, -2226, -2223, -2220, -2217, -2214, -2211, -2208, -2205, -2202, -2199,
+    -2196, -2193, -2187, -2187, -2181, -2178, -2175, -2172, -2169, -2169, -2166, -2163, -2157, -2154, -2151, -2148,
+    -2145, -2145, -2142, -2136, -2133, -2130, -2127, -2124, -2121, -2118, -2115, -2112, -2109, -2106, -2103, -2100,
+    -2097, -2094, -2091, -2088, -2085, -2082, -2076, -2076, -2073, -2070, -2067, -2064, -2058, -2058, -2052, -2052,
+    -2049, -2046, -2040, -2040, -2034, -2031, -2028, -2025, -2022, -2019, -2016, -2013, -2010, -2010, -2004, -2004,
+    -1998, -1995, -1992, -1989, -1986, -1983, -1980, -1977, -1974, -1971, -1968, -1965, -1962, -1959, -1956, -1953,
+    -1950, -1947, -1944, -1941, -1935, -1935, -1929, -1929, -1926, -1923, -1920, -1917, -1911, -1911, -1905, -1905,
+    -1899, -1899, -1893, -1893, -1887, -1887, -1881, -1878, -1875, -1872, -1869, -1866, -1863, -1860, -1857, -1857,
+    -1851, -1851, -1848, -1845, -1839, -1836, -1833, -1833, -1827, -1824, -1821, -1818, -1815, -1812, -1809, -1806,
+    -1803, -1800, -1797, -1794, -1791, -1788, -1785, -1782, -1779, -1776, -1773, -1770, -1767, -1764, -1761, -1758,
+    -1755, -1752, -1749, -1746, -1743, -1740, -1734, -1734, -1728, -1728, -1722, -1722, -1716, -1713, -1710, -1710,
+    -1704, -1701, -1698, -1695, -1692, -1689, -1686, -1683, -1680, -1677, -1674, -1671, -1668, -1665, -1662, -1659,
+    -1656, -1653, -1650, -1647, -1644, -1641, -1635, -1635, -1629, -1629, -1623, -1623, -1617, -1614, -1611, -1608,
+    -1605, -1602, -1599, -1596, -1596, -1590, -1587, -1584, -1581, -1578, -1575, -1572, -1569, -1566, -1563, -1560,
+    -1557, -1554, -1551, -1548, -1545, -1542, -1539, -1536, -1533, -1530, -1527, -1524, -1521, -1518, -1512, -1512,
+    -1509, -1506, -1503, -1500, -1497, -1494, -1491, -1485, -1482, -1479, -1476, -1473, -1470, -1467, -1464, -1464,
+    -1458, -1455, -1452, -1449, -1446, -1443, -1440, -1437, -1434, -1431, -1428, -1425, -1422, -1419, -1416, -1413,
+    -1410, -1407, -1404, -1401, -1398, -1395, -1392, -1389, -1386, -1380, -1380, -1374, -1374, -1368, -1365, -1365,
+    -1359, -1356, -1353, -1350, -1347, -1344, -1341, -1338, -1335, -1332, -1329, -1326, -1323, -1320, -1317, -1314,
+    -1311, -1305, -1305, -1302, -1296, -1296, -1290, -1287, -1284, -1281, -1278, -1275, -1272, -1269, -1266, -1263,
+    -1260, -1257, -1254, -1251, -1248, -1245, -1242, -1239, -1236, -1233, -1230, -1227, -1224, -1221, -1218, -1212,
+    -1209, -1206, -1203, -1200, -1200, -1197, -1191, -1188, -1185, -1182, -1179, -1176, -1173, -1170, -1167, -1164,
+    -1161, -1158, -1155, -1152, -1149, -1146, -1143, -1140, -1137, -1134, -1131, -1125, -1122, -1119, -1116, -1113,
+    -1110, -1107, -1104, -1101, -1098, -1095, -1092, -1089, -1083, -1083, -1080, -1077, -1074, -1068, -1068, -1065,
+    -1062, -1059, -1053, -1050, -1050, -1044, -1044, -1041, -1038, -1032, -1029, -1026, -1023, -1020, -1017, -1014,
+    -1011, -1008, -1005, -1002, -996, -996, -990, -987, -984, -984, -978, -975, -972, -969, -966, -963,
+    -960, -957, -954, -951, -948, -945, -942, -939, -933, -933, -927, -927, -921, -918, -915, -915,
+    -909, -906, -903, -900, -897, -894, -891, -888, -885, -879, -879, -876, -870, -867, -864, -861,
+    -858, -855, -852, -849, -846, -843, -840, -837, -834, -831, -828, -822, -819, -819, -813, -810,
+    -807, -804, -801, -798, -795, -792, -789, -783, -783, -777, -774, -771, -768, -765, -762, -759,
+    -756, -753, -747, -744, -741, -738, -735, -732, -732, -726, -723, -720, -717, -714, -711, -708,
+    -705, -699, -696, -693, -690, -687, -684, -681, -675, -672, -672, -666, -663, -660, -657, -654,
+    -651, -648, -645, -639, -636, -633, -630, -630, -624, -621, -618, -615, -612, -609, -603, -600,
+    -597, -594, -591, -588, -585, -579, -576, -573, -570, -567, -564, -561, -555, -552, -549, -546,
+    -543, -540, -534, -531, -528, -525, -522, -516, -513, -510, -507, -501, -498, -495, -492, -489,
+    -486, -480, -477, -474, -468, -465, -462, -456, -453, -450, -447, -441, -438, -432, -429, -426,
+    -420, -417, -414, -408, -402, -396, -393, -387, -384, -378, -372, -366, -360, -351, -345, -336,
+    -327, -318, -309, -297, -282, -270, -252, -231, -216, -195, -177, -156, -138, -114, -96, -81,
+    -60, -36, -18, 3, 18, 39, 60, 84, 102, 120, 144, 162, 183, 204, 222, 243,
+    261, 279, 297, 318, 336, 357, 375, 396, 414, 435, 453, 471, 489, 507, 525, 543,
+    558, 576, 588, 603, 618, 630, 639, 654, 660, 678, 687, 696, 705, 714, 723, 732,
+    741, 750, 756, 765, 771, 777, 783, 792, 798, 807, 810, 819, 825, 831, 834, 840,
+    846, 852, 858, 864, 870, 873, 879, 885, 888, 897, 900, 906, 909, 915, 921, 924,
+    930, 933, 939, 942, 948, 954, 957, 963, 966, 972, 975, 981, 984, 990, 993, 996,
+    999, 1005, 1008, 1014, 1017, 1023, 1026, 1032, 1035, 1041, 1044, 1047, 1053, 1056, 1059, 1065,
+    1068, 1071, 1077, 1080, 1083, 1089, 1092, 1098, 1101, 1104, 1107, 1113, 1116, 1122, 1125, 1128,
+    1131, 1134, 1137, 1146, 1146, 1152, 1155, 1158, 1164, 1167, 1170, 1173, 1176, 1182, 1185, 1188,
+    1194, 1197, 1200, 1203, 1206, 1212, 1215, 1218, 1221, 1227, 1230, 1233, 1236, 1239, 1242, 1248,
+    1251, 1254, 1260, 1263, 1266, 1269, 1272, 1278, 1281, 1284, 1287, 1290, 1293, 1299, 1302, 1305,
+    1308, 1314, 1317, 1320, 1323, 1329, 1329, 1335, 1338, 1341, 1344, 1350, 1353, 1356, 1359, 1362,
+    1365, 1371, 1374, 1377, 1380, 1383, 1386, 1392, 1395, 1398, 1401, 1407, 1407, 1413, 1416, 1419,
+    1422, 1428, 1428, 1431, 1437, 1440, 1443, 1446, 1449, 1455, 1458, 1461, 1464, 1467, 1470, 1476,
+    1476, 1482, 1485, 1488, 1491, 1494, 1497, 1503, 1506, 1509, 1512, 1515, 1518, 1524, 1527, 1527,
+    1530, 1536, 1539, 1542, 1545, 1548, 1551, 1557, 1560, 1563, 1563, 1569, 1572, 1575, 1578, 1581,
+    1584, 1590, 1590, 1596, 1599, 1602, 1608, 1611, 1614, 1617, 1620, 1623, 1626, 1629, 1632, 1635,
+    1638, 1644, 1644, 1650, 1653, 1656, 1659, 1662, 1665, 1671, 1671, 1677, 1680, 1683, 1686, 1689,
+    1692, 1695, 1698, 1704, 1704, 1710, 1713, 1716, 1719, 1722, 1725, 1728, 1731, 1737, 1737, 1740,
+    1743, 1749, 1752, 1755, 1758, 1764, 1764, 1767, 1770, 1776, 1779, 1782, 1785, 1788, 1791, 1797,
+    1797, 1800, 1806, 1809, 1812, 1815, 1818, 1821, 1824, 1827, 1830, 1836, 1836, 1842, 1845, 1848,
+    1851, 1854, 1857, 1860, 1863, 1869, 1869, 1875, 1878, 1881, 1884, 1887, 1890, 1893, 1896, 1899,
+    1902, 1905, 1908, 1914, 1917, 1920, 1923, 1926, 1929, 1932, 1935, 1938, 1944, 1947, 1947, 1953,
+    1956, 1959, 1962, 1965, 1968, 1974, 1974, 1980, 1980, 1986, 1986, 1992, 1995, 1998, 2001, 2007,
+    2007, 2013, 2013, 2016, 2019, 2025, 2028, 2031, 2034, 2037, 2040, 2043, 2046, 2049, 2052, 2058,
+    2058, 2064, 2067, 2070, 2073, 2076, 2079, 2082, 2085, 2091, 2091, 2097, 2097, 2103, 2106, 2109,
+    2109, 2115, 2115, 2121, 2124, 2127, 2130, 2133, 2136, 2142, 2142, 2148, 2148, 2154, 2157, 2160,
+    2160, 2166, 2169, 2172, 2175, 2178, 2181, 2187, 2187, 2193, 2196, 2199, 2202, 2205, 2208, 2211,
+    2214, 2217, 2220, 2223, 2226, 2232, 2235, 2238, 2238, 2244, 2244, 2250, 2253, 2256, 2259, 2262,
+    2265, 2268, 2271, 2277, 2277, 2283, 2286, 2289, 2292, 2295, 2298, 2301, 2304, 2310, 2310, 2313,
+    2316, 2322, 2322, 2328, 2328, 2334, 2337, 2340, 2340, 2346, 2349, 2352, 2355, 2358, 2361, 2364,
+    2367, 2370, 2376, 2379, 2382, 2385, 2388, 2391, 2391, 2397, 2400, 2403, 2406, 2412, 2412, 2415,
+    2418, 2424, 2424, 2427, 2430, 2436, 2439, 2442, 2445, 2448, 2451, 2454, 2457, 2460, 2463, 2466,
+    2469, 2475, 2478, 2481, 2481, 2487, 2490, 2493, 2496, 2499, 2502, 2505, 2508, 2514, 2514, 2517,
+    2517, 2523, 2526, 2529, 2532, 2535, 2538, 2544, 2544, 2547, 2550, 2556, 2556, 2562, 2565, 2568,
+    2571, 2574, 2577, 2580, 2583, 2586, 2589, 2592, 2595, 2601, 2601, 2607, 2607, 2613, 2616, 2619,
+    2619, 2625, 2628, 2631, 2634, 2637, 2640, 2643, 2646, 2649, 2652, 2655, 2658, 2664, 2664, 2670,
+    2670, 2676, 2679, 2682, 2685, 2688, 2691, 2694, 2697, 2700, 2703, 2706, 2709, 2715, 2715, 2721,
+    2721, 2727, 2727, 2733, 2736, 2739, 2742, 2745, 2745, 2751, 2751, 2757, 2760, 2763, 2766, 2769,
+    2772, 2778, 2778, 2784, 2784, 2790, 2793, 2796, 2799, 2802, 2802, 2808, 2811, 2814, 2817, 2820,
+    2823, 2826, 2829, 2835, 2835, 2841, 2841, 2847, 2847, 2853, 2856, 2859, 2859, 2865, 2868, 2871,
+    2874, 2877, 2880, 2886, 2886, 2892, 2892, 2898, 2898, 2904, 2904, 2910, 2910, 2916, 2919, 2922,
+    2922, 2928, 2928, 2934, 2937, 2940, 2943, 2946, 2949, 2952, 2955, 2958, 2961, 2967, 2967, 2973,
+    2973, 2979, 2979, 2985, 2985, 2991, 2991, 2997, 3000, 3003, 3006, 3009, 3012, 3018, 3018, 3021,
+    3024, 3030, 3030, 3036, 3036, 3042, 3042, 3048, 3048, 3054, 3054, 3060, 3063, 3066, 3069, 3072,
+    3075, 3081, 3081, 3084, 3087, 3090, 3093, 3099, 3102, 3105, 3105, 3111, 3111, 3117, 3117, 3123,
+    3126, 3129, 3132, 3135, 3138, 3141, 3144, 3147, 3150, 3153, 3156, 3162, 3162, 3168, 3168, 3174,
+    3174, 3180, 3180, 3186, 3186, 3192, 3195, 3198, 3198, 3204, 3207, 3210, 3213, 3219, 3219, 3222,
+    3225, 3231, 3231, 3237, 3237, 3243, 3243, 3249, 3252, 3255, 3255, 3261, 3264, 3267, 3270, 3273,
+    3276, 3279, 3282, 3288, 3288, 3294, 3294, 3300, 3300, 3306, 3306, 3312, 3312, 3318, 3321, 3324,
+    3324, 3330, 3330, 3336, 3336, 3342, 3345, 3348, 3351, 3354, 3357, 3360, 3363, 3366, 3369, 3372,
+    3375, 3381, 3381, 3387, 3387, 3393, 3393, 3399, 3399, 3405, 3405, 3411, 3414, 3417, 3420, 3423,
+    3423, 3429, 3432, 3435, 3435, 3444, 3444, 3447, 3450, 3453, 3456, 3462, 3462, 3468, 3468, 3474,
+    3474, 3477, 3480, 3486, 3486, 3492, 3495, 3498, 3498, 3504, 3507, 3510, 3510, 3516, 3516, 3522,
+    3525, 3528, 3531, 3534, 3537, 3543, 3543, 3549, 3549, 3552, 3555, 3561, 3561, 3567, 3567, 3573,
+    3573, 3579, 3582, 3585, 3588, 3591, 3591, 3597, 3600, 3603, 3606, 3609, 3612, 3618, 3618, 3624,
+    3624, 3630, 3630, 3636, 3636, 3642, 3642, 3648, 3648, 3654, 3657, 3660, 3663, 3666, 3669, 3672,
+    3675, 3678, 3681, 3684, 3687, 3693, 3693, 3699, 3699, 3705, 3705, 3711, 3711, 3717, 3717, 3723,
+    3723, 3729, 3729, 3735, 3735, 3741, 3741, 3747, 3747, 3753, 3753, 3759, 3762, 3765, 3765, 3771,
+    3771, 3777, 3780, 3783, 3786, 3792, 3792, 3798, 3798, 3804, 3804, 3810, 3810, 3816, 3816, 3822,
+    3822, 3828, 3828, 3834, 3834, 3840, 3840, 3846, 3846, 3852, 3855, 3858, 3861, 3864, 3867, 3873,
+    3873, 3879, 3879, 3885, 3885, 3888, 3891, 3897, 3897, 3903, 3903, 3909, 3909, 3915, 3915, 3921,
+    3924, 3927, 3930, 3933, 3933, 3939, 3942, 3945, 3948, 3951, 3954, 3960, 3960, 3966, 3966, 3972,
+    3972, 3978, 3978, 3984, 3984, 3990, 3990, 3996, 3996, 4002, 4002, 4008, 4008, 4014, 4017, 4020,
+    4023, 4026, 4029, 4032, 4035, 4038, 4041, 4047, 4047, 4050, 4053, 4059, 4059, 4065, 4065, 4068,
+    4071, 4077, 4077, 4083, 4083, 4089, 4089, 4095, 4095, 4101, 4104, 4107, 4110, 4113, 4116, 4119,
+    4119, 4125, 4125, 4131, 4131, 4137, 4137, 4143, 4143, 4149, 4149, 4155, 4155, 4161, 4164, 4167,
+    4170, 4173, 4176, 4182, 4182, 4188, 4188, 4194, 4194, 4200, 4200, 4206, 4206, 4212, 4212, 4218,
+    4218, 4224, 4224, 4230, 4230, 4236, 4236, 4245, 4242, 4248, 4248, 4257, 4257, 4263, 4263, 4266,
+    4269, 4275, 4275, 4281, 4281, 4287, 4287, 4293, 4293, 4299, 4299, 4305, 4305, 4311, 4311, 4317,
+    4317, 4323, 4323, 4329, 4329, 4335, 4338, 4341, 4341, 4350, 4350, 4353, 4356, 4362, 4362, 4368,
+    4368, 4374, 4374, 4380, 4380, 4386, 4386, 4392, 4392, 4398, 4398, 4404, 4404, 4410, 4410, 4416,
+    4416, 4422, 4422, 4428, 4428, 4434, 4434, 4440, 4440, 4449, 4446, 4455, 4455, 4461, 4461, 4467,
+    4467, 4473, 4473, 4479, 4479, 4485, 4485, 4491, 4491, 4497, 4497, 4503, 4503, 4509, 4512, 4515,
+    4515, 4521, 4521, 4527, 4527, 4533, 4533, 4539, 4539, 4545, 4548, 4551, 4554, 4557, 4560, 4566,
+    4563, 4569, 4572, 4578, 4578, 4581, 4584, 4587, 4590, 4596, 4596, 4602, 4602, 4608, 4608, 4614,
+    4614, 4620, 4620, 4626, 4626, 4632, 4632, 4638, 4641, 4644, 4647, 4653, 4653, 4656, 4659, 4665,
+    4665, 4671, 4671, 4677, 4677, 4683, 4683, 4689, 4689, 4692, 4695, 4701, 4701, 4707, 4707, 4713,
+    4713, 4719, 4719, 4725, 4725, 4731, 4731, 4737, 4740, 4743, 4746, 4749, 4749, 4758, 4755, 4764,
+    4764, 4767, 4770, 4773, 4776, 4782, 4782, 4788, 4788, 4794, 4794, 4800, 4800, 4806, 4806, 4812,
+    4812, 4818, 4818, 4824, 4824, 4830, 4830, 4836, 4836, 4842, 4842, 4848, 4851, 4854, 4857, 4863,
+    4863, 4869, 4869, 4875, 4875, 4878, 4881, 4887, 4887, 4893, 4893, 4899, 4899, 4905, 4905, 4908,
+    4908, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4908, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+    4911, 4911, 4908, 4908, 4908, 4911, 4911, 4911, 4911, 4908, 4911, 4911, 4908, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4908, 4911, 4908, 4911, 4911, 4908, 4911, 4908, 4908, 4911, 4911, 4911,
+    4911, 4911, 4908, 4908, 4908, 4911, 4911, 4908, 4911, 4908, 4908, 4911, 4908, 4908, 4908, 4908,
+    4908, 4911, 4908, 4911, 4908, 4908, 4911, 4911, 4908, 4908, 4911, 4908, 4911, 4911, 4908, 4911,
+    4908, 4908, 4908, 4911, 4911, 4908, 4908, 4911, 4911, 4911, 4911, 4911, 4908, 4911, 4908, 4911,
+    4911, 4911, 4908, 4908, 4911, 4908, 4908, 4911, 4908, 4908, 4911, 4908, 4911, 4911, 4908, 4908,
+    4908, 4911, 4911, 4908, 4911, 4908, 4911, 4911, 4908, 4908, 4911, 4911, 4911, 4908, 4908, 4908,
+    4908, 4911, 4908, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4908, 4908, 4908, 4908, 4911, 4908,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4908, 4911,
+    4911, 4911, 4908, 4911, 4911, 4911, 4911, 4908, 4908, 4911, 4908, 4911, 4911, 4911, 4911, 4911,
+    4908, 4911, 4911, 4911, 4911, 4908, 4911, 4908, 4911, 4911, 4911, 4911, 4911, 4908, 4911, 4911,
+    4911, 4911, 4908, 4911, 4908, 4911, 4911, 4911, 4908, 4908, 4911, 4911, 4908, 4911, 4911, 4911,
+    4911, 4911, 4908, 4911, 4908, 4911, 4911, 4911, 4911, 4908, 4911, 4911, 4908, 4911, 4908, 4911,
+    4911, 4911, 4911, 4908, 4908, 4911, 4908, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4908, 4908,
+    4908, 4908, 4911, 4908, 4911, 4911, 4908, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+    4908, 4908, 4908, 4908, 4911, 4908, 4911, 4911, 4911, 4908, 4911, 4908, 4908, 4911, 4908, 4908,
+    4908, 4911, 4911, 4908, 4908, 4908, 4908, 4911, 4911, 4911, 4911, 4911, 4911, 4908, 4908, 4908,
+    4908, 4908, 4908, 4908, 4908, 4911, 4911, 4911, 4908, 4911, 4911, 4911, 4908, 4908, 4911, 4908,
+    4908, 4908, 4908, 4908, 4908, 4908, 4908, 4908, 4911, 4911, 4911, 4908, 4911, 4908, 4911, 4908,
+    4908, 4908, 4908, 4908, 4908, 4908, 4911, 4908, 4908, 4911, 4911, 4908, 4911, 4908, 4911, 4908,
+    4908, 4911, 4908, 4908, 4908, 4908, 4908, 4911, 4911, 4911, 4911, 4908, 4911, 4908, 4911, 4908,
+    4911, 4911, 4908, 4908, 4908, 4908, 4911, 4908, 4911, 4911, 4911, 4911, 4908, 4911, 4911, 4908,
+    4908, 4908, 4908, 4908, 4908, 4911, 4911, 4911, 4908, 4911, 4908, 4908, 4908, 4911, 4911, 4911,
+    4911, 4908, 4908, 4908, 4908, 4911, 4908, 4911, 4911, 4908, 4911, 4908, 4908, 4908, 4908, 4908,
+    4908, 4911, 4911, 4908, 4908, 4908, 4908, 4908, 4911, 4908, 4911, 4911, 4911, 4911, 4911, 4908,
+    4908, 4908, 4911, 4908, 4911, 4908, 4911, 4911, 4908, 4908, 4911, 4908, 4908, 4911, 4911, 4908,
+    4911, 4908, 4908, 4908, 4908, 4908, 4911, 4911, 4911, 4908, 4911, 4911, 4911, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4908,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4908, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4908, 4911, 4911, 4911, 4911,
+    4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911, 4911,
+};
+
+extern const int16_t Vca1[codeCount] = {
+    -4461, -4467, -4470, -4470, -4470, -4470, -4470, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473,
+    -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473,
+    -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473,
+    -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473,
+    -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473,
+    -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473,
+    -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4473, -4470, -4470, -4470, -4470, -4470, -4470, -4470,
+    -4470, -4470, -4470, -4470, -4470, -4470, -4470, -4470, -4470, -4470, -4470, -4470, -4470, -4470, -4470, -4470,
+    -4470, -4470, -4470, -4470, -4470, -4470, -4470, -4470, -4470, -4470, -4470, -4470, -4470, -4470, -4470, -4470,
+    -4470, -4467, -4467, -4467, -4467, -4467, -4467, -4467, -4467, -4467, -4467, -4467, -4467, -4467, -4467, -4467,
+    -4467, -4467, -4467, -4467, -4467, -4467, -4467, -4467, -4467, -4467, -4467, -4467, -4467, -4467, -4467, -4467,
+    -4467, -4467, -4467, -4467, -4467, -4464, -4464, -4464, -4464, -4464, -4464, -4464, -4464, -4464, -4464, -4464,
+    -4464, -4464, -4464, -4464, -4464, -4464, -4464, -4464, -4464, -4464, -4464, -4464, -4464, -4464, -4464, -4464,
+    -4464, -4461, -4464, -4461, -4464, -4461, -4461, -4461, -4461, -4461, -4461, -4461, -4461, -4461, -4461, -4461,
+    -4461, -4461, -4461, -4461, -4461, -4461, -4461, -4461, -4461, -4461, -4461, -4461, -4461, -4458, -4458, -4458,
+    -4458, -4458, -4458, -4458, -4458, -4458, -4458, -4458, -4458, -4458, -4458, -4458, -4458, -4458, -4458, -4458,
+    -4458, -4458, -4458, -4458, -4455, -4455, -4455, -4455, -4455, -4455, -4455, -4455, -4455, -4455, -4455, -4455,
+    -4455, -4455, -4455, -4455, -4455, -4455, -4455, -4452, -4452, -4452, -4452, -4452, -4452, -4452, -4452, -4452,
+    -4452, -4452, -4452, -4452, -4452, -4452, -4452, -4452, -4449, -4452, -4449, -4449, -4449, -4449, -4449, -4449,
+    -4449, -4449, -4449, -4449, -4446, -4446, -4449, -4446, -4446, -4446, -4446, -4446, -4446, -4443, -4446, -4443,
+    -4443, -4446, -4443, -4443, -4443, -4443, -4443, -4443, -4443, -4443, -4440, -4440, -4440, -4440, -4440, -4440,
+    -4440, -4440, -4440, -4437, -4440, -4437, -4437, -4437, -4434, -4437, -4437, -4434, -4434, -4434, -4434, -4431,
+    -4434, -4431, -4431, -4431, -4431, -4431, -4428, -4428, -4428, -4428, -4428, -4425, -4422, -4425, -4422, -4422,
+    -4419, -4422, -4419, -4416, -4416, -4416, -4416, -4413, -4413, -4410, -4407, -4407, -4407, -4404, -4404, -4401,
+    -4401, -4398, -4395, -4395, -4389, -4389, -4389, -4383, -4386, -4380, -4380, -4374, -4374, -4371, -4371, -4368,
+    -4368, -4362, -4362, -4356, -4356, -4353, -4353, -4347, -4347, -4344, -4344, -4338, -4338, -4332, -4332, -4329,
+    -4329, -4323, -4323, -4317, -4317, -4314, -4314, -4308, -4308, -4302, -4302, -4299, -4299, -4293, -4293, -4287,
+    -4287, -4284, -4284, -4278, -4278, -4272, -4272, -4269, -4269, -4263, -4263, -4257, -4257, -4254, -4254, -4248,
+    -4248, -4245, -4245, -4239, -4239, -4233, -4233, -4230, -4227, -4224, -4224, -4218, -4218, -4215, -4212, -4209,
+    -4209, -4203, -4203, -4200, -4197, -4194, -4194, -4188, -4188, -4182, -4182, -4179, -4179, -4173, -4173, -4170,
+    -4167, -4164, -4164, -4158, -4158, -4152, -4152, -4149, -4149, -4143, -4143, -4140, -4140, -4134, -4134, -4128,
+    -4128, -4122, -4122, -4119, -4116, -4113, -4113, -4107, -4107, -4104, -4104, -4098, -4098, -4092, -4092, -4089,
+    -4089, -4086, -4083, -4080, -4080, -4074, -4074, -4068, -4068, -4065, -4065, -4059, -4059, -4053, -4053, -4050,
+    -4050, -4044, -4044, -4038, -4038, -4035, -4032, -4029, -4029, -4023, -4023, -4020, -4017, -4014, -4014, -4008,
+    -4008, -4005, -4002, -3999, -3999, -3993, -3993, -3987, -3987, -3984, -3984, -3978, -3978, -3972, -3972, -3969,
+    -3966, -3963, -3963, -3957, -3957, -3951, -3951, -3948, -3948, -3942, -3942, -3939, -3936, -3933, -3933, -3927,
+    -3927, -3924, -3921, -3918, -3918, -3912, -3912, -3906, -3906, -3903, -3903, -3897, -3897, -3891, -3891, -3888,
+    -3885, -3882, -3882, -3876, -3876, -3873, -3870, -3867, -3867, -3861, -3861, -3855, -3855, -3852, -3849, -3846,
+    -3846, -3840, -3840, -3834, -3834, -3831, -3831, -3825, -3825, -3822, -3819, -3816, -3816, -3810, -3810, -3804,
+    -3804, -3801, -3801, -3795, -3795, -3789, -3789, -3786, -3783, -3780, -3780, -3774, -3774, -3768, -3768, -3765,
+    -3765, -3759, -3759, -3753, -3753, -3750, -3750, -3744, -3744, -3738, -3738, -3735, -3732, -3729, -3729, -3723,
+    -3723, -3717, -3717, -3714, -3711, -3708, -3708, -3702, -3702, -3699, -3696, -3693, -3693, -3687, -3687, -3684,
+    -3681, -3678, -3678, -3672, -3672, -3666, -3666, -3663, -3660, -3657, -3657, -3651, -3651, -3648, -3645, -3642,
+    -3642, -3636, -3636, -3630, -3630, -3627, -3624, -3621, -3621, -3615, -3615, -3612, -3609, -3606, -3606, -3600,
+    -3600, -3594, -3594, -3591, -3591, -3585, -3585, -3579, -3579, -3576, -3573, -3570, -3570, -3564, -3564, -3561,
+    -3558, -3555, -3552, -3549, -3549, -3543, -3543, -3540, -3537, -3534, -3534, -3528, -3528, -3522, -3522, -3519,
+    -3519, -3513, -3513, -3507, -3507, -3501, -3501, -3498, -3498, -3492, -3492, -3486, -3486, -3483, -3480, -3477,
+    -3477, -3471, -3471, -3465, -3465, -3462, -3459, -3456, -3456, -3450, -3450, -3447, -3444, -3441, -3438, -3435,
+    -3435, -3432, -3429, -3426, -3426, -3420, -3420, -3417, -3414, -3411, -3411, -3405, -3405, -3399, -3399, -3396,
+    -3393, -3390, -3390, -3384, -3384, -3378, -3378, -3375, -3372, -3369, -3369, -3363, -3363, -3360, -3357, -3354,
+    -3351, -3348, -3348, -3342, -3342, -3339, -3336, -3333, -3333, -3327, -3327, -3324, -3321, -3318, -3315, -3312,
+    -3312, -3306, -3306, -3300, -3300, -3297, -3297, -3291, -3291, -3285, -3285, -3279, -3279, -3276, -3276, -3270,
+    -3270, -3264, -3264, -3261, -3258, -3255, -3255, -3249, -3249, -3243, -3243, -3240, -3237, -3234, -3234, -3228,
+    -3228, -3222, -3222, -3219, -3216, -3213, -3213, -3207, -3207, -3201, -3201, -3198, -3195, -3192, -3192, -3186,
+    -3186, -3183, -3180, -3177, -3177, -3171, -3171, -3168, -3165, -3162, -3159, -3156, -3156, -3150, -3150, -3144,
+    -3144, -3141, -3138, -3135, -3135, -3129, -3129, -3126, -3123, -3120, -3117, -3114, -3114, -3108, -3108, -3105,
+    -3102, -3099, -3099, -3093, -3093, -3090, -3087, -3084, -3081, -3078, -3078, -3072, -3072, -3066, -3066, -3063,
+    -3060, -3057, -3057, -3051, -3051, -3048, -3045, -3042, -3039, -3036, -3036, -3030, -3030, -3024, -3024, -3021,
+    -3021, -3015, -3015, -3009, -3009, -3006, -3003, -3000, -3000, -2994, -2994, -2988, -2988, -2985, -2982, -2979,
+    -2976, -2973, -2973, -2967, -2967, -2964, -2961, -2958, -2955, -2952, -2952, -2946, -2946, -2943, -2940, -2937,
+    -2937, -2931, -2931, -2925, -2925, -2922, -2919, -2916, -2916, -2910, -2910, -2904, -2904, -2901, -2898, -2895,
+    -2895, -2889, -2889, -2883, -2883, -2880, -2877, -2874, -2874, -2868, -2868, -2865, -2862, -2859, -2856, -2853,
+    -2853, -2847, -2847, -2841, -2841, -2838, -2835, -2832, -2829, -2826, -2826, -2820, -2820, -2817, -2814, -2811,
+    -2808, -2805, -2805, -2802, -2799, -2796, -2793, -2790, -2790, -2784, -2784, -2778, -2778, -2775, -2772, -2769,
+    -2769, -2766, -2763, -2760, -2757, -2754, -2754, -2751, -2748, -2745, -2742, -2739, -2739, -2733, -2733, -2727,
+    -2727, -2724, -2721, -2718, -2715, -2712, -2712, -2706, -2706, -2703, -2700, -2697, -2694, -2691, -2691, -2685,
+    -2685, -2682, -2679, -2676, -2673, -2670, -2670, -2667, -2664, -2661, -2658, -2655, -2652, -2649, -2649, -2643,
+    -2643, -2640, -2637, -2634, -2631, -2628, -2628, -2622, -2622, -2619, -2616, -2613, -2610, -2607, -2607, -2601,
+    -2601, -2598, -2595, -2592, -2592, -2586, -2586, -2580, -2580, -2577, -2574, -2571, -2568, -2565, -2565, -2559,
+    -2559, -2556, -2553, -2550, -2547, -2544, -2544, -2538, -2538, -2535, -2532, -2529, -2526, -2523, -2520, -2517,
+    -2517, -2514, -2511, -2508, -2505, -2502, -2502, -2496, -2496, -2490, -2490, -2487, -2484, -2481, -2478, -2475,
+    -2475, -2469, -2469, -2466, -2463, -2460, -2457, -2454, -2454, -2451, -2448, -2445, -2442, -2439, -2436, -2433,
+    -2433, -2430, -2427, -2424, -2421, -2418, -2415, -2412, -2412, -2406, -2406, -2403, -2400, -2397, -2394, -2391,
+    -2391, -2385, -2385, -2382, -2379, -2376, -2373, -2370, -2370, -2364, -2364, -2361, -2358, -2355, -2352, -2349,
+    -2349, -2343, -2343, -2340, -2337, -2334, -2331, -2328, -2325, -2322, -2322, -2319, -2316, -2313, -2310, -2307,
+    -2304, -2301, -2301, -2295, -2295, -2292, -2289, -2286, -2283, -2280, -2277, -2274, -2274, -2271, -2268, -2265,
+    -2262, -2259, -2259, -2253, -2253, -2250, -2247, -2244, -2241, -2238, -2238, -2232, -2232, -2229, -2226, -2223,
+    -2220, -2217, -2214, -2211, -2211, -2205, -2205, -2202, -2199, -2196, -2193, -2190, -2190, -2184, -2184, -2181,
+    -2178, -2175, -2172, -2169, -2169, -2163, -2163, -2157, -2157, -2154, -2151, -2148, -2145, -2142, -2142, -2139,
+    -2136, -2133, -2130, -2127, -2124, -2121, -2121, -2115, -2115, -2112, -2109, -2106, -2103, -2100, -2097, -2097,
+    -2094, -2091, -2088, -2085, -2085, -2079, -2079, -2073, -2073, -2070, -2067, -2064, -2061, -2058, -2055, -2055,
+    -2052, -2049, -2046, -2043, -2040, -2037, -2037, -2031, -2031, -2028, -2025, -2022, -2019, -2016, -2013, -2010,
+    -2010, -2004, -2004, -2001, -1998, -1995, -1992, -1989, -1989, -1983, -1983, -1980, -1977, -1974, -1971, -1968,
+    -1968, -1962, -1962, -1956, -1956, -1953, -1950, -1947, -1947, -1941, -1941, -1935, -1935, -1932, -1929, -1926,
+    -1926, -1920, -1920, -1917, -1914, -1911, -1908, -1905, -1902, -1899, -1899, -1893, -1893, -1890, -1887, -1884,
+    -1881, -1878, -1875, -1872, -1872, -1869, -1866, -1863, -1860, -1857, -1854, -1851, -1851, -1845, -1845, -1842,
+    -1839, -1836, -1833, -1830, -1830, -1824, -1824, -1821, -1818, -1815, -1812, -1809, -1806, -1803, -1803, -1800,
+    -1797, -1794, -1791, -1788, -1785, -1782, -1782, -1776, -1776, -1773, -1770, -1767, -1764, -1761, -1758, -1758,
+    -1755, -1752, -1749, -1746, -1743, -1740, -1740, -1734, -1734, -1731, -1728, -1725, -1722, -1719, -1716, -1713,
+    -1713, -1710, -1707, -1704, -1701, -1698, -1695, -1692, -1692, -1686, -1686, -1683, -1680, -1677, -1674, -1671,
+    -1671, -1665, -1665, -1662, -1659, -1656, -1653, -1650, -1647, -1644, -1644, -1641, -1638, -1635, -1632, -1629,
+    -1626, -1623, -1620, -1617, -1617, -1614, -1611, -1608, -1605, -1602, -1599, -1596, -1596, -1593, -1590, -1587,
+    -1584, -1581, -1578, -1575, -1575, -1572, -1569, -1566, -1563, -1560, -1557, -1554, -1554, -1548, -1548, -1545,
+    -1542, -1539, -1536, -1533, -1533, -1530, -1527, -1524, -1521, -1518, -1515, -1512, -1512, -1506, -1506, -1503,
+    -1500, -1497, -1494, -1491, -1488, -1485, -1485, -1482, -1479, -1476, -1473, -1470, -1467, -1464, -1464, -1461,
+    -1458, -1455, -1452, -1449, -1446, -1443, -1443, -1437, -1437, -1434, -1431, -1428, -1425, -1422, -1419, -1419,
+    -1416, -1413, -1410, -1407, -1407, -1401, -1401, -1398, -1395, -1392, -1389, -1386, -1383, -1380, -1380, -1374,
+    -1374, -1371, -1368, -1365, -1362, -1359, -1356, -1356, -1353, -1350, -1347, -1344, -1341, -1338, -1335, -1332,
+    -1332, -1329, -1326, -1323, -1320, -1317, -1314, -1311, -1308, -1305, -1305, -1302, -1299, -1296, -1293, -1290,
+    -1287, -1284, -1284, -1281, -1278, -1275, -1272, -1269, -1266, -1263, -1260, -1257, -1257, -1254, -1251, -1248,
+    -1245, -1242, -1239, -1236, -1236, -1233, -1230, -1227, -1224, -1221, -1218, -1215, -1215, -1209, -1209, -1206,
+    -1203, -1200, -1197, -1194, -1191, -1188, -1188, -1185, -1182, -1179, -1176, -1173, -1170, -1167, -1167, -1164,
+    -1161, -1158, -1155, -1152, -1149, -1146, -1143, -1140, -1140, -1137, -1134, -1131, -1128, -1125, -1122, -1119,
+    -1119, -1116, -1113, -1110, -1107, -1104, -1101, -1098, -1095, -1092, -1092, -1089, -1086, -1083, -1080, -1077,
+    -1074, -1074, -1071, -1068, -1065, -1062, -1059, -1056, -1053, -1050, -1050, -1047, -1044, -1041, -1038, -1035,
+    -1032, -1029, -1026, -1026, -1023, -1020, -1017, -1014, -1011, -1008, -1005, -1002, -999, -996, -996, -993,
+    -990, -987, -984, -981, -978, -975, -975, -972, -969, -966, -963, -960, -957, -954, -954, -951,
+    -948, -945, -942, -939, -936, -933, -930, -927, -927, -924, -921, -918, -915, -912, -909, -906,
+    -906, -903, -900, -897, -894, -891, -888, -885, -882, -879, -879, -876, -873, -870, -867, -864,
+    -861, -858, -855, -855, -852, -849, -846, -843, -840, -837, -834, -831, -831, -828, -825, -822,
+    -819, -816, -813, -810, -810, -807, -804, -801, -798, -795, -792, -789, -786, -783, -780, -780,
+    -777, -774, -771, -768, -765, -762, -759, -756, -756, -753, -750, -747, -744, -741, -738, -738,
+    -735, -732, -729, -726, -723, -720, -717, -717, -714, -711, -708, -705, -702, -699, -696, -693,
+    -693, -690, -687, -684, -681, -678, -675, -672, -669, -669, -666, -663, -660, -657, -654, -651,
+    -648, -645, -642, -642, -639, -636, -633, -630, -627, -624, -621, -618, -615, -615, -612, -609,
+    -606, -603, -600, -597, -594, -594, -591, -588, -585, -582, -579, -576, -573, -570, -567, -567,
+    -564, -561, -558, -555, -552, -549, -546, -546, -543, -540, -537, -534, -531, -528, -525, -525,
+    -522, -519, -516, -513, -510, -507, -504, -501, -501, -498, -495, -492, -489, -486, -483, -480,
+    -480, -477, -474, -471, -468, -465, -462, -459, -456, -453, -450, -450, -447, -444, -441, -438,
+    -435, -432, -432, -429, -426, -423, -420, -417, -414, -411, -408, -408, -405, -402, -399, -396,
+    -393, -390, -387, -387, -384, -381, -378, -375, -372, -369, -366, -363, -363, -360, -357, -354,
+    -351, -348, -345, -342, -339, -339, -336, -333, -330, -327, -324, -321, -318, -318, -315, -312,
+    -309, -306, -303, -300, -297, -294, -294, -291, -288, -285, -282, -279, -276, -273, -270, -270,
+    -267, -264, -261, -258, -255, -252, -249, -249, -243, -243, -240, -237, -234, -231, -228, -228,
+    -225, -222, -219, -216, -213, -210, -207, -204, -204, -201, -198, -195, -192, -189, -186, -183,
+    -180, -180, -177, -174, -171, -168, -165, -162, -159, -159, -156, -153, -150, -147, -144, -141,
+    -138, -135, -135, -132, -129, -126, -123, -120, -117, -114, -111, -111, -108, -105, -102, -99,
+    -96, -93, -90, -90, -84, -84, -81, -78, -75, -72, -69, -66, -63, -63, -60, -57,
+    -54, -51, -48, -45, -42, -39, -36, -36, -33, -30, -27, -24, -21, -18, -15, -15,
+    -12, -9, -6, -3, 0, 3, 6, 6, 9, 12, 15, 18, 21, 24, 27, 27,
+    30, 33, 36, 39, 42, 45, 48, 51, 51, 54, 57, 60, 63, 66, 69, 72,
+    75, 75, 78, 81, 84, 87, 90, 93, 96, 96, 99, 102, 105, 108, 111, 111,
+    117, 117, 120, 123, 126, 129, 132, 135, 138, 141, 144, 144, 147, 150, 153, 156,
+    159, 162, 165, 165, 168, 171, 174, 177, 180, 183, 186, 189, 189, 192, 195, 198,
+    201, 204, 207, 207, 213, 213, 216, 219, 222, 225, 228, 231, 234, 234, 237, 240,
+    243, 246, 249, 252, 255, 255, 261, 261, 264, 267, 270, 273, 276, 279, 282, 282,
+    285, 288, 291, 294, 297, 297, 303, 303, 306, 309, 312, 315, 318, 321, 324, 324,
+    327, 330, 333, 336, 339, 342, 345, 345, 351, 351, 354, 357, 360, 363, 366, 369,
+    372, 372, 378, 378, 381, 384, 387, 390, 393, 393, 399, 399, 402, 405, 408, 411,
+    414, 417, 420, 420, 426, 426, 429, 432, 435, 438, 441, 441, 447, 447, 450, 453,
+    456, 459, 462, 465, 468, 468, 471, 474, 477, 480, 483, 486, 489, 492, 495, 495,
+    498, 501, 504, 507, 510, 513, 516, 516, 522, 522, 525, 528, 531, 534, 537, 540,
+    543, 546, 549, 549, 555, 555, 558, 561, 564, 567, 570, 573, 576, 576, 579, 582,
+    585, 588, 591, 594, 597, 597, 603, 603, 609, 609, 612, 615, 618, 621, 624, 624,
+    627, 630, 633, 636, 639, 642, 645, 645, 648, 651, 654, 657, 660, 663, 666, 669,
+    672, 672, 678, 678, 681, 684, 687, 690, 693, 696, 699, 699, 705, 705, 708, 711,
+    714, 717, 720, 723, 726, 726, 732, 732, 735, 738, 741, 744, 747, 750, 753, 753,
+    759, 759, 762, 765, 768, 771, 774, 777, 780, 780, 786, 786, 789, 792, 795, 798,
+    801, 801, 807, 807, 810, 813, 816, 819, 822, 825, 828, 828, 834, 834, 840, 840,
+    843, 846, 849, 852, 855, 858, 861, 861, 864, 867, 870, 873, 876, 879, 882, 882,
+    888, 888, 891, 894, 897, 900, 903, 906, 909, 912, 915, 915, 921, 921, 924, 927,
+    930, 933, 936, 939, 942, 942, 948, 948, 951, 954, 957, 960, 963, 966, 969, 969,
+    972, 975, 978, 981, 984, 987, 990, 990, 996, 996, 999, 1002, 1005, 1008, 1011, 1014,
+    1017, 1020, 1023, 1023, 1029, 1029, 1032, 1035, 1038, 1041, 1044, 1047, 1050, 1050, 1056, 1056,
+    1059, 1062, 1065, 1068, 1071, 1071, 1077, 1077, 1083, 1083, 1086, 1089, 1092, 1095, 1098, 1101,
+    1104, 1104, 1110, 1110, 1113, 1116, 1119, 1122, 1125, 1128, 1131, 1131, 1137, 1137, 1143, 1143,
+    1146, 1149, 1152, 1152, 1158, 1158, 1161, 1164, 1167, 1170, 1173, 1176, 1179, 1182, 1185, 1185,
+    1191, 1191, 1194, 1197, 1200, 1203, 1206, 1209, 1212, 1212, 1218, 1218, 1224, 1224, 1227, 1230,
+    1233, 1236, 1239, 1239, 1245, 1245, 1248, 1251, 1254, 1257, 1260, 1263, 1266, 1269, 1272, 1272,
+    1275, 1278, 1281, 1284, 1287, 1290, 1293, 1293, 1299, 1299, 1305, 1305, 1308, 1311, 1314, 1314,
+    1320, 1320, 1323, 1326, 1329, 1332, 1335, 1338, 1341, 1344, 1347, 1347, 1353, 1353, 1356, 1359,
+    1362, 1365, 1368, 1368, 1374, 1374, 1380, 1380, 1386, 1386, 1389, 1392, 1395, 1398, 1401, 1401,
+    1407, 1407, 1410, 1413, 1416, 1419, 1422, 1425, 1428, 1428, 1434, 1434, 1440, 1440, 1443, 1446,
+    1449, 1452, 1455, 1458, 1461, 1461, 1467, 1467, 1470, 1473, 1476, 1479, 1482, 1485, 1488, 1488,
+    1491, 1494, 1497, 1500, 1503, 1506, 1509, 1509, 1515, 1515, 1521, 1521, 1524, 1527, 1530, 1533,
+    1536, 1536, 1542, 1542, 1548, 1548, 1551, 1554, 1557, 1560, 1563, 1563, 1569, 1569, 1575, 1575,
+    1578, 1581, 1584, 1584, 1590, 1590, 1596, 1596, 1599, 1602, 1605, 1608, 1611, 1611, 1617, 1617,
+    1623, 1623, 1629, 1629, 1632, 1635, 1638, 1638, 1644, 1644, 1650, 1650, 1653, 1656, 1659, 1662,
+    1665, 1665, 1671, 1671, 1677, 1677, 1680, 1683, 1686, 1689, 1692, 1695, 1698, 1698, 1704, 1704,
+    1710, 1710, 1713, 1716, 1719, 1722, 1725, 1725, 1731, 1731, 1737, 1737, 1740, 1743, 1746, 1749,
+    1752, 1752, 1758, 1758, 1764, 1764, 1767, 1770, 1773, 1776, 1779, 1782, 1785, 1785, 1791, 1791,
+    1797, 1797, 1800, 1803, 1806, 1809, 1812, 1812, 1818, 1818, 1824, 1824, 1827, 1830, 1833, 1833,
+    1839, 1839, 1845, 1845, 1851, 1851, 1854, 1857, 1860, 1863, 1866, 1866, 1872, 1872, 1878, 1878,
+    1881, 1884, 1887, 1890, 1893, 1893, 1899, 1899, 1905, 1905, 1911, 1911, 1914, 1917, 1920, 1920,
+    1926, 1926, 1932, 1932, 1938, 1938, 1941, 1944, 1947, 1950, 1953, 1953, 1959, 1959, 1965, 1965,
+    1968, 1971, 1974, 1977, 1980, 1983, 1986, 1986, 1992, 1992, 1995, 1998, 2001, 2004, 2007, 2007,
+    2013, 2013, 2016, 2019, 2022, 2025, 2028, 2028, 2034, 2034, 2040, 2040, 2046, 2046, 2049, 2052,
+    2055, 2055, 2061, 2061, 2067, 2067, 2073, 2073, 2076, 2079, 2082, 2085, 2088, 2088, 2094, 2094,
+    2100, 2100, 2103, 2106, 2109, 2112, 2115, 2115, 2121, 2121, 2127, 2127, 2133, 2133, 2136, 2139,
+    2142, 2145, 2148, 2148, 2154, 2154, 2160, 2160, 2163, 2166, 2169, 2172, 2175, 2175, 2181, 2181,
+    2187, 2187, 2190, 2193, 2196, 2199, 2202, 2202, 2208, 2208, 2214, 2214, 2220, 2220, 2223, 2226,
+    2229, 2232, 2235, 2235, 2241, 2241, 2247, 2247, 2250, 2253, 2256, 2259, 2262, 2262, 2268, 2268,
+    2274, 2274, 2277, 2280, 2283, 2286, 2289, 2289, 2295, 2295, 2301, 2301, 2307, 2307, 2310, 2313,
+    2316, 2319, 2322, 2322, 2328, 2328, 2334, 2334, 2337, 2340, 2343, 2346, 2349, 2349, 2355, 2355,
+    2358, 2361, 2364, 2367, 2370, 2373, 2376, 2376, 2382, 2382, 2388, 2388, 2391, 2394, 2397, 2397,
+    2403, 2403, 2409, 2409, 2415, 2415, 2421, 2421, 2424, 2427, 2430, 2433, 2436, 2436, 2442, 2442,
+    2448, 2448, 2451, 2454, 2457, 2457, 2463, 2463, 2469, 2469, 2475, 2475, 2478, 2481, 2484, 2484,
+    2490, 2490, 2496, 2496, 2502, 2502, 2508, 2508, 2511, 2514, 2517, 2517, 2523, 2523, 2529, 2529,
+    2532, 2535, 2538, 2541, 2544, 2544, 2550, 2550, 2556, 2556, 2562, 2562, 2565, 2568, 2571, 2571,
+    2577, 2577, 2583, 2583, 2589, 2589, 2595, 2595, 2598, 2601, 2604, 2604, 2610, 2610, 2616, 2616,
+    2622, 2622, 2625, 2628, 2631, 2634, 2637, 2637, 2643, 2643, 2649, 2649, 2655, 2655, 2658, 2658,
+    2664, 2664, 2670, 2670, 2676, 2676, 2682, 2682, 2685, 2688, 2691, 2691, 2697, 2697, 2703, 2703,
+    2706, 2706, 2712, 2712, 2718, 2718, 2724, 2724, 2727, 2730, 2733, 2733, 2739, 2739, 2745, 2745,
+    2748, 2751, 2754, 2757, 2760, 2760, 2766, 2766, 2772, 2772, 2778, 2778, 2781, 2784, 2787, 2787,
+    2793, 2793, 2799, 2799, 2805, 2805, 2811, 2811, 2814, 2814, 2820, 2820, 2826, 2826, 2832, 2832,
+    2838, 2838, 2841, 2844, 2847, 2847, 2853, 2853, 2859, 2859, 2865, 2865, 2871, 2871, 2874, 2874,
+    2880, 2880, 2886, 2886, 2892, 2892, 2895, 2898, 2901, 2901, 2907, 2907, 2913, 2913, 2919, 2919,
+    2925, 2925, 2928, 2928, 2934, 2934, 2940, 2940, 2946, 2946, 2952, 2952, 2955, 2958, 2961, 2961,
+    2967, 2967, 2973, 2973, 2979, 2979, 2985, 2985, 2988, 2991, 2994, 2994, 3000, 3000, 3006, 3006,
+    3012, 3012, 3018, 3015, 3021, 3021, 3027, 3027, 3033, 3033, 3039, 3039, 3042, 3045, 3048, 3048,
+    3054, 3054, 3060, 3060, 3066, 3066, 3069, 3069, 3075, 3075, 3081, 3081, 3087, 3087, 3093, 3093,
+    3096, 3099, 3102, 3102, 3108, 3108, 3114, 3114, 3120, 3120, 3126, 3126, 3129, 3132, 3135, 3135,
+    3141, 3141, 3147, 3147, 3153, 3153, 3159, 3159, 3162, 3162, 3168, 3168, 3174, 3174, 3180, 3180,
+    3183, 3186, 3189, 3189, 3195, 3195, 3201, 3201, 3207, 3207, 3213, 3213, 3216, 3219, 3222, 3222,
+    3228, 3228, 3234, 3234, 3240, 3240, 3243, 3243, 3249, 3249, 3255, 3255, 3261, 3261, 3267, 3267,
+    3270, 3273, 3276, 3276, 3282, 3282, 3288, 3288, 3294, 3294, 3300, 3300, 3303, 3303, 3309, 3309,
+    3315, 3315, 3321, 3321, 3327, 3327, 3330, 3330, 3336, 3336, 3342, 3342, 3348, 3348, 3354, 3354,
+    3357, 3357, 3363, 3363, 3369, 3369, 3375, 3375, 3381, 3381, 3387, 3387, 3390, 3390, 3396, 3396,
+    3402, 3402, 3405, 3405, 3411, 3411, 3417, 3417, 3423, 3423, 3429, 3429, 3435, 3435, 3438, 3438,
+    3444, 3444, 3450, 3450, 3456, 3456, 3462, 3459, 3468, 3465, 3471, 3471, 3477, 3477, 3483, 3483,
+    3489, 3489, 3492, 3492, 3498, 3498, 3504, 3504, 3510, 3510, 3516, 3516, 3522, 3519, 3525, 3525,
+    3531, 3531, 3537, 3537, 3543, 3543, 3549, 3549, 3552, 3555, 3558, 3558, 3564, 3564, 3570, 3570,
+    3576, 3576, 3579, 3579, 3585, 3585, 3591, 3591, 3597, 3597, 3603, 3603, 3609, 3609, 3612, 3612,
+    3618, 3618, 3624, 3624, 3630, 3630, 3636, 3636, 3639, 3639, 3645, 3645, 3651, 3651, 3657, 3657,
+    3663, 3663, 3666, 3666, 3672, 3672, 3678, 3678, 3684, 3684, 3690, 3690, 3693, 3693, 3699, 3699,
+    3705, 3705, 3711, 3711, 3717, 3717, 3723, 3720, 3726, 3726, 3732, 3732, 3738, 3738, 3744, 3744,
+    3747, 3747, 3753, 3753, 3759, 3759, 3765, 3765, 3771, 3771, 3774, 3774, 3780, 3780, 3786, 3786,
+    3792, 3792, 3798, 3798, 3804, 3801, 3807, 3807, 3813, 3813, 3819, 3819, 3825, 3825, 3831, 3831,
+    3834, 3834, 3840, 3840, 3846, 3846, 3852, 3852, 3858, 3858, 3861, 3861, 3867, 3867, 3873, 3873,
+    3879, 3879, 3885, 3885, 3891, 3891, 3894, 3894, 3900, 3900, 3906, 3906, 3912, 3912, 3918, 3915,
+    3921, 3921, 3927, 3927, 3933, 3933, 3939, 3939, 3945, 3942, 3948, 3948, 3954, 3954, 3960, 3960,
+    3966, 3966, 3972, 3972, 3975, 3975, 3981, 3981, 3987, 3987, 3993, 3993, 3999, 3999, 4005, 4002,
+    4008, 4008, 4014, 4014, 4020, 4020, 4026, 4026, 4032, 4029, 4035, 4035, 4041, 4041, 4047, 4047,
+    4053, 4053, 4059, 4059, 4062, 4062, 4068, 4068, 4074, 4074, 4080, 4080, 4086, 4086, 4092, 4089,
+    4095, 4095, 4098, 4101, 4104, 4104, 4110, 4110, 4116, 4116, 4122, 4122, 4128, 4128, 4134, 4131,
+    4137, 4137, 4143, 4143, 4149, 4149, 4155, 4155, 4161, 4158, 4164, 4164, 4170, 4170, 4176, 4176,
+    4182, 4182, 4188, 4185, 4191, 4191, 4197, 4197, 4203, 4203, 4209, 4209, 4215, 4215, 4218, 4218,
+    4224, 4224, 4230, 4230, 4236, 4236, 4242, 4242, 4248, 4245, 4251, 4251, 4257, 4257, 4263, 4263,
+    4269, 4269, 4275, 4272, 4278, 4278, 4284, 4284, 4290, 4290, 4296, 4296, 4299, 4299, 4305, 4305,
+    4311, 4311, 4317, 4317, 4323, 4323, 4329, 4326, 4332, 4332, 4338, 4338, 4344, 4344, 4350, 4350,
+    4353, 4353, 4359, 4359, 4365, 4365, 4371, 4371, 4377, 4377, 4383, 4383, 4386, 4386, 4392, 4392,
+    4398, 4398, 4404, 4404, 4410, 4410, 4416, 4413, 4419, 4419, 4425, 4425, 4431, 4431, 4437, 4434,
+    4440, 4440, 4446, 4446, 4452, 4452, 4458, 4458, 4464, 4464, 4467, 4467, 4473, 4473, 4479, 4479,
+    4485, 4485, 4491, 4488, 4497, 4497, 4500, 4500, 4506, 4506, 4512, 4512, 4518, 4518, 4524, 4521,
+    4527, 4527, 4533, 4533, 4539, 4539, 4545, 4545, 4551, 4548, 4554, 4554, 4560, 4560, 4566, 4566,
+    4572, 4572, 4578, 4575, 4581, 4581, 4587, 4587, 4593, 4593, 4599, 4599, 4605, 4605, 4611, 4608,
+    4614, 4614, 4620, 4620, 4626, 4623, 4629, 4629, 4635, 4635, 4641, 4638, 4644, 4644, 4650, 4650,
+    4653, 4653, 4659, 4659, 4662, 4662, 4665, 4665, 4668, 4668, 4674, 4671, 4677, 4677, 4680, 4677,
+    4680, 4680, 4683, 4683, 4686, 4686, 4689, 4689, 4689, 4689, 4692, 4692, 4695, 4695, 4695, 4695,
+    4698, 4698, 4698, 4698, 4701, 4698, 4701, 4701, 4701, 4701, 4704, 4704, 4704, 4704, 4707, 4704,
+    4707, 4707, 4707, 4707, 4710, 4710, 4710, 4710, 4710, 4710, 4710, 4710, 4713, 4713, 4713, 4713,
+    4713, 4713, 4713, 4713, 4716, 4716, 4716, 4716, 4716, 4716, 4716, 4716, 4719, 4719, 4719, 4719,
+    4719, 4719, 4719, 4719, 4722, 4722, 4722, 4722, 4722, 4722, 4722, 4722, 4722, 4722, 4725, 4722,
+    4725, 4725, 4725, 4725, 4725, 4725, 4725, 4725, 4725, 4725, 4728, 4728, 4728, 4728, 4728, 4728,
+    4728, 4728, 4728, 4728, 4728, 4728, 4731, 4728, 4731, 4731, 4731, 4731, 4731, 4731, 4731, 4731,
+    4731, 4731, 4731, 4731, 4731, 4731, 4734, 4731, 4734, 4734, 4734, 4734, 4734, 4734, 4734, 4734,
+    4734, 4734, 4734, 4734, 4734, 4734, 4734, 4734, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737,
+    4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737,
+    4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737,
+    4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737,
+    4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737,
+    4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737,
+    4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737,
+    4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737,
+    4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737,
+    4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737, 4737,
+};
+
+extern const int16_t Vca2[codeCount] = {
+    -4926, -4929, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4935, -4935,
+    -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935,
+    -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935,
+    -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935,
+    -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935,
+    -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935,
+    -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935,
+    -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935,
+    -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935,
+    -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935,
+    -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935,
+    -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4935, -4932, -4932,
+    -4935, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932,
+    -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932,
+    -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932, -4932,
+    -4932, -4932, -4932, -4929, -4932, -4932, -4929, -4929, -4929, -4929, -4929, -4929, -4929, -4929, -4929, -4929,
+    -4929, -4929, -4929, -4929, -4929, -4929, -4929, -4929, -4929, -4929, -4929, -4929, -4929, -4929, -4929, -4929,
+    -4929, -4929, -4929, -4929, -4929, -4929, -4929, -4929, -4929, -4929, -4929, -4926, -4926, -4926, -4926, -4926,
+    -4926, -4926, -4926, -4926, -4926, -4926, -4926, -4926, -4926, -4926, -4926, -4926, -4926, -4926, -4926, -4926,
+    -4926, -4926, -4926, -4926, -4926, -4923, -4926, -4923, -4923, -4923, -4923, -4923, -4923, -4923, -4923, -4923,
+    -4923, -4923, -4923, -4923, -4923, -4920, -4923, -4923, -4923, -4920, -4920, -4920, -4920, -4920, -4920, -4920,
+    -4920, -4920, -4920, -4920, -4920, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4914,
+    -4917, -4914, -4914, -4914, -4914, -4914, -4914, -4911, -4911, -4911, -4911, -4911, -4911, -4911, -4911, -4908,
+    -4908, -4908, -4905, -4905, -4905, -4905, -4902, -4902, -4899, -4899, -4899, -4896, -4899, -4893, -4893, -4890,
+    -4893, -4887, -4887, -4887, -4884, -4884, -4881, -4878, -4878, -4875, -4875, -4872, -4872, -4869, -4869, -4866,
+    -4866, -4863, -4863, -4860, -4860, -4854, -4854, -4851, -4851, -4848, -4848, -4845, -4842, -4839, -4839, -4836,
+    -4836, -4830, -4830, -4827, -4827, -4821, -4821, -4818, -4818, -4812, -4812, -4809, -4809, -4803, -4803, -4800,
+    -4800, -4794, -4794, -4791, -4788, -4785, -4785, -4779, -4779, -4776, -4773, -4770, -4770, -4764, -4764, -4758,
+    -4758, -4755, -4755, -4749, -4749, -4743, -4743, -4737, -4737, -4731, -4731, -4728, -4725, -4722, -4722, -4716,
+    -4716, -4710, -4710, -4704, -4704, -4698, -4698, -4692, -4692, -4689, -4686, -4683, -4683, -4677, -4677, -4671,
+    -4671, -4665, -4665, -4659, -4659, -4653, -4653, -4650, -4647, -4644, -4644, -4638, -4635, -4632, -4632, -4626,
+    -4626, -4620, -4620, -4614, -4614, -4608, -4608, -4602, -4602, -4596, -4596, -4593, -4590, -4587, -4584, -4581,
+    -4581, -4575, -4575, -4572, -4569, -4566, -4563, -4560, -4560, -4554, -4554, -4548, -4548, -4542, -4542, -4536,
+    -4536, -4530, -4530, -4524, -4524, -4518, -4518, -4515, -4512, -4509, -4506, -4503, -4503, -4497, -4497, -4491,
+    -4491, -4485, -4485, -4479, -4479, -4473, -4473, -4467, -4467, -4461, -4461, -4458, -4455, -4452, -4449, -4446,
+    -4443, -4440, -4440, -4434, -4434, -4428, -4428, -4422, -4422, -4416, -4416, -4410, -4410, -4404, -4404, -4401,
+    -4398, -4395, -4392, -4389, -4386, -4383, -4383, -4377, -4377, -4371, -4371, -4365, -4365, -4359, -4359, -4353,
+    -4353, -4347, -4347, -4341, -4341, -4335, -4335, -4329, -4329, -4323, -4323, -4320, -4317, -4311, -4311, -4308,
+    -4308, -4302, -4302, -4296, -4296, -4290, -4290, -4284, -4284, -4278, -4278, -4272, -4272, -4266, -4266, -4260,
+    -4260, -4254, -4254, -4248, -4248, -4242, -4242, -4239, -4236, -4233, -4230, -4227, -4224, -4221, -4218, -4215,
+    -4215, -4209, -4209, -4203, -4203, -4197, -4197, -4191, -4191, -4185, -4185, -4179, -4179, -4173, -4173, -4170,
+    -4167, -4164, -4161, -4158, -4155, -4152, -4149, -4146, -4143, -4140, -4137, -4134, -4134, -4128, -4128, -4122,
+    -4122, -4116, -4116, -4110, -4110, -4104, -4104, -4098, -4098, -4092, -4092, -4086, -4086, -4080, -4080, -4074,
+    -4074, -4068, -4068, -4062, -4062, -4059, -4056, -4053, -4050, -4047, -4044, -4041, -4041, -4035, -4032, -4029,
+    -4029, -4023, -4023, -4017, -4017, -4011, -4011, -4005, -4005, -3999, -3999, -3993, -3993, -3987, -3987, -3981,
+    -3981, -3975, -3975, -3969, -3969, -3963, -3963, -3957, -3957, -3954, -3951, -3948, -3945, -3942, -3939, -3936,
+    -3936, -3930, -3927, -3924, -3924, -3918, -3918, -3912, -3912, -3906, -3906, -3900, -3900, -3894, -3894, -3888,
+    -3888, -3882, -3882, -3876, -3876, -3870, -3870, -3864, -3864, -3858, -3858, -3852, -3852, -3846, -3846, -3843,
+    -3843, -3837, -3837, -3831, -3831, -3825, -3825, -3819, -3819, -3813, -3813, -3807, -3807, -3801, -3801, -3795,
+    -3795, -3789, -3789, -3783, -3783, -3777, -3777, -3771, -3771, -3765, -3765, -3759, -3759, -3753, -3753, -3747,
+    -3747, -3741, -3741, -3738, -3735, -3729, -3729, -3726, -3723, -3720, -3717, -3714, -3711, -3708, -3705, -3702,
+    -3699, -3696, -3693, -3690, -3687, -3684, -3681, -3678, -3678, -3672, -3672, -3666, -3666, -3660, -3660, -3654,
+    -3654, -3648, -3648, -3642, -3642, -3636, -3636, -3630, -3630, -3624, -3624, -3618, -3618, -3612, -3612, -3606,
+    -3606, -3600, -3600, -3594, -3594, -3588, -3588, -3582, -3582, -3579, -3576, -3570, -3570, -3567, -3564, -3561,
+    -3558, -3555, -3552, -3549, -3546, -3543, -3540, -3537, -3534, -3531, -3528, -3525, -3522, -3519, -3516, -3513,
+    -3513, -3507, -3507, -3501, -3501, -3495, -3495, -3489, -3489, -3483, -3483, -3477, -3477, -3471, -3471, -3465,
+    -3465, -3459, -3459, -3453, -3453, -3447, -3447, -3444, -3441, -3438, -3435, -3429, -3429, -3426, -3423, -3420,
+    -3417, -3414, -3411, -3408, -3405, -3402, -3399, -3396, -3393, -3390, -3387, -3384, -3381, -3378, -3375, -3372,
+    -3369, -3366, -3363, -3360, -3357, -3354, -3354, -3348, -3348, -3342, -3342, -3336, -3336, -3330, -3330, -3324,
+    -3321, -3318, -3318, -3312, -3312, -3306, -3306, -3300, -3300, -3294, -3294, -3288, -3288, -3282, -3282, -3276,
+    -3276, -3270, -3270, -3264, -3264, -3258, -3258, -3252, -3252, -3246, -3246, -3240, -3240, -3234, -3234, -3228,
+    -3228, -3222, -3222, -3216, -3216, -3210, -3210, -3204, -3204, -3198, -3198, -3192, -3192, -3186, -3186, -3183,
+    -3180, -3177, -3174, -3171, -3168, -3165, -3162, -3159, -3156, -3153, -3150, -3147, -3144, -3141, -3138, -3135,
+    -3132, -3129, -3126, -3123, -3120, -3117, -3114, -3111, -3108, -3105, -3102, -3099, -3096, -3093, -3090, -3090,
+    -3087, -3081, -3081, -3075, -3075, -3072, -3069, -3063, -3063, -3060, -3057, -3054, -3051, -3045, -3045, -3042,
+    -3039, -3036, -3033, -3030, -3027, -3024, -3021, -3018, -3015, -3009, -3009, -3006, -3003, -3000, -2997, -2994,
+    -2991, -2988, -2985, -2982, -2979, -2976, -2973, -2970, -2967, -2964, -2961, -2958, -2955, -2952, -2949, -2946,
+    -2943, -2940, -2937, -2934, -2931, -2928, -2925, -2922, -2919, -2916, -2913, -2910, -2907, -2904, -2901, -2898,
+    -2898, -2892, -2892, -2886, -2886, -2880, -2880, -2874, -2874, -2868, -2868, -2862, -2862, -2856, -2853, -2850,
+    -2850, -2844, -2844, -2838, -2838, -2832, -2832, -2826, -2826, -2820, -2820, -2814, -2814, -2808, -2808, -2802,
+    -2802, -2796, -2796, -2790, -2790, -2784, -2784, -2778, -2778, -2772, -2772, -2766, -2766, -2760, -2760, -2754,
+    -2754, -2748, -2748, -2742, -2742, -2739, -2736, -2730, -2730, -2724, -2724, -2718, -2718, -2712, -2712, -2709,
+    -2706, -2703, -2700, -2697, -2694, -2691, -2688, -2685, -2682, -2679, -2676, -2673, -2670, -2667, -2664, -2661,
+    -2658, -2655, -2652, -2649, -2646, -2643, -2640, -2637, -2634, -2631, -2628, -2625, -2622, -2619, -2616, -2613,
+    -2610, -2607, -2604, -2601, -2598, -2595, -2592, -2589, -2586, -2583, -2580, -2577, -2574, -2571, -2568, -2565,
+    -2562, -2559, -2556, -2553, -2550, -2547, -2544, -2541, -2538, -2535, -2532, -2529, -2526, -2523, -2520, -2517,
+    -2517, -2511, -2511, -2505, -2505, -2499, -2499, -2493, -2493, -2487, -2487, -2481, -2478, -2475, -2475, -2469,
+    -2469, -2463, -2460, -2457, -2454, -2451, -2448, -2445, -2445, -2439, -2439, -2433, -2430, -2427, -2427, -2421,
+    -2421, -2415, -2415, -2409, -2409, -2403, -2403, -2397, -2397, -2391, -2391, -2385, -2385, -2379, -2379, -2373,
+    -2373, -2367, -2367, -2361, -2361, -2355, -2352, -2349, -2349, -2343, -2343, -2337, -2337, -2331, -2328, -2328,
+    -2325, -2322, -2319, -2316, -2313, -2310, -2307, -2304, -2301, -2298, -2295, -2292, -2289, -2286, -2283, -2280,
+    -2277, -2274, -2271, -2268, -2265, -2262, -2259, -2256, -2253, -2250, -2247, -2244, -2241, -2238, -2235, -2232,
+    -2229, -2226, -2223, -2220, -2217, -2214, -2211, -2208, -2205, -2202, -2199, -2196, -2193, -2190, -2187, -2184,
+    -2181, -2178, -2175, -2172, -2169, -2166, -2163, -2160, -2157, -2154, -2151, -2148, -2145, -2142, -2139, -2136,
+    -2133, -2130, -2127, -2124, -2121, -2118, -2115, -2112, -2109, -2106, -2103, -2100, -2097, -2094, -2091, -2088,
+    -2085, -2082, -2079, -2076, -2073, -2070, -2067, -2064, -2061, -2058, -2055, -2052, -2049, -2046, -2043, -2040,
+    -2037, -2034, -2031, -2028, -2025, -2022, -2019, -2016, -2013, -2010, -2007, -2004, -2001, -1998, -1995, -1992,
+    -1989, -1986, -1983, -1980, -1977, -1974, -1971, -1968, -1965, -1962, -1959, -1956, -1953, -1950, -1947, -1944,
+    -1944, -1938, -1938, -1932, -1932, -1926, -1926, -1923, -1920, -1914, -1914, -1911, -1908, -1902, -1902, -1896,
+    -1896, -1890, -1890, -1887, -1884, -1878, -1878, -1875, -1872, -1866, -1866, -1863, -1860, -1854, -1854, -1851,
+    -1848, -1845, -1842, -1839, -1836, -1833, -1830, -1827, -1824, -1821, -1818, -1815, -1812, -1809, -1806, -1803,
+    -1800, -1797, -1794, -1791, -1788, -1785, -1782, -1779, -1776, -1773, -1770, -1767, -1764, -1761, -1758, -1755,
+    -1752, -1749, -1746, -1743, -1740, -1737, -1734, -1731, -1728, -1725, -1722, -1719, -1716, -1713, -1710, -1707,
+    -1704, -1701, -1698, -1695, -1692, -1689, -1686, -1683, -1680, -1677, -1674, -1671, -1668, -1665, -1662, -1659,
+    -1656, -1653, -1650, -1647, -1644, -1641, -1638, -1635, -1632, -1629, -1626, -1623, -1620, -1617, -1614, -1611,
+    -1608, -1605, -1602, -1599, -1596, -1593, -1590, -1587, -1584, -1581, -1578, -1575, -1572, -1569, -1566, -1566,
+    -1563, -1560, -1557, -1554, -1551, -1548, -1545, -1542, -1539, -1536, -1533, -1530, -1527, -1524, -1521, -1518,
+    -1515, -1512, -1509, -1506, -1503, -1500, -1497, -1494, -1491, -1488, -1485, -1482, -1479, -1476, -1473, -1470,
+    -1467, -1464, -1461, -1458, -1455, -1452, -1449, -1446, -1443, -1440, -1437, -1434, -1431, -1428, -1425, -1422,
+    -1419, -1416, -1413, -1410, -1407, -1404, -1401, -1398, -1395, -1392, -1389, -1386, -1383, -1380, -1377, -1374,
+    -1374, -1368, -1365, -1362, -1362, -1356, -1353, -1350, -1347, -1344, -1341, -1338, -1335, -1332, -1329, -1326,
+    -1323, -1320, -1320, -1314, -1314, -1311, -1308, -1305, -1299, -1296, -1293, -1290, -1290, -1284, -1284, -1281,
+    -1278, -1272, -1272, -1269, -1266, -1260, -1260, -1257, -1254, -1251, -1248, -1242, -1242, -1239, -1236, -1233,
+    -1230, -1224, -1224, -1221, -1218, -1215, -1212, -1209, -1206, -1203, -1200, -1197, -1194, -1191, -1188, -1185,
+    -1182, -1179, -1176, -1173, -1170, -1167, -1164, -1161, -1158, -1155, -1152, -1149, -1146, -1143, -1140, -1137,
+    -1134, -1131, -1128, -1125, -1122, -1119, -1116, -1113, -1110, -1107, -1104, -1101, -1098, -1095, -1092, -1089,
+    -1086, -1083, -1080, -1077, -1074, -1071, -1068, -1065, -1062, -1059, -1056, -1053, -1050, -1047, -1044, -1041,
+    -1038, -1035, -1035, -1029, -1026, -1023, -1020, -1017, -1014, -1011, -1008, -1005, -1002, -1002, -996, -996,
+    -993, -990, -987, -984, -981, -975, -975, -972, -969, -966, -963, -957, -957, -954, -951, -948,
+    -945, -942, -939, -936, -933, -930, -927, -924, -921, -918, -915, -912, -909, -906, -903, -900,
+    -897, -894, -891, -888, -885, -882, -879, -876, -873, -870, -867, -864, -861, -858, -855, -852,
+    -849, -846, -843, -840, -837, -834, -831, -828, -825, -822, -819, -816, -813, -810, -807, -807,
+    -804, -801, -798, -795, -792, -786, -786, -783, -780, -774, -774, -771, -768, -762, -762, -759,
+    -756, -753, -750, -747, -744, -741, -738, -735, -732, -729, -726, -723, -720, -717, -714, -711,
+    -708, -705, -702, -699, -696, -693, -690, -687, -684, -681, -678, -675, -672, -669, -666, -663,
+    -660, -657, -654, -651, -648, -645, -642, -639, -636, -633, -630, -627, -624, -621, -618, -618,
+    -615, -612, -609, -606, -603, -600, -597, -594, -591, -588, -585, -582, -579, -576, -573, -570,
+    -567, -564, -561, -558, -555, -552, -549, -546, -543, -540, -537, -534, -531, -528, -525, -522,
+    -519, -516, -513, -510, -507, -504, -501, -498, -495, -492, -489, -486, -486, -480, -477, -477,
+    -474, -471, -468, -465, -462, -459, -456, -453, -450, -447, -444, -441, -438, -435, -432, -429,
+    -426, -423, -420, -417, -414, -411, -408, -408, -402, -399, -396, -396, -390, -390, -387, -384,
+    -381, -378, -375, -372, -369, -366, -363, -360, -357, -354, -351, -348, -345, -342, -339, -336,
+    -333, -330, -327, -324, -321, -318, -315, -315, -309, -309, -303, -303, -300, -297, -294, -291,
+    -288, -285, -282, -279, -276, -273, -270, -267, -264, -261, -258, -255, -252, -249, -246, -243,
+    -243, -240, -237, -234, -231, -228, -225, -222, -219, -216, -213, -210, -207, -204, -201, -198,
+    -195, -192, -189, -186, -183, -180, -177, -174, -171, -171, -165, -165, -162, -159, -156, -153,
+    -150, -147, -144, -141, -138, -135, -132, -129, -126, -123, -120, -117, -114, -114, -108, -108,
+    -105, -102, -99, -96, -93, -90, -87, -84, -81, -78, -75, -72, -69, -66, -63, -60,
+    -60, -57, -54, -51, -48, -45, -42, -39, -36, -33, -30, -27, -24, -21, -18, -15,
+    -12, -12, -6, -6, -3, 0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 27,
+    30, 33, 36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 66, 69, 72, 72,
+    78, 78, 84, 84, 87, 90, 93, 96, 99, 102, 105, 108, 111, 114, 117, 117,
+    120, 123, 126, 129, 132, 135, 138, 141, 144, 147, 150, 153, 156, 159, 162, 162,
+    168, 168, 171, 174, 177, 180, 183, 186, 189, 192, 195, 198, 201, 204, 207, 207,
+    210, 213, 216, 219, 222, 225, 228, 231, 234, 237, 240, 243, 246, 249, 252, 255,
+    258, 261, 264, 264, 267, 270, 273, 276, 279, 282, 285, 288, 291, 294, 297, 300,
+    303, 306, 309, 309, 315, 315, 321, 321, 324, 327, 330, 333, 336, 339, 342, 345,
+    348, 351, 354, 357, 360, 363, 366, 369, 372, 375, 378, 378, 384, 384, 390, 390,
+    393, 396, 399, 402, 405, 408, 411, 414, 417, 420, 423, 426, 429, 432, 435, 438,
+    441, 444, 447, 450, 453, 456, 459, 462, 465, 465, 471, 471, 477, 477, 483, 483,
+    486, 489, 492, 495, 498, 501, 504, 507, 510, 513, 516, 519, 522, 525, 528, 531,
+    534, 537, 540, 543, 546, 549, 552, 555, 558, 558, 564, 564, 570, 573, 576, 576,
+    579, 582, 588, 588, 591, 594, 597, 600, 603, 606, 609, 612, 615, 618, 624, 624,
+    627, 630, 633, 636, 639, 642, 645, 648, 651, 654, 657, 660, 663, 666, 669, 669,
+    675, 675, 681, 681, 687, 687, 693, 693, 699, 699, 702, 705, 711, 711, 714, 717,
+    720, 723, 726, 729, 735, 735, 738, 741, 744, 747, 750, 753, 756, 759, 762, 765,
+    768, 771, 774, 777, 780, 783, 786, 789, 792, 795, 798, 801, 804, 807, 810, 813,
+    816, 819, 822, 825, 828, 831, 834, 834, 840, 843, 846, 849, 852, 852, 858, 858,
+    864, 864, 870, 870, 876, 876, 882, 882, 888, 888, 894, 894, 900, 900, 906, 906,
+    912, 912, 918, 918, 921, 924, 927, 930, 936, 936, 939, 942, 945, 948, 954, 954,
+    957, 960, 963, 966, 969, 972, 975, 978, 981, 984, 987, 990, 993, 996, 999, 1002,
+    1005, 1008, 1011, 1014, 1017, 1020, 1023, 1026, 1029, 1032, 1035, 1038, 1041, 1044, 1047, 1047,
+    1053, 1056, 1059, 1059, 1065, 1065, 1071, 1074, 1077, 1080, 1083, 1083, 1089, 1092, 1095, 1095,
+    1101, 1101, 1107, 1110, 1113, 1116, 1119, 1119, 1125, 1128, 1131, 1131, 1137, 1137, 1143, 1143,
+    1149, 1149, 1155, 1155, 1161, 1161, 1167, 1167, 1173, 1173, 1179, 1179, 1185, 1185, 1191, 1191,
+    1194, 1197, 1203, 1203, 1206, 1209, 1212, 1215, 1218, 1221, 1227, 1227, 1230, 1233, 1236, 1239,
+    1242, 1245, 1248, 1251, 1254, 1257, 1260, 1263, 1266, 1269, 1272, 1275, 1278, 1281, 1284, 1287,
+    1290, 1293, 1296, 1299, 1302, 1305, 1308, 1311, 1314, 1317, 1320, 1323, 1326, 1329, 1332, 1335,
+    1338, 1341, 1344, 1347, 1350, 1353, 1356, 1359, 1362, 1365, 1368, 1371, 1374, 1377, 1380, 1383,
+    1386, 1389, 1392, 1395, 1398, 1401, 1404, 1407, 1410, 1413, 1416, 1419, 1422, 1425, 1428, 1428,
+    1431, 1434, 1440, 1440, 1446, 1446, 1452, 1452, 1458, 1458, 1464, 1464, 1470, 1470, 1476, 1476,
+    1482, 1482, 1488, 1488, 1494, 1494, 1500, 1500, 1506, 1506, 1512, 1512, 1515, 1518, 1521, 1524,
+    1527, 1530, 1533, 1536, 1539, 1542, 1545, 1548, 1551, 1554, 1557, 1560, 1563, 1566, 1569, 1572,
+    1575, 1578, 1581, 1584, 1587, 1590, 1593, 1596, 1599, 1602, 1605, 1608, 1611, 1614, 1617, 1617,
+    1623, 1623, 1629, 1629, 1635, 1635, 1641, 1641, 1647, 1647, 1653, 1656, 1659, 1659, 1665, 1665,
+    1671, 1671, 1677, 1680, 1683, 1683, 1689, 1689, 1695, 1698, 1701, 1701, 1707, 1707, 1713, 1713,
+    1719, 1719, 1725, 1725, 1731, 1731, 1737, 1737, 1743, 1743, 1749, 1752, 1755, 1755, 1761, 1761,
+    1767, 1767, 1773, 1773, 1779, 1782, 1785, 1785, 1791, 1791, 1797, 1797, 1803, 1803, 1809, 1809,
+    1815, 1815, 1821, 1821, 1824, 1827, 1833, 1833, 1839, 1839, 1845, 1845, 1851, 1851, 1857, 1857,
+    1863, 1863, 1869, 1869, 1875, 1875, 1881, 1881, 1887, 1887, 1893, 1893, 1899, 1899, 1905, 1905,
+    1911, 1911, 1914, 1917, 1920, 1923, 1929, 1929, 1932, 1935, 1941, 1941, 1944, 1947, 1953, 1953,
+    1956, 1959, 1962, 1965, 1968, 1971, 1974, 1977, 1980, 1983, 1989, 1989, 1995, 1995, 2001, 2001,
+    2004, 2007, 2010, 2013, 2016, 2019, 2022, 2025, 2028, 2031, 2034, 2037, 2040, 2043, 2046, 2049,
+    2052, 2055, 2058, 2061, 2064, 2067, 2073, 2073, 2079, 2079, 2082, 2085, 2088, 2091, 2097, 2097,
+    2100, 2103, 2106, 2109, 2112, 2115, 2118, 2121, 2124, 2127, 2130, 2133, 2136, 2139, 2142, 2145,
+    2148, 2151, 2154, 2157, 2160, 2163, 2166, 2169, 2172, 2175, 2178, 2181, 2184, 2187, 2190, 2190,
+    2196, 2196, 2202, 2205, 2208, 2208, 2214, 2217, 2220, 2220, 2226, 2226, 2232, 2232, 2238, 2238,
+    2244, 2244, 2250, 2250, 2256, 2256, 2262, 2265, 2268, 2268, 2274, 2274, 2280, 2283, 2286, 2289,
+    2292, 2295, 2298, 2298, 2304, 2304, 2310, 2310, 2316, 2316, 2322, 2322, 2328, 2328, 2334, 2334,
+    2340, 2340, 2346, 2346, 2352, 2352, 2358, 2358, 2364, 2364, 2370, 2370, 2376, 2376, 2382, 2382,
+    2388, 2388, 2394, 2394, 2400, 2400, 2406, 2406, 2412, 2412, 2418, 2418, 2424, 2424, 2430, 2430,
+    2436, 2436, 2442, 2442, 2448, 2448, 2454, 2454, 2460, 2460, 2466, 2466, 2472, 2472, 2478, 2478,
+    2484, 2484, 2490, 2490, 2496, 2496, 2502, 2502, 2508, 2508, 2514, 2514, 2520, 2520, 2526, 2526,
+    2532, 2532, 2538, 2538, 2544, 2544, 2550, 2550, 2556, 2556, 2562, 2562, 2568, 2568, 2574, 2574,
+    2580, 2580, 2586, 2586, 2592, 2592, 2598, 2598, 2604, 2604, 2610, 2610, 2616, 2616, 2622, 2622,
+    2628, 2628, 2634, 2634, 2640, 2640, 2646, 2646, 2652, 2652, 2658, 2658, 2664, 2664, 2670, 2670,
+    2676, 2676, 2682, 2682, 2688, 2688, 2694, 2694, 2700, 2700, 2706, 2706, 2712, 2712, 2718, 2718,
+    2724, 2724, 2730, 2730, 2736, 2736, 2742, 2742, 2748, 2748, 2754, 2754, 2760, 2760, 2766, 2766,
+    2772, 2772, 2775, 2778, 2784, 2784, 2790, 2790, 2796, 2796, 2802, 2802, 2808, 2808, 2814, 2814,
+    2820, 2820, 2826, 2826, 2832, 2832, 2838, 2838, 2844, 2844, 2850, 2850, 2856, 2856, 2862, 2862,
+    2868, 2868, 2874, 2874, 2880, 2880, 2886, 2886, 2892, 2892, 2898, 2898, 2904, 2904, 2910, 2910,
+    2916, 2916, 2922, 2922, 2928, 2928, 2934, 2934, 2940, 2940, 2946, 2946, 2952, 2952, 2958, 2955,
+    2961, 2961, 2967, 2967, 2973, 2973, 2979, 2979, 2985, 2985, 2991, 2991, 2997, 2997, 3003, 3003,
+    3009, 3009, 3015, 3015, 3021, 3024, 3027, 3027, 3033, 3033, 3039, 3039, 3045, 3045, 3051, 3051,
+    3057, 3057, 3063, 3063, 3069, 3069, 3075, 3075, 3081, 3081, 3087, 3087, 3093, 3093, 3099, 3099,
+    3105, 3105, 3111, 3111, 3117, 3117, 3123, 3123, 3129, 3129, 3135, 3135, 3141, 3141, 3147, 3147,
+    3153, 3153, 3159, 3159, 3165, 3165, 3171, 3171, 3177, 3177, 3183, 3183, 3189, 3189, 3195, 3195,
+    3201, 3201, 3207, 3207, 3213, 3213, 3219, 3219, 3225, 3225, 3231, 3231, 3237, 3237, 3243, 3243,
+    3249, 3249, 3255, 3255, 3261, 3261, 3267, 3267, 3273, 3273, 3279, 3279, 3285, 3285, 3291, 3291,
+    3297, 3297, 3303, 3303, 3309, 3309, 3315, 3315, 3321, 3321, 3327, 3327, 3333, 3333, 3339, 3339,
+    3345, 3345, 3351, 3351, 3357, 3357, 3363, 3363, 3369, 3369, 3375, 3375, 3381, 3381, 3387, 3387,
+    3393, 3393, 3399, 3399, 3405, 3405, 3411, 3411, 3417, 3417, 3423, 3423, 3429, 3429, 3435, 3435,
+    3441, 3441, 3447, 3447, 3453, 3453, 3459, 3459, 3465, 3465, 3471, 3471, 3477, 3477, 3483, 3483,
+    3489, 3489, 3495, 3495, 3501, 3501, 3507, 3507, 3513, 3513, 3519, 3519, 3525, 3525, 3531, 3531,
+    3537, 3537, 3543, 3543, 3549, 3549, 3555, 3555, 3561, 3561, 3567, 3567, 3573, 3573, 3579, 3579,
+    3585, 3585, 3591, 3591, 3597, 3597, 3603, 3603, 3609, 3609, 3615, 3615, 3621, 3621, 3627, 3627,
+    3633, 3633, 3639, 3639, 3645, 3645, 3651, 3651, 3657, 3657, 3663, 3663, 3669, 3669, 3675, 3675,
+    3681, 3681, 3687, 3687, 3693, 3693, 3699, 3699, 3705, 3705, 3711, 3711, 3717, 3717, 3723, 3723,
+    3726, 3729, 3735, 3735, 3741, 3741, 3747, 3747, 3753, 3753, 3759, 3759, 3765, 3765, 3771, 3771,
+    3777, 3777, 3783, 3783, 3789, 3789, 3795, 3795, 3801, 3801, 3807, 3807, 3813, 3813, 3819, 3819,
+    3825, 3825, 3831, 3831, 3837, 3837, 3843, 3843, 3849, 3849, 3855, 3855, 3861, 3861, 3867, 3867,
+    3873, 3873, 3879, 3879, 3885, 3885, 3891, 3891, 3897, 3897, 3903, 3903, 3909, 3909, 3915, 3915,
+    3921, 3921, 3927, 3927, 3933, 3933, 3939, 3939, 3945, 3945, 3951, 3951, 3957, 3957, 3963, 3963,
+    3969, 3969, 3975, 3975, 3981, 3981, 3987, 3987, 3993, 3993, 3999, 3999, 4005, 4005, 4011, 4011,
+    4017, 4017, 4023, 4023, 4029, 4029, 4035, 4035, 4041, 4041, 4047, 4047, 4053, 4053, 4059, 4059,
+    4065, 4065, 4071, 4071, 4077, 4077, 4083, 4083, 4089, 4089, 4095, 4095, 4101, 4101, 4107, 4104,
+    4110, 4113, 4116, 4119, 4125, 4122, 4131, 4128, 4137, 4137, 4143, 4140, 4149, 4149, 4152, 4155,
+    4158, 4161, 4167, 4167, 4173, 4173, 4176, 4176, 4185, 4182, 4191, 4188, 4194, 4197, 4200, 4200,
+    4209, 4206, 4212, 4212, 4221, 4221, 4227, 4224, 4233, 4230, 4239, 4239, 4242, 4242, 4251, 4248,
+    4254, 4257, 4263, 4263, 4269, 4269, 4275, 4275, 4281, 4281, 4287, 4284, 4293, 4293, 4299, 4296,
+    4302, 4302, 4308, 4308, 4314, 4314, 4323, 4320, 4326, 4326, 4332, 4332, 4341, 4341, 4347, 4344,
+    4353, 4350, 4359, 4356, 4362, 4362, 4371, 4368, 4374, 4374, 4380, 4380, 4389, 4389, 4395, 4392,
+    4398, 4398, 4404, 4404, 4410, 4410, 4416, 4416, 4422, 4422, 4428, 4428, 4434, 4434, 4443, 4440,
+    4446, 4446, 4452, 4452, 4461, 4458, 4467, 4464, 4470, 4470, 4476, 4476, 4482, 4482, 4491, 4488,
+    4494, 4494, 4500, 4500, 4506, 4506, 4512, 4512, 4518, 4518, 4524, 4524, 4530, 4530, 4536, 4536,
+    4542, 4542, 4548, 4548, 4554, 4554, 4560, 4560, 4566, 4566, 4572, 4572, 4578, 4578, 4584, 4584,
+    4590, 4590, 4596, 4596, 4602, 4602, 4608, 4608, 4614, 4614, 4620, 4620, 4626, 4626, 4632, 4632,
+    4638, 4638, 4644, 4644, 4650, 4650, 4656, 4656, 4662, 4662, 4668, 4668, 4674, 4674, 4680, 4680,
+    4686, 4686, 4692, 4692, 4698, 4698, 4704, 4704, 4710, 4710, 4716, 4716, 4722, 4722, 4728, 4728,
+    4734, 4734, 4740, 4740, 4746, 4746, 4752, 4752, 4758, 4758, 4764, 4764, 4770, 4770, 4776, 4776,
+    4782, 4782, 4788, 4788, 4794, 4794, 4800, 4800, 4806, 4806, 4812, 4812, 4818, 4818, 4824, 4824,
+    4830, 4830, 4836, 4836, 4842, 4842, 4848, 4848, 4854, 4854, 4860, 4860, 4866, 4866, 4872, 4872,
+    4878, 4875, 4884, 4884, 4890, 4890, 4896, 4896, 4902, 4902, 4908, 4905, 4914, 4911, 4920, 4920,
+    4926, 4926, 4932, 4929, 4938, 4935, 4944, 4941, 4950, 4950, 4956, 4956, 4962, 4959, 4968, 4965,
+    4974, 4974, 4980, 4977, 4983, 4986, 4992, 4992, 4995, 4995, 5004, 5001, 5010, 5007, 5016, 5013,
+    5019, 5019, 5028, 5028, 5031, 5031, 5040, 5037, 5043, 5043, 5049, 5046, 5055, 5052, 5058, 5058,
+    5064, 5064, 5070, 5070, 5073, 5073, 5076, 5076, 5082, 5082, 5085, 5085, 5091, 5091, 5091, 5091,
+    5094, 5097, 5100, 5100, 5103, 5100, 5103, 5103, 5106, 5106, 5109, 5109, 5109, 5109, 5112, 5112,
+    5112, 5112, 5115, 5115, 5118, 5115, 5118, 5118, 5121, 5118, 5118, 5118, 5121, 5121, 5121, 5121,
+    5121, 5121, 5124, 5124, 5124, 5124, 5124, 5121, 5124, 5124, 5127, 5127, 5127, 5127, 5127, 5127,
+    5127, 5127, 5127, 5130, 5130, 5130, 5130, 5130, 5130, 5130, 5130, 5130, 5130, 5130, 5133, 5133,
+    5133, 5133, 5133, 5133, 5133, 5133, 5133, 5133, 5136, 5136, 5136, 5136, 5136, 5136, 5136, 5136,
+    5133, 5136, 5136, 5139, 5136, 5136, 5139, 5139, 5139, 5139, 5139, 5136, 5136, 5139, 5139, 5139,
+    5139, 5139, 5139, 5142, 5142, 5142, 5142, 5142, 5142, 5142, 5142, 5142, 5142, 5142, 5142, 5142,
+    5142, 5142, 5142, 5142, 5142, 5142, 5145, 5142, 5142, 5145, 5145, 5142, 5142, 5142, 5145, 5142,
+    5142, 5142, 5145, 5145, 5148, 5145, 5145, 5145, 5148, 5145, 5145, 5145, 5145, 5145, 5148, 5148,
+    5145, 5148, 5145, 5148, 5148, 5148, 5148, 5148, 5145, 5148, 5145, 5148, 5148, 5148, 5148, 5148,
+    5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5151, 5145,
+    5151, 5145, 5148, 5148, 5151, 5148, 5148, 5148, 5148, 5148, 5148, 5145, 5145, 5145, 5148, 5145,
+    5148, 5148, 5148, 5148, 5148, 5148, 5145, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5145,
+    5148, 5151, 5148, 5148, 5145, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148,
+    5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5151, 5148, 5148, 5145, 5148, 5148, 5148,
+    5145, 5148, 5148, 5148, 5148, 5145, 5148, 5148, 5148, 5151, 5148, 5148, 5148, 5148, 5148, 5148,
+    5151, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5145, 5148, 5148, 5148, 5145, 5148,
+    5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5151, 5148, 5148, 5148, 5148,
+    5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5148, 5151, 5148, 5151,
+};
+
+extern const int16_t Vca3[codeCount] = {
+    -4920, -4920, -4920, -4920, -4920, -4920, -4923, -4923, -4923, -4923, -4923, -4923, -4923, -4923, -4923, -4923,
+    -4923, -4923, -4923, -4923, -4923, -4923, -4923, -4923, -4923, -4923, -4923, -4923, -4923, -4923, -4923, -4923,
+    -4923, -4923, -4923, -4923, -4923, -4923, -4923, -4923, -4923, -4920, -4923, -4923, -4923, -4923, -4923, -4920,
+    -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920,
+    -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920,
+    -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920,
+    -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920,
+    -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4920, -4917, -4917, -4917, -4917, -4917, -4917, -4917,
+    -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917,
+    -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917,
+    -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4917, -4914, -4917, -4914,
+    -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914,
+    -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914,
+    -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4914, -4911, -4911, -4911, -4914, -4911, -4911, -4911,
+    -4911, -4911, -4911, -4911, -4911, -4911, -4911, -4911, -4911, -4911, -4911, -4911, -4911, -4911, -4911, -4911,
+    -4911, -4911, -4911, -4911, -4911, -4911, -4911, -4911, -4911, -4908, -4911, -4908, -4908, -4908, -4908, -4908,
+    -4908, -4908, -4908, -4908, -4908, -4908, -4908, -4908, -4908, -4908, -4908, -4908, -4908, -4908, -4908, -4908,
+    -4908, -4905, -4908, -4905, -4908, -4905, -4908, -4905, -4908, -4905, -4908, -4905, -4905, -4905, -4905, -4905,
+    -4905, -4905, -4905, -4905, -4905, -4905, -4905, -4905, -4905, -4905, -4905, -4905, -4905, -4902, -4902, -4902,
+    -4902, -4902, -4902, -4902, -4902, -4902, -4902, -4902, -4902, -4902, -4902, -4899, -4899, -4902, -4902, -4902,
+    -4902, -4902, -4902, -4899, -4899, -4899, -4899, -4899, -4899, -4899, -4899, -4899, -4899, -4899, -4896, -4896,
+    -4896, -4896, -4896, -4896, -4896, -4896, -4896, -4896, -4893, -4893, -4896, -4893, -4893, -4893, -4893, -4893,
+    -4890, -4890, -4893, -4890, -4890, -4887, -4890, -4887, -4887, -4887, -4884, -4884, -4887, -4884, -4884, -4884,
+    -4881, -4881, -4881, -4878, -4878, -4875, -4878, -4872, -4872, -4869, -4872, -4869, -4869, -4866, -4866, -4863,
+    -4863, -4860, -4860, -4857, -4857, -4851, -4851, -4848, -4848, -4845, -4845, -4839, -4839, -4836, -4836, -4830,
+    -4830, -4827, -4827, -4821, -4821, -4818, -4818, -4812, -4812, -4809, -4806, -4803, -4803, -4797, -4797, -4794,
+    -4794, -4788, -4788, -4782, -4782, -4776, -4776, -4773, -4773, -4767, -4767, -4761, -4761, -4755, -4755, -4752,
+    -4749, -4746, -4746, -4740, -4740, -4734, -4734, -4728, -4728, -4722, -4722, -4719, -4716, -4713, -4713, -4707,
+    -4707, -4701, -4701, -4695, -4695, -4689, -4689, -4686, -4683, -4680, -4680, -4674, -4674, -4668, -4668, -4662,
+    -4662, -4656, -4656, -4650, -4650, -4644, -4644, -4641, -4641, -4635, -4635, -4629, -4629, -4623, -4623, -4617,
+    -4617, -4614, -4611, -4608, -4605, -4602, -4599, -4596, -4596, -4590, -4590, -4584, -4584, -4578, -4578, -4572,
+    -4572, -4566, -4566, -4563, -4560, -4557, -4557, -4551, -4551, -4545, -4545, -4539, -4539, -4533, -4533, -4530,
+    -4530, -4524, -4524, -4518, -4518, -4512, -4512, -4506, -4506, -4500, -4500, -4494, -4494, -4488, -4488, -4485,
+    -4485, -4479, -4479, -4473, -4473, -4467, -4467, -4461, -4461, -4455, -4455, -4449, -4449, -4443, -4443, -4440,
+    -4437, -4434, -4431, -4428, -4428, -4422, -4422, -4416, -4416, -4410, -4410, -4404, -4404, -4398, -4398, -4392,
+    -4392, -4386, -4386, -4383, -4380, -4377, -4377, -4371, -4368, -4365, -4365, -4359, -4359, -4353, -4353, -4347,
+    -4347, -4341, -4341, -4338, -4335, -4332, -4329, -4326, -4323, -4320, -4317, -4314, -4314, -4308, -4308, -4302,
+    -4302, -4296, -4296, -4290, -4290, -4284, -4284, -4278, -4278, -4272, -4272, -4266, -4266, -4263, -4260, -4257,
+    -4254, -4251, -4251, -4245, -4245, -4239, -4239, -4233, -4233, -4227, -4227, -4221, -4221, -4215, -4215, -4209,
+    -4209, -4206, -4203, -4200, -4197, -4194, -4191, -4188, -4185, -4182, -4182, -4176, -4176, -4170, -4170, -4164,
+    -4164, -4158, -4158, -4152, -4152, -4149, -4146, -4143, -4140, -4137, -4134, -4131, -4128, -4125, -4125, -4119,
+    -4119, -4113, -4113, -4107, -4107, -4101, -4101, -4095, -4095, -4089, -4089, -4083, -4083, -4077, -4077, -4074,
+    -4071, -4068, -4065, -4062, -4062, -4056, -4053, -4050, -4050, -4044, -4041, -4038, -4038, -4032, -4032, -4026,
+    -4026, -4020, -4020, -4014, -4014, -4008, -4008, -4002, -4002, -3996, -3996, -3990, -3990, -3987, -3984, -3981,
+    -3981, -3975, -3975, -3969, -3969, -3963, -3963, -3957, -3957, -3951, -3951, -3945, -3945, -3939, -3939, -3933,
+    -3933, -3927, -3927, -3921, -3921, -3915, -3915, -3912, -3909, -3906, -3903, -3900, -3897, -3894, -3891, -3888,
+    -3888, -3882, -3882, -3876, -3876, -3870, -3870, -3864, -3864, -3858, -3858, -3852, -3852, -3846, -3846, -3840,
+    -3840, -3834, -3834, -3831, -3828, -3822, -3822, -3819, -3816, -3813, -3810, -3807, -3804, -3801, -3798, -3795,
+    -3795, -3789, -3789, -3783, -3783, -3777, -3777, -3771, -3771, -3765, -3765, -3759, -3759, -3753, -3753, -3750,
+    -3747, -3744, -3741, -3738, -3735, -3732, -3729, -3726, -3723, -3720, -3720, -3714, -3714, -3708, -3708, -3702,
+    -3702, -3696, -3696, -3690, -3690, -3684, -3684, -3678, -3678, -3672, -3672, -3666, -3666, -3663, -3660, -3657,
+    -3654, -3651, -3648, -3645, -3642, -3639, -3636, -3633, -3630, -3627, -3627, -3621, -3618, -3615, -3615, -3609,
+    -3609, -3603, -3603, -3597, -3597, -3591, -3591, -3585, -3585, -3579, -3579, -3573, -3573, -3567, -3567, -3564,
+    -3561, -3558, -3555, -3552, -3549, -3546, -3543, -3540, -3537, -3534, -3531, -3528, -3525, -3522, -3519, -3516,
+    -3516, -3510, -3510, -3504, -3504, -3498, -3498, -3492, -3492, -3486, -3486, -3480, -3480, -3474, -3474, -3471,
+    -3468, -3462, -3462, -3459, -3456, -3453, -3450, -3447, -3444, -3441, -3438, -3435, -3432, -3429, -3426, -3423,
+    -3423, -3417, -3417, -3411, -3411, -3405, -3405, -3399, -3399, -3393, -3393, -3387, -3387, -3381, -3381, -3378,
+    -3375, -3372, -3369, -3366, -3363, -3360, -3357, -3354, -3351, -3348, -3345, -3342, -3339, -3336, -3333, -3330,
+    -3327, -3324, -3324, -3318, -3318, -3312, -3312, -3306, -3306, -3300, -3300, -3294, -3294, -3288, -3288, -3282,
+    -3282, -3276, -3276, -3270, -3270, -3264, -3264, -3258, -3258, -3255, -3252, -3246, -3246, -3243, -3240, -3237,
+    -3234, -3231, -3228, -3225, -3222, -3219, -3216, -3213, -3210, -3207, -3204, -3201, -3201, -3195, -3195, -3189,
+    -3189, -3183, -3183, -3177, -3177, -3171, -3171, -3165, -3165, -3159, -3159, -3153, -3153, -3147, -3147, -3141,
+    -3141, -3138, -3135, -3129, -3129, -3126, -3123, -3117, -3117, -3114, -3111, -3108, -3105, -3102, -3099, -3096,
+    -3093, -3090, -3087, -3084, -3081, -3078, -3075, -3072, -3069, -3066, -3063, -3060, -3057, -3054, -3051, -3051,
+    -3048, -3045, -3042, -3039, -3036, -3033, -3030, -3027, -3024, -3021, -3018, -3015, -3012, -3009, -3006, -3003,
+    -3000, -2997, -2994, -2991, -2991, -2985, -2982, -2979, -2979, -2973, -2973, -2967, -2967, -2961, -2961, -2955,
+    -2955, -2949, -2949, -2943, -2943, -2937, -2937, -2931, -2931, -2925, -2925, -2919, -2919, -2913, -2913, -2910,
+    -2907, -2904, -2901, -2898, -2895, -2892, -2889, -2886, -2883, -2880, -2877, -2874, -2871, -2868, -2865, -2862,
+    -2859, -2856, -2853, -2850, -2847, -2844, -2841, -2838, -2838, -2832, -2832, -2826, -2826, -2820, -2817, -2814,
+    -2814, -2808, -2808, -2802, -2802, -2796, -2796, -2790, -2790, -2784, -2784, -2778, -2778, -2772, -2772, -2766,
+    -2766, -2763, -2760, -2757, -2754, -2748, -2748, -2745, -2742, -2739, -2736, -2733, -2730, -2727, -2724, -2721,
+    -2718, -2715, -2712, -2709, -2706, -2703, -2700, -2697, -2694, -2691, -2688, -2685, -2682, -2679, -2676, -2673,
+    -2673, -2667, -2667, -2661, -2661, -2655, -2655, -2649, -2649, -2643, -2643, -2637, -2637, -2631, -2631, -2628,
+    -2625, -2622, -2619, -2616, -2613, -2610, -2607, -2604, -2601, -2598, -2595, -2592, -2589, -2586, -2583, -2580,
+    -2577, -2574, -2571, -2568, -2565, -2562, -2559, -2556, -2553, -2550, -2547, -2544, -2541, -2538, -2535, -2532,
+    -2529, -2526, -2526, -2520, -2517, -2514, -2511, -2508, -2508, -2502, -2499, -2496, -2496, -2490, -2490, -2487,
+    -2484, -2478, -2478, -2472, -2472, -2466, -2466, -2460, -2460, -2454, -2454, -2451, -2448, -2445, -2442, -2436,
+    -2436, -2433, -2430, -2427, -2424, -2421, -2418, -2415, -2412, -2409, -2406, -2403, -2400, -2397, -2394, -2391,
+    -2388, -2385, -2382, -2379, -2376, -2373, -2370, -2367, -2364, -2361, -2358, -2355, -2352, -2349, -2346, -2343,
+    -2340, -2337, -2334, -2331, -2331, -2325, -2322, -2319, -2316, -2313, -2310, -2307, -2307, -2301, -2301, -2298,
+    -2295, -2292, -2289, -2286, -2283, -2280, -2277, -2274, -2271, -2268, -2265, -2262, -2259, -2256, -2253, -2250,
+    -2247, -2244, -2241, -2238, -2235, -2232, -2229, -2226, -2223, -2220, -2217, -2214, -2211, -2208, -2205, -2202,
+    -2202, -2196, -2193, -2190, -2190, -2184, -2181, -2178, -2175, -2172, -2172, -2166, -2166, -2160, -2160, -2154,
+    -2154, -2148, -2148, -2142, -2142, -2136, -2136, -2133, -2130, -2124, -2124, -2121, -2118, -2115, -2112, -2109,
+    -2106, -2103, -2100, -2097, -2094, -2091, -2088, -2085, -2082, -2079, -2076, -2073, -2070, -2067, -2064, -2061,
+    -2058, -2055, -2052, -2049, -2046, -2043, -2040, -2037, -2034, -2031, -2028, -2025, -2022, -2019, -2016, -2013,
+    -2010, -2007, -2004, -2001, -2001, -1995, -1992, -1989, -1989, -1983, -1983, -1977, -1974, -1971, -1971, -1965,
+    -1965, -1959, -1959, -1953, -1953, -1950, -1947, -1944, -1941, -1938, -1935, -1932, -1929, -1926, -1923, -1920,
+    -1917, -1914, -1911, -1908, -1905, -1902, -1899, -1896, -1893, -1890, -1887, -1884, -1881, -1878, -1875, -1872,
+    -1869, -1866, -1863, -1860, -1857, -1854, -1851, -1848, -1845, -1842, -1842, -1836, -1833, -1830, -1830, -1824,
+    -1824, -1821, -1818, -1812, -1812, -1809, -1806, -1803, -1800, -1797, -1794, -1788, -1788, -1785, -1782, -1779,
+    -1776, -1773, -1770, -1767, -1764, -1761, -1758, -1755, -1752, -1749, -1746, -1743, -1740, -1737, -1734, -1731,
+    -1728, -1725, -1722, -1719, -1716, -1713, -1710, -1707, -1704, -1701, -1698, -1695, -1692, -1689, -1686, -1683,
+    -1680, -1677, -1674, -1671, -1668, -1665, -1662, -1659, -1656, -1653, -1653, -1647, -1647, -1641, -1641, -1638,
+    -1635, -1632, -1629, -1626, -1623, -1620, -1617, -1614, -1611, -1608, -1605, -1602, -1599, -1596, -1593, -1590,
+    -1587, -1584, -1581, -1578, -1575, -1572, -1569, -1566, -1563, -1560, -1557, -1554, -1551, -1548, -1545, -1545,
+    -1542, -1539, -1536, -1533, -1530, -1527, -1524, -1521, -1518, -1515, -1512, -1509, -1506, -1503, -1500, -1497,
+    -1494, -1491, -1488, -1485, -1482, -1479, -1476, -1473, -1470, -1467, -1464, -1461, -1458, -1455, -1455, -1449,
+    -1449, -1446, -1443, -1437, -1437, -1431, -1431, -1425, -1425, -1422, -1419, -1416, -1413, -1410, -1407, -1404,
+    -1401, -1398, -1395, -1392, -1389, -1386, -1383, -1380, -1377, -1374, -1371, -1368, -1365, -1362, -1359, -1356,
+    -1353, -1350, -1347, -1344, -1341, -1338, -1335, -1332, -1329, -1326, -1323, -1320, -1317, -1314, -1311, -1308,
+    -1305, -1302, -1299, -1296, -1293, -1290, -1287, -1284, -1284, -1278, -1275, -1272, -1272, -1266, -1263, -1263,
+    -1260, -1257, -1254, -1251, -1248, -1245, -1242, -1239, -1236, -1233, -1230, -1227, -1224, -1221, -1218, -1215,
+    -1212, -1209, -1206, -1203, -1200, -1197, -1194, -1191, -1188, -1185, -1182, -1179, -1176, -1173, -1170, -1167,
+    -1164, -1161, -1158, -1155, -1152, -1149, -1149, -1146, -1140, -1137, -1137, -1134, -1131, -1128, -1125, -1122,
+    -1119, -1116, -1113, -1110, -1107, -1104, -1101, -1098, -1095, -1092, -1089, -1086, -1083, -1080, -1077, -1074,
+    -1071, -1068, -1065, -1062, -1059, -1056, -1053, -1050, -1047, -1044, -1041, -1038, -1035, -1032, -1029, -1026,
+    -1023, -1020, -1017, -1014, -1011, -1008, -1005, -1002, -1002, -999, -996, -990, -987, -984, -981, -981,
+    -978, -975, -972, -969, -966, -963, -960, -957, -954, -951, -948, -945, -942, -939, -936, -933,
+    -930, -927, -924, -921, -918, -915, -912, -909, -906, -903, -900, -897, -894, -891, -888, -888,
+    -882, -879, -876, -873, -873, -867, -864, -864, -861, -858, -855, -852, -849, -843, -843, -840,
+    -837, -834, -831, -828, -825, -822, -819, -816, -813, -810, -807, -804, -801, -798, -795, -792,
+    -789, -786, -783, -783, -780, -777, -774, -771, -768, -765, -762, -759, -756, -753, -750, -747,
+    -744, -741, -738, -735, -732, -729, -726, -723, -720, -717, -714, -711, -708, -705, -702, -699,
+    -696, -693, -690, -687, -684, -681, -678, -675, -672, -672, -669, -663, -660, -657, -654, -654,
+    -651, -648, -645, -642, -639, -636, -633, -630, -627, -624, -621, -618, -615, -612, -609, -606,
+    -603, -600, -597, -594, -591, -588, -585, -582, -579, -579, -573, -573, -567, -567, -564, -561,
+    -558, -555, -552, -549, -546, -543, -540, -537, -534, -531, -528, -525, -522, -519, -516, -513,
+    -510, -507, -504, -501, -498, -495, -492, -492, -489, -486, -483, -480, -474, -474, -471, -468,
+    -465, -462, -459, -456, -453, -450, -447, -444, -441, -438, -435, -432, -429, -426, -423, -423,
+    -420, -417, -414, -411, -408, -405, -402, -399, -396, -393, -390, -387, -384, -381, -378, -375,
+    -372, -369, -366, -363, -360, -357, -354, -354, -351, -348, -345, -342, -339, -336, -333, -330,
+    -327, -324, -321, -318, -315, -312, -309, -309, -303, -300, -300, -294, -294, -291, -288, -285,
+    -282, -279, -276, -273, -270, -267, -264, -261, -258, -255, -252, -249, -246, -243, -240, -240,
+    -237, -234, -231, -228, -225, -222, -219, -216, -213, -210, -207, -204, -201, -198, -195, -195,
+    -189, -186, -186, -183, -180, -177, -174, -171, -168, -165, -162, -159, -156, -153, -150, -147,
+    -144, -141, -138, -138, -135, -132, -129, -126, -123, -120, -117, -114, -111, -108, -105, -105,
+    -99, -99, -96, -93, -90, -87, -84, -81, -78, -75, -72, -69, -66, -63, -60, -57,
+    -54, -54, -51, -48, -45, -42, -39, -36, -33, -30, -27, -24, -21, -18, -15, -15,
+    -12, -9, -6, -3, 0, 3, 6, 9, 12, 15, 18, 21, 24, 24, 27, 30,
+    33, 36, 39, 42, 45, 48, 51, 51, 54, 57, 60, 63, 66, 69, 72, 75,
+    78, 81, 84, 84, 90, 90, 93, 96, 99, 102, 105, 108, 111, 114, 117, 117,
+    120, 123, 126, 129, 132, 135, 138, 141, 144, 147, 150, 150, 156, 156, 159, 162,
+    165, 168, 171, 174, 177, 180, 183, 186, 189, 192, 192, 195, 198, 201, 204, 207,
+    210, 213, 216, 219, 222, 222, 228, 228, 234, 234, 237, 240, 243, 246, 249, 252,
+    255, 258, 261, 261, 267, 267, 273, 273, 276, 279, 282, 285, 288, 291, 294, 294,
+    300, 300, 303, 306, 309, 312, 315, 318, 321, 324, 327, 330, 333, 336, 339, 342,
+    345, 348, 351, 351, 357, 357, 360, 363, 366, 369, 372, 375, 378, 381, 384, 387,
+    390, 390, 396, 396, 402, 402, 405, 408, 411, 414, 417, 420, 423, 426, 429, 432,
+    435, 438, 441, 444, 447, 447, 453, 453, 459, 459, 462, 465, 468, 471, 474, 477,
+    480, 483, 486, 489, 492, 495, 498, 498, 504, 507, 510, 510, 516, 516, 519, 522,
+    525, 528, 531, 534, 537, 540, 543, 546, 549, 552, 555, 558, 561, 564, 567, 567,
+    573, 573, 579, 579, 585, 585, 588, 591, 594, 597, 600, 603, 606, 609, 612, 615,
+    618, 621, 624, 627, 630, 633, 636, 639, 642, 645, 648, 651, 654, 654, 660, 660,
+    663, 666, 669, 672, 675, 678, 681, 684, 687, 690, 693, 693, 699, 702, 705, 705,
+    711, 711, 717, 717, 720, 723, 729, 729, 732, 735, 738, 741, 744, 747, 750, 753,
+    756, 759, 762, 765, 768, 771, 774, 774, 780, 780, 786, 786, 792, 792, 798, 798,
+    801, 804, 807, 810, 813, 816, 819, 822, 825, 828, 831, 834, 837, 840, 843, 846,
+    849, 849, 855, 855, 861, 861, 867, 867, 873, 873, 879, 879, 885, 885, 891, 891,
+    894, 897, 900, 903, 906, 909, 912, 915, 918, 921, 924, 927, 930, 933, 936, 939,
+    942, 945, 948, 948, 954, 954, 960, 960, 966, 966, 972, 972, 978, 978, 984, 984,
+    987, 990, 996, 996, 999, 1002, 1005, 1008, 1011, 1014, 1017, 1020, 1023, 1026, 1029, 1032,
+    1035, 1035, 1041, 1041, 1047, 1047, 1053, 1053, 1059, 1059, 1065, 1065, 1071, 1071, 1077, 1077,
+    1080, 1083, 1086, 1089, 1092, 1095, 1098, 1101, 1104, 1107, 1110, 1113, 1116, 1119, 1122, 1122,
+    1128, 1131, 1134, 1134, 1140, 1140, 1146, 1146, 1152, 1152, 1158, 1158, 1164, 1164, 1170, 1170,
+    1176, 1176, 1179, 1182, 1185, 1188, 1191, 1194, 1197, 1200, 1203, 1206, 1209, 1212, 1215, 1218,
+    1221, 1224, 1227, 1227, 1233, 1233, 1239, 1239, 1245, 1245, 1251, 1251, 1257, 1257, 1263, 1263,
+    1266, 1269, 1275, 1275, 1278, 1281, 1284, 1287, 1290, 1293, 1296, 1299, 1302, 1305, 1308, 1311,
+    1314, 1317, 1320, 1323, 1326, 1329, 1332, 1335, 1338, 1341, 1344, 1347, 1350, 1350, 1356, 1356,
+    1362, 1362, 1368, 1368, 1374, 1374, 1380, 1380, 1386, 1386, 1389, 1392, 1398, 1398, 1404, 1404,
+    1407, 1407, 1413, 1413, 1419, 1419, 1425, 1425, 1431, 1431, 1437, 1437, 1443, 1443, 1449, 1449,
+    1455, 1455, 1461, 1461, 1467, 1467, 1473, 1473, 1476, 1479, 1482, 1485, 1488, 1491, 1494, 1497,
+    1500, 1503, 1506, 1509, 1512, 1515, 1518, 1518, 1524, 1527, 1530, 1530, 1536, 1536, 1542, 1542,
+    1548, 1548, 1551, 1554, 1560, 1560, 1563, 1566, 1569, 1572, 1575, 1578, 1581, 1584, 1587, 1590,
+    1593, 1596, 1599, 1599, 1605, 1605, 1611, 1611, 1617, 1617, 1623, 1623, 1629, 1629, 1635, 1635,
+    1641, 1641, 1647, 1647, 1650, 1653, 1659, 1659, 1662, 1665, 1668, 1671, 1674, 1677, 1680, 1683,
+    1686, 1689, 1692, 1695, 1698, 1701, 1704, 1707, 1710, 1710, 1716, 1719, 1722, 1722, 1728, 1728,
+    1734, 1734, 1740, 1740, 1746, 1746, 1752, 1752, 1758, 1758, 1764, 1764, 1767, 1770, 1776, 1776,
+    1779, 1782, 1785, 1788, 1791, 1794, 1797, 1800, 1803, 1806, 1809, 1812, 1815, 1818, 1821, 1821,
+    1827, 1827, 1833, 1833, 1839, 1839, 1845, 1845, 1851, 1851, 1857, 1857, 1863, 1863, 1869, 1869,
+    1872, 1875, 1878, 1881, 1884, 1887, 1890, 1893, 1896, 1899, 1902, 1905, 1908, 1911, 1914, 1917,
+    1920, 1923, 1926, 1926, 1932, 1935, 1938, 1938, 1944, 1947, 1950, 1950, 1956, 1956, 1962, 1962,
+    1968, 1968, 1974, 1974, 1980, 1980, 1983, 1986, 1992, 1992, 1995, 1998, 2001, 2004, 2007, 2010,
+    2013, 2016, 2019, 2022, 2025, 2028, 2031, 2034, 2037, 2040, 2043, 2046, 2049, 2049, 2055, 2055,
+    2061, 2061, 2067, 2067, 2073, 2073, 2079, 2079, 2085, 2085, 2091, 2091, 2097, 2097, 2103, 2103,
+    2109, 2109, 2115, 2115, 2121, 2121, 2127, 2127, 2130, 2133, 2136, 2139, 2145, 2145, 2148, 2148,
+    2154, 2154, 2160, 2160, 2166, 2166, 2172, 2172, 2178, 2178, 2184, 2184, 2190, 2190, 2196, 2196,
+    2202, 2202, 2208, 2208, 2214, 2214, 2220, 2220, 2223, 2226, 2229, 2232, 2235, 2238, 2241, 2244,
+    2247, 2250, 2253, 2256, 2259, 2262, 2265, 2268, 2271, 2271, 2277, 2277, 2283, 2283, 2289, 2289,
+    2295, 2295, 2301, 2301, 2307, 2307, 2313, 2313, 2319, 2319, 2325, 2325, 2331, 2331, 2337, 2337,
+    2340, 2343, 2346, 2349, 2352, 2355, 2358, 2361, 2364, 2367, 2370, 2373, 2376, 2379, 2382, 2382,
+    2388, 2388, 2394, 2394, 2400, 2400, 2406, 2406, 2412, 2412, 2418, 2418, 2424, 2424, 2430, 2430,
+    2436, 2436, 2442, 2442, 2448, 2448, 2454, 2454, 2460, 2460, 2466, 2466, 2472, 2472, 2478, 2478,
+    2481, 2484, 2490, 2490, 2493, 2496, 2499, 2502, 2505, 2508, 2511, 2514, 2517, 2520, 2523, 2523,
+    2529, 2529, 2535, 2535, 2541, 2541, 2547, 2547, 2553, 2553, 2559, 2559, 2565, 2565, 2571, 2571,
+    2577, 2577, 2583, 2583, 2589, 2589, 2595, 2595, 2598, 2601, 2604, 2607, 2610, 2613, 2616, 2619,
+    2622, 2625, 2628, 2628, 2634, 2637, 2640, 2640, 2646, 2649, 2652, 2652, 2658, 2658, 2664, 2664,
+    2670, 2670, 2676, 2676, 2682, 2682, 2688, 2688, 2694, 2694, 2700, 2700, 2706, 2706, 2712, 2712,
+    2715, 2718, 2721, 2724, 2727, 2730, 2733, 2736, 2739, 2742, 2745, 2748, 2751, 2754, 2757, 2757,
+    2763, 2763, 2769, 2769, 2775, 2775, 2781, 2781, 2787, 2787, 2793, 2793, 2799, 2799, 2805, 2805,
+    2811, 2811, 2817, 2817, 2823, 2823, 2829, 2829, 2835, 2835, 2841, 2841, 2847, 2847, 2853, 2853,
+    2856, 2859, 2862, 2865, 2868, 2871, 2874, 2877, 2880, 2883, 2886, 2889, 2892, 2892, 2898, 2898,
+    2904, 2904, 2910, 2910, 2913, 2916, 2922, 2922, 2925, 2928, 2931, 2934, 2937, 2940, 2943, 2946,
+    2949, 2949, 2955, 2955, 2961, 2961, 2967, 2967, 2973, 2973, 2979, 2979, 2985, 2985, 2991, 2991,
+    2997, 2997, 3003, 3003, 3009, 3009, 3015, 3015, 3021, 3021, 3027, 3027, 3033, 3033, 3039, 3039,
+    3045, 3045, 3051, 3051, 3057, 3057, 3063, 3063, 3066, 3069, 3072, 3075, 3078, 3081, 3084, 3084,
+    3090, 3090, 3096, 3096, 3102, 3102, 3108, 3108, 3114, 3114, 3120, 3120, 3126, 3126, 3132, 3132,
+    3138, 3138, 3144, 3144, 3150, 3150, 3156, 3156, 3162, 3162, 3168, 3168, 3174, 3174, 3180, 3180,
+    3186, 3186, 3189, 3192, 3195, 3198, 3201, 3204, 3207, 3207, 3213, 3216, 3219, 3222, 3225, 3225,
+    3231, 3231, 3237, 3237, 3243, 3243, 3249, 3249, 3255, 3255, 3261, 3261, 3267, 3267, 3273, 3273,
+    3279, 3279, 3285, 3285, 3291, 3291, 3297, 3297, 3303, 3303, 3309, 3309, 3312, 3315, 3318, 3321,
+    3324, 3327, 3330, 3333, 3336, 3339, 3342, 3345, 3348, 3348, 3354, 3354, 3360, 3360, 3366, 3366,
+    3372, 3372, 3378, 3378, 3384, 3384, 3390, 3390, 3396, 3396, 3402, 3402, 3408, 3408, 3414, 3414,
+    3420, 3420, 3426, 3426, 3432, 3432, 3435, 3438, 3441, 3444, 3447, 3447, 3453, 3456, 3459, 3459,
+    3465, 3465, 3471, 3471, 3477, 3477, 3483, 3483, 3489, 3489, 3495, 3495, 3501, 3501, 3507, 3507,
+    3513, 3513, 3519, 3519, 3525, 3525, 3531, 3531, 3537, 3537, 3543, 3543, 3549, 3549, 3555, 3555,
+    3558, 3558, 3564, 3564, 3570, 3570, 3576, 3576, 3582, 3582, 3588, 3588, 3594, 3594, 3600, 3600,
+    3606, 3606, 3612, 3612, 3618, 3618, 3624, 3624, 3630, 3630, 3636, 3636, 3642, 3642, 3648, 3645,
+    3651, 3651, 3657, 3657, 3663, 3666, 3669, 3669, 3675, 3675, 3681, 3681, 3687, 3687, 3693, 3693,
+    3699, 3699, 3705, 3705, 3711, 3711, 3717, 3717, 3723, 3723, 3729, 3729, 3735, 3735, 3741, 3741,
+    3747, 3747, 3753, 3753, 3759, 3759, 3765, 3765, 3771, 3771, 3777, 3777, 3780, 3783, 3786, 3789,
+    3792, 3795, 3798, 3798, 3804, 3804, 3810, 3810, 3816, 3816, 3822, 3822, 3828, 3828, 3834, 3834,
+    3840, 3840, 3846, 3846, 3852, 3852, 3858, 3858, 3864, 3864, 3870, 3870, 3876, 3876, 3882, 3882,
+    3888, 3888, 3894, 3894, 3900, 3900, 3906, 3906, 3912, 3912, 3915, 3918, 3921, 3921, 3927, 3927,
+    3933, 3933, 3939, 3939, 3945, 3945, 3951, 3951, 3957, 3957, 3963, 3963, 3969, 3969, 3975, 3975,
+    3981, 3981, 3987, 3987, 3993, 3993, 3999, 3999, 4005, 4005, 4011, 4011, 4017, 4017, 4023, 4020,
+    4026, 4026, 4032, 4032, 4038, 4038, 4044, 4044, 4050, 4050, 4056, 4056, 4062, 4062, 4068, 4068,
+    4074, 4074, 4080, 4080, 4086, 4086, 4092, 4092, 4098, 4098, 4104, 4104, 4110, 4110, 4116, 4116,
+    4122, 4122, 4128, 4128, 4134, 4134, 4140, 4140, 4143, 4146, 4152, 4152, 4158, 4158, 4164, 4161,
+    4167, 4170, 4173, 4173, 4179, 4179, 4185, 4185, 4191, 4191, 4197, 4197, 4203, 4203, 4209, 4209,
+    4215, 4215, 4221, 4221, 4227, 4227, 4233, 4233, 4239, 4239, 4245, 4245, 4251, 4251, 4257, 4257,
+    4263, 4263, 4269, 4269, 4275, 4275, 4281, 4281, 4287, 4284, 4290, 4290, 4296, 4299, 4302, 4302,
+    4308, 4308, 4314, 4314, 4320, 4320, 4326, 4326, 4332, 4332, 4338, 4338, 4344, 4344, 4350, 4350,
+    4356, 4356, 4362, 4362, 4368, 4368, 4374, 4374, 4380, 4380, 4386, 4386, 4392, 4392, 4398, 4395,
+    4401, 4401, 4407, 4407, 4413, 4413, 4419, 4419, 4425, 4425, 4431, 4431, 4437, 4437, 4443, 4443,
+    4449, 4449, 4455, 4455, 4461, 4461, 4467, 4467, 4473, 4470, 4479, 4479, 4485, 4482, 4491, 4488,
+    4494, 4494, 4500, 4500, 4506, 4506, 4512, 4512, 4518, 4518, 4524, 4524, 4530, 4530, 4536, 4536,
+    4542, 4542, 4548, 4548, 4554, 4554, 4560, 4560, 4566, 4566, 4572, 4572, 4578, 4578, 4584, 4584,
+    4590, 4590, 4596, 4596, 4602, 4599, 4608, 4605, 4611, 4611, 4617, 4617, 4623, 4623, 4629, 4629,
+    4635, 4635, 4641, 4641, 4647, 4647, 4653, 4653, 4659, 4659, 4665, 4665, 4671, 4671, 4677, 4677,
+    4683, 4683, 4689, 4689, 4695, 4695, 4701, 4701, 4707, 4707, 4713, 4713, 4719, 4719, 4725, 4722,
+    4731, 4728, 4737, 4737, 4740, 4740, 4746, 4746, 4752, 4752, 4758, 4758, 4764, 4764, 4770, 4770,
+    4776, 4776, 4782, 4782, 4788, 4788, 4794, 4794, 4800, 4800, 4806, 4806, 4812, 4812, 4818, 4815,
+    4824, 4821, 4830, 4827, 4836, 4833, 4839, 4839, 4845, 4845, 4854, 4851, 4857, 4857, 4863, 4863,
+    4869, 4869, 4875, 4875, 4881, 4881, 4887, 4887, 4893, 4893, 4899, 4899, 4905, 4905, 4911, 4911,
+    4917, 4917, 4923, 4923, 4929, 4926, 4935, 4935, 4941, 4938, 4944, 4944, 4950, 4953, 4959, 4956,
+    4962, 4962, 4968, 4968, 4974, 4974, 4980, 4980, 4986, 4983, 4989, 4989, 4992, 4995, 4998, 5001,
+    5004, 5001, 5007, 5010, 5010, 5013, 5016, 5016, 5019, 5019, 5022, 5022, 5025, 5028, 5028, 5031,
+    5028, 5031, 5034, 5031, 5034, 5034, 5037, 5037, 5037, 5037, 5040, 5040, 5040, 5040, 5043, 5043,
+    5046, 5046, 5046, 5046, 5049, 5046, 5049, 5046, 5052, 5049, 5049, 5049, 5052, 5052, 5052, 5055,
+    5055, 5055, 5052, 5055, 5058, 5055, 5055, 5055, 5058, 5058, 5058, 5058, 5058, 5058, 5061, 5061,
+    5061, 5061, 5061, 5061, 5061, 5061, 5061, 5064, 5064, 5064, 5064, 5064, 5064, 5067, 5064, 5064,
+    5067, 5064, 5067, 5064, 5067, 5064, 5067, 5067, 5064, 5067, 5067, 5067, 5067, 5067, 5070, 5070,
+    5067, 5070, 5070, 5070, 5070, 5070, 5070, 5070, 5070, 5070, 5070, 5070, 5073, 5070, 5073, 5073,
+    5073, 5073, 5073, 5073, 5073, 5073, 5073, 5073, 5076, 5076, 5073, 5073, 5076, 5076, 5076, 5076,
+    5079, 5076, 5076, 5079, 5076, 5076, 5079, 5076, 5079, 5076, 5079, 5079, 5079, 5079, 5079, 5079,
+    5079, 5079, 5079, 5079, 5079, 5079, 5079, 5079, 5079, 5079, 5082, 5079, 5079, 5079, 5079, 5082,
+    5082, 5082, 5079, 5082, 5082, 5082, 5079, 5079, 5079, 5082, 5082, 5082, 5079, 5079, 5082, 5079,
+    5082, 5082, 5079, 5082, 5082, 5079, 5079, 5082, 5082, 5082, 5079, 5082, 5079, 5079, 5079, 5082,
+    5082, 5079, 5082, 5082, 5079, 5082, 5082, 5079, 5085, 5082, 5076, 5082, 5079, 5082, 5082, 5082,
+    5079, 5079, 5079, 5082, 5082, 5079, 5082, 5082, 5082, 5082, 5082, 5079, 5082, 5082, 5079, 5082,
+    5082, 5079, 5079, 5085, 5079, 5079, 5082, 5082, 5079, 5082, 5079, 5082, 5079, 5082, 5082, 5079,
+    5082, 5082, 5079, 5079, 5082, 5082, 5079, 5082, 5082, 5079, 5082, 5079, 5082, 5082, 5082, 5079,
+    5076, 5079, 5079, 5082, 5082, 5082, 5079, 5082, 5082, 5082, 5082, 5082, 5079, 5079, 5082, 5079,
+    5079, 5082, 5079, 5079, 5079, 5079, 5079, 5079, 5082, 5082, 5082, 5079, 5079, 5082, 5082, 5079,
+    5082, 5079, 5082, 5082, 5079, 5082, 5079, 5082, 5079, 5082, 5079, 5079, 5082, 5082, 5082,
+};
+
+} // namespace Codes
+} // namespace WaveShaper
+} // namespace AudioMath
+} // namespace sspo
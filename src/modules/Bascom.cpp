@@ -119,6 +119,13 @@ struct BascomWidget : ModuleWidget
             module->configOutput (Comp::MAIN_OUTPUT, "Right");
         }
     }
+
+    void appendContextMenu (Menu* menu) override;
 };
 
+void BascomWidget::appendContextMenu (Menu* menu)
+{
+    sspo::appendOversampleFilterMenu (menu, module, Comp::OVERSAMPLE_FILTER_PARAM);
+}
+
 Model* modelBascom = createModel<Bascom, BascomWidget> ("Bascom");
\ No newline at end of file
@@ -98,6 +98,13 @@ struct CombFilterWidget : ModuleWidget
             module->configOutput (Comp::MAIN_OUTPUT, "Main");
         }
     }
+    void appendContextMenu (Menu* menu) override;
 };
 
+void CombFilterWidget::appendContextMenu (Menu* menu)
+{
+    sspo::appendInterpolationMenu (menu, module, Comp::INTERPOLATION_PARAM);
+    sspo::appendLimiterLookaheadMenu (menu, module, Comp::LIMITER_LOOKAHEAD_PARAM);
+}
+
 Model* modelCombFilter = createModel<CombFilter, CombFilterWidget> ("CombFilter");
\ No newline at end of file
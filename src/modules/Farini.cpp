@@ -160,6 +160,8 @@ void FariniWidget::appendContextMenu (Menu* menu)
     useNldMenuItem->text = "Waveshaping";
     useNldMenuItem->rightText = CHECKMARK (module->params[Comp::USE_NLD_PARAM].getValue());
     menu->addChild (useNldMenuItem);
+
+    sspo::appendOversampleFilterMenu (menu, module, Comp::OVERSAMPLE_FILTER_PARAM);
 }
 
 Model* modelFarini = createModel<Farini, FariniWidget> ("Farini");
\ No newline at end of file
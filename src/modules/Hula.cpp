@@ -106,6 +106,8 @@ void HulaWidget::appendContextMenu (Menu* menu)
     oversampleSlider->box.size.x = 200.0f;
     menu->addChild (oversampleSlider);
 
+    sspo::appendOversampleFilterMenu (menu, module, Comp::OVERSAMPLE_FILTER_PARAM);
+
     //Default tuning
 
     menu->addChild (new MenuEntry);
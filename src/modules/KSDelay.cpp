@@ -105,6 +105,13 @@ struct KSDelayWidget : ModuleWidget
             module->configOutput (Comp::OUT_OUTPUT, "Audio");
         }
     }
+    void appendContextMenu (Menu* menu) override;
 };
 
+void KSDelayWidget::appendContextMenu (Menu* menu)
+{
+    sspo::appendInterpolationMenu (menu, module, Comp::INTERPOLATION_PARAM);
+    sspo::appendUpdateDividerMenu (menu, module, Comp::PARAM_UPDATE_DIVIDER_PARAM);
+}
+
 Model* modelKSDelay = createModel<KSDelay, KSDelayWidget> ("KSDelay");
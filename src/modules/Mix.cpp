@@ -119,6 +119,9 @@ void MixWidget::appendContextMenu (Menu* menu)
     nldSlider->quantity = module->getParamQuantity (Comp::NLD_PARAM);
     nldSlider->box.size.x = 200.0f;
     menu->addChild (nldSlider);
+
+    sspo::appendAntialiasingMenu (menu, module, Comp::ANTIALIASING_PARAM);
+    sspo::appendOversampleFilterMenu (menu, module, Comp::OVERSAMPLE_FILTER_PARAM);
 }
 
 Model* modelMix = createModel<Mix, MixWidget> ("Mix");
\ No newline at end of file
@@ -23,6 +23,7 @@
 
 #include "IComposite.h"
 #include "../dsp/UtilityFilters.h"
+#include "../dsp/Sanitize.h"
 #include <memory>
 #include <vector>
 #include <array>
@@ -97,7 +98,6 @@ public:
         //resize arrays
         //initialise dsp object
 
-        sspo::AudioMath::defaultGenerator.seed (time (NULL));
         for (auto& d : dividers)
             d.setDivisor (divisorRate);
     }
@@ -178,8 +178,7 @@ inline void SLUGComp<TBase>::step()
 
         float_4 out = dcOutFilters[c / 4].process (in);
 
-        //simd'ed out = std::isfinite (out) ? out : 0;
-        out = rack::simd::ifelse ((movemask (out == out) != 0xF), float_4 (0.0f), out);
+        out = sspo::scrub (out);
 
         TBase::outputs[MAIN_OUTPUT].setVoltageSimd (out, c);
     }
@@ -22,7 +22,10 @@
 #include "componentlibrary.hpp"
 #include "ui/Slider.hpp"
 #include <string>
+#include <vector>
 #include "dsp/WaveShaper.h"
+#include "dsp/UtilityFilters.h"
+#include "dsp/FractionalDelay.h"
 
 namespace sspo
 {
@@ -163,7 +166,7 @@ namespace sspo
             float progress = quantity ? quantity->getScaledValue() : 0.0f;
             std::string text = quantity ? quantity->getLabel() + " : " : "";
             text += quantity
-                        ? sspo::AudioMath::WaveShaper::nld.getShapeName (int (quantity->getValue()))
+                        ? sspo::AudioMath::WaveShaper::nld().getShapeName (int (quantity->getValue()))
                         : "";
 
             bndSlider (args.vg,
@@ -179,6 +182,95 @@ namespace sspo
         }
     };
 
+    /// sets a param to a fixed value, used for radio style menu choices
+    struct ParamValueMenuItem : MenuItem
+    {
+        engine::Module* module;
+        int paramId;
+        float value;
+        void onAction (const event::Action& e) override
+        {
+            module->params[paramId].setValue (value);
+        }
+    };
+
+    /// a labelled radio style choice, the item names[i] sets paramId to values[i]
+    inline void appendParamChoiceMenu (Menu* menu,
+                                       engine::Module* module,
+                                       const int paramId,
+                                       const std::string& label,
+                                       const std::vector<std::string>& names,
+                                       const std::vector<float>& values)
+    {
+        assert (names.size() == values.size());
+        menu->addChild (new MenuEntry);
+
+        MenuLabel* menuLabel = new MenuLabel();
+        menuLabel->text = label;
+        menu->addChild (menuLabel);
+
+        for (auto i = 0U; i < names.size(); ++i)
+        {
+            auto* item = new ParamValueMenuItem;
+            item->module = module;
+            item->paramId = paramId;
+            item->value = values[i];
+            item->text = names[i];
+            item->rightText = CHECKMARK (module->params[paramId].getValue() == values[i]);
+            menu->addChild (item);
+        }
+    }
+
+    /// menu choice of the oversampling filters, paramId holds a sspo::OversampleFilter
+    inline void appendOversampleFilterMenu (Menu* menu, engine::Module* module, const int paramId)
+    {
+        appendParamChoiceMenu (menu,
+                               module,
+                               paramId,
+                               "Oversample Filter",
+                               { "IIR", "FIR Linear Phase", "FIR Minimum Phase" },
+                               { IIR_OVERSAMPLE_FILTER, LINEAR_PHASE_OVERSAMPLE_FILTER, MINIMUM_PHASE_OVERSAMPLE_FILTER });
+    }
+
+    /// menu choice of how a shaper suppresses aliasing, paramId holds a sspo::Antialiasing
+    inline void appendAntialiasingMenu (Menu* menu, engine::Module* module, const int paramId)
+    {
+        appendParamChoiceMenu (menu,
+                               module,
+                               paramId,
+                               "Antialiasing",
+                               { "Oversample", "ADAA" },
+                               { OVERSAMPLE_ANTIALIASING, ADAA_ANTIALIASING });
+    }
+
+    /// menu choice of the fractional delay reads, paramId holds a sspo::Interpolation
+    inline void appendInterpolationMenu (Menu* menu, engine::Module* module, const int paramId)
+    {
+        appendParamChoiceMenu (menu,
+                               module,
+                               paramId,
+                               "Interpolation",
+                               { "Linear", "Lagrange", "Allpass" },
+                               { LINEAR_INTERPOLATION, LAGRANGE_INTERPOLATION, ALLPASS_INTERPOLATION });
+    }
+
+    /// menu choice of the output limiter delaying the audio so it can catch every peak
+    inline void appendLimiterLookaheadMenu (Menu* menu, engine::Module* module, const int paramId)
+    {
+        appendParamChoiceMenu (menu, module, paramId, "Limiter Lookahead", { "Off", "On" }, { 0, 1 });
+    }
+
+    /// menu choice of how many samples apart the control rate work runs
+    inline void appendUpdateDividerMenu (Menu* menu, engine::Module* module, const int paramId)
+    {
+        appendParamChoiceMenu (menu,
+                               module,
+                               paramId,
+                               "Update Divider",
+                               { "1", "2", "4", "8", "16", "32", "64" },
+                               { 1, 2, 4, 8, 16, 32, 64 });
+    }
+
     inline NVGcolor green()
     {
         return nvgRGB (0x00, 128, 0x00);
@@ -50,6 +50,7 @@ extern void testEva();
 extern void testEmpty();
 extern void testAudioMath();
 extern void testCircularBuffer();
+extern void testDelayArena();
 extern void testLookupTable();
 extern void testAnalyzer();
 extern void testPolyShiftRegister();
@@ -60,6 +61,7 @@ extern void testMaccomo();
 extern void testBascom();
 extern void testAmburgh();
 extern void testSaturator();
+extern void testCompressor();
 extern void testUtilityFilter();
 extern void testLala();
 extern void testEva();
@@ -69,6 +71,9 @@ extern void testIverson();
 extern void testTriggerSequencer();
 extern void testWaveShaper();
 extern void testHula();
+extern void testParamSnapshot();
+extern void testRandom();
+extern void testSanitize();
 
 //external performance tests
 extern void initPerf();
@@ -109,6 +114,7 @@ int main (int argc, char** argv)
 
     // run external tests defined above
     // ADD NEWTEST
+    testParamSnapshot();
     testPatchNotes(); //valgrind ok
     testThru(); //valgrind ok
     testLalaStereo(); //valgrind ok
@@ -132,14 +138,18 @@ int main (int argc, char** argv)
     testZazel(); //valgrind ok
     //    //    testEasing();
     testSaturator(); //valgrind ok
+    testCompressor();
     testEmpty(); //valgrind ok
     testTestSignal(); //valgring ok
     testAudioMath(); //valgrind ok
+    testRandom();
+    testSanitize();
     testCircularBuffer(); //valgring ok
+    testDelayArena();
     testLookupTable(); //valgring ok
     testAnalyzer(); //valgring ok
     //    testPolyShiftRegister();
-    //    testKSDelay();
+    testKSDelay();
     testCombFilter(); //Fails Vailgrind
     testMaccomo(); //valgrin
     testUtilityFilter();
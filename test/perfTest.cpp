@@ -26,6 +26,7 @@ SOFTWARE.
 #include <time.h>
 #include <cmath>
 #include <limits>
+#include <memory>
 #include <random>
 
 #include "dsp/filter.hpp"
@@ -45,11 +46,17 @@ extern double overheadOutOnly;
 
 #include "MeasureTime.h"
 #include "TestComposite.h"
+#include "FftAnalyzer.h"
 
 #include "AudioMath.h"
 #include "CircularBuffer.h"
 #include "HardLimiter.h"
+#include "MirroredCircularBuffer.h"
 #include "LookupTable.h"
+#include "Random.h"
+#include "Sanitize.h"
+#include "SynthFilter.h"
+#include "SynthFilterII.h"
 #include "UtilityFilters.h"
 #include "WaveShaper.h"
 
@@ -58,6 +65,11 @@ extern double overheadOutOnly;
 #include "CombFilter.h"
 #include "Eva.h"
 #include "Zazel.h"
+#include "LaLa.h"
+#include "Amburgh.h"
+#include "Maccomo.h"
+#include "Bascom.h"
+#include "Mix.h"
 
 using float_4 = rack::simd::float_4;
 using namespace rack;
@@ -180,61 +192,35 @@ static void testNoise (bool useDefault)
                 return distribution (gen); },
         1);
 
+    std::uniform_real_distribution<float> uniformDistribution{ 0.0f, 1.0f };
     MeasureTime<float>::run (
-        overheadInOut, "rand01", []()
-        {
-            float x = rand01();
-            return x; },
+        overheadInOut, "std uniform (old rand01)", [&uniformDistribution, &defaultGenerator]()
+        { return uniformDistribution (defaultGenerator); },
         1);
 }
 
-static uint64_t xoroshiro128plus_state[2] = {};
-
-static uint64_t rotl (const uint64_t x, int k)
-{
-    return (x << k) | (x >> (64 - k));
-}
-
-static uint64_t xoroshiro128plus_next (void)
+static void testRandom()
 {
-    const uint64_t s0 = xoroshiro128plus_state[0];
-    uint64_t s1 = xoroshiro128plus_state[1];
-    const uint64_t result = s0 + s1;
-
-    s1 ^= s0;
-    xoroshiro128plus_state[0] = rotl (s0, 55) ^ s1 ^ (s1 << 14); // a, b
-    xoroshiro128plus_state[1] = rotl (s1, 36); // c
-
-    return result;
-}
+    sspo::Random random (99);
 
-float randomUniformX()
-{
-    // 24 bits of granularity is the best that can be done with floats while ensuring that the return value lies in [0.0, 1.0).
-    return (xoroshiro128plus_next() >> (64 - 24)) / powf (2, 24);
-}
+    MeasureTime<float>::run (
+        overheadInOut, "Random uniform", [&random]()
+        { return random.uniform(); },
+        1);
 
-float randomNormalX()
-{
-    // Box-Muller transform
-    float radius = sqrtf (-2.f * logf (1.f - randomUniformX()));
-    float theta = 2.f * M_PI * randomUniformX();
-    return radius * sinf (theta);
+    MeasureTime<float>::run (
+        overheadInOut, "Random uniform4, 4 values", [&random]()
+        { return random.uniform4()[0]; },
+        1);
 
-    // // Central Limit Theorem
-    // const int n = 8;
-    // float sum = 0.0;
-    // for (int i = 0; i < n; i++) {
-    // 	sum += randomUniform();
-    // }
-    // return (sum - n / 2.f) / sqrtf(n / 12.f);
-}
+    MeasureTime<float>::run (
+        overheadInOut, "Random gaussian", [&random]()
+        { return random.gaussian(); },
+        1);
 
-static void testNormal()
-{
     MeasureTime<float>::run (
-        overheadInOut, "normal", []()
-        { return randomNormalX(); },
+        overheadInOut, "Random gaussian4, 4 values", [&random]()
+        { return random.gaussian4()[0]; },
         1);
 }
 
@@ -274,9 +260,182 @@ static void testWaveShaper()
                                            TestBuffers<float>::get()),4);
             return x[0]; },
         1);
+
+    MeasureTime<float>::run (
+        overheadInOut, "nld.process 4x scalar", [&nld]()
+        {
+            auto x = float_4 (nld.process (TestBuffers<float>::get(), 4),
+                              nld.process (TestBuffers<float>::get(), 4),
+                              nld.process (TestBuffers<float>::get(), 4),
+                              nld.process (TestBuffers<float>::get(), 4));
+            return x[0]; },
+        1);
 }
 
 
+static void testAdaa()
+{
+    const auto& nld = sspo::AudioMath::WaveShaper::nld();
+    sspo::AudioMath::WaveShaper::Adaa<float_4> adaa;
+    MeasureTime<float>::run (
+        overheadInOut, "nld shaper simd 1x", [&nld]()
+        {
+            auto x = nld.process (float_4 (TestBuffers<float>::get()), 2);
+            return x[0]; },
+        1);
+
+    MeasureTime<float>::run (
+        overheadInOut, "nld adaa simd 1x", [&nld, &adaa]()
+        {
+            auto x = adaa.process (nld, float_4 (TestBuffers<float>::get()), 2);
+            return x[0]; },
+        1);
+
+    static constexpr int maxOversample = 12;
+    for (auto factor : { 2, 4, 8, 12 })
+    {
+        sspo::Upsampler<maxOversample, maxOversample, float_4> upsampler;
+        sspo::Decimator<maxOversample, maxOversample, float_4> decimator;
+        upsampler.setQuality (1);
+        decimator.setQuality (1);
+        upsampler.setOverSample (factor);
+        decimator.setOverSample (factor);
+        float_4 buffer[maxOversample];
+        std::string title = "nld iir oversample simd " + std::to_string (factor) + "x";
+        MeasureTime<float>::run (
+            overheadInOut, title.c_str(), [&nld, &upsampler, &decimator, &buffer, factor]()
+            {
+                upsampler.process (float_4 (TestBuffers<float>::get()), buffer);
+                nld.processBlock (buffer, buffer, factor, 2);
+                auto x = decimator.process (buffer);
+                return x[0]; },
+            1);
+    }
+
+    // the Mix composite, 16 channels through the shaper, oversampled against ADAA
+    using Mix = MixComp<TestComposite>;
+    for (auto antialiasing : { sspo::OVERSAMPLE_ANTIALIASING, sspo::ADAA_ANTIALIASING })
+    {
+        Mix mix;
+        mix.setSampleRate (44100.0f);
+        mix.init();
+        mix.params[Mix::NLD_PARAM].setValue (2.0f);
+        mix.params[Mix::ANTIALIASING_PARAM].setValue (antialiasing);
+        mix.inputs[Mix::ONE_INPUT].setChannels (16);
+        std::string title = std::string ("Mix 16 channels ") + (antialiasing == sspo::ADAA_ANTIALIASING ? "adaa" : "oversample");
+        MeasureTime<float>::run (
+            overheadInOut, title.c_str(), [&mix]()
+            {
+                mix.inputs[Mix::ONE_INPUT].setVoltage (TestBuffers<float>::get(), 0);
+                mix.step();
+                return mix.outputs[Mix::MAIN_OUTPUT].getVoltage (0); },
+            1);
+    }
+}
+
+// alias level of a 4981Hz tone through the shaper, ADAA at the base rate
+// against the IIR oversampling factors
+static void testAdaaAliasing()
+{
+    static constexpr int size = 32768;
+    static constexpr int p = 3701; // prime, 4981Hz at 44.1kHz
+    static constexpr int maxOversample = 12;
+    static constexpr int quality = 1; // Bascom default
+    const auto& nld = sspo::AudioMath::WaveShaper::nld();
+    auto sine = [] (const int i) -> float
+    { return 0.9f * float (std::sin (2.0 * M_PI * double (p) * i / size)); };
+
+    std::vector<float> signal (size);
+    for (auto shape : { 1, 2, 7, 9 })
+    {
+        for (auto i = 0; i < size; ++i)
+            signal[i] = nld.process (sine (i), shape);
+        auto naive = sspo::FftAnalyzer::getAliasDb (signal, p);
+
+        sspo::AudioMath::WaveShaper::Adaa<float> adaa;
+        for (auto i = 0; i < size; ++i)
+            adaa.process (nld, sine (i), shape);
+        for (auto i = 0; i < size; ++i)
+            signal[i] = adaa.process (nld, sine (i), shape);
+        auto adaaDb = sspo::FftAnalyzer::getAliasDb (signal, p);
+
+        printf ("%s alias: naive %f adaa 1x %f", nld.getShapeName (shape).c_str(), naive, adaaDb);
+        for (auto factor : { 2, 4, 8, 12 })
+        {
+            sspo::Upsampler<maxOversample, maxOversample, float> upsampler;
+            sspo::Decimator<maxOversample, maxOversample, float> decimator;
+            upsampler.setQuality (quality);
+            decimator.setQuality (quality);
+            upsampler.setOverSample (factor);
+            decimator.setOverSample (factor);
+            float buffer[maxOversample];
+            auto oversampled = [&] (const int i) -> float
+            {
+                // zero stuffing loses the gain of the oversample factor
+                upsampler.process (sine (i) * factor, buffer);
+                nld.processBlock (buffer, buffer, factor, shape);
+                return decimator.process (buffer);
+            };
+            for (auto i = 0; i < size; ++i)
+                oversampled (i);
+            for (auto i = 0; i < size; ++i)
+                signal[i] = oversampled (i);
+            printf (" iir %dx %f", factor, sspo::FftAnalyzer::getAliasDb (signal, p));
+        }
+        printf ("\n");
+    }
+}
+
+// round trip cost of one float_4 sample, up to the oversampled rate and back
+static void testOversample()
+{
+    static constexpr int maxOversample = 16;
+    for (auto factor : { 2, 4, 8, 16 })
+    {
+        for (auto quality : { 1, 12 })
+        {
+            sspo::Upsampler<maxOversample, 12, float_4> upsampler;
+            sspo::Decimator<maxOversample, 12, float_4> decimator;
+            upsampler.setQuality (quality);
+            decimator.setQuality (quality);
+            upsampler.setOverSample (factor);
+            decimator.setOverSample (factor);
+            float_4 buffer[maxOversample];
+            std::string title = "iir oversample quality " + std::to_string (quality) + " "
+                                + std::to_string (factor) + "x";
+            MeasureTime<float>::run (
+                overheadInOut, title.c_str(), [&upsampler, &decimator, &buffer]()
+                {
+                    upsampler.process (float_4 (TestBuffers<float>::get()), buffer);
+                    auto x = decimator.process (buffer);
+                    return x[0]; },
+                1);
+        }
+
+        for (auto phase : { sspo::HalfBandPhase::Linear, sspo::HalfBandPhase::Minimum })
+        {
+            sspo::HalfBandUpsampler<maxOversample, float_4> upsampler;
+            sspo::HalfBandDecimator<maxOversample, float_4> decimator;
+            upsampler.setPhase (phase);
+            decimator.setPhase (phase);
+            upsampler.setOverSample (factor);
+            decimator.setOverSample (factor);
+            float_4 buffer[maxOversample];
+            std::string title = std::string ("half-band ")
+                                + (phase == sspo::HalfBandPhase::Linear ? "linear" : "minimum")
+                                + " phase oversample " + std::to_string (factor) + "x, latency "
+                                + std::to_string (upsampler.getLatency() + decimator.getLatency());
+            MeasureTime<float>::run (
+                overheadInOut, title.c_str(), [&upsampler, &decimator, &buffer]()
+                {
+                    upsampler.process (float_4 (TestBuffers<float>::get()), buffer);
+                    auto x = decimator.process (buffer);
+                    return x[0]; },
+                1);
+        }
+    }
+}
+
 static void testLookupTable()
 {
     MeasureTime<float>::run (
@@ -384,6 +543,210 @@ static void testLookupTable()
         1);
 }
 
+// compares building the lookup tables once per translation unit, as the
+// old header statics did, with the shared registry
+static void testLookupRegistry()
+{
+    namespace lt = sspo::AudioMath::LookupTable;
+    namespace ws = sspo::AudioMath::WaveShaper;
+    static constexpr int translationUnits = 21;
+
+    auto t0 = SqTime::seconds();
+    size_t perUnitBytes = 0;
+    for (auto i = 0; i < translationUnits; ++i)
+    {
+        std::vector<lt::Table<float>> tables;
+        tables.push_back (lt::makeSineTable());
+        tables.push_back (lt::makePow2Table());
+        tables.push_back (lt::makePow10Table());
+        tables.push_back (lt::makeLog10Table());
+        tables.push_back (lt::makeUnisonSpreadTable());
+        tables.push_back (lt::makeHulaSineTable());
+        std::unique_ptr<ws::NldTables> nldTables (new ws::NldTables());
+        perUnitBytes = sizeof (ws::NldTables);
+        for (const auto& t : tables)
+            perUnitBytes += lt::sizeInBytes (t);
+    }
+    auto t1 = SqTime::seconds();
+
+    auto sharedBytes = lt::Registry::buildAll();
+    ws::nld();
+    sharedBytes += sizeof (ws::NldTables);
+    auto t2 = SqTime::seconds();
+
+    printf ("\nlookup tables per translation unit (%d units) %f seconds, %zu bytes\n",
+            translationUnits,
+            t1 - t0,
+            perUnitBytes * translationUnits);
+    printf ("lookup tables shared registry %f seconds, %zu bytes\n", t2 - t1, sharedBytes);
+    fflush (stdout);
+}
+
+static void testCircularBufferTaps (const int taps)
+{
+    CircularBuffer<float> c;
+    for (auto i = 0; i < c.size(); ++i)
+        c.writeBuffer (static_cast<float> (i % 100) * 0.01f);
+
+    // unison style taps, a moving base delay with fixed fractional spacing
+    float delays[8];
+    float out[8];
+    float base = 100.0f;
+    auto moveTaps = [&delays, &base, taps]()
+    {
+        base = base > 3000.0f ? 100.0f : base + 0.37f;
+        for (auto i = 0; i < taps; ++i)
+            delays[i] = base + i * 13.1f;
+    };
+
+    std::string title = "Circular Buffer readBuffer, taps " + std::to_string (taps);
+    MeasureTime<float>::run (
+        overheadInOut, title.c_str(), [&]()
+        {
+            moveTaps();
+            auto sum = 0.0f;
+            for (auto i = 0; i < taps; ++i)
+                sum += c.readBuffer (delays[i]);
+            return sum; },
+        1);
+
+    title = "Circular Buffer readTaps, taps " + std::to_string (taps);
+    MeasureTime<float>::run (
+        overheadInOut, title.c_str(), [&]()
+        {
+            moveTaps();
+            c.readTaps (delays, out, taps);
+            auto sum = 0.0f;
+            for (auto i = 0; i < taps; ++i)
+                sum += out[i];
+            return sum; },
+        1);
+
+    if (taps % 4 == 0)
+    {
+        title = "Circular Buffer readTaps float_4, taps " + std::to_string (taps);
+        MeasureTime<float>::run (
+            overheadInOut, title.c_str(), [&]()
+            {
+                moveTaps();
+                auto sum = float_4::zero();
+                for (auto i = 0; i < taps; i += 4)
+                    sum += c.readTaps (float_4::load (delays + i));
+                return sum[0] + sum[1] + sum[2] + sum[3]; },
+            1);
+    }
+}
+
+// a comb style write and fractional read on every channel, one scalar buffer per
+// channel against four channels interleaved per float_4 buffer
+static void testInterleavedDelay (const int channels)
+{
+    CircularBuffer<float> scalarBuffers[16];
+    CircularBuffer<float_4> interleaved[4];
+    float delays[16];
+    for (auto c = 0; c < 16; ++c)
+        delays[c] = 100.0f + c * 37.3f;
+
+    std::string title = "Circular Buffer per channel, channels " + std::to_string (channels);
+    MeasureTime<float>::run (
+        overheadInOut, title.c_str(), [&scalarBuffers, &delays, channels]()
+        {
+            auto in = TestBuffers<float>::get();
+            auto sum = 0.0f;
+            for (auto c = 0; c < channels; ++c)
+            {
+                auto out = in + scalarBuffers[c].readBuffer (delays[c]) * 0.5f;
+                scalarBuffers[c].writeBuffer (out);
+                sum += out;
+            }
+            return sum; },
+        1);
+
+    title = "Circular Buffer float_4 interleaved, channels " + std::to_string (channels);
+    MeasureTime<float>::run (
+        overheadInOut, title.c_str(), [&interleaved, &delays, channels]()
+        {
+            auto in = float_4 (TestBuffers<float>::get());
+            auto sum = float_4::zero();
+            for (auto c = 0; c < channels; c += 4)
+            {
+                auto out = in + interleaved[c / 4].readBuffer (float_4::load (delays + c)) * 0.5f;
+                interleaved[c / 4].writeBuffer (out);
+                sum += out;
+            }
+            return sum[0]; },
+        1);
+}
+
+// masked reads against the mirrored buffer's single mask and contiguous loads, a moving
+// delay so the reads keep crossing the wrap
+static void testMirroredBuffer()
+{
+    constexpr int blockSize = 16;
+    CircularBuffer<float> masked (1024);
+    MirroredCircularBuffer<float, blockSize - 1> mirrored (1024);
+    auto delay = 100.0f;
+    auto moveDelay = [&delay]() { delay = delay > 1000.0f ? 20.0f : delay + 0.37f; };
+
+    MeasureTime<float>::run (
+        overheadInOut, "Circular Buffer masked linear", [&]()
+        {
+            moveDelay();
+            masked.writeBuffer (TestBuffers<float>::get() + delay * 0.001f);
+            return masked.readBuffer (delay); },
+        1);
+
+    MeasureTime<float>::run (
+        overheadInOut, "Circular Buffer mirrored linear", [&]()
+        {
+            moveDelay();
+            mirrored.writeBuffer (TestBuffers<float>::get() + delay * 0.001f);
+            return mirrored.readBuffer (delay); },
+        1);
+
+    MeasureTime<float>::run (
+        overheadInOut, "Circular Buffer masked lagrange", [&]()
+        {
+            moveDelay();
+            masked.writeBuffer (TestBuffers<float>::get() + delay * 0.001f);
+            return masked.readLagrange (delay); },
+        1);
+
+    MeasureTime<float>::run (
+        overheadInOut, "Circular Buffer mirrored lagrange", [&]()
+        {
+            moveDelay();
+            mirrored.writeBuffer (TestBuffers<float>::get() + delay * 0.001f);
+            return mirrored.readLagrange (delay); },
+        1);
+
+    std::string title = "Circular Buffer masked block " + std::to_string (blockSize);
+    MeasureTime<float>::run (
+        overheadInOut, title.c_str(), [&]()
+        {
+            moveDelay();
+            masked.writeBuffer (TestBuffers<float>::get() + delay * 0.001f);
+            const auto whole = static_cast<int> (delay);
+            auto sum = 0.0f;
+            for (auto k = 0; k < blockSize; ++k)
+                sum += masked.readBuffer (whole + blockSize - 1 - k) * (k + 1);
+            return sum; },
+        1);
+
+    title = "Circular Buffer mirrored block " + std::to_string (blockSize);
+    MeasureTime<float>::run (
+        overheadInOut, title.c_str(), [&]()
+        {
+            moveDelay();
+            mirrored.writeBuffer (TestBuffers<float>::get() + delay * 0.001f);
+            const auto* block = mirrored.block (static_cast<int> (delay), blockSize);
+            auto sum = 0.0f;
+            for (auto k = 0; k < blockSize; ++k)
+                sum += block[k] * (k + 1);
+            return sum; },
+        1);
+}
+
 static void testCircularBuffer()
 {
     CircularBuffer<float> c;
@@ -403,6 +766,79 @@ static void testCircularBuffer()
             float x = c.readBuffer (TestBuffers<float>::get() * 1000.0f);
             return x; },
         1);
+
+    testCircularBufferTaps (1);
+    testCircularBufferTaps (4);
+    testCircularBufferTaps (8);
+
+    testInterleavedDelay (4);
+    testInterleavedDelay (8);
+    testInterleavedDelay (16);
+
+    testMirroredBuffer();
+}
+
+// 16 channels of delay line writes, each sample checked as the buffers used to, against
+// one scrub per float_4 group and plain stores. Then a decaying feedback loop, whose tail
+// goes denormal, with and without flush to zero.
+static void testSanitize()
+{
+    CircularBuffer<float> buffers[16];
+    auto feedback = 0.0f;
+
+    MeasureTime<float>::run (
+        overheadInOut, "16 delay writes, each checked", [&buffers, &feedback]()
+        {
+            const auto in = TestBuffers<float>::get() + feedback;
+            for (auto c = 0; c < 16; ++c)
+            {
+                const auto x = in * (c + 1);
+                buffers[c].writeBuffer (std::isnan (x) || std::isinf (x) ? 0.0f : x);
+            }
+            feedback = buffers[15].readBuffer (1) * 0.0001f;
+            return feedback; },
+        1);
+
+    MeasureTime<float>::run (
+        overheadInOut, "16 delay writes, one scrub per group", [&buffers, &feedback]()
+        {
+            const auto in = float_4 (TestBuffers<float>::get() + feedback);
+            for (auto g = 0; g < 4; ++g)
+            {
+                const auto x = sspo::scrub (in * float_4 (g * 4 + 1, g * 4 + 2, g * 4 + 3, g * 4 + 4));
+                for (auto l = 0; l < 4; ++l)
+                    buffers[g * 4 + l].writeBuffer (x[l]);
+            }
+            feedback = buffers[15].readBuffer (1) * 0.0001f;
+            return feedback; },
+        1);
+
+    // the loop settles in the denormal range, where the feedback multiplies are slow
+    auto decay = [] (float_4& state)
+    {
+        state = state * 0.5f + float_4 (1e-39f);
+        return state[0];
+    };
+    auto state = float_4 (1e-39f);
+#if SSPO_HAS_MXCSR
+    // -funsafe-math-optimizations builds start with flush to zero on, so turn it off here
+    const auto csr = _mm_getcsr();
+    _mm_setcsr (csr & ~0x8040u);
+    MeasureTime<float>::run (
+        overheadInOut, "denormal feedback, no flush", [&state, &decay]()
+        { return decay (state); },
+        1);
+    _mm_setcsr (csr);
+#endif
+
+    {
+        sspo::ScopedFlushDenormals flush;
+        state = float_4 (1e-39f);
+        MeasureTime<float>::run (
+            overheadInOut, "denormal feedback, flush to zero", [&state, &decay]()
+            { return decay (state); },
+            1);
+    }
 }
 
 static void testHardLimiter()
@@ -443,27 +879,259 @@ static void testHardLimiter()
         1);
 }
 
+// the float_4 output saturator, the masked curve against the lane by lane scalar one it
+// replaced, the input spans the identity, the knee and the clip
+static void testVoltageSaturate()
+{
+    MeasureTime<float>::run (
+        overheadInOut, "voltageSaturate float_4, lane by lane", []()
+        {
+            auto in = (float_4 (TestBuffers<float>::get(), TestBuffers<float>::get(), TestBuffers<float>::get(), TestBuffers<float>::get()) - 0.5f) * 30.0f;
+            float_4 out;
+            for (auto i = 0; i < 4; ++i)
+                out[i] = sspo::voltageSaturate (in[i]);
+            return out[0]; },
+        1);
+
+    MeasureTime<float>::run (
+        overheadInOut, "voltageSaturate float_4", []()
+        {
+            auto in = (float_4 (TestBuffers<float>::get(), TestBuffers<float>::get(), TestBuffers<float>::get(), TestBuffers<float>::get()) - 0.5f) * 30.0f;
+            return sspo::voltageSaturate (in)[0]; },
+        1);
+}
+
+// 16 channels of limiting, a bank of scalar limiters against four float_4 ones
+static void testCompressor()
+{
+    sspo::Compressor scalars[16];
+    for (auto& l : scalars)
+    {
+        l.setSampleRate (44100);
+        l.threshold = -0.5f;
+    }
+    MeasureTime<float>::run (
+        overheadInOut, "Compressor, 16 scalar", [&scalars]()
+        {
+            auto in = TestBuffers<float>::get() * 2.0f;
+            auto sum = 0.0f;
+            for (auto& l : scalars)
+                sum += l.process (in);
+            return sum; },
+        1);
+
+    for (auto lookahead : { false, true })
+    {
+        sspo::Compressor_4 vectors[4];
+        for (auto& l : vectors)
+        {
+            l.setSampleRate (44100);
+            l.threshold = -0.5f;
+            l.setLookahead (lookahead);
+        }
+        std::string title = std::string ("Compressor_4, 16 channels") + (lookahead ? ", lookahead" : "");
+        MeasureTime<float>::run (
+            overheadInOut, title.c_str(), [&vectors]()
+            {
+                auto in = float_4 (TestBuffers<float>::get() * 2.0f);
+                auto sum = float_4::zero();
+                for (auto& l : vectors)
+                    sum += l.process (in);
+                return sum[0]; },
+            1);
+    }
+}
+
 using KSDelay = KSDelayComp<TestComposite>;
 
-static void testKSDelay()
+static void testKSDelay (const int channels)
 {
     KSDelay ks;
 
     ks.setSampleRate (44100);
     ks.init();
 
-    ks.inputs[KSDelay::IN_INPUT].setVoltage (0, 0);
-    ks.inputs[KSDelay::IN_INPUT].setChannels (1);
+    ks.params[KSDelay::UNISON_PARAM].setValue (7.0f);
+    ks.inputs[KSDelay::IN_INPUT].setChannels (channels);
+    for (auto c = 0; c < channels; ++c)
+        ks.inputs[KSDelay::IN_INPUT].setVoltage (0, c);
 
     //first run 33.16 of one percent
+    std::string title = "KS Delay, 7 unison, channels " + std::to_string (channels);
     MeasureTime<double>::run (
-        overheadInOut, "KS Delay", [&ks]()
+        overheadInOut, title.c_str(), [&ks]()
         {
+            ks.inputs[KSDelay::IN_INPUT].setVoltage (TestBuffers<float>::get(), 0);
             ks.step();
             return ks.outputs[KSDelay::OUT_OUTPUT].getVoltage (0); },
         1);
 }
 
+// the pitch, glide and unison controls once per divider samples, 16 channels with the
+// pitch moving so the glide and delay time ramps are always busy
+static void testKSDelayDivider()
+{
+    for (auto divider : { 1, 8, 32, 64 })
+    {
+        KSDelay ks;
+        ks.setSampleRate (44100);
+        ks.init();
+        ks.params[KSDelay::UNISON_PARAM].setValue (7.0f);
+        ks.params[KSDelay::PARAM_UPDATE_DIVIDER_PARAM].setValue (divider);
+        ks.inputs[KSDelay::IN_INPUT].setChannels (16);
+        ks.inputs[KSDelay::VOCT].setChannels (16);
+
+        std::string title = "KS Delay, 7 unison, channels 16, divider " + std::to_string (divider);
+        MeasureTime<float>::run (
+            overheadInOut, title.c_str(), [&ks]()
+            {
+                ks.inputs[KSDelay::IN_INPUT].setVoltage (TestBuffers<float>::get(), 0);
+                ks.inputs[KSDelay::VOCT].setVoltage (TestBuffers<float>::get(), 0);
+                ks.step();
+                return ks.outputs[KSDelay::OUT_OUTPUT].getVoltage (0); },
+            1);
+    }
+}
+
+// 16 channels of float_4 Moog ladders at 44.1k with a saturation policy.
+// TestBuffers is not filled, its zeros would leave the ladder settled on 0 where every
+// policy is cheap, so the ladders are driven by a prepared +-5v saw per lane instead,
+// and run for a second before timing so every policy is measured in the same state
+template <typename NonLinear>
+static void testMoogPolicy (const char* name)
+{
+    std::vector<float_4> signal (4096);
+    for (auto i = 0U; i < signal.size(); ++i)
+    {
+        for (auto lane = 0; lane < 4; ++lane)
+            signal[i][lane] = 10.0f * std::fmod (i * (0.011f + 0.003f * lane), 1.0f) - 5.0f;
+    }
+    auto index = 0U;
+
+    std::vector<sspo::MoogLadderFilter<float_4, NonLinear>> moogs (4);
+    for (auto& moog : moogs)
+    {
+        moog.setUseNonLinearProcessing (true);
+        moog.setParameters (float_4 (1000.0f), float_4 (3.0f), float_4 (1.5f), float_4 (0.0f), 44100.0f);
+    }
+    auto process = [&moogs, &signal, &index]()
+    {
+        const auto in = signal[index];
+        index = (index + 1) & (signal.size() - 1);
+        auto sum = float_4::zero();
+        for (auto& moog : moogs)
+            sum += moog.process (in);
+        return sum[0];
+    };
+    for (auto i = 0; i < 44100; ++i)
+        TestBuffers<float>::put (process());
+
+    std::string title = std::string ("MoogLadderFilter 16 channels, ") + name;
+    MeasureTime<float>::run (overheadInOut, title.c_str(), process, 1);
+}
+
+static void testMoogPolicies()
+{
+    testMoogPolicy<sspo::TanhPolicy> ("std::tanh");
+    testMoogPolicy<sspo::FastTanhPolicy> ("fastTanh");
+    testMoogPolicy<sspo::AtanPolicy> ("atan");
+    testMoogPolicy<sspo::NldPolicy<1>> ("nld tanh table");
+}
+
+using Maccomo = MaccomoComp<TestComposite>;
+
+// 16 channels, every channel in a different mode from the mode CV
+static void testMaccomo()
+{
+    Maccomo maccomo;
+    maccomo.setSampleRate (44100);
+    maccomo.init();
+    maccomo.params[Maccomo::FREQUENCY_PARAM].setValue (0.5f);
+    maccomo.params[Maccomo::RESONANCE_PARAM].setValue (3.0f);
+    maccomo.params[Maccomo::DRIVE_PARAM].setValue (0.6f);
+    maccomo.inputs[Maccomo::MAIN_INPUT].setChannels (16);
+    maccomo.inputs[Maccomo::MODE_CV_INPUT].setChannels (16);
+    for (auto c = 0; c < 16; ++c)
+        maccomo.inputs[Maccomo::MODE_CV_INPUT].setVoltage (float (c % Maccomo::typeCount), c);
+
+    MeasureTime<float>::run (
+        overheadInOut, "Maccomo 16 channels", [&maccomo]()
+        {
+            maccomo.inputs[Maccomo::MAIN_INPUT].setVoltage (TestBuffers<float>::get(), 0);
+            maccomo.step();
+            return maccomo.outputs[Maccomo::MAIN_OUTPUT].getVoltage (0); },
+        1);
+}
+
+using Bascom = BascomComp<TestComposite>;
+
+// 16 channels at 4x oversample, the ladder stages linear, one shaped point, and all shaped
+static void testBascomNld()
+{
+    struct Config
+    {
+        const char* name;
+        float types[6];
+    };
+    const Config configs[] = {
+        { "all linear", { 0, 0, 0, 0, 0, 0 } },
+        { "resonance nld", { 0, 1, 0, 0, 0, 0 } },
+        { "all nld", { 1, 1, 2, 3, 2, 1 } },
+    };
+
+    for (const auto& config : configs)
+    {
+        sspo::synthFilterII::LadderFilter<float_4> ladder;
+        ladder.setSampleRate (44100.0f * 4.0f);
+        ladder.setFcQSat (1000.0f, 5.0f, 1.0f);
+        ladder.setCoeffs (0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+        ladder.setNldTypes (config.types[0], config.types[1], config.types[2],
+                            config.types[3], config.types[4], config.types[5]);
+        float_4 buffer[4];
+        std::string title = std::string ("ladder float_4 block of 4, ") + config.name;
+        MeasureTime<float>::run (
+            overheadInOut, title.c_str(), [&ladder, &buffer]()
+            {
+                for (auto& b : buffer)
+                    b = float_4 (TestBuffers<float>::get());
+                ladder.processBlock (buffer, buffer, 4);
+                return buffer[3][0]; },
+            1);
+    }
+
+    for (const auto& config : configs)
+    {
+        Bascom bascom;
+        bascom.setSampleRate (44100);
+        bascom.init();
+        bascom.params[Bascom::FREQUENCY_PARAM].setValue (0.5f);
+        bascom.params[Bascom::RESONANCE_PARAM].setValue (5.0f);
+        bascom.params[Bascom::DRIVE_PARAM].setValue (1.0f);
+        bascom.params[Bascom::VCA_PARAM].setValue (1.0f);
+        bascom.params[Bascom::OVERSAMPLE_PARAM].setValue (4.0f);
+        bascom.params[Bascom::DECIMATOR_FILTERS_PARAM].setValue (4.0f);
+        bascom.params[Bascom::PARAM_UPDATE_DIVIDER_PARAM].setValue (1.0f);
+        bascom.params[Bascom::COEFF_E_PARAM].setValue (1.0f);
+        bascom.params[Bascom::INPUT_NLD_TYPE_PARAM].setValue (config.types[0]);
+        bascom.params[Bascom::RESONANCE_NLD_TYPE_PARAM].setValue (config.types[1]);
+        bascom.params[Bascom::STAGE_1_NLD_TYPE_PARAM].setValue (config.types[2]);
+        bascom.params[Bascom::STAGE_2_NLD_TYPE_PARAM].setValue (config.types[3]);
+        bascom.params[Bascom::STAGE_3_NLD_TYPE_PARAM].setValue (config.types[4]);
+        bascom.params[Bascom::STAGE_4_NLD_TYPE_PARAM].setValue (config.types[5]);
+        bascom.inputs[Bascom::MAIN_INPUT].setChannels (16);
+        bascom.outputs[Bascom::MAIN_OUTPUT].setChannels (16);
+
+        std::string title = std::string ("Bascom 16 channels 4x, ") + config.name;
+        MeasureTime<float>::run (
+            overheadInOut, title.c_str(), [&bascom]()
+            {
+                bascom.inputs[Bascom::MAIN_INPUT].setVoltage (TestBuffers<float>::get(), 0);
+                bascom.step();
+                return bascom.outputs[Bascom::MAIN_OUTPUT].getVoltage (0); },
+            1);
+    }
+}
+
 using Eva = EvaComp<TestComposite>;
 
 static void testEva()
@@ -485,25 +1153,134 @@ static void testEva()
 using PolyShiftRegister = PolyShiftRegisterComp<TestComposite>;
 using CombFilter = CombFilterComp<TestComposite>;
 
-static void testCombFilter()
+static void testCombFilter (const int channels)
 {
     CombFilter cf;
 
     cf.setSampleRate (44100);
     cf.init();
 
-    cf.inputs[KSDelay::IN_INPUT].setVoltage (0, 0);
-    cf.inputs[KSDelay::IN_INPUT].setChannels (1);
+    cf.inputs[CombFilter::MAIN_INPUT].setChannels (channels);
 
     //first run 33.16 of one percent
+    std::string title = "Comb Filter Massarti, channels " + std::to_string (channels);
     MeasureTime<double>::run (
-        overheadInOut, "Comb Filter Massarti", [&cf]()
+        overheadInOut, title.c_str(), [&cf]()
         {
+            cf.inputs[CombFilter::MAIN_INPUT].setVoltage (TestBuffers<float>::get(), 0);
             cf.step();
-            return cf.outputs[KSDelay::OUT_OUTPUT].getVoltage (0); },
+            return cf.outputs[CombFilter::MAIN_OUTPUT].getVoltage (0); },
         1);
 }
 
+// delay memory and 16 channel throughput at each sample rate, the arena sizes the
+// delay lines from the rate and the module's lowest frequency
+static void testDelayArena()
+{
+    for (auto rate : { 44100.0f, 48000.0f, 96000.0f, 192000.0f })
+    {
+        KSDelay ks;
+        ks.setSampleRate (rate);
+        ks.init();
+        ks.inputs[KSDelay::IN_INPUT].setChannels (16);
+
+        CombFilter cf;
+        cf.setSampleRate (rate);
+        cf.init();
+        cf.inputs[CombFilter::MAIN_INPUT].setChannels (16);
+
+        printf ("\ndelay arena at %.0f: KS Delay %d samples per channel, %zu bytes, Comb Filter %d samples per channel, %zu bytes\n",
+                rate,
+                ks.buffers[0].size(),
+                ks.arena.sizeInBytes(),
+                cf.buffers[0].size(),
+                cf.arena.sizeInBytes());
+
+        std::string title = "KS Delay 16 channels at " + std::to_string (static_cast<int> (rate));
+        MeasureTime<float>::run (
+            overheadInOut, title.c_str(), [&ks]()
+            {
+                ks.inputs[KSDelay::IN_INPUT].setVoltage (TestBuffers<float>::get(), 0);
+                ks.step();
+                return ks.outputs[KSDelay::OUT_OUTPUT].getVoltage (0); },
+            1);
+
+        title = "Comb Filter 16 channels at " + std::to_string (static_cast<int> (rate));
+        MeasureTime<float>::run (
+            overheadInOut, title.c_str(), [&cf]()
+            {
+                cf.inputs[CombFilter::MAIN_INPUT].setVoltage (TestBuffers<float>::get(), 0);
+                cf.step();
+                return cf.outputs[CombFilter::MAIN_OUTPUT].getVoltage (0); },
+            1);
+    }
+}
+
+// each fractional delay read, on its own and in the modules that offer the choice
+static void testInterpolation()
+{
+    const char* names[sspo::NUM_INTERPOLATIONS] = { "linear", "lagrange", "allpass" };
+    for (auto mode = 0; mode < sspo::NUM_INTERPOLATIONS; ++mode)
+    {
+        CircularBuffer<float> c;
+        CircularBuffer<float_4> interleaved;
+        auto state = 0.0f;
+        auto state4 = float_4::zero();
+        auto delay = 100.0f;
+
+        std::string title = std::string ("Circular Buffer read ") + names[mode];
+        MeasureTime<float>::run (
+            overheadInOut, title.c_str(), [&c, &state, &delay, mode]()
+            {
+                delay = delay > 3000.0f ? 100.0f : delay + 0.37f;
+                auto out = 0.5f * c.read (delay, mode, state);
+                c.writeBuffer (TestBuffers<float>::get() + out);
+                return out; },
+            1);
+
+        title = std::string ("Circular Buffer float_4 read ") + names[mode];
+        MeasureTime<float>::run (
+            overheadInOut, title.c_str(), [&interleaved, &state4, &delay, mode]()
+            {
+                delay = delay > 3000.0f ? 100.0f : delay + 0.37f;
+                auto out = 0.5f * interleaved.read (float_4 (delay, delay + 1.3f, delay + 2.6f, delay + 3.9f), mode, state4);
+                interleaved.writeBuffer (float_4 (TestBuffers<float>::get()) + out);
+                return out[0]; },
+            1);
+
+        KSDelay ks;
+        ks.setSampleRate (44100);
+        ks.init();
+        ks.params[KSDelay::UNISON_PARAM].setValue (7.0f);
+        ks.params[KSDelay::INTERPOLATION_PARAM].setValue (mode);
+        ks.inputs[KSDelay::IN_INPUT].setChannels (4);
+
+        title = std::string ("KS Delay, 7 unison, channels 4, ") + names[mode];
+        MeasureTime<float>::run (
+            overheadInOut, title.c_str(), [&ks]()
+            {
+                ks.inputs[KSDelay::IN_INPUT].setVoltage (TestBuffers<float>::get(), 0);
+                ks.step();
+                return ks.outputs[KSDelay::OUT_OUTPUT].getVoltage (0); },
+            1);
+
+        CombFilter cf;
+        cf.setSampleRate (44100);
+        cf.init();
+        cf.params[CombFilter::INTERPOLATION_PARAM].setValue (mode);
+        cf.inputs[CombFilter::MAIN_INPUT].setChannels (16);
+
+        title = std::string ("Comb Filter, channels 16, ") + names[mode];
+        MeasureTime<float>::run (
+            overheadInOut, title.c_str(), [&cf]()
+            {
+                cf.inputs[CombFilter::MAIN_INPUT].setVoltage (TestBuffers<float>::get(), 0);
+                cf.step();
+                return cf.outputs[CombFilter::MAIN_OUTPUT].getVoltage (0); },
+            1);
+    }
+}
+
 static void testPolyShiftRegister()
 {
     PolyShiftRegister psr;
@@ -596,6 +1373,266 @@ static void testZazel()
         1);
 }
 
+// a block through four lowpass stages, one BiQuad after another per sample,
+// against the cascade's stage interleaved processBlock
+static float firstLane (const float x)
+{
+    return x;
+}
+
+static float firstLane (const float_4 x)
+{
+    return x[0];
+}
+
+template <typename T>
+static void testBiQuadCascade (const char* type)
+{
+    static constexpr int stages = 4;
+    static constexpr int maxBlock = 128;
+    for (auto blockSize : { 1, 8, 32, 128 })
+    {
+        sspo::BiQuad<T> serial[stages];
+        sspo::BiQuadCascade<T, stages> cascade;
+        for (auto k = 0; k < stages; ++k)
+        {
+            serial[k].setButterworthLp2 (T (44100.0f), T (2000.0f));
+            cascade.setCoeffs (k, serial[k].coeffs);
+        }
+        std::vector<T> buffer (maxBlock);
+
+        std::string title = std::string ("biquad ") + type + " loop block " + std::to_string (blockSize);
+        MeasureTime<float>::run (
+            overheadInOut, title.c_str(), [&serial, &buffer, blockSize]()
+            {
+                for (auto i = 0; i < blockSize; ++i)
+                {
+                    auto x = T (TestBuffers<float>::get());
+                    for (auto k = 0; k < stages; ++k)
+                        x = serial[k].process (x);
+                    buffer[i] = x;
+                }
+                return firstLane (buffer[blockSize - 1]); },
+            1);
+
+        title = std::string ("biquad ") + type + " cascade block " + std::to_string (blockSize);
+        MeasureTime<float>::run (
+            overheadInOut, title.c_str(), [&cascade, &buffer, blockSize]()
+            {
+                for (auto i = 0; i < blockSize; ++i)
+                    buffer[i] = T (TestBuffers<float>::get());
+                cascade.processBlock (buffer.data(), buffer.data(), blockSize);
+                return firstLane (buffer[blockSize - 1]); },
+            1);
+    }
+}
+
+// coefficient updates, the prewarp on its own against simd::tan and then the setters that
+// share it, each call sweeps the cutoff so nothing is hoisted out of the loop
+static void testPrewarp()
+{
+    auto ratio = float_4 (0.001f, 0.002f, 0.003f, 0.004f);
+    auto next = [&ratio]()
+    {
+        ratio = simd::ifelse (ratio > 0.45f, ratio - 0.449f, ratio + 0.0007f);
+        return ratio;
+    };
+
+    MeasureTime<float>::run (
+        overheadInOut, "prewarp float_4, simd::tan", [&next]()
+        { return firstLane (simd::tan (sspo::AudioMath::k_pi * next())); },
+        1);
+
+    MeasureTime<float>::run (
+        overheadInOut, "prewarp float_4, tanPi", [&next]()
+        { return firstLane (sspo::AudioMath::tanPi (next())); },
+        1);
+
+    sspo::BiQuad<float_4> biquad;
+    MeasureTime<float>::run (
+        overheadInOut, "biquad float_4 setButterworthLp2", [&next, &biquad]()
+        {
+            biquad.setButterworthLp2 (float_4 (44100.0f), next() * 44100.0f);
+            return firstLane (biquad.coeffs.a0); },
+        1);
+
+    MeasureTime<float>::run (
+        overheadInOut, "biquad float_4 setLinkwitzRileyLp2", [&next, &biquad]()
+        {
+            biquad.setLinkwitzRileyLp2 (float_4 (44100.0f), next() * 44100.0f);
+            return firstLane (biquad.coeffs.a0); },
+        1);
+
+    sspo::MoogLadderFilter<float_4> moog;
+    MeasureTime<float>::run (
+        overheadInOut, "MoogLadderFilter float_4 setParameters", [&next, &moog]()
+        {
+            moog.setParameters (next() * 44100.0f, float_4 (2.0f), float_4 (1.0f), float_4 (0.0f), 44100.0f);
+            return firstLane (moog.process (float_4 (TestBuffers<float>::get()))); },
+        1);
+
+    sspo::synthFilterII::LadderFilter<float_4> ladder;
+    ladder.setSampleRate (44100.0f);
+    MeasureTime<float>::run (
+        overheadInOut, "synthFilterII LadderFilter float_4 setFcQSat", [&next, &ladder]()
+        {
+            ladder.setFcQSat (next() * 44100.0f, float_4 (2.0f), float_4 (1.0f));
+            return firstLane (ladder.process (float_4 (TestBuffers<float>::get()))); },
+        1);
+}
+
+// 16 channels of Linkwitz Riley 4th order, per group objects against the struct of arrays bank
+static void testBiquadBank()
+{
+    static constexpr int channels = 16;
+    std::array<sspo::LinkwitzRileyLP4<float_4>, channels / 4> filters;
+    sspo::BiquadBank<channels, 2> bank;
+    for (auto g = 0; g < channels / 4; ++g)
+    {
+        filters[g].setParameters (44100.0f, 1000.0f);
+        bank.setButterworthLp2 (g, 44100.0f, 1000.0f);
+    }
+    float buffer[channels];
+
+    MeasureTime<float>::run (
+        overheadInOut, "biquad lr4 16 channels per group", [&filters, &buffer]()
+        {
+            for (auto c = 0; c < channels; c += 4)
+                filters[c / 4].process (float_4 (TestBuffers<float>::get())).store (buffer + c);
+            return buffer[channels - 1]; },
+        1);
+
+    MeasureTime<float>::run (
+        overheadInOut, "biquad lr4 16 channels bank", [&bank, &buffer]()
+        {
+            for (auto c = 0; c < channels; c += 4)
+                float_4 (TestBuffers<float>::get()).store (buffer + c);
+            bank.process (buffer, buffer, channels);
+            return buffer[channels - 1]; },
+        1);
+}
+
+// 16 channels of both Linkwitz Riley 4th order bands, the low and high banks LaLa used
+// against the crossover, and the coefficient update of each
+static void testCrossover()
+{
+    static constexpr int channels = 16;
+    sspo::BiquadBank<channels, 2> lpBank;
+    sspo::BiquadBank<channels, 2> hpBank;
+    std::array<sspo::Crossover<float_4>, channels / 4> crossovers;
+    for (auto g = 0; g < channels / 4; ++g)
+    {
+        lpBank.setButterworthLp2 (g, 44100.0f, 1000.0f);
+        hpBank.setButterworthHp2 (g, 44100.0f, 1000.0f);
+        crossovers[g].setParameters (44100.0f, 1000.0f);
+    }
+    float input[channels];
+    float low[channels];
+    float high[channels];
+
+    MeasureTime<float>::run (
+        overheadInOut, "crossover lr4 16 channels lp and hp banks", [&lpBank, &hpBank, &input, &low, &high]()
+        {
+            for (auto c = 0; c < channels; c += 4)
+                float_4 (TestBuffers<float>::get()).store (input + c);
+            lpBank.process (input, low, channels);
+            hpBank.process (input, high, channels);
+            return low[channels - 1] + high[channels - 1]; },
+        1);
+
+    MeasureTime<float>::run (
+        overheadInOut, "crossover lr4 16 channels crossover", [&crossovers, &low, &high]()
+        {
+            for (auto c = 0; c < channels; c += 4)
+            {
+                float_4 l;
+                float_4 h;
+                crossovers[c / 4].process (float_4 (TestBuffers<float>::get()), l, h);
+                l.store (low + c);
+                h.store (high + c);
+            }
+            return low[channels - 1] + high[channels - 1]; },
+        1);
+
+    MeasureTime<float>::run (
+        overheadInOut, "crossover lr4 16 channels set banks", [&lpBank, &hpBank]()
+        {
+            const auto freq = float_4 (20.0f + TestBuffers<float>::get() * 20000.0f);
+            for (auto g = 0; g < channels / 4; ++g)
+            {
+                lpBank.setButterworthLp2 (g, 44100.0f, freq);
+                hpBank.setButterworthHp2 (g, 44100.0f, freq);
+            }
+            return 0.0f; },
+        1);
+
+    MeasureTime<float>::run (
+        overheadInOut, "crossover lr4 16 channels set crossover", [&crossovers]()
+        {
+            const auto freq = float_4 (20.0f + TestBuffers<float>::get() * 20000.0f);
+            for (auto& crossover : crossovers)
+                crossover.setParameters (44100.0f, freq);
+            return 0.0f; },
+        1);
+}
+
+using LaLa = LaLaComp<TestComposite>;
+using Amburgh = AmburghComp<TestComposite>;
+
+// a patch with static knobs and CV against one where the frequency moves every sample,
+// the moving patch recalculates the coefficients on every snapshot read, once per divisorRate
+// TestBuffers is not filled, so the frequency sweep is its own ramp
+static void testParamSnapshot()
+{
+    auto sweep = 0.0f;
+    LaLa lala;
+    lala.setSampleRate (44100);
+    lala.init();
+    lala.inputs[LaLa::MAIN_INPUT].setChannels (16);
+    lala.inputs[LaLa::FREQ_CV_INPUT].setChannels (1);
+
+    MeasureTime<float>::run (
+        overheadInOut, "LaLa 16 channels static params", [&lala]()
+        {
+            lala.inputs[LaLa::MAIN_INPUT].setVoltage (TestBuffers<float>::get(), 0);
+            lala.step();
+            return lala.outputs[LaLa::LOW_OUTPUT].getVoltage (0); },
+        1);
+
+    MeasureTime<float>::run (
+        overheadInOut, "LaLa 16 channels moving params", [&lala, &sweep]()
+        {
+            sweep = sweep > 1.0f ? 0.0f : sweep + 1e-3f;
+            lala.inputs[LaLa::MAIN_INPUT].setVoltage (TestBuffers<float>::get(), 0);
+            lala.params[LaLa::FREQ_PARAM].setValue (sweep);
+            lala.step();
+            return lala.outputs[LaLa::LOW_OUTPUT].getVoltage (0); },
+        1);
+
+    Amburgh amburgh;
+    amburgh.setSampleRate (44100);
+    amburgh.init();
+    amburgh.inputs[Amburgh::MAIN_INPUT].setChannels (16);
+
+    MeasureTime<float>::run (
+        overheadInOut, "Amburgh 16 channels static params", [&amburgh]()
+        {
+            amburgh.inputs[Amburgh::MAIN_INPUT].setVoltage (TestBuffers<float>::get(), 0);
+            amburgh.step();
+            return amburgh.outputs[Amburgh::MAIN_OUTPUT].getVoltage (0); },
+        1);
+
+    MeasureTime<float>::run (
+        overheadInOut, "Amburgh 16 channels moving params", [&amburgh, &sweep]()
+        {
+            sweep = sweep > 1.0f ? 0.0f : sweep + 1e-3f;
+            amburgh.inputs[Amburgh::MAIN_INPUT].setVoltage (TestBuffers<float>::get(), 0);
+            amburgh.params[Amburgh::FREQUENCY_PARAM].setValue (sweep);
+            amburgh.step();
+            return amburgh.outputs[Amburgh::MAIN_OUTPUT].getVoltage (0); },
+        1);
+}
+
 static void testUtilityFilters()
 {
     sspo::BiQuad<float> bq;
@@ -640,20 +1677,46 @@ void perfTest()
     //  setup();
     assert (overheadInOut > 0);
     assert (overheadOutOnly > 0);
+    testSanitize();
+    // the rest run with denormals flushed, as Rack's engine threads do
+    sspo::ScopedFlushDenormals flush;
+    testLookupRegistry();
     testWaveShaper();
+    testAdaa();
+    testAdaaAliasing();
+    testOversample();
+    testBiQuadCascade<float> ("float");
+    testBiQuadCascade<float_4> ("float_4");
+    testBiquadBank();
+    testCrossover();
+    testPrewarp();
+    testParamSnapshot();
+    testRandom();
+    testCircularBuffer();
     testLookupTable();
     //    test1();
     //    testUtilityFilters();
     //    testZazel();
     //    //test1();
     //    testNoise (true);
-    //    testNormal();
     //    testFastApprox();
-    //    testCircularBuffer();
     //    testHardLimiter();
-    //    testKSDelay();
+    testCompressor();
+    testVoltageSaturate();
+    testKSDelay (1);
+    testKSDelay (4);
+    testKSDelay (8);
+    testKSDelay (16);
+    testKSDelayDivider();
+    testDelayArena();
+    testInterpolation();
     //    testPolyShiftRegister();
     //
-    //    testCombFilter();
+    testCombFilter (4);
+    testCombFilter (8);
+    testCombFilter (16);
+    testBascomNld();
+    testMoogPolicies();
+    testMaccomo();
     //    testEva();
 }
\ No newline at end of file
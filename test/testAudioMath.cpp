@@ -24,7 +24,6 @@
 #include "../src/composites/Eva.h"
 #include <assert.h>
 #include <stdio.h>
-#include <map>
 
 #include "simd/functions.hpp"
 #include "simd/sse_mathfun.h"
@@ -74,27 +73,54 @@ static void testFastTanh()
     }
 }
 
-static void testlinearInterpolate()
+// the prewarp against std::tan in double, from DC to 0.49 of the sample rate, in both
+// the scalar and float_4 forms
+static void testTanPi()
 {
-    assert (AudioMath::linearInterpolate (0.0f, 2.0f, 0.5f) == 1.0f && "linearInterpolate");
-    assert (AudioMath::linearInterpolate (-4.0f, 10.0f, 0.5f) == 3.0f && "linearInteroplate");
+    for (auto x = 0.0f; x <= 0.49f; x += 0.00001f)
+    {
+        const auto pi = static_cast<double> (AudioMath::LD_PI);
+        const auto expected = static_cast<float> (std::tan (pi * x));
+        const auto tolerance = 3e-7f * expected;
+        assertClose (AudioMath::tanPi (x), expected, tolerance);
+
+        auto lanes = AudioMath::tanPi (float_4 (x, x * 0.5f, x * 0.25f, x * 0.1f));
+        assertClose (lanes[0], expected, tolerance);
+        assertClose (lanes[1], static_cast<float> (std::tan (pi * (x * 0.5f))), tolerance);
+    }
+
+    // past a quarter the reflection must still give tan, not its reciprocal
+    assertClose (AudioMath::tanPi (0.6f), std::tan (AudioMath::k_pi * 0.6f), 0.00001f);
+    assertClose (AudioMath::tanPi (-0.2f), std::tan (AudioMath::k_pi * -0.2f), 0.00001f);
 }
 
-static void testRand01()
+// over the whole range the limiters use, from far below -200dB to well above 0dB
+static void testFastLog2()
 {
-    //map used to check spread of results
-    std::map<int, bool> bands;
+    for (auto x = 1e-11f; x < 1000.0f; x *= 1.001f)
+    {
+        auto fast = AudioMath::fastLog2 (float_4 (x, x * 1.0002f, x * 1.0004f, x * 1.0006f));
+        assertClose (fast[0], std::log2 (x), 0.0001f);
+        assertClose (fast[3], std::log2 (x * 1.0006f), 0.0001f);
+    }
+}
 
-    for (auto i = 0; i < 1000000; ++i)
+static void testFastExp2()
+{
+    for (auto x = -40.0f; x < 20.0f; x += 0.0013f)
     {
-        auto x = AudioMath::rand01();
-        assertLT (x, 1.0f);
-        assertGE (x, 0.0f);
-        bands[static_cast<int> (x * 100)] = true;
+        auto fast = AudioMath::fastExp2 (float_4 (x, -x, x + 0.5f, std::round (x)));
+        assertClose (fast[0] / std::exp2 (x), 1.0f, 0.000005f);
+        assertClose (fast[1] / std::exp2 (-x), 1.0f, 0.000005f);
+        assertClose (fast[2] / std::exp2 (x + 0.5f), 1.0f, 0.000005f);
+        assertClose (fast[3] / std::exp2 (std::round (x)), 1.0f, 0.000005f);
     }
+}
 
-    assertGT (bands.size(), 99);
-    //printf ("rand01 %d \n", static_cast<int>(bands.size()));
+static void testlinearInterpolate()
+{
+    assert (AudioMath::linearInterpolate (0.0f, 2.0f, 0.5f) == 1.0f && "linearInterpolate");
+    assert (AudioMath::linearInterpolate (-4.0f, 10.0f, 0.5f) == 3.0f && "linearInteroplate");
 }
 
 static void testlinearInterpolateSimd()
@@ -116,7 +142,9 @@ void testAudioMath()
     printf ("AudioMath\n");
     testAreSame();
     testFastTanh();
+    testTanPi();
+    testFastLog2();
+    testFastExp2();
     testlinearInterpolate();
     testlinearInterpolateSimd();
-    testRand01();
 }
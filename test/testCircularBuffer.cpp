@@ -20,9 +20,14 @@
  */
 
 #include "CircularBuffer.h"
+#include "MirroredCircularBuffer.h"
 #include "asserts.h"
 #include <assert.h>
 #include <stdio.h>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <vector>
 
 using namespace sspo;
 
@@ -96,6 +101,251 @@ static void testReadBufferWrap()
         assertEQ (c.readBuffer (i), 9 - i);
 }
 
+static void testReadTapsMatchesReadBuffer()
+{
+    CircularBuffer<float> c (64);
+    for (auto i = 0; i < 100; ++i)
+        c.writeBuffer (static_cast<float> (std::rand()) / RAND_MAX);
+
+    // includes delays that wrap, and a count that is not a multiple of the block
+    float delays[11];
+    float out[11];
+    for (auto i = 0; i < 11; ++i)
+        delays[i] = i * 5.37f + 0.25f;
+    c.readTaps (delays, out, 11);
+    for (auto i = 0; i < 11; ++i)
+        assertEQ (out[i], c.readBuffer (delays[i]));
+
+    auto delays4 = rack::simd::float_4 (0.0f, 1.5f, 33.9f, 62.99f);
+    auto out4 = c.readTaps (delays4);
+    for (auto i = 0; i < 4; ++i)
+        assertEQ (out4[i], c.readBuffer (delays4[i]));
+}
+
+// each lane of the interleaved buffer behaves as its own scalar buffer
+static void testInterleavedMatchesScalar()
+{
+    using float_4 = rack::simd::float_4;
+    CircularBuffer<float_4> c (64);
+    CircularBuffer<float> lanes[4] = { CircularBuffer<float> (64), CircularBuffer<float> (64), CircularBuffer<float> (64), CircularBuffer<float> (64) };
+    assertEQ (c.size(), 64);
+
+    for (auto i = 0; i < 100; ++i)
+    {
+        float_4 x (std::rand() * 0.001f, std::rand() * 0.002f, -1.0f * i, 0.5f * i);
+        c.writeBuffer (x);
+        for (auto l = 0; l < 4; ++l)
+            lanes[l].writeBuffer (x[l]);
+
+        float_4 delays (0.0f, 1.5f, i * 0.6f, 62.99f - i * 0.3f);
+        auto out = c.readBuffer (delays);
+        for (auto l = 0; l < 4; ++l)
+            assertEQ (out[l], lanes[l].readBuffer (delays[l]));
+    }
+}
+
+// only the strict build checks each write, see Sanitize.h
+static void testInterleavedNonFinite()
+{
+#if SSPO_STRICT_FINITE
+    using float_4 = rack::simd::float_4;
+    CircularBuffer<float_4> c (8);
+    c.writeBuffer (float_4 (1.0f, std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity()));
+    auto out = c.readBuffer (0);
+    assertEQ (out[0], 1.0f);
+    assertEQ (out[1], 0.0f);
+    assertEQ (out[2], 0.0f);
+    assertEQ (out[3], 0.0f);
+#endif
+}
+
+// the Lagrange read is exact for a cubic, whatever the fraction
+static void testLagrangeExactForCubic()
+{
+    auto cubic = [] (float t) { return 0.001f * t * t * t - 0.02f * t * t + 0.3f * t - 1.0f; };
+    CircularBuffer<float> c (64);
+    for (auto i = 0; i < 40; ++i)
+        c.writeBuffer (cubic (static_cast<float> (i)));
+
+    // fractions on the table rows, sample 39 is the newest
+    for (auto row = 0; row <= FractionalDelay::tableSize; row += 16)
+    {
+        const auto delay = 10.0f + static_cast<float> (row) / FractionalDelay::tableSize;
+        assertClose (c.readLagrange (delay), cubic (39.0f - delay), 0.0001f);
+    }
+}
+
+// each lane of the interleaved readers behaves as the scalar reader
+static void testInterleavedReadersMatchScalar()
+{
+    using float_4 = rack::simd::float_4;
+    CircularBuffer<float_4> c (64);
+    CircularBuffer<float> lanes[4] = { CircularBuffer<float> (64), CircularBuffer<float> (64), CircularBuffer<float> (64), CircularBuffer<float> (64) };
+    auto state = float_4::zero();
+    float laneStates[4] = {};
+
+    for (auto i = 0; i < 100; ++i)
+    {
+        float_4 x (std::sin (i * 0.1f), std::rand() * 0.001f, -1.0f * i, 0.5f * i);
+        c.writeBuffer (x);
+        for (auto l = 0; l < 4; ++l)
+            lanes[l].writeBuffer (x[l]);
+
+        float_4 delays (1.0f, 1.5f, 1.0f + i * 0.6f, 62.0f - i * 0.3f);
+        auto lagrange = c.readLagrange (delays);
+        auto allpass = c.readAllpass (delays, state);
+        for (auto l = 0; l < 4; ++l)
+        {
+            assertClose (lagrange[l], lanes[l].readLagrange (delays[l]), 0.0001f);
+            assertClose (allpass[l], lanes[l].readAllpass (delays[l], laneStates[l]), 0.0001f);
+        }
+    }
+}
+
+// every read of the mirrored buffer gives what the masked one does, across many wraps
+static void testMirroredMatchesMasked()
+{
+    CircularBuffer<float> masked (32);
+    MirroredCircularBuffer<float> mirrored (32);
+    assertEQ (mirrored.size(), 32);
+    auto maskedState = 0.0f;
+    auto mirroredState = 0.0f;
+
+    for (auto i = 0; i < 200; ++i)
+    {
+        const auto x = static_cast<float> (std::rand()) / RAND_MAX - 0.5f;
+        masked.writeBuffer (x);
+        mirrored.writeBuffer (x);
+
+        for (auto d = 0; d < 32; ++d)
+            assertEQ (mirrored.readBuffer (d), masked.readBuffer (d));
+
+        const auto delay = 1.0f + (i % 29) + (i % 7) * 0.13f;
+        assertEQ (mirrored.readBuffer (delay), masked.readBuffer (delay));
+        assertEQ (mirrored.readLagrange (delay), masked.readLagrange (delay));
+        assertEQ (mirrored.readAllpass (delay, mirroredState), masked.readAllpass (delay, maskedState));
+    }
+}
+
+// a block is contiguous in time order wherever it falls, including over the wrap
+static void testMirroredBlock()
+{
+    MirroredCircularBuffer<float, 7> c (16);
+    for (auto i = 0; i < 100; ++i)
+    {
+        c.writeBuffer (static_cast<float> (i));
+        for (auto delay = 0; delay < 8; ++delay)
+        {
+            const auto* block = c.block (delay, 8);
+            for (auto k = 0; k < 8; ++k)
+                assertEQ (block[k], c.readBuffer (delay + 7 - k));
+        }
+    }
+
+    MirroredCircularBuffer<rack::simd::float_4, 3> interleaved (8);
+    for (auto i = 0; i < 20; ++i)
+    {
+        interleaved.writeBuffer (rack::simd::float_4 (i, -i, 2.0f * i, 0.5f * i));
+        const auto* block = interleaved.block (1, 4);
+        for (auto k = 0; k < 4; ++k)
+        {
+            assertEQ (block[k][0], interleaved.readBuffer (4 - k)[0]);
+            assertEQ (block[k][3], interleaved.readBuffer (4 - k)[3]);
+        }
+    }
+}
+
+// hann windowed dft power at one frequency
+static double power (const std::vector<float>& x, const double frequency, const double sampleRate)
+{
+    double re = 0.0;
+    double im = 0.0;
+    const auto n = x.size();
+    for (size_t i = 0; i < n; ++i)
+    {
+        const auto window = 0.5 - 0.5 * std::cos (AudioMath::k_2pi * i / (n - 1));
+        const auto phase = AudioMath::k_2pi * frequency * i / sampleRate;
+        re += window * x[i] * std::cos (phase);
+        im -= window * x[i] * std::sin (phase);
+    }
+    return re * re + im * im;
+}
+
+// the strongest frequency within 50 cents of expected, in cents from expected
+static double centsFrom (const std::vector<float>& x, const double expected, const double sampleRate)
+{
+    auto best = 0.0;
+    auto bestPower = 0.0;
+    for (auto cents = -50.0; cents <= 50.0; cents += 1.0)
+    {
+        const auto p = power (x, expected * std::pow (2.0, cents / 1200.0), sampleRate);
+        if (p > bestPower)
+        {
+            bestPower = p;
+            best = cents;
+        }
+    }
+    const auto coarse = best;
+    for (auto cents = coarse - 1.0; cents <= coarse + 1.0; cents += 0.02)
+    {
+        const auto p = power (x, expected * std::pow (2.0, cents / 1200.0), sampleRate);
+        if (p > bestPower)
+        {
+            bestPower = p;
+            best = cents;
+        }
+    }
+    return best;
+}
+
+// a Karplus Strong style loop, one write per sample, so the read is one sample short of the period
+static std::vector<float> ringLoop (const int interpolation, const float frequency, const float sampleRate)
+{
+    CircularBuffer<float> c (64);
+    auto state = 0.0f;
+    const auto delay = sampleRate / frequency - 1.0f;
+    std::vector<float> out;
+    for (auto i = 0; i < 2048; ++i)
+    {
+        const auto y = (i == 0 ? 1.0f : 0.0f) + 0.999f * c.read (delay, interpolation, state);
+        c.writeBuffer (y);
+        out.push_back (y);
+    }
+    return out;
+}
+
+static float tailEnergy (const std::vector<float>& x)
+{
+    auto energy = 0.0f;
+    for (auto i = x.size() - 256; i < x.size(); ++i)
+        energy += x[i] * x[i];
+    return energy;
+}
+
+// pitch of the loop from 1 to 5 kHz, Lagrange within half a cent, linear and allpass within a few
+// linear loses level every pass, the allpass none
+static void testTuning()
+{
+    const auto sampleRate = 44100.0f;
+    const double limits[NUM_INTERPOLATIONS] = { 2.5, 0.5, 3.0 };
+    double errors[NUM_INTERPOLATIONS] = {};
+    float tails[NUM_INTERPOLATIONS] = {};
+    for (auto frequency = 1000.0f; frequency <= 5000.0f; frequency += 1000.0f)
+    {
+        for (auto mode = 0; mode < NUM_INTERPOLATIONS; ++mode)
+        {
+            const auto loop = ringLoop (mode, frequency, sampleRate);
+            errors[mode] = std::abs (centsFrom (loop, frequency, sampleRate));
+            tails[mode] = tailEnergy (loop);
+            assertLT (errors[mode], limits[mode]);
+        }
+        assertGT (tails[LAGRANGE_INTERPOLATION], tails[LINEAR_INTERPOLATION]);
+        assertGT (tails[ALLPASS_INTERPOLATION], tails[LAGRANGE_INTERPOLATION]);
+    }
+    // at 5 kHz
+    assertLT (errors[LAGRANGE_INTERPOLATION], errors[LINEAR_INTERPOLATION]);
+}
+
 void testCircularBuffer()
 {
     printf ("testCircularBuffer\n");
@@ -107,4 +357,12 @@ void testCircularBuffer()
     testReadIntSampleDelay();
     testReadFloatSampleDelay();
     testReadBufferWrap();
+    testReadTapsMatchesReadBuffer();
+    testInterleavedMatchesScalar();
+    testInterleavedNonFinite();
+    testLagrangeExactForCubic();
+    testInterleavedReadersMatchScalar();
+    testMirroredMatchesMasked();
+    testMirroredBlock();
+    testTuning();
 }
\ No newline at end of file
@@ -23,6 +23,7 @@
 
 #include <assert.h>
 #include <stdio.h>
+#include <cmath>
 #include "dsp/filter.hpp"
 #include "dsp/digital.hpp"
 #include "TestComposite.h"
@@ -106,10 +107,57 @@ void testPositiveCombPeaks (float voct, float sr)
     }
 }
 
+// the interleaved float_4 delay lines must give every channel the result it gets alone,
+// each channel has its own pitch and input so a mixed up lane shows
+static void testPolyMatchesMono (const int interpolation)
+{
+    static constexpr int channels = 7;
+    CF poly;
+    CF mono[channels];
+    auto setup = [interpolation] (CF& cf)
+    {
+        cf.setSampleRate (44100);
+        cf.init();
+        cf.params[CF::COMB_PARAM].setValue (1.0f);
+        cf.params[CF::FEEDBACK_PARAM].setValue (0.8f);
+        cf.params[CF::INTERPOLATION_PARAM].setValue (interpolation);
+        cf.params[CF::LIMITER_LOOKAHEAD_PARAM].setValue (1.0f);
+    };
+    setup (poly);
+    poly.inputs[CF::MAIN_INPUT].setChannels (channels);
+    poly.inputs[CF::VOCT_INPUT].setChannels (channels);
+    for (auto c = 0; c < channels; ++c)
+    {
+        setup (mono[c]);
+        mono[c].inputs[CF::MAIN_INPUT].setChannels (1);
+        mono[c].inputs[CF::VOCT_INPUT].setChannels (1);
+        mono[c].inputs[CF::VOCT_INPUT].setVoltage (-1.0f + 0.3f * c, 0);
+        poly.inputs[CF::VOCT_INPUT].setVoltage (-1.0f + 0.3f * c, c);
+    }
+
+    for (auto i = 0; i < 5000; ++i)
+    {
+        for (auto c = 0; c < channels; ++c)
+        {
+            auto in = i < 2000 ? 5.0f * std::sin (0.05f * (c + 1) * i) : 0.0f;
+            mono[c].inputs[CF::MAIN_INPUT].setVoltage (in, 0);
+            poly.inputs[CF::MAIN_INPUT].setVoltage (in, c);
+            mono[c].step();
+        }
+        poly.step();
+
+        assertEQ (poly.outputs[CF::MAIN_OUTPUT].getChannels(), channels);
+        for (auto c = 0; c < channels; ++c)
+            assertClose (poly.outputs[CF::MAIN_OUTPUT].getVoltage (c), mono[c].outputs[CF::MAIN_OUTPUT].getVoltage (0), 0.0001f);
+    }
+}
+
 void testCombFilter()
 {
     printf ("CombFilter \n");
     testPositiveCombPeaks (0.0f, 44100.0f);
+    for (auto interpolation = 0; interpolation < sspo::NUM_INTERPOLATIONS; ++interpolation)
+        testPolyMatchesMono (interpolation);
     //    testPositiveCombPeaks (0.0f, 5000.0f);
     //    testPositiveCombPeaks (-4.0f, 44100.0f);
     //    testPositiveCombPeaks (3.0f, 44100.0f);
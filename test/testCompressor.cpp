@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2020 Dave French <contact/dot/dave/dot/french3/at/googlemail/dot/com>
+ *
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program (see COPYING); if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ *
+ */
+
+#include "common.hpp"
+
+#include "HardLimiter.h"
+#include "asserts.h"
+#include <assert.h>
+#include <stdio.h>
+#include <algorithm>
+#include <cmath>
+
+using float_4 = rack::simd::float_4;
+
+static float db (const float gain)
+{
+    return 20.0f * std::log10 (gain);
+}
+
+static void setup (sspo::Compressor_4& c, const float threshold, const float ratio)
+{
+    c.setSampleRate (44100);
+    c.setTimes (0.0f, 0.0025f);
+    c.threshold = threshold;
+    c.ratio = ratio;
+    c.reset();
+}
+
+// a steady level in each lane settles to the hard knee curve
+static void testStaticCurve()
+{
+    sspo::Compressor_4 c;
+    setup (c, -6.0f, 4.0f);
+
+    // -12dB, -6dB, 0dB and +6dB
+    const float_4 levels (0.25118864f, 0.50118723f, 1.0f, 1.9952623f);
+    float_4 out;
+    for (auto i = 0; i < 4410; ++i)
+        out = c.process (i % 2 ? levels : -levels);
+
+    const float expected[] = { -12.0f, -6.0f, -6.0f + 6.0f / 4.0f, -6.0f + 12.0f / 4.0f };
+    for (auto l = 0; l < 4; ++l)
+        assertClose (db (std::abs (out[l])), expected[l], 0.01f);
+}
+
+// the lanes share the settings, but each follows its own input
+static void testMatchesScalar()
+{
+    sspo::Compressor_4 vector;
+    setup (vector, -0.5f, 10.5f);
+    sspo::Compressor scalar[4];
+    for (auto& s : scalar)
+    {
+        s.setTimes (0.0f, 0.0025f);
+        s.setSampleRate (44100);
+        s.threshold = -0.5f;
+    }
+
+    const float_4 levels (0.2f, 0.9f, 1.5f, 4.0f);
+    float_4 out;
+    float scalarOut[4];
+    for (auto i = 0; i < 44100; ++i)
+    {
+        auto in = levels * std::sin (i * 0.01f);
+        out = vector.process (in);
+        for (auto l = 0; l < 4; ++l)
+            scalarOut[l] = scalar[l].process (in[l]);
+    }
+
+    // once both envelopes have settled, compare over the last cycles of the sine
+    float_4 peak = float_4::zero();
+    float scalarPeak[4] = {};
+    for (auto i = 44100; i < 46000; ++i)
+    {
+        auto in = levels * std::sin (i * 0.01f);
+        peak = rack::simd::fmax (peak, rack::simd::abs (vector.process (in)));
+        for (auto l = 0; l < 4; ++l)
+            scalarPeak[l] = std::max (scalarPeak[l], std::abs (scalar[l].process (in[l])));
+    }
+    for (auto l = 0; l < 4; ++l)
+        assertClose (db (peak[l]), db (scalarPeak[l]), 0.1f);
+}
+
+// with lookahead the first loud block is turned down before it is heard, without it the
+// edge gets through at full level for a block
+static void testLookahead()
+{
+    const auto threshold = -6.0f;
+    const auto ratio = 100.0f;
+    float peaks[2];
+    for (auto lookahead = 0; lookahead < 2; ++lookahead)
+    {
+        sspo::Compressor_4 c;
+        setup (c, threshold, ratio);
+        c.setLookahead (lookahead);
+        assertEQ (c.latency(), (lookahead ? 4 : 0));
+
+        peaks[lookahead] = 0.0f;
+        for (auto i = 0; i < 1001; ++i)
+        {
+            auto in = float_4 (i < 501 ? 0.01f : 4.0f);
+            peaks[lookahead] = std::max (peaks[lookahead], c.process (in)[0]);
+        }
+    }
+    const auto limit = threshold + (db (4.0f) - threshold) / ratio;
+    assertLT (db (peaks[1]), limit + 0.01f);
+    assertClose (db (peaks[0]), db (4.0f), 0.01f);
+}
+
+// the delay must not change the audio, only hold it back
+static void testLookaheadLatency()
+{
+    sspo::Compressor_4 c;
+    setup (c, 20.0f, 2.0f);
+    c.setLookahead (true);
+    for (auto i = 0; i < 100; ++i)
+    {
+        auto out = c.process (float_4 (static_cast<float> (i) / 100.0f));
+        auto expected = i < c.latency() ? 0.0f : static_cast<float> (i - c.latency()) / 100.0f;
+        assertClose (out[0], expected, 0.00001f);
+    }
+}
+
+void testCompressor()
+{
+    printf ("testCompressor\n");
+    testStaticCurve();
+    testMatchesScalar();
+    testLookahead();
+    testLookaheadLatency();
+}
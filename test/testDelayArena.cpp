@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2020 Dave French <contact/dot/dave/dot/french3/at/googlemail/dot/com>
+ *
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program (see COPYING); if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ *
+ */
+
+#include "DelayArena.h"
+#include "asserts.h"
+#include <assert.h>
+#include <stdio.h>
+#include <cstdint>
+
+using namespace sspo;
+
+static void testSizedFromSampleRate()
+{
+    DelayArena<float> arena;
+    CircularBuffer<float> buffers[4];
+
+    // 44100 / 20 + 3 = 2208
+    arena.allocate (buffers, 4, 44100.0f, 20.0f);
+    assertEQ (arena.getBufferLength(), 4096u);
+    assertEQ (buffers[0].size(), 4096);
+
+    // 192000 / 20 + 3 = 9603, the old fixed 4096 was too short
+    arena.allocate (buffers, 4, 192000.0f, 20.0f);
+    assertEQ (arena.getBufferLength(), 16384u);
+    assertEQ (buffers[3].size(), 16384);
+    assertGE (static_cast<unsigned int> (buffers[3].size()), DelayArena<float>::samplesFor (192000.0f, 20.0f));
+}
+
+static void testPackedAndAligned()
+{
+    DelayArena<float> arena;
+    CircularBuffer<float> buffers[3];
+    arena.allocate (buffers, 3, 48000.0f, 20.0f);
+
+    // a spare cache line between buffers
+    assertEQ (arena.getStride(), arena.getBufferLength() + DelayArena<float>::cacheLine / sizeof (float));
+    assertEQ (arena.sizeInBytes(), 3 * arena.getStride() * sizeof (float));
+
+    // each buffer starts on a cache line
+    assertEQ (reinterpret_cast<uintptr_t> (arena.data()) % DelayArena<float>::cacheLine, 0u);
+    assertEQ ((arena.getStride() * sizeof (float)) % DelayArena<float>::cacheLine, 0u);
+    for (auto i = 0; i < 3; ++i)
+    {
+        buffers[i].writeBuffer (1.0f + i);
+        assertEQ (buffers[i].readBuffer (0), 1.0f + i);
+    }
+}
+
+// the mirror sits in front of each buffer, which still starts on a cache line
+static void testMirroredPacked()
+{
+    DelayArena<float> arena;
+    MirroredCircularBuffer<float, 17> buffers[3];
+    arena.allocate (buffers, 3, 48000.0f, 20.0f);
+
+    // 17 samples of mirror take two cache lines
+    const auto lineSamples = DelayArena<float>::cacheLine / sizeof (float);
+    assertEQ (arena.getStride(), 2 * lineSamples + arena.getBufferLength() + lineSamples);
+
+    // nothing written yet, the newest sample is the first of the buffer
+    for (auto i = 0; i < 3; ++i)
+    {
+        const auto* start = buffers[i].block (0, 1);
+        assertEQ (reinterpret_cast<uintptr_t> (start) % DelayArena<float>::cacheLine, 0u);
+    }
+
+    // writing through the mirror of the second buffer leaves the first alone
+    auto length = buffers[0].size();
+    for (auto i = 0; i < length * 2; ++i)
+        buffers[1].writeBuffer (1.0f);
+    for (auto i = 0; i < length; ++i)
+    {
+        assertEQ (buffers[0].readBuffer (i), 0.0f);
+        assertEQ (buffers[2].readBuffer (i), 0.0f);
+    }
+}
+
+static void testBuffersIndependent()
+{
+    DelayArena<float> arena;
+    CircularBuffer<float> buffers[2];
+    arena.allocate (buffers, 2, 44100.0f, 100.0f);
+    auto length = buffers[0].size();
+
+    // fill the whole of the first buffer, the second must stay silent
+    for (auto i = 0; i < length * 2; ++i)
+        buffers[0].writeBuffer (1.0f);
+    for (auto i = 0; i < length; ++i)
+        assertEQ (buffers[1].readBuffer (i), 0.0f);
+}
+
+static void testReallocateClears()
+{
+    DelayArena<float> arena;
+    CircularBuffer<float> buffers[2];
+    arena.allocate (buffers, 2, 44100.0f, 20.0f);
+    buffers[1].writeBuffer (1.0f);
+
+    arena.allocate (buffers, 2, 96000.0f, 20.0f);
+    for (auto i = 0; i < buffers[1].size(); ++i)
+        assertEQ (buffers[1].readBuffer (i), 0.0f);
+}
+
+void testDelayArena()
+{
+    printf ("testDelayArena\n");
+    testSizedFromSampleRate();
+    testPackedAndAligned();
+    testMirroredPacked();
+    testBuffersIndependent();
+    testReallocateClears();
+}
@@ -26,8 +26,12 @@
 #include "TestComposite.h"
 #include "asserts.h"
 #include "KSDelay.h"
+#include <algorithm>
 #include <assert.h>
 #include <stdio.h>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
 #include "ExtremeTester.h"
 
 using KSD = KSDelayComp<TestComposite>;
@@ -40,6 +44,158 @@ static void test01()
     ksd.step();
 }
 
+// the float_4 loop must give every channel the result it gets alone
+static void testPolyMatchesMono()
+{
+    KSD mono;
+    KSD poly;
+    mono.setSampleRate (44100);
+    poly.setSampleRate (44100);
+    std::srand (3);
+    mono.init();
+    std::srand (3);
+    poly.init();
+
+    const auto channels = 6;
+    mono.inputs[KSD::IN_INPUT].setChannels (1);
+    poly.inputs[KSD::IN_INPUT].setChannels (channels);
+    mono.params[KSD::UNISON_PARAM].setValue (5.0f);
+    poly.params[KSD::UNISON_PARAM].setValue (5.0f);
+
+    auto energy = std::vector<float> (channels, 0.0f);
+    for (auto i = 0; i < 10000; ++i)
+    {
+        auto in = i < 100 ? 5.0f : 0.0f;
+        mono.inputs[KSD::IN_INPUT].setVoltage (in, 0);
+        for (auto c = 0; c < channels; ++c)
+            poly.inputs[KSD::IN_INPUT].setVoltage (in, c);
+        mono.step();
+        poly.step();
+
+        assertEQ (poly.outputs[KSD::OUT_OUTPUT].getChannels(), channels);
+        assertClose (poly.outputs[KSD::OUT_OUTPUT].getVoltage (0), mono.outputs[KSD::OUT_OUTPUT].getVoltage (0), 0.0001f);
+        for (auto c = 0; c < channels; ++c)
+            energy[c] += std::abs (poly.outputs[KSD::OUT_OUTPUT].getVoltage (c));
+    }
+
+    for (auto c = 0; c < channels; ++c)
+        assertGT (energy[c], 1.0f);
+}
+
+// at a high pitch linear interpolation damps the string, the other reads ring on for longer
+static void testInterpolationRings()
+{
+    float tails[sspo::NUM_INTERPOLATIONS];
+    for (auto mode = 0; mode < sspo::NUM_INTERPOLATIONS; ++mode)
+    {
+        KSD ksd;
+        ksd.setSampleRate (44100);
+        std::srand (5);
+        ksd.init();
+        ksd.params[KSD::OCTAVE_PARAM].setValue (2.0f);
+        ksd.params[KSD::TUNE_PARAM].setValue (3.0f);
+        ksd.params[KSD::FEEDBACK_PARAM].setValue (0.5f);
+        ksd.params[KSD::UNISON_PARAM].setValue (1.0f);
+        ksd.params[KSD::INTERPOLATION_PARAM].setValue (mode);
+        ksd.inputs[KSD::IN_INPUT].setChannels (1);
+
+        tails[mode] = 0.0f;
+        for (auto i = 0; i < 4000; ++i)
+        {
+            ksd.inputs[KSD::IN_INPUT].setVoltage (i < 20 ? 5.0f : 0.0f, 0);
+            ksd.step();
+            auto out = ksd.outputs[KSD::OUT_OUTPUT].getVoltage (0);
+            assert (std::isfinite (out));
+            if (i >= 3000)
+                tails[mode] += out * out;
+        }
+    }
+    assertGT (tails[sspo::LAGRANGE_INTERPOLATION], tails[sspo::LINEAR_INTERPOLATION]);
+    assertGT (tails[sspo::ALLPASS_INTERPOLATION], tails[sspo::LINEAR_INTERPOLATION]);
+}
+
+// the period the delay loop plays, in samples, for channel 0
+static float loopPeriod (const KSD& ksd)
+{
+    return ksd.controls.index[0][0] + 1.5f;
+}
+
+// with a divider the pitch is read once a block, so the delay time lags the pitch worked
+// out every sample by up to a block, and the glide can catch its target a block later.
+// Through a vibrato and a jump of an octave it must stay within a few cents of the range
+// the every sample period covered over the last two blocks, and track the slow vibrato
+// to within a few cents
+static void testDividerTracksPitch()
+{
+    const int dividers[] = { 8, 32, 64 };
+    const float limits[] = { 1.0f, 3.0f, 6.0f };
+    for (auto d = 0; d < 3; ++d)
+    {
+        const auto divider = dividers[d];
+        KSD reference;
+        KSD divided;
+        for (auto* ksd : { &reference, &divided })
+        {
+            ksd->setSampleRate (44100);
+            ksd->init();
+            ksd->params[KSD::UNISON_PARAM].setValue (1.0f);
+            ksd->inputs[KSD::IN_INPUT].setChannels (1);
+            ksd->inputs[KSD::VOCT].setChannels (1);
+        }
+        divided.params[KSD::PARAM_UPDATE_DIVIDER_PARAM].setValue (divider);
+
+        std::vector<float> history;
+        for (auto i = 0; i < 44100; ++i)
+        {
+            // 5Hz vibrato of a semitone, then up an octave half way through
+            auto pitch = std::sin (sspo::AudioMath::k_2pi * 5.0f * i / 44100.0f) / 12.0f;
+            if (i >= 22050)
+                pitch += 1.0f;
+            reference.inputs[KSD::VOCT].setVoltage (pitch, 0);
+            divided.inputs[KSD::VOCT].setVoltage (pitch, 0);
+            reference.step();
+            divided.step();
+            history.push_back (loopPeriod (reference));
+
+            // the glide up from the reset pitch has settled by then
+            if (i < 4410)
+                continue;
+
+            auto period = loopPeriod (divided);
+            auto first = history.end() - (2 * divider + 1);
+            auto lowest = *std::min_element (first, history.end());
+            auto highest = *std::max_element (first, history.end());
+            assertLT (1200.0f * std::log2 (lowest / period), limits[d]);
+            assertLT (1200.0f * std::log2 (period / highest), limits[d]);
+
+            if (i < 22050)
+                assertLT (std::abs (1200.0f * std::log2 (period / history.back())), limits[d]);
+        }
+    }
+}
+
+// a steady pitch must land on exactly the same delay time whatever the divider
+static void testDividerSteadyPitch()
+{
+    KSD reference;
+    KSD divided;
+    for (auto* ksd : { &reference, &divided })
+    {
+        ksd->setSampleRate (44100);
+        ksd->init();
+        ksd->params[KSD::OCTAVE_PARAM].setValue (1.0f);
+        ksd->inputs[KSD::IN_INPUT].setChannels (1);
+    }
+    divided.params[KSD::PARAM_UPDATE_DIVIDER_PARAM].setValue (64.0f);
+
+    for (auto i = 0; i < 10000; ++i)
+    {
+        reference.step();
+        divided.step();
+    }
+    assertEQ (loopPeriod (divided), loopPeriod (reference));
+}
+
 static void testExtreme()
 {
     KSD ksd;
@@ -65,5 +221,9 @@ void testKSDelay()
 {
     printf ("testKSDelay\n");
     test01();
+    testPolyMatchesMono();
+    testInterpolationRings();
+    testDividerTracksPitch();
+    testDividerSteadyPitch();
     testExtreme();
 }
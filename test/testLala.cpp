@@ -61,9 +61,45 @@ static void testExtreme (float sr)
     ExtremeTester<Lala>::test (lala, paramLimits, true, "Lala");
 }
 
+// params are read every divisorRate samples, a change anywhere within one period
+// gives the same output as a change at its end
+static void testControlRate()
+{
+    const auto period = static_cast<int> (Lala::divisorRate);
+    for (auto offset : { 1, period / 2, period })
+    {
+        Lala early;
+        Lala late;
+        for (auto lala : { &early, &late })
+        {
+            lala->setSampleRate (44100.0f);
+            lala->init();
+            lala->params[Lala::FREQ_PARAM].setValue (0.2f);
+            lala->inputs[Lala::MAIN_INPUT].setChannels (1);
+        }
+
+        for (auto i = 0; i < period * 4; ++i)
+        {
+            if (i == offset)
+                early.params[Lala::FREQ_PARAM].setValue (0.8f);
+            if (i == period)
+                late.params[Lala::FREQ_PARAM].setValue (0.8f);
+
+            const auto x = 5.0f * std::sin (0.3f * i);
+            early.inputs[Lala::MAIN_INPUT].setVoltage (x);
+            late.inputs[Lala::MAIN_INPUT].setVoltage (x);
+            early.step();
+            late.step();
+            assertEQ (early.outputs[Lala::LOW_OUTPUT].getVoltage(), late.outputs[Lala::LOW_OUTPUT].getVoltage());
+            assertEQ (early.outputs[Lala::HIGH_OUTPUT].getVoltage(), late.outputs[Lala::HIGH_OUTPUT].getVoltage());
+        }
+    }
+}
+
 void testLala()
 {
     printf ("testLala\n");
     test01();
+    testControlRate();
     testExtreme (96000.0f);
 }
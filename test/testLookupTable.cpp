@@ -95,10 +95,31 @@ static void testConsumeSimd()
     printf ("testConsumeSimd Test Lookup ok");
 }
 
+static void testRegistry()
+{
+    // every accessor must hand out the same, fully built, table
+    assert (&LookupTable::Registry::sine() == &LookupTable::Registry::sine());
+    assert (&LookupTable::Registry::pow2() == &LookupTable::Registry::pow2());
+    assert (&LookupTable::Registry::hulaSine() == &LookupTable::Registry::hulaSine());
+
+    auto fresh = LookupTable::makePow2Table();
+    const auto& shared = LookupTable::Registry::pow2();
+    assertEQ (fresh.table.size(), shared.table.size());
+    for (auto i = 0u; i < fresh.table.size(); ++i)
+        assertEQ (fresh.table[i], shared.table[i]);
+
+    assertGT (LookupTable::Registry::buildAll(), 0u);
+
+    const LookupTable::Lookup other{};
+    for (float i = -3.0f; i < 3.0f; i += 0.01f)
+        assertEQ (other.hulaSin (i), lookup.hulaSin (i));
+}
+
 void testLookupTable()
 {
     printf ("testLookupTable\n");
     testCreate();
     testConsume();
     testConsumeSimd();
+    testRegistry();
 }
@@ -117,9 +117,54 @@ static void testSelfOscillate()
     testSelfOscillate (4.0f, 44100);
 }
 
+// each channel's mode from its own MODE_CV_INPUT voltage, against one scalar ladder per channel
+static void testPerChannelModes()
+{
+    static constexpr int channels = 10;
+    static constexpr float sr = 44100.0f;
+    MA ma;
+    ma.setSampleRate (sr);
+    ma.init();
+    ma.params[MA::FREQUENCY_PARAM].setValue (0.5f);
+    ma.params[MA::RESONANCE_PARAM].setValue (3.0f);
+    ma.params[MA::DRIVE_PARAM].setValue (1.0f);
+    ma.params[MA::MODE_PARAM].setValue (0.0f);
+    ma.inputs[MA::MAIN_INPUT].setChannels (channels);
+    ma.inputs[MA::VOCT_INPUT].setChannels (channels);
+    ma.inputs[MA::MODE_CV_INPUT].setChannels (channels);
+
+    std::vector<sspo::MoogLadderFilter<float>> expected (channels);
+    for (auto c = 0; c < channels; ++c)
+    {
+        const auto mode = c % MA::typeCount;
+        ma.inputs[MA::MODE_CV_INPUT].setVoltage (float (mode), c);
+        ma.inputs[MA::VOCT_INPUT].setVoltage ((c - 5) * 0.3f, c);
+
+        expected[c].setUseNonLinearProcessing (true);
+        expected[c].setType (sspo::MoogLadderFilter<float>::types()[mode]);
+    }
+
+    for (auto i = 0; i < 2000; ++i)
+    {
+        const auto in = 5.0f * std::sin (0.05f * i);
+        for (auto c = 0; c < channels; ++c)
+            ma.inputs[MA::MAIN_INPUT].setVoltage (in, c);
+        ma.step();
+
+        for (auto c = 0; c < channels; ++c)
+        {
+            const auto frequency = dsp::FREQ_C4 * std::pow (2.0f, (c - 5) * 0.3f);
+            expected[c].setParameters (frequency, 3.0f, 1.0f, 0.0f, sr);
+            const auto out = expected[c].process (in / 10.0f) * 10.0f;
+            assertClose (ma.outputs[MA::MAIN_OUTPUT].getVoltage (c), out, 1e-3f);
+        }
+    }
+}
+
 void testMaccomo()
 {
     printf ("testMaccomo\n");
+    testPerChannelModes();
     testExtreme();
     testSelfOscillate();
 }
\ No newline at end of file
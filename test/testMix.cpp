@@ -160,10 +160,87 @@ static void testAllInputsPoly()
     assert (same[0] < delta && same[1] < delta && same[2] < delta && same[3] < delta);
 }
 
+// with ADAA a steady input settles on the static shaper, each float_4 group on its own
+static void testAdaa()
+{
+    MA mixer;
+    mixer.setSampleRate (44100.0f);
+    mixer.init();
+
+    const auto nldType = 2;
+    mixer.params[MA::NLD_PARAM].setValue (nldType);
+    mixer.params[MA::ANTIALIASING_PARAM].setValue (sspo::ADAA_ANTIALIASING);
+    mixer.params[MA::ONE_PARAM].setValue (1.0f);
+    mixer.params[MA::MAIN_PARAM].setValue (1.0f);
+    for (auto i = 1; i < 5; ++i)
+        mixer.params[i].setValue (0.0f);
+
+    mixer.inputs[MA::ONE_INPUT].setChannels (8);
+    for (auto c = 0; c < 8; ++c)
+        mixer.inputs[MA::ONE_INPUT].setVoltage (-7.0f + 2.0f * c, c);
+
+    for (auto i = 0; i < 4; ++i)
+        mixer.step();
+    assertEQ (mixer.upSampleRate, 0);
+
+    for (auto c = 0; c < 8; ++c)
+    {
+        const auto in = -7.0f + 2.0f * c;
+        const auto expected = sspo::AudioMath::WaveShaper::nld().process (in * 0.1f, nldType) * 10.0f;
+        assertClose (mixer.outputs[MA::MAIN_OUTPUT].getVoltage (c), expected, 1e-3f);
+    }
+}
+
+// each float_4 group has its own resampler, so a silent group stays silent
+// while the others carry a tone through the half-band filters
+static void testNoCrosstalk()
+{
+    const auto sr = 44100.0f;
+    const auto nldType = 2;
+
+    // the mixer under test carries 16 channels, the reference only the silent group
+    std::array<MA, 2> mixers;
+    std::array<int, 2> channels = { 16, 4 };
+    for (auto m = 0; m < 2; ++m)
+    {
+        auto& mixer = mixers[m];
+        mixer.setSampleRate (sr);
+        mixer.init();
+        mixer.params[MA::NLD_PARAM].setValue (nldType);
+        mixer.params[MA::ANTIALIASING_PARAM].setValue (sspo::OVERSAMPLE_ANTIALIASING);
+        mixer.params[MA::OVERSAMPLE_FILTER_PARAM].setValue (sspo::LINEAR_PHASE_OVERSAMPLE_FILTER);
+        mixer.params[MA::ONE_PARAM].setValue (1.0f);
+        mixer.params[MA::MAIN_PARAM].setValue (1.0f);
+        for (auto i = 1; i < 5; ++i)
+            mixer.params[i].setValue (0.0f);
+        mixer.inputs[MA::ONE_INPUT].setChannels (channels[m]);
+        for (auto c = 0; c < 4; ++c)
+            mixer.inputs[MA::ONE_INPUT].setVoltage (0.0f, c);
+    }
+
+    const auto freq = 1000.0f;
+    for (auto i = 0; i < 4096; ++i)
+    {
+        const auto in = 5.0f * std::sin (sspo::AudioMath::k_2pi * freq * i / sr);
+        for (auto c = 4; c < 16; ++c)
+            mixers[0].inputs[MA::ONE_INPUT].setVoltage (in, c);
+
+        for (auto& mixer : mixers)
+            mixer.step();
+
+        for (auto c = 0; c < 4; ++c)
+            assertEQ (mixers[0].outputs[MA::MAIN_OUTPUT].getVoltage (c),
+                      mixers[1].outputs[MA::MAIN_OUTPUT].getVoltage (c));
+    }
+    assertEQ (mixers[0].upSampleRate, 4);
+}
+
 void testMix()
 {
     printf ("test Mix\n");
     testExtreme();
     testAllinputsMono();
     testAllInputsPoly();
+    testAdaa();
+    testNoCrosstalk();
 }
\ No newline at end of file
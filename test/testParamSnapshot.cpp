@@ -0,0 +1,122 @@
+/*
+* Copyright (c) 2020 Dave French <contact/dot/dave/dot/french3/at/googlemail/dot/com>
+*
+*
+* This program is free software; you can redistribute it and/or
+* modify it under the terms of the GNU General Public
+* License as published by the Free Software Foundation; either
+* version 3 of the License, or (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+* General Public License for more details.
+*
+* You should have received a copy of the GNU General Public
+* License along with this program (see COPYING); if not, write to the
+* Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+* Boston, MA 02110-1301 USA.
+*
+*/
+
+
+#include <assert.h>
+#include <stdio.h>
+#include "asserts.h"
+#include "TestComposite.h"
+#include "ParamSnapshot.h"
+
+enum
+{
+    FREQ_PARAM,
+    GAIN_PARAM,
+    NUM_PARAMS
+};
+enum
+{
+    CV_INPUT,
+    MAIN_INPUT,
+    NUM_INPUTS
+};
+
+using Snapshot = ParamSnapshot<NUM_PARAMS, NUM_INPUTS>;
+
+static void testFirstReadChanges()
+{
+    TestComposite comp;
+    Snapshot snapshot;
+    assert (snapshot.process (comp));
+    assert (!snapshot.process (comp));
+    snapshot.invalidate();
+    assert (snapshot.process (comp));
+}
+
+static void testParams()
+{
+    TestComposite comp;
+    Snapshot snapshot;
+    snapshot.process (comp);
+
+    comp.params[GAIN_PARAM].setValue (0.5f);
+    assert (snapshot.process (comp));
+    assertEQ (snapshot.getValue (GAIN_PARAM), 0.5f);
+    assert (!snapshot.process (comp));
+
+    // setting the same value is not a change
+    comp.params[GAIN_PARAM].setValue (0.5f);
+    assert (!snapshot.process (comp));
+}
+
+static void testInputs()
+{
+    TestComposite comp;
+    Snapshot snapshot;
+    snapshot.watchVoltages (CV_INPUT);
+    snapshot.process (comp);
+
+    // connecting and disconnecting any input is a change
+    comp.inputs[MAIN_INPUT].setChannels (2);
+    assert (snapshot.process (comp));
+    assertEQ (snapshot.getChannels (MAIN_INPUT), 2);
+    assert (snapshot.isConnected (MAIN_INPUT));
+    comp.inputs[MAIN_INPUT].channels = 0;
+    assert (snapshot.process (comp));
+    assert (!snapshot.isConnected (MAIN_INPUT));
+
+    // voltages only count on watched inputs
+    comp.inputs[MAIN_INPUT].setChannels (1);
+    snapshot.process (comp);
+    comp.inputs[MAIN_INPUT].setVoltage (3.0f);
+    assert (!snapshot.process (comp));
+
+    comp.inputs[CV_INPUT].setChannels (4);
+    snapshot.process (comp);
+    comp.inputs[CV_INPUT].setVoltage (1.0f, 3);
+    assert (snapshot.process (comp));
+    assert (!snapshot.process (comp));
+}
+
+static void testDivisor()
+{
+    TestComposite comp;
+    Snapshot snapshot;
+    snapshot.setDivisor (4);
+    assert (snapshot.process (comp));
+
+    comp.params[FREQ_PARAM].setValue (1.0f);
+    assert (!snapshot.process (comp));
+    assert (!snapshot.process (comp));
+    assert (!snapshot.process (comp));
+    assertEQ (snapshot.getValue (FREQ_PARAM), 0.0f);
+    assert (snapshot.process (comp));
+    assertEQ (snapshot.getValue (FREQ_PARAM), 1.0f);
+}
+
+void testParamSnapshot()
+{
+    printf ("testParamSnapshot\n");
+    testFirstReadChanges();
+    testParams();
+    testInputs();
+    testDivisor();
+}
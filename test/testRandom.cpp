@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2020 Dave French <contact/dot/dave/dot/french3/at/googlemail/dot/com>
+ *
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program (see COPYING); if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ *
+ */
+
+#include "Random.h"
+#include "asserts.h"
+#include <assert.h>
+#include <stdio.h>
+#include <cmath>
+#include <map>
+
+using namespace sspo;
+
+static void testUniform()
+{
+    Random random (1);
+    //map used to check spread of results
+    std::map<int, bool> bands;
+
+    for (auto i = 0; i < 1000000; ++i)
+    {
+        auto x = random.uniform();
+        assertLT (x, 1.0f);
+        assertGE (x, 0.0f);
+        bands[static_cast<int> (x * 100)] = true;
+    }
+
+    assertGT (bands.size(), 99);
+}
+
+static void testUniform4()
+{
+    Random random (2);
+    double sum[4] = {};
+    constexpr int count = 100000;
+    for (auto i = 0; i < count; ++i)
+    {
+        auto x = random.uniform4();
+        for (auto lane = 0; lane < 4; ++lane)
+        {
+            assertLT (x[lane], 1.0f);
+            assertGE (x[lane], 0.0f);
+            sum[lane] += x[lane];
+        }
+        // the lanes are independent generators
+        assert (x[0] != x[1] || x[1] != x[2]);
+    }
+    for (auto lane = 0; lane < 4; ++lane)
+        assertClose (sum[lane] / count, 0.5, 0.01);
+}
+
+static void testBipolar()
+{
+    Random random (3);
+    auto minimum = 1.0f;
+    auto maximum = -1.0f;
+    for (auto i = 0; i < 100000; ++i)
+    {
+        auto x = random.bipolar();
+        auto x4 = random.bipolar4();
+        assertGE (x, -1.0f);
+        assertLT (x, 1.0f);
+        assertGE (x4[3], -1.0f);
+        assertLT (x4[3], 1.0f);
+        minimum = std::min (minimum, x);
+        maximum = std::max (maximum, x);
+    }
+    assertLT (minimum, -0.99f);
+    assertGT (maximum, 0.99f);
+}
+
+static void testGaussian()
+{
+    Random random (4);
+    constexpr int count = 200000;
+    double sum = 0;
+    double sumSquares = 0;
+    double sum4 = 0;
+    double sumSquares4 = 0;
+    for (auto i = 0; i < count; ++i)
+    {
+        double x = random.gaussian();
+        sum += x;
+        sumSquares += x * x;
+        double x4 = random.gaussian4()[2];
+        sum4 += x4;
+        sumSquares4 += x4 * x4;
+    }
+    assertClose (sum / count, 0.0, 0.01);
+    assertClose (std::sqrt (sumSquares / count), 1.0, 0.01);
+    assertClose (sum4 / count, 0.0, 0.01);
+    assertClose (std::sqrt (sumSquares4 / count), 1.0, 0.01);
+}
+
+static void testSeed()
+{
+    Random a (42);
+    Random b (42);
+    for (auto i = 0; i < 100; ++i)
+        assertEQ (a.uniform(), b.uniform());
+
+    a.seed (7);
+    b.seed (8);
+    auto same = 0;
+    for (auto i = 0; i < 100; ++i)
+        same += a.uniform() == b.uniform();
+    assertLT (same, 2);
+
+    // default seeded instances differ
+    Random c;
+    Random d;
+    assert (c.uniform4()[0] != d.uniform4()[0]);
+}
+
+void testRandom()
+{
+    printf ("testRandom\n");
+    testUniform();
+    testUniform4();
+    testBipolar();
+    testGaussian();
+    testSeed();
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2020 Dave French <contact/dot/dave/dot/french3/at/googlemail/dot/com>
+ *
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program (see COPYING); if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301 USA.
+ *
+ */
+
+#include "Sanitize.h"
+#include "asserts.h"
+#include <assert.h>
+#include <stdio.h>
+#include <limits>
+
+using namespace sspo;
+using float_4 = rack::simd::float_4;
+
+static const float notANumber = std::numeric_limits<float>::quiet_NaN();
+static const float infinity = std::numeric_limits<float>::infinity();
+
+static void testScrubScalar()
+{
+    assertEQ (scrub (1.5f), 1.5f);
+    assertEQ (scrub (-std::numeric_limits<float>::max()), -std::numeric_limits<float>::max());
+    assertEQ (scrub (notANumber), 0.0f);
+    assertEQ (scrub (infinity), 0.0f);
+    assertEQ (scrub (-infinity), 0.0f);
+}
+
+// a bad lane is zeroed, the others pass through
+static void testScrubLanes()
+{
+    auto out = scrub (float_4 (notANumber, 2.0f, -infinity, -3.0f));
+    assertEQ (out[0], 0.0f);
+    assertEQ (out[1], 2.0f);
+    assertEQ (out[2], 0.0f);
+    assertEQ (out[3], -3.0f);
+
+    out = scrub (float_4 (1.0f, 2.0f, 3.0f, 4.0f));
+    for (auto i = 0; i < 4; ++i)
+        assertEQ (out[i], i + 1.0f);
+}
+
+static void testDelayLineValue()
+{
+    assertEQ (delayLineValue (0.25f), 0.25f);
+    assertEQ (delayLineValue (7), 7);
+#if SSPO_STRICT_FINITE
+    assertEQ (delayLineValue (notANumber), 0.0f);
+    assertEQ (delayLineValue (float_4 (infinity))[0], 0.0f);
+#endif
+}
+
+static void testFlushDenormals()
+{
+#if SSPO_HAS_MXCSR
+    volatile float tiny = std::numeric_limits<float>::min();
+    const auto before = _mm_getcsr();
+    {
+        ScopedFlushDenormals flush;
+        volatile float result = tiny * 0.5f;
+        assertEQ (result, 0.0f);
+    }
+    assertEQ (_mm_getcsr(), before);
+#endif
+}
+
+void testSanitize()
+{
+    printf ("testSanitize\n");
+    testScrubScalar();
+    testScrubLanes();
+    testDelayLineValue();
+    testFlushDenormals();
+}
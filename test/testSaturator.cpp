@@ -106,6 +106,40 @@ static void testVoltageSaturator()
         assertClose (sspo::voltageSaturate (i), sat.process (i), epslion);
 }
 
+// every lane of the float_4 curve against the scalar one, through both knees and on to the
+// limits, the tolerance is the one documented on saturateSimd
+static void testSimdMatchesScalar (float limit, float knee)
+{
+    const auto tolerance = 0.000002f * limit;
+    for (auto i = -2.0f * limit; i < 2.0f * limit; i += inc * limit)
+    {
+        auto in = float_4 (i, -i, i * 0.5f, i + knee * 0.3f);
+        auto out = sspo::saturateSimd (in, limit, knee);
+        for (auto l = 0; l < 4; ++l)
+            assertClose (out[l], sspo::saturate (in[l], limit, knee), tolerance);
+    }
+
+    auto infinity = std::numeric_limits<float>::infinity();
+    auto notANumber = std::numeric_limits<float>::quiet_NaN();
+    auto out = sspo::saturateSimd (float_4 (infinity, -infinity, notANumber, 0.0f), limit, knee);
+    assertEQ (out[0], limit);
+    assertEQ (out[1], -limit);
+    assertEQ (out[2], sspo::saturate (notANumber, limit, knee));
+    assertEQ (out[3], 0.0f);
+}
+
+static void testVoltageSaturatorSimd()
+{
+    for (auto i = -150.0f; i < 150.0f; i += inc * 10.0f)
+    {
+        auto out = sspo::voltageSaturate (float_4 (i, i * 0.1f, -i * 0.1f, i * 0.08f));
+        assertClose (out[0], sspo::voltageSaturate (i), 0.000002f * 11.7f);
+        assertClose (out[1], sspo::voltageSaturate (i * 0.1f), 0.000002f * 11.7f);
+        assertClose (out[2], sspo::voltageSaturate (-i * 0.1f), 0.000002f * 11.7f);
+        assertClose (out[3], sspo::voltageSaturate (i * 0.08f), 0.000002f * 11.7f);
+    }
+}
+
 void testSaturator()
 {
     printf ("testSaturator\n");
@@ -119,4 +153,7 @@ void testSaturator()
     testInfinate (11.7f, 0.5f);
     testDefaultConstructor();
     testVoltageSaturator();
+    testSimdMatchesScalar (1.0f, 0.05f);
+    testSimdMatchesScalar (11.7f, 0.5f);
+    testVoltageSaturatorSimd();
 }
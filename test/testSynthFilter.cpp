@@ -86,17 +86,25 @@ static void testOnePoleImpulse (std::string filename,
     assert (ts::areSame (impulse, test, 0.1f));
 }
 
+// the drive as a plain gain, so the slope and peak tests see the linear ladder
+struct GainPolicy
+{
+    static float process (const float in, const float drive)
+    {
+        return in * drive;
+    }
+};
+
 static void testMoogLadderSlope (SynthFilter<float>::Type type,
                                  const float cutoff,
                                  const float sr,
                                  const float expected,
                                  const float tol = 1.5f)
 {
-    MoogLadderFilter<float> filter;
+    MoogLadderFilter<float, GainPolicy> filter;
     filter.setType (type);
     filter.setUseNonLinearProcessing (true);
     filter.setParameters (cutoff, 0.0f, 1.1f, 0.0f, sr);
-    filter.nonLinearProcess = [] (float a, float b) { return a * b; };
 
     constexpr int fftSize = 1024 * 32;
 
@@ -177,10 +185,9 @@ static void testMoogBpPeak()
 
     auto sr = 44100.0f;
 
-    MoogLadderFilter<float> filter;
+    MoogLadderFilter<float, GainPolicy> filter;
     filter.setType (SynthFilter<float>::Type::BPF2);
     filter.setUseNonLinearProcessing (false);
-    filter.nonLinearProcess = [] (float a, float b) { return a * b; };
 
     constexpr int fftSize = 1024 * 8;
     const float binWidth = sr / fftSize;
@@ -206,11 +213,38 @@ static void testMoogBpPeak()
     }
 }
 
+// the ready made saturation policies against std::tanh and each other, scalar and simd
+static void testSaturationPolicies()
+{
+    using float_4 = rack::simd::float_4;
+    for (auto x = -1.1f; x < 1.1f; x += 0.001f)
+    {
+        const auto drive = 1.5f;
+        const auto expected = std::tanh (x * drive);
+        assertEQ (TanhPolicy::process (x, drive), expected);
+        assertEQ (TanhPolicy::process (float_4 (x), float_4 (drive))[2], expected);
+        assertClose (FastTanhPolicy::process (x, drive), expected, 0.025f);
+        assertEQ (FastTanhPolicy::process (float_4 (x), float_4 (drive))[1], FastTanhPolicy::process (x, drive));
+
+        // the Nld tanh table covers +-1.2
+        assertClose (NldPolicy<1>::process (x, 1.0f), std::tanh (x), 0.0001f);
+        assertClose (NldPolicy<1>::process (float_4 (x), float_4 (1.0f))[0], std::tanh (x), 0.0001f);
+
+        assertClose (AtanPolicy::process (float_4 (x), float_4 (drive))[3], AtanPolicy::process (x, drive), 0.00001f);
+    }
+
+    // saturated, not wrapped, beyond the approximations' ranges
+    assertEQ (FastTanhPolicy::process (10.0f, 1.0f), 1.0f);
+    assertEQ (FastTanhPolicy::process (-10.0f, 1.0f), -1.0f);
+    assertClose (NldPolicy<1>::process (5.0f, 1.0f), std::tanh (1.2f), 0.001f);
+}
+
 void testSynthFilter()
 {
     printf ("testSynthFilter\n");
     testMoogLPHP();
     testMoogBpPeak();
+    testSaturationPolicies();
 
 //impulse response tests to check for changes
 //set below to #if 1 to run impulse tests, #if 0 to generate impulses
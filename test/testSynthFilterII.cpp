@@ -19,17 +19,18 @@
 *
 */
 
-//#include "SynthFilterII.h"
+#include "SynthFilterII.h"
 //#include "Analyzer.h"
 //#include "FftAnalyzer.h"
 //#include "AudioMath.h"
 //#include "testSignal.h"
-//#include "asserts.h"
+#include "asserts.h"
 //#include "simd/functions.hpp"
 //#include "simd/sse_mathfun.h"
 //#include "simd/sse_mathfun_extension.h"
 //#include <assert.h>
 #include <stdio.h>
+#include <cmath>
 //#include <algorithm>
 //
 //using float_4 = ::rack::simd::float_4;
@@ -126,9 +127,131 @@
 //    }
 //}
 
+static void testLadderProcessBlock()
+{
+    sspo::synthFilterII::LadderFilter<rack::simd::float_4> perSample;
+    sspo::synthFilterII::LadderFilter<rack::simd::float_4> block;
+    for (auto* f : { &perSample, &block })
+    {
+        f->setSampleRate (44100.0f * 4.0f);
+        f->setFcQSat (1000.0f, 5.0f, 1.0f);
+        f->setCoeffs (0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+        f->setNldTypes (1, 2, 0, 3, 0, 1);
+    }
+
+    static constexpr int n = 4;
+    rack::simd::float_4 buffer[n];
+    for (auto j = 0; j < 100; ++j)
+    {
+        for (auto i = 0; i < n; ++i)
+            buffer[i] = rack::simd::float_4 (std::sin (0.1f * (j * n + i)) * 0.9f);
+
+        rack::simd::float_4 expected[n];
+        for (auto i = 0; i < n; ++i)
+            expected[i] = perSample.process (buffer[i]);
+
+        block.processBlock (buffer, buffer, n);
+        for (auto i = 0; i < n; ++i)
+            assertEQ (buffer[i][0], expected[i][0]);
+    }
+}
+
+/// a stage as the ladder shaped it before the stages were compiled,
+/// Nld::process for the type of the table, which is the identity for type 0
+struct BaselineStage
+{
+    static rack::simd::float_4 process (const rack::simd::float_4 x, const sspo::AudioMath::WaveShaper::Table* table)
+    {
+        const auto& nld = sspo::AudioMath::WaveShaper::nld();
+        auto type = 0;
+        while (nld.getTable (type) != table)
+            ++type;
+        rack::simd::float_4 out;
+        nld.process (out, x, type);
+        return out;
+    }
+};
+
+// the ladder selected by setNldTypes against one shaping every stage as before
+static void testLadderCompiledStages (const int res, const int s1, const int s2, const int s3, const int s4)
+{
+    sspo::synthFilterII::LadderFilter<rack::simd::float_4> selected;
+    sspo::synthFilterII::LadderFilter<rack::simd::float_4> baseline;
+    for (auto* f : { &selected, &baseline })
+    {
+        f->setSampleRate (44100.0f * 4.0f);
+        f->setFcQSat (1000.0f, 5.0f, 1.0f);
+        f->setCoeffs (0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+        f->setNldTypes (1, res, s1, s2, s3, s4);
+    }
+
+    static constexpr int n = 4;
+    for (auto j = 0; j < 500; ++j)
+    {
+        rack::simd::float_4 expected[n];
+        rack::simd::float_4 actual[n];
+        for (auto i = 0; i < n; ++i)
+            expected[i] = rack::simd::float_4 (std::sin (0.1f * (j * n + i)) * 0.5f);
+
+        selected.processBlock (expected, actual, n);
+        baseline.processBlock<BaselineStage, BaselineStage, BaselineStage, BaselineStage, BaselineStage> (expected, expected, n);
+        for (auto i = 0; i < n; ++i)
+            assertEQ (actual[i][0], expected[i][0]);
+    }
+}
+
+// the scalar ladder compiles, and follows lane 0 of the simd ladder
+static void testLadderScalar()
+{
+    sspo::synthFilterII::LadderFilter<float> scalar;
+    sspo::synthFilterII::LadderFilter<rack::simd::float_4> simd;
+    scalar.setSampleRate (44100.0f * 4.0f);
+    scalar.setFcQSat (1000.0f, 5.0f, 1.0f);
+    scalar.setCoeffs (0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+    scalar.setNldTypes (1, 2, 0, 3, 0, 9);
+    simd.setSampleRate (44100.0f * 4.0f);
+    simd.setFcQSat (1000.0f, 5.0f, 1.0f);
+    simd.setCoeffs (0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+    simd.setNldTypes (1, 2, 0, 3, 0, 9);
+
+    for (auto i = 0; i < 2000; ++i)
+    {
+        const auto in = std::sin (0.1f * i) * 0.9f;
+        assertClose (scalar.process (in), simd.process (rack::simd::float_4 (in))[0], 1e-3f);
+    }
+}
+
+// a captured input shape driven past the top of its range holds its clipped value,
+// the ladder at unity gain settles on it
+static void testLadderInputClipped()
+{
+    const auto tl074 = 8;
+    const auto top = (*sspo::AudioMath::WaveShaper::nld().getTable (tl074))[sspo::AudioMath::WaveShaper::length - 3];
+
+    sspo::synthFilterII::LadderFilter<rack::simd::float_4> ladder;
+    ladder.setSampleRate (44100.0f);
+    ladder.setFcQSat (1000.0f, 1.0f, 1.0f);
+    ladder.setCoeffs (0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+    ladder.setNldTypes (tl074, 0, 0, 0, 0, 0);
+
+    rack::simd::float_4 out;
+    for (auto i = 0; i < 10000; ++i)
+        out = ladder.process (rack::simd::float_4 (1.2f, 1.25f, 1.5f, 10.0f));
+
+    for (auto lane = 0; lane < 4; ++lane)
+        assertClose (out[lane], top, 0.002f);
+}
+
 void testSynthFilterII()
 {
     printf ("SynthFilterII\n");
+    testLadderProcessBlock();
+    testLadderCompiledStages (0, 0, 0, 0, 0);
+    testLadderCompiledStages (0, 0, 3, 0, 0);
+    testLadderCompiledStages (2, 0, 0, 0, 5);
+    testLadderCompiledStages (1, 2, 3, 4, 5);
+    testLadderScalar();
+    testLadderInputClipped();
 //    testSlopeOnePoleLpFilterFloat();
 //    testSlopeOnePoleLpFilterSimd();
 }
\ No newline at end of file
@@ -25,12 +25,16 @@
 #include "AudioMath.h"
 #include "testSignal.h"
 #include "asserts.h"
+#include "FFT.h"
+#include "FFTData.h"
 #include "simd/functions.hpp"
 #include "simd/sse_mathfun.h"
 #include "simd/sse_mathfun_extension.h"
 #include <assert.h>
 #include <stdio.h>
 #include <algorithm>
+#include <cmath>
+#include <vector>
 
 using float_4 = ::rack::simd::float_4;
 namespace ts = sspo::TestSignal;
@@ -789,6 +793,155 @@ static void testSlopeButterworthHp (const float cutoff,
 #endif
 }
 
+// the cascade runs in transposed direct form II, so allow for rounding against BiQuad
+static void testBiQuadCascade (const int blockSize, const int stages)
+{
+    constexpr int maxStages = 4;
+    BiQuad<float> serial[maxStages];
+    BiQuadCascade<float, maxStages> cascade;
+    cascade.setStages (stages);
+    for (auto i = 0; i < maxStages; ++i)
+    {
+        serial[i].setButterworthLp2 (44100.0f, 2000.0f + 3000.0f * i);
+        cascade.setCoeffs (i, serial[i].coeffs);
+    }
+
+    constexpr int size = 1024;
+    auto signal = ts::makeSine (size, 1000, 44100);
+    signal[100] += 1.0f;
+    std::vector<float> expected (size);
+    for (auto i = 0; i < size; ++i)
+    {
+        expected[i] = signal[i];
+        for (auto k = 0; k < stages; ++k)
+            expected[i] = serial[k].process (expected[i]);
+    }
+
+    // in place, in uneven blocks so the wavefront has to pick up where it left off
+    std::vector<float> actual (signal.begin(), signal.end());
+    auto pos = 0;
+    auto block = blockSize;
+    while (pos < size)
+    {
+        const auto n = std::min (block, size - pos);
+        cascade.processBlock (&actual[pos], &actual[pos], n);
+        pos += n;
+        block = block == blockSize ? std::max (1, blockSize / 2 + 1) : blockSize;
+    }
+
+    for (auto i = 0; i < size; ++i)
+        assertClose (actual[i], expected[i], 1e-4f);
+}
+
+static void testBiQuadCascadeSimd()
+{
+    constexpr int stages = 3;
+    BiQuadCascade<float, stages> lanes[4];
+    BiQuadCascade<float_4, stages> cascade;
+    for (auto k = 0; k < stages; ++k)
+    {
+        BiQuad<float_4> design;
+        design.setButterworthLp2 (44100.0f, float_4 (1000.0f, 2000.0f, 4000.0f, 8000.0f) * (k + 1));
+        cascade.setCoeffs (k, design.coeffs);
+        for (auto lane = 0; lane < 4; ++lane)
+        {
+            BiQuad<float> laneDesign;
+            laneDesign.setButterworthLp2 (44100.0f, 1000.0f * (1 << lane) * (k + 1));
+            lanes[lane].setCoeffs (k, laneDesign.coeffs);
+        }
+    }
+
+    constexpr int size = 256;
+    auto signal = ts::makeSine (size, 500, 44100);
+    float_4 in[size];
+    float_4 out[size];
+    float laneOut[4][size];
+    for (auto i = 0; i < size; ++i)
+        in[i] = float_4 (signal[i], -signal[i], 0.5f * signal[i], i == 10 ? 1.0f : 0.0f);
+
+    cascade.processBlock (in, out, size);
+    for (auto lane = 0; lane < 4; ++lane)
+    {
+        float laneIn[size];
+        for (auto i = 0; i < size; ++i)
+            laneIn[i] = in[i][lane];
+        lanes[lane].processBlock (laneIn, laneOut[lane], size);
+    }
+
+    for (auto i = 0; i < size; ++i)
+        for (auto lane = 0; lane < 4; ++lane)
+            assertClose (out[i][lane], laneOut[lane][i], 1e-5f);
+}
+
+static void testBiQuadCascade()
+{
+    for (auto blockSize : { 1, 2, 8, 32, 128 })
+        for (auto stages : { 1, 2, 4 })
+            testBiQuadCascade (blockSize, stages);
+    testBiQuadCascadeSimd();
+}
+
+// the bank runs the same direct form as BiQuad, so should match it exactly
+static void testBiquadBank()
+{
+    constexpr int channels = 16;
+    BiquadBank<channels, 2> bank;
+    BiQuad<float_4> first[channels / 4];
+    BiQuad<float_4> second[channels / 4];
+    BiQuad<float> single[2];
+
+    for (auto g = 0; g < channels / 4; ++g)
+    {
+        const auto freq = float_4 (100.0f, 1000.0f, 5000.0f, 10000.0f) * (g + 1) * 0.5f;
+        bank.setButterworthLp2 (g, 44100.0f, freq);
+        first[g].setButterworthLp2 (44100.0f, freq);
+        second[g].setButterworthLp2 (44100.0f, freq);
+    }
+    // channel 13 replaced with a high pass
+    single[0].setButterworthHp2 (44100.0f, 300.0f);
+    single[1].setButterworthHp2 (44100.0f, 300.0f);
+    bank.setChannelCoeffs (13, single[0].coeffs);
+
+    auto signal = ts::makeSine (512, 250, 44100);
+    float in[channels];
+    float out[channels];
+    for (auto i = 0; i < 512; ++i)
+    {
+        for (auto c = 0; c < channels; ++c)
+            in[c] = signal[i] * (c + 1) + (i == 5 ? 1.0f : 0.0f);
+
+        // only 14 channels active, rounded up to whole groups
+        bank.process (in, out, 14);
+
+        for (auto g = 0; g < channels / 4; ++g)
+        {
+            auto expected = second[g].process (first[g].process (float_4::load (in + 4 * g)));
+            for (auto lane = 0; lane < 4; ++lane)
+            {
+                if (g * 4 + lane != 13)
+                    assertEQ (out[g * 4 + lane], expected[lane]);
+            }
+        }
+        assertEQ (out[13], single[1].process (single[0].process (in[13])));
+    }
+
+    // in place
+    BiquadBank<channels> dc;
+    BiQuad<float_4> dcExpected;
+    for (auto g = 0; g < channels / 4; ++g)
+        dc.setButterworthHp2 (g, 44100.0f, 5.5f);
+    dcExpected.setButterworthHp2 (44100.0f, 5.5f);
+    for (auto i = 0; i < 64; ++i)
+    {
+        for (auto c = 0; c < channels; ++c)
+            in[c] = signal[i] + 1.0f;
+        auto expected = dcExpected.process (float_4::load (in));
+        dc.process (in, in, 4);
+        for (auto lane = 0; lane < 4; ++lane)
+            assertEQ (in[lane], expected[lane]);
+    }
+}
+
 static void testUpsampleDecimator()
 {
     constexpr int OVERSAMPLE = 4;
@@ -821,6 +974,121 @@ static void testUpsampleDecimator()
     assertEQ (s_max_bin, r_max_bin);
 }
 
+static void testHalfBandRoundTrip (const int overSample, const HalfBandPhase phase, const float tolerance)
+{
+    HalfBandUpsampler<16, float> up;
+    HalfBandDecimator<16, float> decimator;
+    up.setPhase (phase);
+    decimator.setPhase (phase);
+    up.setOverSample (overSample);
+    decimator.setOverSample (overSample);
+    assertEQ (up.getOverSample(), overSample);
+    assertEQ (decimator.getOverSample(), overSample);
+
+    const auto latency = up.getLatency() + decimator.getLatency();
+    const auto w = k_2pi * 1000.0f / 44100.0f;
+    float buffer[16];
+    auto maxError = 0.0f;
+    for (auto i = 0; i < 4096; ++i)
+    {
+        up.process (std::sin (w * i), buffer);
+        auto out = decimator.process (buffer);
+        if (i > 256)
+            maxError = std::max (maxError, std::abs (out - std::sin (w * (i - latency))));
+    }
+    assertLT (maxError, tolerance);
+}
+
+static void testHalfBandRoundTrip()
+{
+    HalfBandUpsampler<16, float> up;
+    up.setOverSample (2);
+    assertClose (up.getLatency(), 13.5f, 1e-4f);
+    up.setOverSample (12); // rounded down
+    assertEQ (up.getOverSample(), 8);
+    up.setOverSample (1);
+    assertEQ (up.getOverSample(), 1);
+
+    for (auto overSample : { 1, 2, 4, 8, 16 })
+    {
+        testHalfBandRoundTrip (overSample, HalfBandPhase::Linear, 1e-4f);
+        // the group delay of a minimum phase filter is only flat near DC
+        testHalfBandRoundTrip (overSample, HalfBandPhase::Minimum, 2e-3f);
+    }
+}
+
+// a bin exact tone near the top of the audio band, every other bin of the upsampled
+// spectrum is an image the interpolation filters failed to remove
+static void testHalfBandImages (const int overSample, const HalfBandPhase phase)
+{
+    static constexpr int size = 4096;
+    static constexpr int p = 1393; // ~15kHz at 44.1kHz
+
+    HalfBandUpsampler<16, float> up;
+    up.setPhase (phase);
+    up.setOverSample (overSample);
+
+    // settle the filters, then capture one whole period of the fft
+    float buffer[16];
+    const auto w = 2.0 * M_PI * p / size;
+    for (auto i = 0; i < size; ++i)
+        up.process (float (std::sin (w * i)), buffer);
+
+    FFTDataReal in (size * overSample);
+    FFTDataCpx out (size * overSample);
+    for (auto i = 0; i < size; ++i)
+    {
+        up.process (float (std::sin (w * i)), buffer);
+        for (auto j = 0; j < overSample; ++j)
+            in.set (i * overSample + j, buffer[j]);
+    }
+    FFT::forward (&out, in);
+
+    double images = 0.0;
+    for (auto bin = 1; bin < size * overSample / 2; ++bin)
+    {
+        if (bin != p)
+            images += std::norm (out.get (bin));
+    }
+    assertLT (10.0 * std::log10 (images / std::norm (out.get (p))), -75.0);
+}
+
+static void testHalfBandImages()
+{
+    for (auto overSample : { 2, 4, 8, 16 })
+    {
+        testHalfBandImages (overSample, HalfBandPhase::Linear);
+        testHalfBandImages (overSample, HalfBandPhase::Minimum);
+    }
+}
+
+static void testHalfBandSimd()
+{
+    HalfBandUpsampler<8, float> up;
+    HalfBandDecimator<8, float> decimator;
+    HalfBandUpsampler<8, float_4> up4;
+    HalfBandDecimator<8, float_4> decimator4;
+    up.setPhase (HalfBandPhase::Minimum);
+    decimator.setPhase (HalfBandPhase::Minimum);
+    up4.setPhase (HalfBandPhase::Minimum);
+    decimator4.setPhase (HalfBandPhase::Minimum);
+
+    float buffer[8];
+    float_4 buffer4[8];
+    for (auto i = 0; i < 1000; ++i)
+    {
+        auto x = std::sin (i * 0.1f);
+        up.process (x, buffer);
+        up4.process (float_4 (x, -x, 0.5f * x, 0.0f), buffer4);
+        auto out = decimator.process (buffer);
+        auto out4 = decimator4.process (buffer4);
+        assertClose (out4[0], out, 1e-6f);
+        assertClose (out4[1], -out, 1e-6f);
+        assertClose (out4[2], 0.5f * out, 1e-6f);
+        assertEQ (out4[3], 0.0f);
+    }
+}
+
 static void testSlopeButterworthHp (const float_4 cutoff,
                                     const float_4 sr,
                                     const float expectedCorner,
@@ -891,6 +1159,123 @@ static void testButterworthLpSmid()
     }
 }
 
+// low plus high of the crossover, per lane, across the whole band. The impulse response
+// has fully decayed within the fft, so it is transformed without a window, getResponse's
+// hamming window would skew the slow low crossovers
+static void testCrossoverFlat (const CrossoverSlope slope, const float_4 fc, const float sr)
+{
+    Crossover<float_4> crossover;
+    crossover.setSlope (slope);
+    crossover.setParameters (float_4 (sr), fc);
+
+    constexpr int fftSize = 1024 * 32;
+    std::vector<FFTDataReal> impulses (4, FFTDataReal (fftSize));
+    for (auto i = 0; i < fftSize; ++i)
+    {
+        float_4 low;
+        float_4 high;
+        crossover.process (float_4 (i == 0 ? 1.0f : 0.0f), low, high);
+        const auto sum = low + high;
+        for (auto lane = 0; lane < 4; ++lane)
+            impulses[lane].set (i, sum[lane]);
+    }
+
+    FFTDataReal driac (fftSize);
+    driac.set (0, 1.0f);
+    FFTDataCpx driacResponse (fftSize);
+    FFT::forward (&driacResponse, driac);
+
+    for (auto lane = 0; lane < 4; ++lane)
+    {
+        FFTDataCpx response (fftSize);
+        FFT::forward (&response, impulses[lane]);
+        for (auto bin = 0; bin < fftSize / 2; ++bin)
+        {
+            const auto level = db (response.getAbs (bin)) - db (driacResponse.getAbs (bin));
+            assertClose (level, 0.0f, 0.06f); // float rounding in the lowest crossovers
+        }
+    }
+}
+
+static void testCrossoverFlat()
+{
+    for (auto slope : { CrossoverSlope::LR2, CrossoverSlope::LR4 })
+    {
+        for (auto fc = 20.0f; fc < 18000.0f; fc += 1000.0f)
+            testCrossoverFlat (slope, float_4 (fc, fc + 10.0f, fc + 250.0f, fc + 400.0f), 44100.0f);
+        testCrossoverFlat (slope, float_4 (20.0f, 200.0f, 2000.0f, 20000.0f), 96000.0f);
+    }
+}
+
+// the bands against the separate Linkwitz Riley filters, the LR2 high band is inverted
+static void testCrossoverBands()
+{
+    const auto sr = 44100.0f;
+    for (auto fc : { 50.0f, 1000.0f, 15000.0f })
+    {
+        Crossover<float> lr2;
+        Crossover<float> lr4;
+        lr2.setSlope (CrossoverSlope::LR2);
+        lr2.setParameters (sr, fc);
+        lr4.setParameters (sr, fc);
+        LinkwitzRileyLP2<float> lp2;
+        LinkwitzRileyHP2<float> hp2;
+        LinkwitzRileyLP4<float> lp4;
+        LinkwitzRileyHP4<float> hp4;
+        lp2.setParameters (sr, fc);
+        hp2.setParameters (sr, fc);
+        lp4.setParameters (sr, fc);
+        hp4.setParameters (sr, fc);
+
+        for (auto i = 0; i < 5000; ++i)
+        {
+            const auto x = std::sin (0.001f * i * i) + (i == 0 ? 1.0f : 0.0f);
+            const auto low2 = lp2.process (x);
+            const auto high2 = -hp2.process (x);
+            const auto low4 = lp4.process (x);
+            const auto high4 = hp4.process (x);
+            float low;
+            float high;
+            lr2.process (x, low, high);
+            assertClose (low, low2, 0.001f);
+            assertClose (high, high2, 0.001f);
+            lr4.process (x, low, high);
+            assertClose (low, low4, 0.001f);
+            assertClose (high, high4, 0.001f);
+        }
+    }
+}
+
+// the slope set after the parameters gives the same bands as the slope set before them
+static void testCrossoverSlopeAfterParameters()
+{
+    const auto sr = 44100.0f;
+    const auto fc = 1000.0f;
+    for (auto slope : { CrossoverSlope::LR2, CrossoverSlope::LR4 })
+    {
+        Crossover<float> before;
+        Crossover<float> after;
+        before.setSlope (slope);
+        before.setParameters (sr, fc);
+        after.setSlope (slope == CrossoverSlope::LR2 ? CrossoverSlope::LR4 : CrossoverSlope::LR2);
+        after.setParameters (sr, fc);
+        after.setSlope (slope);
+
+        for (auto i = 0; i < 1000; ++i)
+        {
+            const auto x = std::sin (0.001f * i * i) + (i == 0 ? 1.0f : 0.0f);
+            float lowBefore;
+            float highBefore;
+            float lowAfter;
+            float highAfter;
+            before.process (x, lowBefore, highBefore);
+            after.process (x, lowAfter, highAfter);
+            assertEQ (lowAfter, lowBefore);
+            assertEQ (highAfter, highBefore);
+        }
+    }
+}
+
 void testUtilityFilter()
 {
     printf ("Utility Filter\n");
@@ -906,11 +1291,19 @@ void testUtilityFilter()
     testLrHpSmid();
     testLrLpSmid();
     testLWRCrossOverSmid();
+    testCrossoverFlat();
+    testCrossoverBands();
+    testCrossoverSlopeAfterParameters();
     testAllPass();
     testMixedBiquadSimd();
     testButterworthLp();
     testButterworthHp();
     testButterworthLpSmid();
     testButterworthHpSmid();
+    testBiQuadCascade();
+    testBiquadBank();
     testUpsampleDecimator();
+    testHalfBandRoundTrip();
+    testHalfBandImages();
+    testHalfBandSimd();
 }
\ No newline at end of file
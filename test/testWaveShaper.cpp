@@ -22,10 +22,13 @@
 
 #include "math.hpp"
 #include "WaveShaper.h"
+#include "FftAnalyzer.h"
 
 #include <asserts.h>
+#include <algorithm>
 #include <cmath>
 #include <stdio.h>
+#include <vector>
 
 using namespace sspo::AudioMath;
 
@@ -73,10 +76,241 @@ static void testConsume()
     }
 }
 
+static void testConsumeSimd()
+{
+    const auto& nld = WaveShaper::nld();
+    for (auto shape = 1u; shape < nld.size(); ++shape)
+    {
+        for (float i = -1.3f; i < 1.3f; i += WaveShaper::interval * 0.37f)
+        {
+            float_4 in{ i, -i, i * 0.5f, i + WaveShaper::interval * 0.25f };
+            auto out = nld.process (in, shape);
+            float_4 outRef;
+            nld.process (outRef, in, shape);
+
+            auto x = rack::simd::clamp (in, WaveShaper::minValue, WaveShaper::maxValue - WaveShaper::interval);
+            auto xRef = rack::simd::clamp (in, WaveShaper::minValue, WaveShaper::maxValue - WaveShaper::interval * 3);
+            for (auto lane = 0; lane < 4; ++lane)
+            {
+                // simd and scalar must match bit for bit
+                assertEQ (out[lane], nld.process (x[lane], shape));
+                assertEQ (outRef[lane], nld.process (xRef[lane], shape));
+            }
+        }
+    }
+}
+
+static void testProcessBlock()
+{
+    const auto& nld = WaveShaper::nld();
+    static constexpr int n = 12;
+    float_4 in[n];
+    float_4 out[n];
+    float inScalar[n];
+    float outScalar[n];
+
+    for (auto shape = 0u; shape < nld.size(); ++shape)
+    {
+        for (auto i = 0; i < n; ++i)
+        {
+            in[i] = float_4 (-1.3f + i * 0.22f, 1.3f - i * 0.21f, i * 0.05f, -i * 0.07f);
+            inScalar[i] = in[i][0];
+        }
+        nld.processBlock (in, out, n, shape);
+        nld.processBlock (inScalar, outScalar, n, shape);
+
+        for (auto i = 0; i < n; ++i)
+        {
+            float_4 expected;
+            nld.process (expected, in[i], shape);
+            for (auto lane = 0; lane < 4; ++lane)
+                assertEQ (out[i][lane], expected[lane]);
+            assertEQ (outScalar[i], expected[0]);
+        }
+
+        // in place
+        nld.processBlock (in, in, n, shape);
+        for (auto i = 0; i < n; ++i)
+            assertEQ (in[i][1], out[i][1]);
+    }
+}
+
+// driven past the top of the range the captured shapes must hold their last value,
+// not interpolate into the empty last slot of the table
+static void testProcessBlockClipped()
+{
+    const auto& nld = WaveShaper::nld();
+    static constexpr int n = 4;
+    const float_4 in[n] = { float_4 (1.2f), float_4 (1.25f), float_4 (1.5f), float_4 (10.0f) };
+    const float inScalar[n] = { 1.2f, 1.25f, 1.5f, 10.0f };
+    float_4 out[n];
+    float outScalar[n];
+
+    for (auto shape = 8u; shape < nld.size(); ++shape)
+    {
+        const auto* table = nld.getTable (shape);
+        assertEQ ((*table)[WaveShaper::length - 1], 0.0f);
+        const auto top = (*table)[WaveShaper::length - 3];
+        assertGT (std::abs (top), 0.1f);
+
+        nld.processBlock (in, out, n, shape);
+        nld.processBlock (inScalar, outScalar, n, shape);
+        for (auto i = 0; i < n; ++i)
+        {
+            for (auto lane = 0; lane < 4; ++lane)
+                assertClose (out[i][lane], top, 0.002f);
+            assertClose (outScalar[i], top, 0.002f);
+        }
+    }
+}
+
+static void testIntegral()
+{
+    // the derivative of the integral table must be the shape
+    const auto& nld = WaveShaper::nld();
+    for (auto shape = 1u; shape < nld.size(); ++shape)
+    {
+        const auto* table = nld.getTable (shape);
+        const auto* integral = nld.getIntegral (shape);
+        assert (integral != nullptr);
+        assertClose (WaveShaper::processIntegral (integral, 0.0f), 0.0f, 1e-6f);
+        for (auto i = 1u; i < WaveShaper::length - 1; i += 7)
+        {
+            auto derivative = ((*integral)[i + 1] - (*integral)[i - 1]) / (2.0f * WaveShaper::interval);
+            assertClose (derivative, (*table)[i], 0.01f);
+        }
+    }
+}
+
+static void testAdaaSlowSignal()
+{
+    // a slowly changing input must give the static curve
+    const auto& nld = WaveShaper::nld();
+    for (auto shape = 1u; shape < nld.size(); ++shape)
+    {
+        WaveShaper::Adaa<float> adaa;
+        WaveShaper::Adaa<float_4> adaa4;
+        auto x = -1.1f;
+        adaa.process (nld, x, shape);
+        adaa4.process (nld, float_4 (x), shape);
+        for (x = -1.1f; x < 1.1f; x += 0.0013f)
+        {
+            auto out = adaa.process (nld, x, shape);
+            auto out4 = adaa4.process (nld, float_4 (x, x, x, x), shape);
+            assertClose (out, nld.process (x - 0.00065f, shape), 0.01f);
+            assertClose (out4[2], out, 1e-6f);
+        }
+    }
+}
+
+static void testAdaaFullScale()
+{
+    // at and beyond the table range the output stays finite, within the shape's range and
+    // continuous, the clamp keeps the integral read inside the table
+    const auto& nld = WaveShaper::nld();
+    for (auto shape = 1u; shape < nld.size(); ++shape)
+    {
+        const auto* table = nld.getTable (shape);
+        const auto low = *std::min_element (table->begin(), table->end());
+        const auto high = *std::max_element (table->begin(), table->end());
+
+        for (auto amplitude : { 1.2f, 5.0f })
+        {
+            WaveShaper::Adaa<float> adaa;
+            WaveShaper::Adaa<float_4> adaa4;
+            for (auto i = 0; i < 4096; ++i)
+            {
+                const auto x = amplitude * std::sin (0.37f * i);
+                const auto out = adaa.process (nld, x, shape);
+                const auto out4 = adaa4.process (nld, float_4 (x, -x, x, -x), shape);
+                assert (std::isfinite (out));
+                assertGE (out, low - 0.01f);
+                assertLE (out, high + 0.01f);
+                assertClose (out4[0], out, 1e-6f);
+                assert (std::isfinite (out4[1]));
+            }
+        }
+
+        WaveShaper::Adaa<float> adaa;
+        adaa.process (nld, -5.0f, shape);
+        auto last = adaa.process (nld, -5.0f, shape);
+        for (auto x = -5.0f; x < 5.0f; x += 0.0013f)
+        {
+            const auto out = adaa.process (nld, x, shape);
+            assertClose (out, last, 0.05f);
+            last = out;
+        }
+        assertClose (last, (*table)[WaveShaper::length - 2], 0.01f);
+    }
+}
+
+// ADAA at the base rate must alias well below the plain shaper,
+// perfTest compares it with the oversampling factors
+static void testAdaaAliasing()
+{
+    static constexpr int size = 32768;
+    static constexpr int p = 3701; // prime, 4981Hz at 44.1kHz
+    const auto& nld = WaveShaper::nld();
+    auto sine = [] (const int i) -> float
+    { return 0.9f * float (std::sin (2.0 * M_PI * double (p) * i / size)); };
+
+    std::vector<float> signal (size);
+    for (auto shape : { 1, 2, 7, 9 })
+    {
+        for (auto i = 0; i < size; ++i)
+            signal[i] = nld.process (sine (i), shape);
+        auto naive = sspo::FftAnalyzer::getAliasDb (signal, p);
+
+        WaveShaper::Adaa<float> adaa;
+        for (auto i = 0; i < size; ++i)
+            adaa.process (nld, sine (i), shape);
+        for (auto i = 0; i < size; ++i)
+            signal[i] = adaa.process (nld, sine (i), shape);
+        auto adaaDb = sspo::FftAnalyzer::getAliasDb (signal, p);
+
+        assertLT (adaaDb, naive - 5.0f);
+    }
+}
+
+static void testFixedShapes()
+{
+    const auto& fixed = WaveShaper::sharedFixedShapes();
+    for (auto i = 0; i < WaveShaper::Codes::codeCount; ++i)
+        assertEQ (fixed.throughShape[i], WaveShaper::Codes::ThroughShape[i] / 5120.0f);
+    assertEQ (fixed.vca3Shape[WaveShaper::length - 1], 0.0f);
+
+    // captured shapes are bipolar, a sanity check the codes have been decoded
+    assertLT (fixed.diodeOneAndOneShape[0], -0.9f);
+    assertGT (fixed.diodeOneAndOneShape[WaveShaper::length - 2], 0.9f);
+}
+
+static void testShared()
+{
+    // the shared nld is a single instance, using the shared tables
+    assert (&WaveShaper::nld() == &WaveShaper::nld());
+    assert (&WaveShaper::sharedNldTables() == &WaveShaper::sharedNldTables());
+
+    WaveShaper::Nld local;
+    assertEQ (local.size(), WaveShaper::nld().size());
+    for (float i = WaveShaper::minValue; i < WaveShaper::maxValue - WaveShaper::interval; i += WaveShaper::interval)
+    {
+        for (auto s = 0u; s < local.size(); ++s)
+            assertEQ (local.process (i, s), WaveShaper::nld().process (i, s));
+    }
+}
+
 void testWaveShaper()
 {
     printf ("testWave shaper\n");
     testCreate();
     testConsume();
-    //    testConsumeSimd();
+    testShared();
+    testConsumeSimd();
+    testProcessBlock();
+    testProcessBlockClipped();
+    testFixedShapes();
+    testIntegral();
+    testAdaaSlowSignal();
+    testAdaaFullScale();
+    testAdaaAliasing();
 }
\ No newline at end of file
@@ -111,5 +111,26 @@ namespace sspo
             return getPhase (response);
         }
 
+        /// ratio in dB of the aliased energy to the fundamental of a shaped tone.
+        /// the tone must sit exactly on bin p of the unwindowed fft, so every harmonic
+        /// lands on a multiple of p and every alias lands between them
+        inline float getAliasDb (const std::vector<float>& signal, const int p)
+        {
+            const auto size = static_cast<int> (signal.size());
+            FFTDataReal in (size);
+            FFTDataCpx out (size);
+            for (auto i = 0; i < size; ++i)
+                in.set (i, signal[i]);
+            FFT::forward (&out, in);
+
+            double alias = 0.0;
+            for (auto bin = 1; bin < size / 2; ++bin)
+            {
+                if (bin % p != 0)
+                    alias += std::norm (out.get (bin));
+            }
+            return float (10.0 * std::log10 (alias / std::norm (out.get (p))));
+        }
+
     } // namespace FftAnalyzer
 } // namespace sspo
\ No newline at end of file